@@ -0,0 +1,377 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file benchmarks/acado_benchmarks.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2012
+ *
+ *    Driver of the ACADO benchmark suite. Usage:
+ *
+ *        acado_benchmarks [--csv|--json] [--repetitions <n>] [<name> ...]
+ *
+ *    Runs all workloads (or those whose name contains one of the given
+ *    names) and writes wall time, function evaluations, integrator steps,
+ *    iterations and heap allocations per repetition to stdout. With glibc,
+ *    all calls of malloc, calloc and realloc (including those made by
+ *    operator new) are counted as allocations; on other platforms only the
+ *    calls of operator new are.
+ */
+
+
+#include "benchmarks.hpp"
+
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+
+USING_NAMESPACE_ACADO
+
+
+// ---------------------------------------------------------------------------
+// ALLOCATION COUNTING:
+// ---------------------------------------------------------------------------
+
+#if __cplusplus >= 201103L
+	#define BENCHMARK_THROW_BAD_ALLOC
+	#define BENCHMARK_THROW_NOTHING  noexcept
+#else
+	#define BENCHMARK_THROW_BAD_ALLOC  throw( std::bad_alloc )
+	#define BENCHMARK_THROW_NOTHING    throw( )
+#endif
+
+// The counters are updated by every thread that allocates (OpenMP and
+// pthread workers of the integrators and the simulation environment),
+// hence all accesses are atomic.
+#if defined(__GNUC__)
+	typedef long AllocationCounter;
+	#define BENCHMARK_ATOMIC_ADD( counter,value )  __sync_fetch_and_add( &(counter),(value) )
+	#define BENCHMARK_ATOMIC_READ( counter )       __sync_fetch_and_add( &(counter),0L )
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+	typedef long AllocationCounter;
+	#define BENCHMARK_ATOMIC_ADD( counter,value )  _InterlockedExchangeAdd( &(counter),(value) )
+	#define BENCHMARK_ATOMIC_READ( counter )       _InterlockedExchangeAdd( &(counter),0L )
+#elif __cplusplus >= 201103L
+	#include <atomic>
+	typedef std::atomic<long> AllocationCounter;
+	#define BENCHMARK_ATOMIC_ADD( counter,value )  (counter).fetch_add( (value) )
+	#define BENCHMARK_ATOMIC_READ( counter )       (counter).load( )
+#else
+	#error "acado_benchmarks requires atomic operations (GCC, MSVC or C++11)"
+#endif
+
+static AllocationCounter allocationCount( 0 );
+static AllocationCounter allocatedBytes( 0 );
+
+
+static void countAllocation( std::size_t size )
+{
+	BENCHMARK_ATOMIC_ADD( allocationCount,1L );
+	BENCHMARK_ATOMIC_ADD( allocatedBytes,(long)size );
+}
+
+
+#if defined(__GLIBC__)
+
+// With glibc, the C allocation functions are replaced, which counts the
+// buffers allocated by malloc/calloc/realloc (e.g. by the variables grids
+// and the options lists) as well as operator new, which calls malloc.
+extern "C" {
+
+void* __libc_malloc( std::size_t size );
+void* __libc_calloc( std::size_t nmemb, std::size_t size );
+void* __libc_realloc( void* ptr, std::size_t size );
+void  __libc_free( void* ptr );
+
+void* malloc( std::size_t size ) __THROW
+{
+	countAllocation( size );
+	return __libc_malloc( size );
+}
+
+void* calloc( std::size_t nmemb, std::size_t size ) __THROW
+{
+	countAllocation( nmemb*size );
+	return __libc_calloc( nmemb,size );
+}
+
+void* realloc( void* ptr, std::size_t size ) __THROW
+{
+	countAllocation( size );
+	return __libc_realloc( ptr,size );
+}
+
+void free( void* ptr ) __THROW
+{
+	__libc_free( ptr );
+}
+
+}
+
+#else
+
+// Elsewhere, only operator new is replaced, i.e. the allocations reported
+// are the calls of operator new (buffers allocated by malloc, calloc or
+// realloc are not counted).
+static void* countedAllocation( std::size_t size )
+{
+	countAllocation( size );
+
+	void* ptr = std::malloc( size > 0 ? size : 1 );
+	if ( ptr == 0 )
+		throw std::bad_alloc( );
+	return ptr;
+}
+
+void* operator new( std::size_t size ) BENCHMARK_THROW_BAD_ALLOC
+{
+	return countedAllocation( size );
+}
+
+void* operator new[]( std::size_t size ) BENCHMARK_THROW_BAD_ALLOC
+{
+	return countedAllocation( size );
+}
+
+void operator delete( void* ptr ) BENCHMARK_THROW_NOTHING
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) BENCHMARK_THROW_NOTHING
+{
+	std::free( ptr );
+}
+
+#endif
+
+
+long getAllocationCount( )
+{
+	return BENCHMARK_ATOMIC_READ( allocationCount );
+}
+
+long getAllocatedBytes( )
+{
+	return BENCHMARK_ATOMIC_READ( allocatedBytes );
+}
+
+
+// ---------------------------------------------------------------------------
+// MEASUREMENT:
+// ---------------------------------------------------------------------------
+
+static double startTime        = 0.0;
+static long   startAllocations = 0;
+static long   startBytes       = 0;
+
+
+void startBenchmark(	BenchmarkResult& result,
+						const char* name,
+						int repetitions
+						)
+{
+	result.name                = name;
+	result.status              = SUCCESSFUL_RETURN;
+	result.repetitions         = repetitions;
+	result.wallTime            = 0.0;
+	result.functionEvaluations = -1;
+	result.integratorSteps     = -1;
+	result.iterations          = -1;
+	result.allocations         = 0;
+	result.allocatedBytes      = 0;
+
+	startAllocations = getAllocationCount( );
+	startBytes       = getAllocatedBytes( );
+	startTime        = acadoGetTime( );
+}
+
+
+void stopBenchmark(	BenchmarkResult& result,
+					returnValue status
+					)
+{
+	double stopTime        = acadoGetTime( );
+	long   stopAllocations = getAllocationCount( );
+	long   stopBytes       = getAllocatedBytes( );
+
+	int n = result.repetitions > 0 ? result.repetitions : 1;
+
+	result.status         = (int)status;
+	result.wallTime       = ( stopTime - startTime ) / (double)n;
+	result.allocations    = ( stopAllocations - startAllocations ) / n;
+	result.allocatedBytes = ( stopBytes - startBytes ) / n;
+}
+
+
+// ---------------------------------------------------------------------------
+// OUTPUT:
+// ---------------------------------------------------------------------------
+
+static void printCSVHeader( )
+{
+	printf( "name,status,repetitions,wall_time_s,function_evaluations,"
+			"integrator_steps,iterations,allocations,allocated_bytes\n" );
+}
+
+static void printCSV( const BenchmarkResult& r )
+{
+	printf( "%s,%d,%d,%.9e,%d,%d,%d,%ld,%ld\n",
+			r.name, r.status, r.repetitions, r.wallTime, r.functionEvaluations,
+			r.integratorSteps, r.iterations, r.allocations, r.allocatedBytes );
+}
+
+static void printJSON( const BenchmarkResult& r, BooleanType isFirst )
+{
+	printf( "%s\n    { \"name\": \"%s\", \"status\": %d, \"repetitions\": %d, "
+			"\"wall_time_s\": %.9e, \"function_evaluations\": %d, "
+			"\"integrator_steps\": %d, \"iterations\": %d, "
+			"\"allocations\": %ld, \"allocated_bytes\": %ld }",
+			isFirst == BT_TRUE ? "" : ",",
+			r.name, r.status, r.repetitions, r.wallTime, r.functionEvaluations,
+			r.integratorSteps, r.iterations, r.allocations, r.allocatedBytes );
+}
+
+
+// ---------------------------------------------------------------------------
+// MAIN:
+// ---------------------------------------------------------------------------
+
+/** Resets the numbering of all symbolic variables, such that every workload
+ *  sees only its own variables (cf. include/acado/utils/matlab_acado_utils.hpp). */
+static returnValue clearAllStaticCounters( )
+{
+	AlgebraicState              dummy1;
+	Control                     dummy2;
+	DifferentialState           dummy3;
+	DifferentialStateDerivative dummy4;
+	Disturbance                 dummy5;
+	IntegerControl              dummy6;
+	IntegerParameter            dummy7;
+	IntermediateState           dummy8;
+	Parameter                   dummy9;
+
+	dummy1.clearStaticCounters();
+	dummy2.clearStaticCounters();
+	dummy3.clearStaticCounters();
+	dummy4.clearStaticCounters();
+	dummy5.clearStaticCounters();
+	dummy6.clearStaticCounters();
+	dummy7.clearStaticCounters();
+	dummy8.clearStaticCounters();
+	dummy9.clearStaticCounters();
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+typedef BenchmarkResult (*BenchmarkFunction)( int );
+
+struct BenchmarkEntry
+{
+	const char*       name;
+	BenchmarkFunction run;
+	int               defaultRepetitions;
+};
+
+static const BenchmarkEntry benchmarks[] =
+{
+	{ "integrator_hydroscal_bdf", benchmarkHydroscalIntegration,  5 },
+	{ "integrator_cstr_rk45",     benchmarkCstrIntegration,      20 },
+	{ "ocp_pendulum_condensing",  benchmarkPendulumOCP,           5 },
+	{ "rti_pendulum",             benchmarkPendulumRTI,           5 },
+	{ "rti_pendulum_feedback",    benchmarkPendulumFeedback,      5 },
+	{ "rti_pendulum_exported",    benchmarkExportedRTI,          20 },
+	{ "export_pendulum_rti",      benchmarkPendulumExport,        5 }
+};
+
+static const int nBenchmarks = sizeof( benchmarks ) / sizeof( BenchmarkEntry );
+
+
+int main( int argc, char* argv[] )
+{
+	BooleanType useJSON     = BT_FALSE;
+	int         repetitions = 0;
+	int         nFilters    = 0;
+	const char* filters[64];
+
+	for( int i=1; i<argc; ++i )
+	{
+		if ( strcmp( argv[i],"--json" ) == 0 )
+			useJSON = BT_TRUE;
+		else if ( strcmp( argv[i],"--csv" ) == 0 )
+			useJSON = BT_FALSE;
+		else if ( ( strcmp( argv[i],"--repetitions" ) == 0 ) && ( i+1 < argc ) )
+			repetitions = atoi( argv[++i] );
+		else if ( nFilters < 64 )
+			filters[nFilters++] = argv[i];
+	}
+
+	if ( useJSON == BT_TRUE )
+		printf( "[" );
+	else
+		printCSVHeader( );
+
+	BooleanType isFirst = BT_TRUE;
+
+	for( int i=0; i<nBenchmarks; ++i )
+	{
+		BooleanType isSelected = nFilters > 0 ? BT_FALSE : BT_TRUE;
+		for( int j=0; j<nFilters; ++j )
+			if ( strstr( benchmarks[i].name,filters[j] ) != 0 )
+				isSelected = BT_TRUE;
+
+		if ( isSelected == BT_FALSE )
+			continue;
+
+		clearAllStaticCounters( );
+
+		BenchmarkResult result = benchmarks[i].run( repetitions > 0 ? repetitions : benchmarks[i].defaultRepetitions );
+		result.name = benchmarks[i].name;
+
+		if ( useJSON == BT_TRUE )
+			printJSON( result,isFirst );
+		else
+			printCSV( result );
+
+		fflush( stdout );
+		isFirst = BT_FALSE;
+	}
+
+	if ( useJSON == BT_TRUE )
+		printf( "\n]\n" );
+
+	return 0;
+}
+
+
+/*
+ *  end of file
+ */
@@ -0,0 +1,114 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file benchmarks/benchmarks.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2012
+ *
+ *    Common declarations of the ACADO benchmark suite. Each workload fills
+ *    one BenchmarkResult; the driver (acado_benchmarks.cpp) runs all of them
+ *    and reports the results as CSV or JSON.
+ */
+
+
+#ifndef ACADO_BENCHMARKS_HPP
+#define ACADO_BENCHMARKS_HPP
+
+
+#include <acado_optimal_control.hpp>
+
+
+/** Results of a single benchmark workload. Counters that are not available
+ *  for a workload are set to -1. */
+struct BenchmarkResult
+{
+	const char* name;                 /**< name of the workload                      */
+	int         status;               /**< return value of the workload               */
+	int         repetitions;          /**< number of timed repetitions                */
+	double      wallTime;             /**< wall time per repetition [s]               */
+	int         functionEvaluations;  /**< rhs evaluations per repetition             */
+	int         integratorSteps;      /**< accepted integrator steps per repetition   */
+	int         iterations;           /**< SQP (or RTI) iterations per repetition     */
+	long        allocations;          /**< heap allocations per repetition            */
+	long        allocatedBytes;       /**< heap memory allocated per repetition [B]   */
+};
+
+
+/** Number of calls to the global operator new (counted by the driver). */
+long getAllocationCount( );
+
+/** Number of bytes requested from the global operator new. */
+long getAllocatedBytes( );
+
+
+/** Starts the measurement of a workload. */
+void startBenchmark(	BenchmarkResult& result,
+						const char* name,
+						int repetitions
+						);
+
+/** Stops the measurement of a workload and normalises all counters
+ *  by the number of repetitions. */
+void stopBenchmark(	BenchmarkResult& result,
+					ACADO::returnValue status
+					);
+
+
+/** Integrates the hydroscal distillation column (BDF, 82 differential and 122
+ *  algebraic states, cf. examples/integrator/hydroscal.cpp). */
+BenchmarkResult benchmarkHydroscalIntegration( int repetitions );
+
+/** Integrates the CSTR model together with its Riccati equation
+ *  (RK45, 20 states, cf. examples/integrator/cstr.cpp). */
+BenchmarkResult benchmarkCstrIntegration( int repetitions );
+
+/** Solves the pendulum (crane) OCP by multiple shooting and condensing. */
+BenchmarkResult benchmarkPendulumOCP( int repetitions );
+
+/** Runs a closed loop of real-time iterations (RTI) on the pendulum OCP. */
+BenchmarkResult benchmarkPendulumRTI( int repetitions );
+
+/** Runs a closed loop of real-time iterations on the pendulum OCP in the
+ *  reduced-allocation feedback mode (REDUCE_FEEDBACK_ALLOCATIONS) and reports
+ *  wall time and heap allocations of the feedback steps only. */
+BenchmarkResult benchmarkPendulumFeedback( int repetitions );
+
+/** Runs a closed loop of the code-generated RTI scheme of the pendulum OCP
+ *  (cf. examples/code_generation/nmpc/getting_started_closed_loop.cpp). */
+BenchmarkResult benchmarkExportedRTI( int repetitions );
+
+/** Generates the code of the RTI scheme for the pendulum OCP
+ *  (cf. examples/code_generation/nmpc/getting_started.cpp). */
+BenchmarkResult benchmarkPendulumExport( int repetitions );
+
+
+#endif  // ACADO_BENCHMARKS_HPP
+
+/*
+ *  end of file
+ */
@@ -0,0 +1,134 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file benchmarks/exported_rti_benchmarks.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2012
+ *
+ *    Closed-loop benchmark of the code-generated RTI scheme of the pendulum
+ *    OCP (cf. examples/code_generation/nmpc/getting_started_closed_loop.cpp).
+ *    The code is generated at build time by generator/pendulum_export.cpp.
+ */
+
+
+#include "benchmarks.hpp"
+
+#include <acado_toolkit.hpp>
+
+
+extern "C"
+{
+#include "acado.h"
+#include "auxiliary_functions.c"
+} // extern "C"
+
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+Vars         vars;
+Params       params;
+
+
+USING_NAMESPACE_ACADO
+
+
+BenchmarkResult benchmarkExportedRTI( int repetitions )
+{
+	const int    nSteps       = 100;
+	const double samplingTime = 0.3;
+
+	ExportedRTIscheme rtiScheme(
+			4, // number of states
+			1, // number of controls
+			10, // number of horizon intervals
+			samplingTime,
+
+			/* Function handlers: */
+			preparationStep,
+			feedbackStep,
+			shiftControls,
+			shiftStates,
+			getAcadoVariablesX,
+			getAcadoVariablesU,
+			getAcadoVariablesXRef,
+			getAcadoVariablesURef );
+
+	Vector xuRef(5);
+	xuRef.setZero( );
+
+	VariablesGrid reference;
+	reference.addVector( xuRef,  0.0 );
+	reference.addVector( xuRef, samplingTime*10.0 );
+
+	Vector x( 4 );
+	Vector u( 1 );
+
+	BenchmarkResult result;
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	startBenchmark( result,"rti_pendulum_exported",repetitions );
+
+	for( int run=0; run<repetitions; ++run )
+	{
+		x.setZero( );
+		x(0) = 1.0;
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = rtiScheme.init( 0.0,x,emptyConstVector,reference );
+
+		for( int k=0; k<nSteps; ++k )
+		{
+			if ( returnvalue != SUCCESSFUL_RETURN )
+				break;
+
+			returnvalue = rtiScheme.step( k*samplingTime,x,emptyConstVector,reference );
+			rtiScheme.getU( u );
+
+			// simulate the plant by an explicit Euler step
+			double dx[4] = { x(1),
+			                 u(0),
+			                 x(3),
+			                 -9.81*sin(x(2)) - u(0)*cos(x(2)) - 0.2*x(3) };
+
+			for( int i=0; i<4; ++i )
+				x(i) += samplingTime*dx[i];
+		}
+	}
+
+	stopBenchmark( result,returnvalue );
+
+	result.iterations = nSteps;
+
+	return result;
+}
+
+
+/*
+ *  end of file
+ */
@@ -0,0 +1,95 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file benchmarks/generator/pendulum_export.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2012
+ *
+ *    Generates the RTI scheme of the pendulum (crane) OCP into the folder
+ *    given as first argument (same setup as
+ *    examples/code_generation/nmpc/getting_started.cpp). The generated code
+ *    is compiled into the benchmark suite.
+ */
+
+
+#include <acado_code_generation.hpp>
+
+
+int main( int argc, char* argv[] )
+{
+	USING_NAMESPACE_ACADO
+
+	if ( argc < 2 )
+		return 1;
+
+	DifferentialState   p    ;  // the trolley position
+	DifferentialState   v    ;  // the trolley velocity
+	DifferentialState   phi  ;  // the excitation angle
+	DifferentialState   omega;  // the angular velocity
+	Control             a    ;  // the acc. of the trolley
+
+	const double     g = 9.81;  // the gravitational constant
+	const double     b = 0.20;  // the friction coefficient
+
+	DifferentialEquation f;
+
+	f << dot( p     )  ==  v                                ;
+	f << dot( v     )  ==  a                                ;
+	f << dot( phi   )  ==  omega                            ;
+	f << dot( omega )  == -g*sin(phi) - a*cos(phi) - b*omega;
+
+	Matrix Q  = eye(4);
+	Matrix R  = eye(1);
+
+	Matrix P  = eye(4);
+	P *= 5.0;
+
+	OCP ocp( 0.0,3.0, 10 );
+
+	ocp.minimizeLSQ       ( Q,R );
+	ocp.minimizeLSQEndTerm( P   );
+
+	ocp.subjectTo( f );
+	ocp.subjectTo( -1.0 <= a <= 1.0 );
+
+	MPCexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION,       GAUSS_NEWTON    );
+	mpc.set( DISCRETIZATION_TYPE,         SINGLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE,             INT_RK4         );
+	mpc.set( NUM_INTEGRATOR_STEPS,        30              );
+	mpc.set( QP_SOLVER,                   QP_QPOASES      );
+	mpc.set( GENERATE_TEST_FILE,          NO              );
+	mpc.set( GENERATE_MAKE_FILE,          NO              );
+	mpc.set( GENERATE_SIMULINK_INTERFACE, NO              );
+
+	if ( mpc.exportCode( argv[1] ) != SUCCESSFUL_RETURN )
+		return 1;
+
+	return 0;
+}
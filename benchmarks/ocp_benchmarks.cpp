@@ -0,0 +1,338 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file benchmarks/ocp_benchmarks.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2012
+ */
+
+
+#include "benchmarks.hpp"
+
+#include <acado_code_generation.hpp>
+
+
+#ifndef ACADO_BENCHMARKS_EXPORT_DIR
+	#define ACADO_BENCHMARKS_EXPORT_DIR "."
+#endif
+
+
+USING_NAMESPACE_ACADO
+
+
+// ---------------------------------------------------------------------------
+// PENDULUM (CRANE) OCP:
+// ---------------------------------------------------------------------------
+
+// Number of closed-loop steps of the RTI benchmark.
+static const int    nRTIsteps   = 50;
+static const double samplingTime = 0.1;
+
+static const double x0[4] = { 0.5, 0.0, 0.3, 0.0 };
+
+
+/** Sets up the pendulum (crane) OCP of examples/code_generation/nmpc/getting_started.cpp. */
+static void setupPendulumOCP(	OCP& ocp,
+								BooleanType fixInitialValue
+								)
+{
+	DifferentialState   p    ;  // the trolley position
+	DifferentialState   v    ;  // the trolley velocity
+	DifferentialState   phi  ;  // the excitation angle
+	DifferentialState   omega;  // the angular velocity
+	Control             a    ;  // the acc. of the trolley
+
+	const double     g = 9.81;  // the gravitational constant
+	const double     b = 0.20;  // the friction coefficient
+
+	DifferentialEquation f;
+
+	f << dot( p     )  ==  v                                ;
+	f << dot( v     )  ==  a                                ;
+	f << dot( phi   )  ==  omega                            ;
+	f << dot( omega )  == -g*sin(phi) - a*cos(phi) - b*omega;
+
+	Function h;
+	h << p << v << phi << omega << a;
+
+	Function hN;
+	hN << p << v << phi << omega;
+
+	Matrix Q = eye(5);
+	Matrix P = eye(4);
+	P *= 5.0;
+
+	Vector r ( 5 );
+	Vector rN( 4 );
+	r.setZero( );
+	rN.setZero( );
+
+	ocp.minimizeLSQ       ( Q,h ,r  );
+	ocp.minimizeLSQEndTerm( P,hN,rN );
+
+	ocp.subjectTo( f );
+	ocp.subjectTo( -1.0 <= a <= 1.0 );
+
+	if ( fixInitialValue == BT_TRUE )
+	{
+		ocp.subjectTo( AT_START, p     == x0[0] );
+		ocp.subjectTo( AT_START, v     == x0[1] );
+		ocp.subjectTo( AT_START, phi   == x0[2] );
+		ocp.subjectTo( AT_START, omega == x0[3] );
+	}
+}
+
+
+BenchmarkResult benchmarkPendulumOCP( int repetitions )
+{
+	OCP ocp( 0.0,3.0,20 );
+	setupPendulumOCP( ocp,BT_TRUE );
+
+	BenchmarkResult result;
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+	Matrix nSQP( 1,1 );
+	nSQP.setZero( );
+
+	startBenchmark( result,"ocp_pendulum_condensing",repetitions );
+
+	for( int run=0; run<repetitions; ++run )
+	{
+		OptimizationAlgorithm algorithm( ocp );
+		algorithm.set( PRINTLEVEL,      NONE );
+		algorithm.set( PRINT_COPYRIGHT, NO   );
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = algorithm.solve( );
+
+		if ( run == repetitions-1 )
+			algorithm.getLast( LOG_NUM_SQP_ITERATIONS,nSQP );
+	}
+
+	stopBenchmark( result,returnvalue );
+
+	result.iterations = (int)nSQP(0,0);
+
+	return result;
+}
+
+
+BenchmarkResult benchmarkPendulumRTI( int repetitions )
+{
+	OCP ocp( 0.0,3.0,20 );
+	setupPendulumOCP( ocp,BT_FALSE );
+
+	RealTimeAlgorithm algorithm( ocp,samplingTime );
+	algorithm.set( MAX_NUM_ITERATIONS, 1    );
+	algorithm.set( PRINTLEVEL,         NONE );
+	algorithm.set( PRINT_COPYRIGHT,    NO   );
+
+	Vector x( 4 );
+	Vector u( 1 );
+
+	for( int i=0; i<4; ++i )
+		x(i) = x0[i];
+
+	BenchmarkResult result;
+	returnValue returnvalue = algorithm.init( 0.0,x );
+
+	startBenchmark( result,"rti_pendulum",repetitions );
+
+	for( int run=0; run<repetitions; ++run )
+	{
+		for( int i=0; i<4; ++i )
+			x(i) = x0[i];
+
+		for( int k=0; k<nRTIsteps; ++k )
+		{
+			if ( returnvalue != SUCCESSFUL_RETURN )
+				break;
+
+			returnvalue = algorithm.step( k*samplingTime,x );
+			algorithm.getU( u );
+
+			// simulate the plant by an explicit Euler step
+			double dx[4] = { x(1),
+			                 u(0),
+			                 x(3),
+			                 -9.81*sin(x(2)) - u(0)*cos(x(2)) - 0.2*x(3) };
+
+			for( int i=0; i<4; ++i )
+				x(i) += samplingTime*dx[i];
+		}
+	}
+
+	stopBenchmark( result,returnvalue );
+
+	result.iterations = nRTIsteps;
+
+	return result;
+}
+
+
+BenchmarkResult benchmarkPendulumFeedback( int repetitions )
+{
+	OCP ocp( 0.0,3.0,20 );
+	setupPendulumOCP( ocp,BT_FALSE );
+
+	RealTimeAlgorithm algorithm( ocp,samplingTime );
+	algorithm.set( MAX_NUM_ITERATIONS,          1    );
+	algorithm.set( REDUCE_FEEDBACK_ALLOCATIONS, YES  );
+	algorithm.set( PRINTLEVEL,                  NONE );
+	algorithm.set( PRINT_COPYRIGHT,             NO   );
+
+	Vector x( 4 );
+	Vector u( 1 );
+
+	for( int i=0; i<4; ++i )
+		x(i) = x0[i];
+
+	BenchmarkResult result;
+	returnValue returnvalue = algorithm.init( 0.0,x );
+
+	// the first feedback step sets up the workspace of the QP solver
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = algorithm.feedbackStep( 0.0,x );
+
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = algorithm.preparationStep( );
+
+	long   feedbackAllocations = 0;
+	long   feedbackBytes       = 0;
+	double feedbackTime        = 0.0;
+
+	startBenchmark( result,"rti_pendulum_feedback",repetitions );
+
+	for( int run=0; run<repetitions; ++run )
+	{
+		for( int k=1; k<=nRTIsteps; ++k )
+		{
+			if ( returnvalue != SUCCESSFUL_RETURN )
+				break;
+
+			// only the feedback step is counted (the preparation step
+			// may allocate, as it runs in the idle time of the controller)
+			long   allocations = getAllocationCount( );
+			long   bytes       = getAllocatedBytes( );
+			double startTime   = acadoGetTime( );
+
+			returnvalue = algorithm.feedbackStep( k*samplingTime,x );
+
+			feedbackTime        += acadoGetTime( ) - startTime;
+			feedbackAllocations += getAllocationCount( ) - allocations;
+			feedbackBytes       += getAllocatedBytes( ) - bytes;
+
+			algorithm.getU( u );
+
+			if ( returnvalue == SUCCESSFUL_RETURN )
+				returnvalue = algorithm.preparationStep( );
+
+			// simulate the plant by an explicit Euler step
+			double dx[4] = { x(1),
+			                 u(0),
+			                 x(3),
+			                 -9.81*sin(x(2)) - u(0)*cos(x(2)) - 0.2*x(3) };
+
+			for( int i=0; i<4; ++i )
+				x(i) += samplingTime*dx[i];
+		}
+	}
+
+	stopBenchmark( result,returnvalue );
+
+	// report wall time and heap allocations per feedback step
+	int nSteps = ( repetitions > 0 ? repetitions : 1 ) * nRTIsteps;
+
+	result.wallTime       = feedbackTime / (double)nSteps;
+	result.allocations    = feedbackAllocations / nSteps;
+	result.allocatedBytes = feedbackBytes / nSteps;
+	result.iterations     = nRTIsteps;
+
+	return result;
+}
+
+
+BenchmarkResult benchmarkPendulumExport( int repetitions )
+{
+	DifferentialState   p, v, phi, omega;
+	Control             a;
+
+	const double     g = 9.81;
+	const double     b = 0.20;
+
+	DifferentialEquation f;
+
+	f << dot( p     )  ==  v                                ;
+	f << dot( v     )  ==  a                                ;
+	f << dot( phi   )  ==  omega                            ;
+	f << dot( omega )  == -g*sin(phi) - a*cos(phi) - b*omega;
+
+	Matrix Q = eye(4);
+	Matrix R = eye(1);
+	Matrix P = eye(4);
+	P *= 5.0;
+
+	OCP ocp( 0.0,3.0,10 );
+
+	ocp.minimizeLSQ       ( Q,R );
+	ocp.minimizeLSQEndTerm( P   );
+
+	ocp.subjectTo( f );
+	ocp.subjectTo( -1.0 <= a <= 1.0 );
+
+	BenchmarkResult result;
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	startBenchmark( result,"export_pendulum_rti",repetitions );
+
+	for( int run=0; run<repetitions; ++run )
+	{
+		MPCexport mpc( ocp );
+
+		mpc.set( HESSIAN_APPROXIMATION,       GAUSS_NEWTON    );
+		mpc.set( DISCRETIZATION_TYPE,         SINGLE_SHOOTING );
+		mpc.set( INTEGRATOR_TYPE,             INT_RK4         );
+		mpc.set( NUM_INTEGRATOR_STEPS,        30              );
+		mpc.set( QP_SOLVER,                   QP_QPOASES      );
+		mpc.set( GENERATE_TEST_FILE,          NO              );
+		mpc.set( GENERATE_MAKE_FILE,          NO              );
+		mpc.set( GENERATE_SIMULINK_INTERFACE, NO              );
+		mpc.set( PRINTLEVEL,                  NONE            );
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = mpc.exportCode( ACADO_BENCHMARKS_EXPORT_DIR );
+	}
+
+	stopBenchmark( result,returnvalue );
+
+	return result;
+}
+
+
+/*
+ *  end of file
+ */
@@ -32,6 +32,7 @@
 #		- Variable: ACADO_STATIC_LIBRARIES
 #		- Variable: ACADO_SHARED_LIBS_FOUND
 #		- Variable: ACADO_SHARED_LIBRARIES
+#		- Variable: ACADO_EXTERNAL_LIBRARIES
 #
 # Authors:
 #	Milan Vukov, milan.vukov@esat.kuleuven.be
@@ -116,6 +117,18 @@ ELSE()
 	ENDFOREACH()
 ENDIF()
 
+#
+# Libraries and linker flags the ACADO libraries depend on (OpenMP, POSIX
+# threads, dynamic loader); they are needed for linking against the static
+# libraries and hence appended to them
+#
+SET( ACADO_EXTERNAL_LIBRARIES $ENV{ACADO_ENV_EXTERNAL_LIBRARIES} )
+IF( ACADO_STATIC_LIBS_FOUND AND ACADO_EXTERNAL_LIBRARIES )
+	SET( ACADO_STATIC_LIBRARIES
+		${ACADO_STATIC_LIBRARIES} ${ACADO_EXTERNAL_LIBRARIES}
+	)
+ENDIF()
+
 SET( ACADO_BUILD_STATIC ${ACADO_STATIC_LIBS_FOUND} )
 
 IF( VERBOSE )
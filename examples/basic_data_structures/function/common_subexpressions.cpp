@@ -0,0 +1,201 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file examples/basic_data_structures/function/common_subexpressions.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ *    Compiles a function whose components share several subterms and checks
+ *    that the tape evaluates them only once, i.e. that it needs fewer
+ *    instructions than the tapes of the single components together, while
+ *    its values and first order derivatives coincide with the ones of the
+ *    operator tree.
+ */
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/user_interaction/user_interaction.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+int main( ){
+
+    // DEFINE VARIABLES:
+    // -----------------------
+       DifferentialState x, y;
+       Control           u;
+       Function          f, g, single[3];
+
+       Expression a = sin( x*y ) + y;
+       Expression b = exp( x-u );
+
+       Expression h[3];
+       h[0] = a*b;
+       h[1] = a/( 1.0+b*b );
+       h[2] = cos( a ) - b + sin( x*y );
+
+       int run1, run2;
+
+       for( run1 = 0; run1 < 3; run1++ ){
+           f << h[run1];
+           single[run1] << h[run1];
+           single[run1].compile();
+       }
+
+       g = f;
+       g.compile();
+
+
+    // COMPARE THE NUMBER OF INSTRUCTIONS:
+    // -----------------------------------
+       int nSingle = 0;
+       for( run1 = 0; run1 < 3; run1++ )
+           nSingle += single[run1].getNumTapeInstructions();
+
+       acadoPrintf( "instructions: %d (components compiled separately)   %d (shared)\n",
+                    nSingle, g.getNumTapeInstructions() );
+
+       int nErrors = 0;
+
+       if( g.getNumTapeInstructions() >= nSingle )
+           nErrors++;
+
+
+    // COMPARE THE TREE AND THE TAPE:
+    // ------------------------------
+       const int nv = f.getNumberOfVariables()+1;
+
+       EvaluationWorkspace ws;
+       g.initWorkspace( ws );
+
+       double *xx    = new double[nv];
+       double *seed  = new double[nv];
+       double *df1   = new double[nv];
+       double *df2   = new double[nv];
+       double  bseed[3] = { 1.0, -2.0, 0.5 };
+       double  rf[3], rg[3], dg[3];
+
+       for( run1 = 0; run1 < nv; run1++ ){
+           xx  [run1] = 0.3*(run1+1);
+           seed[run1] = 0.0;
+           df1 [run1] = 0.0;
+           df2 [run1] = 0.0;
+       }
+       seed[f.index(VT_DIFFERENTIAL_STATE,0)] = 1.0;
+
+       f.evaluate( 0, xx, rf );
+       g.evaluate( xx, rg );
+
+       for( run1 = 0; run1 < 3; run1++ )
+           if( rf[run1] != rg[run1] )
+               nErrors++;
+
+       f.AD_forward( 0, seed, rf );
+       f.AD_backward( 0, bseed, df1 );
+
+       g.AD_forward( xx, seed, rg, dg, ws );
+       g.AD_backward( xx, bseed, df2, ws );
+
+       for( run1 = 0; run1 < 3; run1++ )
+           if( fabs( rf[run1] - dg[run1] ) > 1e-12 )
+               nErrors++;
+
+       for( run1 = 0; run1 < nv; run1++ )
+           if( fabs( df1[run1] - df2[run1] ) > 1e-12 )
+               nErrors++;
+
+
+    // BACKWARD DERIVATIVES AT THE POINTS OF A BATCHED EVALUATION:
+    // -----------------------------------------------------------
+       const int nPoints = 4;
+
+       EvaluationWorkspace wsBatch;
+       g.initWorkspace( wsBatch,1,nPoints );
+
+       double *xBatch = new double[nv*nPoints];
+       double  rBatch[3*nPoints];
+
+       for( run1 = 0; run1 < nv; run1++ )
+           for( run2 = 0; run2 < nPoints; run2++ )
+               xBatch[run1*nPoints+run2] = 0.3*(run1+1) - 0.1*run2;
+
+       g.evaluateBatch( nPoints, xBatch, rBatch, wsBatch );
+
+       for( run2 = 0; run2 < nPoints; run2++ ){
+
+           for( run1 = 0; run1 < nv; run1++ ){
+               xx [run1] = xBatch[run1*nPoints+run2];
+               df1[run1] = 0.0;
+               df2[run1] = 0.0;
+           }
+
+           f.evaluate( 0, xx, rf );
+           f.AD_backward( 0, bseed, df1 );
+           g.AD_backward( run2, bseed, df2, wsBatch );
+
+           for( run1 = 0; run1 < 3; run1++ )
+               if( rf[run1] != rBatch[run1*nPoints+run2] )
+                   nErrors++;
+
+           for( run1 = 0; run1 < nv; run1++ )
+               if( fabs( df1[run1] - df2[run1] ) > 1e-12 )
+                   nErrors++;
+       }
+
+
+    // THE SAME FOR THE NATIVE CODE:
+    // -----------------------------
+       if( g.compileNative() == SUCCESSFUL_RETURN ){
+
+           for( run1 = 0; run1 < nv; run1++ ){
+               xx [run1] = 0.3*(run1+1);
+               df1[run1] = 0.0;
+               df2[run1] = 0.0;
+           }
+
+           f.evaluate( 0, xx, rf );
+           f.AD_backward( 0, bseed, df1 );
+           g.AD_backward( xx, bseed, df2, ws );
+
+           for( run1 = 0; run1 < nv; run1++ )
+               if( fabs( df1[run1] - df2[run1] ) > 1e-12 )
+                   nErrors++;
+       }
+
+       if( nErrors > 0 )
+           acadoPrintf( "\ncommon subexpression check FAILED (%d mismatches)\n", nErrors );
+       else
+           acadoPrintf( "\ncommon subexpression check passed\n" );
+
+       delete[] xx;
+       delete[] seed;
+       delete[] df1;
+       delete[] df2;
+       delete[] xBatch;
+
+    return ( nErrors > 0 );
+}
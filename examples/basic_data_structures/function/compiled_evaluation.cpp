@@ -0,0 +1,207 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/basic_data_structures/function/compiled_evaluation.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ */
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/user_interaction/user_interaction.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+int main( ){
+
+    // DEFINE VARIABLES:
+    // -----------------------
+       DifferentialState x, y, phi;
+       Control           u;
+       DifferentialState v(24);   // (moves the index of z beyond the number of tape registers)
+       IntermediateState z;
+       Function          f, g;
+
+       z = sin(phi)*x + pow(y,3);
+
+       f << z*z - exp( -x*u ) + y/(1.0+x*x);
+       f << cos(z) + pow(x,y) - log(1.0+u*u);
+       f << atan( z ) + tan( 0.1*phi );
+       f << v.getSumSquare();
+
+       g = f;
+       g.compile();
+
+
+    // COMPARE THE TREE AND THE TAPE EVALUATION:
+    // -----------------------------------------
+       const int nRuns = 100000;
+       int       run1;
+
+       double *xx = new double[f.getNumberOfVariables()+1];
+       double  rf[4], rg[4];
+
+       for( run1 = 0; run1 < f.getNumberOfVariables()+1; run1++ )
+           xx[run1] = 0.1*(run1+1);
+
+       double t1 = -acadoGetTime();
+       for( run1 = 0; run1 < nRuns; run1++ )
+           f.evaluate( xx, rf );
+       t1 += acadoGetTime();
+
+       double t2 = -acadoGetTime();
+       for( run1 = 0; run1 < nRuns; run1++ )
+           g.evaluate( xx, rg );
+       t2 += acadoGetTime();
+
+       for( run1 = 0; run1 < 4; run1++ )
+           acadoPrintf( "f[%d] = %.16e  (tree)   %.16e  (tape)\n", run1, rf[run1], rg[run1] );
+
+       acadoPrintf( "\ntree evaluation: %.3e s\n", t1/nRuns );
+       acadoPrintf( "tape evaluation: %.3e s\n",   t2/nRuns );
+
+
+
+    // DERIVATIVES BASED ON A CALLER-OWNED WORKSPACE:
+    // ----------------------------------------------
+       EvaluationWorkspace ws;
+       g.initWorkspace( ws );
+
+       const int nv = f.getNumberOfVariables()+1;
+
+       double *seed = new double[nv];
+       double *df1  = new double[nv];
+       double *df2  = new double[nv];
+       double  bseed[4] = { 1.0, -2.0, 0.5, 0.25 };
+       double  dg[4];
+
+       for( run1 = 0; run1 < nv; run1++ ){
+           seed[run1] = 0.0;
+           df1 [run1] = 0.0;
+           df2 [run1] = 0.0;
+       }
+       seed[0] = 1.0;
+
+       f.evaluate( 0, xx, rf );
+       f.AD_forward( 0, seed, rf );
+       f.AD_backward( 0, bseed, df1 );
+
+       g.AD_forward( xx, seed, rg, dg, ws );
+       g.AD_backward( xx, bseed, df2, ws );
+
+       for( run1 = 0; run1 < 4; run1++ )
+           acadoPrintf( "df[%d]/dx = %.16e  (tree)   %.16e  (tape)\n", run1, rf[run1], dg[run1] );
+
+       for( run1 = 0; run1 < 3; run1++ )
+           acadoPrintf( "adjoint[%d] = %.16e  (tree)   %.16e  (tape)\n", run1,
+                        df1[f.index(VT_DIFFERENTIAL_STATE,run1)], df2[g.index(VT_DIFFERENTIAL_STATE,run1)] );
+
+
+    // CHECK THE BACKWARD DERIVATIVES OF THE TAPE (AND OF THE NATIVE CODE):
+    // --------------------------------------------------------------------
+       int nErrors = 0;
+
+       for( run1 = 0; run1 < f.getNX(); run1++ )
+           if( fabs( df1[f.index(VT_DIFFERENTIAL_STATE,run1)] - df2[g.index(VT_DIFFERENTIAL_STATE,run1)] ) > 1e-12 )
+               nErrors++;
+       for( run1 = 0; run1 < f.getNU(); run1++ )
+           if( fabs( df1[f.index(VT_CONTROL,run1)] - df2[g.index(VT_CONTROL,run1)] ) > 1e-12 )
+               nErrors++;
+
+
+    // BACKWARD DERIVATIVES AT THE POINTS OF A BATCHED EVALUATION:
+    // -----------------------------------------------------------
+       const int nPoints = 3;
+       int       run2;
+
+       EvaluationWorkspace wsBatch;
+       g.initWorkspace( wsBatch,1,nPoints );
+
+       double *xBatch = new double[nv*nPoints];
+       double *xPoint = new double[nv];
+       double *dfa    = new double[nv];
+       double *dfb    = new double[nv];
+       double  rBatch[4*nPoints];
+
+       for( run1 = 0; run1 < nv; run1++ )
+           for( run2 = 0; run2 < nPoints; run2++ )
+               xBatch[run1*nPoints+run2] = 0.1*(run1+1) + 0.2*run2;
+
+       g.evaluateBatch( nPoints, xBatch, rBatch, wsBatch );
+
+       // (the trace based derivatives coincide with the ones of a
+       // separate evaluation at each point)
+       for( run2 = 0; run2 < nPoints; run2++ ){
+
+           for( run1 = 0; run1 < nv; run1++ ){
+               xPoint[run1] = xBatch[run1*nPoints+run2];
+               dfa   [run1] = 0.0;
+               dfb   [run1] = 0.0;
+           }
+
+           g.AD_backward( xPoint, bseed, dfa, ws );
+           g.AD_backward( run2, bseed, dfb, wsBatch );
+
+           for( run1 = 0; run1 < nv; run1++ )
+               if( dfa[run1] != dfb[run1] )
+                   nErrors++;
+       }
+
+       delete[] xBatch;
+       delete[] xPoint;
+       delete[] dfa;
+       delete[] dfb;
+
+       if( g.compileNative() == SUCCESSFUL_RETURN ){
+
+           for( run1 = 0; run1 < nv; run1++ )
+               df2[run1] = 0.0;
+
+           g.AD_backward( xx, bseed, df2, ws );
+
+           for( run1 = 0; run1 < f.getNX(); run1++ )
+               if( fabs( df1[f.index(VT_DIFFERENTIAL_STATE,run1)] - df2[g.index(VT_DIFFERENTIAL_STATE,run1)] ) > 1e-12 )
+                   nErrors++;
+           for( run1 = 0; run1 < f.getNU(); run1++ )
+               if( fabs( df1[f.index(VT_CONTROL,run1)] - df2[g.index(VT_CONTROL,run1)] ) > 1e-12 )
+                   nErrors++;
+       }
+
+       if( nErrors > 0 )
+           acadoPrintf( "\nbackward AD check FAILED (%d mismatches)\n", nErrors );
+       else
+           acadoPrintf( "\nbackward AD check passed\n" );
+
+       delete[] seed;
+       delete[] df1;
+       delete[] df2;
+       delete[] xx;
+
+    return ( nErrors > 0 );
+}
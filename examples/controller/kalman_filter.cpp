@@ -0,0 +1,180 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file   examples/controller/kalman_filter.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date   2010
+ *
+ *    Estimates position and velocity of a damped oscillator from position
+ *    measurements by the extended and the square-root unscented Kalman
+ *    filter, once directly and once via Controller::obtainEstimates, and
+ *    compares the estimates with the analytic trajectory of the oscillator.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* analytic solution of  p'' + 0.2 p' + p = 0,  p(0) = 1, p'(0) = 0 */
+void trajectory( double t, Vector& x )
+{
+    double omega = sqrt( 0.99 );
+
+    x.init( 2 );
+    x(0) =  exp( -0.1*t ) * ( cos( omega*t ) + 0.1/omega*sin( omega*t ) );
+    x(1) = -exp( -0.1*t ) / omega * sin( omega*t );
+}
+
+
+/* runs the filter over the measurements and returns the largest estimation
+ * error over the last second */
+returnValue estimate( KalmanFilter& filter, BooleanType useController, double& err )
+{
+    const double samplingTime = 0.1;
+    const int    nSteps       = 100;
+
+    Vector x0( 2 ), xTrue, xEst, pEst, y( 1 );
+
+    // poor initial guess
+    x0(0) = 0.5;
+    x0(1) = 0.5;
+
+    Matrix K( 1,2 );
+    K.setZero( );
+
+    LinearStateFeedback feedback( K,samplingTime );
+    Controller controller( feedback,filter );
+
+    if ( useController == BT_TRUE )
+    {
+        if ( controller.init( 0.0,x0 ) != SUCCESSFUL_RETURN )
+            return RET_CONTROLLER_INIT_FAILED;
+    }
+    else
+    {
+        if ( filter.init( 0.0,x0 ) != SUCCESSFUL_RETURN )
+            return RET_ESTIMATOR_INIT_FAILED;
+    }
+
+    err = 0.0;
+
+    for( int k = 1; k <= nSteps; k++ )
+    {
+        double t = k*samplingTime;
+
+        trajectory( t,xTrue );
+        y(0) = xTrue(0);
+
+        if ( useController == BT_TRUE )
+        {
+            if ( controller.obtainEstimates( t,y,xEst,pEst ) != SUCCESSFUL_RETURN )
+                return RET_CONTROLLER_STEP_FAILED;
+        }
+        else
+        {
+            if ( ( filter.step( t,y ) != SUCCESSFUL_RETURN ) || ( filter.getX( xEst ) != SUCCESSFUL_RETURN ) )
+                return RET_ESTIMATOR_STEP_FAILED;
+        }
+
+        if ( k > nSteps-10 )
+            err = acadoMax( err, acadoMax( fabs( xEst(0)-xTrue(0) ),fabs( xEst(1)-xTrue(1) ) ) );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int main( )
+{
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState p, v;
+    Control           u;
+
+
+    // DEFINE THE DAMPED OSCILLATOR AND ITS MEASUREMENT:
+    // -------------------------------------------------
+    DifferentialEquation f;
+
+    f << dot(p) == v;
+    f << dot(v) == -p - 0.2*v + u;
+
+    OutputFcn h;
+    h << p;
+
+    DynamicSystem dynamicSystem( f,h );
+
+    Matrix Q( 2,2 );
+    Q.setIdentity( );
+    Q *= 1.0e-6;
+
+    Matrix R( 1,1 );
+    R(0,0) = 1.0e-4;
+
+
+    // RUN BOTH FILTERS, ONCE DIRECTLY AND ONCE WITHIN A CONTROLLER:
+    // -------------------------------------------------------------
+    const char* name[2] = { "extended Kalman filter ", "unscented Kalman filter" };
+    KalmanFilterType type[2] = { EXTENDED_KALMAN_FILTER, UNSCENTED_KALMAN_FILTER };
+
+    int nFailed = 0;
+
+    for( int run1 = 0; run1 < 2; run1++ )
+    {
+        for( int run2 = 0; run2 < 2; run2++ )
+        {
+            KalmanFilter filter( dynamicSystem,Q,R,type[run1],INT_RK45,0.1 );
+
+            Matrix P0( 2,2 );
+            P0.setIdentity( );
+            filter.setCovariance( P0 );
+
+            double err;
+            returnValue returnvalue = estimate( filter,(BooleanType)( run2 == 1 ),err );
+
+            printf( "%s %s: max. estimation error %.3e\n", name[run1],
+                    ( run2 == 1 ) ? "(controller)" : "(direct)    ", err );
+
+            if ( ( returnvalue != SUCCESSFUL_RETURN ) || ( err > 1.0e-3 ) )
+                nFailed++;
+        }
+    }
+
+    if ( nFailed > 0 )
+    {
+        printf( "kalman filter check FAILED\n" );
+        return 1;
+    }
+
+    printf( "kalman filter check passed\n" );
+    return 0;
+}
+
+/* <<< end tutorial code <<< */
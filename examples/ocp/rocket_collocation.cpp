@@ -0,0 +1,144 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+  *    \file   examples/ocp/rocket_collocation.cpp
+  *    \author Boris Houska, Hans Joachim Ferreau
+  *    \date   2009
+  *
+  *    Solves a rocket problem (maximal final mass) with a collocation
+  *    discretization and compares the result to the one obtained by
+  *    multiple shooting. With an exact Hessian the collocation
+  *    discretization is not available and the algorithm falls back to
+  *    multiple shooting.
+  */
+
+#include <acado_optimal_control.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+returnValue solve( const DifferentialEquation &f,
+                   const DifferentialState &s, const DifferentialState &v,
+                   const DifferentialState &m, const Control &u,
+                   StateDiscretizationType discType,
+                   HessianApproximationMode hessMode,
+                   double &objective, VariablesGrid &states ){
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    OCP ocp( 0.0, 10.0, 20 );
+    ocp.minimizeMayerTerm( -m );
+    ocp.subjectTo( f );
+
+    ocp.subjectTo( AT_START, s ==  0.0 );
+    ocp.subjectTo( AT_START, v ==  0.0 );
+    ocp.subjectTo( AT_START, m ==  1.0 );
+    ocp.subjectTo( AT_END  , s == 10.0 );
+    ocp.subjectTo( AT_END  , v ==  0.0 );
+
+    ocp.subjectTo( -0.01 <= v <= 1.3 );
+
+
+    // SOLVE THE OCP WITH THE GIVEN DISCRETIZATION:
+    // --------------------------------------------
+    OptimizationAlgorithm algorithm(ocp);
+
+    algorithm.set( DISCRETIZATION_TYPE  , discType );
+    algorithm.set( HESSIAN_APPROXIMATION, hessMode );
+    algorithm.set( MAX_NUM_ITERATIONS   , 50       );
+    algorithm.set( KKT_TOLERANCE        , 1e-10    );
+    algorithm.set( PRINTLEVEL           , NONE     );
+
+    if( algorithm.solve() != SUCCESSFUL_RETURN )
+        return RET_OPTALG_SOLVE_FAILED;
+
+    algorithm.getDifferentialStates( states );
+    objective = algorithm.getObjectiveValue();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+double maxDeviation( const VariablesGrid &a, const VariablesGrid &b ){
+
+    double err = 0.0;
+    for( uint run1 = 0; run1 < a.getNumPoints(); run1++ )
+        for( uint run2 = 0; run2 < a.getNumValues(); run2++ )
+            err = acadoMax( err, fabs( a(run1,run2) - b(run1,run2) ) );
+    return err;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState     s,v,m;
+    Control               u    ;
+    DifferentialEquation  f    ;
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    f << dot(s) == v;
+    f << dot(v) == (u-0.02*v*v)/m;
+    f << dot(m) == -0.01*u*u;
+
+
+    // SOLVE BY MULTIPLE SHOOTING AND BY COLLOCATION:
+    // ----------------------------------------------
+    VariablesGrid xMS, xCOL, xEH;
+    double objMS, objCOL, objEH;
+
+    if( ( solve( f,s,v,m,u, MULTIPLE_SHOOTING, BLOCK_BFGS_UPDATE, objMS , xMS  ) != SUCCESSFUL_RETURN ) ||
+        ( solve( f,s,v,m,u, COLLOCATION      , BLOCK_BFGS_UPDATE, objCOL, xCOL ) != SUCCESSFUL_RETURN ) ||
+        // (collocation provides no second order sensitivities, hence
+        //  an exact Hessian falls back to multiple shooting)
+        ( solve( f,s,v,m,u, COLLOCATION      , EXACT_HESSIAN    , objEH , xEH  ) != SUCCESSFUL_RETURN ) ){
+        printf( "collocation check FAILED (no solution)\n" );
+        return 1;
+    }
+
+    printf( "objective (multiple shooting)          : %.10e\n", objMS  );
+    printf( "objective (collocation)                : %.10e\n", objCOL );
+    printf( "objective (collocation, exact Hessian) : %.10e\n", objEH  );
+
+    double errCOL = maxDeviation( xMS,xCOL );
+    double errEH  = maxDeviation( xMS,xEH  );
+
+    printf( "max. state deviation (collocation)     : %.3e\n", errCOL );
+    printf( "max. state deviation (exact Hessian)   : %.3e\n", errEH  );
+
+    if( ( errCOL > 1e-4 ) || ( errEH > 1e-6 ) ){
+        printf( "collocation check FAILED\n" );
+        return 1;
+    }
+
+    printf( "collocation check passed\n" );
+    return 0;
+}
+/* <<< end tutorial code <<< */
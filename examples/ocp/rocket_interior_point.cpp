@@ -0,0 +1,134 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+  *    \file   examples/ocp/rocket_interior_point.cpp
+  *    \author Boris Houska, Hans Joachim Ferreau
+  *    \date   2009
+  *
+  *    Solves a time-optimal rocket problem by the interior point method
+  *    (NLP_SOLUTION = INTERIOR_POINT_METHOD) and compares the result to
+  *    the one of the sequential quadratic programming method.
+  */
+
+#include <acado_optimal_control.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+returnValue solve( const DifferentialEquation &f,
+                   const DifferentialState &s, const DifferentialState &v,
+                   const DifferentialState &m, const Control &u,
+                   const Parameter &T,
+                   NLPsolutionMethods nlpSolution,
+                   double &endTime, VariablesGrid &states ){
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    OCP ocp( 0.0, T, 20 );
+    ocp.minimizeMayerTerm( T );
+    ocp.subjectTo( f );
+
+    ocp.subjectTo( AT_START, s ==  0.0 );
+    ocp.subjectTo( AT_START, v ==  0.0 );
+    ocp.subjectTo( AT_START, m ==  1.0 );
+    ocp.subjectTo( AT_END  , s == 10.0 );
+    ocp.subjectTo( AT_END  , v ==  0.0 );
+
+    ocp.subjectTo( -0.1 <= v <=  1.7 );
+    ocp.subjectTo( -1.1 <= u <=  1.1 );
+    ocp.subjectTo(  5.0 <= T <= 15.0 );
+
+
+    // SOLVE THE OCP WITH THE GIVEN NLP SOLVER:
+    // ----------------------------------------
+    OptimizationAlgorithm algorithm(ocp);
+
+    algorithm.set( NLP_SOLUTION   , nlpSolution );
+    algorithm.set( PRINTLEVEL     , NONE        );
+
+    // (the interior point method works on the sparse KKT system)
+    if ( nlpSolution == INTERIOR_POINT_METHOD )
+        algorithm.set( SPARSE_QP_SOLUTION, SPARSE_SOLVER );
+
+    if( algorithm.solve() != SUCCESSFUL_RETURN )
+        return RET_OPTALG_SOLVE_FAILED;
+
+    Vector p;
+    algorithm.getParameters( p );
+    algorithm.getDifferentialStates( states );
+    endTime = p(0);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState     s,v,m;
+    Control               u    ;
+    Parameter             T    ;
+    DifferentialEquation  f( 0.0, T );
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    f << dot(s) == v;
+    f << dot(v) == (u-0.2*v*v)/m;
+    f << dot(m) == -0.01*u*u;
+
+
+    // SOLVE BY SQP AND BY THE INTERIOR POINT METHOD:
+    // ----------------------------------------------
+    VariablesGrid xSQP, xIP;
+    double TSQP, TIP;
+
+    if( ( solve( f,s,v,m,u,T, SEQUENTIAL_CONVEX_PROGRAMMING, TSQP, xSQP ) != SUCCESSFUL_RETURN ) ||
+        ( solve( f,s,v,m,u,T, INTERIOR_POINT_METHOD        , TIP , xIP  ) != SUCCESSFUL_RETURN ) ){
+        printf( "interior point check FAILED (no solution)\n" );
+        return 1;
+    }
+
+    double err = 0.0;
+    for( uint run1 = 0; run1 < xSQP.getNumPoints(); run1++ )
+        for( uint run2 = 0; run2 < xSQP.getNumValues(); run2++ )
+            err = acadoMax( err, fabs( xSQP(run1,run2) - xIP(run1,run2) ) );
+
+    printf( "end time (SQP)                : %.10e\n", TSQP );
+    printf( "end time (interior point)     : %.10e\n", TIP  );
+    printf( "max. state deviation          : %.3e\n" , err  );
+
+    if( ( fabs( TSQP - TIP ) > 1e-4 ) || ( err > 1e-3 ) ){
+        printf( "interior point check FAILED\n" );
+        return 1;
+    }
+
+    printf( "interior point check passed\n" );
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,181 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/process/adaptive_step_count.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2010
+ *
+ *    Simulates an oscillator whose frequency is a control by three steps of
+ *    a Process with an adaptive integrator. The second step integrates a
+ *    faster oscillation and is split into several integration intervals by
+ *    the grid of a (zero) process disturbance, so the logged trajectories
+ *    of the steps differ in their number of points. Checks that each step
+ *    simulates up to its end time and ends in the analytic solution, and
+ *    that all logged trajectories can be obtained.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* simulates one step and compares the result with the analytic solution */
+BooleanType simulateStep(	Process& process,
+							double startTime,
+							double endTime,
+							double omega,
+							Vector& x,
+							uint& nPoints
+							)
+{
+	Vector u( 1 );
+	u(0) = omega*omega;
+
+	if ( process.step( startTime,endTime,u ) != SUCCESSFUL_RETURN )
+		return BT_FALSE;
+
+	VariablesGrid xSim;
+	process.getLast( LOG_SIMULATED_DIFFERENTIAL_STATES,xSim );
+
+	nPoints = xSim.getNumPoints( );
+
+	// analytic solution of  p'' + omega^2 p = 0
+	double tau = endTime-startTime;
+	double p = x(0)*cos( omega*tau ) + x(1)/omega*sin( omega*tau );
+	double v = -x(0)*omega*sin( omega*tau ) + x(1)*cos( omega*tau );
+
+	x(0) = p;
+	x(1) = v;
+
+	Vector xEnd = xSim.getLastVector( );
+
+	printf( "step [%.1f,%.1f]: %3d points, end time %.6f, error %.3e\n",
+			startTime,endTime,(int)nPoints,xSim.getLastTime( ),
+			acadoMax( fabs( xEnd(0)-p ),fabs( xEnd(1)-v ) ) );
+
+	if ( fabs( xSim.getLastTime( )-endTime ) > 1.0e-10 )
+		return BT_FALSE;
+
+	if ( acadoMax( fabs( xEnd(0)-p ),fabs( xEnd(1)-v ) ) > 1.0e-4 )
+		return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
+int main( )
+{
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+	DifferentialState p, v;
+	Control           w;
+	Disturbance       d;
+
+
+    // DEFINE AN OSCILLATOR WITH CONTROLLED FREQUENCY:
+    // -----------------------------------------------
+    DifferentialEquation f;
+
+	f << dot(p) == v;
+	f << dot(v) == -w*p + d;
+
+	OutputFcn g;
+	g << p;
+
+    DynamicSystem dynSys( f,g );
+
+
+    // SETUP THE PROCESS:
+    // ------------------
+	Process process( dynSys,INT_RK45 );
+
+	process.set( INTEGRATOR_TOLERANCE,1.0e-8 );
+	process.set( ABSOLUTE_TOLERANCE,1.0e-8 );
+
+	// the disturbance vanishes, but its grid is finer during the second step
+	Grid disturbanceGrid( 7 );
+	disturbanceGrid.setTime( 0,0.0  );
+	disturbanceGrid.setTime( 1,1.0  );
+	disturbanceGrid.setTime( 2,1.25 );
+	disturbanceGrid.setTime( 3,1.5  );
+	disturbanceGrid.setTime( 4,1.75 );
+	disturbanceGrid.setTime( 5,2.0  );
+	disturbanceGrid.setTime( 6,3.0  );
+
+	VariablesGrid disturbance( 1,disturbanceGrid );
+	disturbance.setZero( );
+	process.setProcessDisturbance( disturbance );
+
+	Vector x( 2 );
+	x(0) = 1.0;
+	x(1) = 0.0;
+
+	if ( process.init( 0.0,x ) != SUCCESSFUL_RETURN )
+	{
+		printf( "process logging check FAILED\n" );
+		return 1;
+	}
+
+
+    // SIMULATE A SLOW AND A FAST OSCILLATION:
+    // ---------------------------------------
+	uint nPoints[3];
+	BooleanType isOk = BT_TRUE;
+
+	if ( simulateStep( process,0.0,1.0, 1.0,x,nPoints[0] ) == BT_FALSE )
+		isOk = BT_FALSE;
+
+	if ( simulateStep( process,1.0,2.0,10.0,x,nPoints[1] ) == BT_FALSE )
+		isOk = BT_FALSE;
+
+	if ( simulateStep( process,2.0,3.0, 1.0,x,nPoints[2] ) == BT_FALSE )
+		isOk = BT_FALSE;
+
+	if ( ( nPoints[0] == nPoints[1] ) || ( nPoints[1] == nPoints[2] ) )
+		isOk = BT_FALSE;
+
+	// all logged trajectories one after another
+	VariablesGrid xAll;
+	if ( process.getAll( LOG_SIMULATED_DIFFERENTIAL_STATES,xAll ) != SUCCESSFUL_RETURN )
+		isOk = BT_FALSE;
+
+	if ( xAll.getNumPoints( ) != nPoints[0]+nPoints[1]+nPoints[2] )
+		isOk = BT_FALSE;
+
+	if ( isOk == BT_FALSE )
+	{
+		printf( "process logging check FAILED\n" );
+		return 1;
+	}
+
+	printf( "process logging check passed\n" );
+	return 0;
+}
+
+/* <<< end tutorial code <<< */
@@ -44,6 +44,7 @@
 // ---------------------
    struct cs_numeric ;
    struct cs_symbolic;
+   struct cs_sparse  ;
 
 
 
@@ -115,6 +116,19 @@ class ACADOcsparse : public SparseSolver{
 
 
 
+        /** Sets the matrix A from a dense, row-wise stored array and    \n
+         *  computes its LU decomposition. If all non-zero elements of   \n
+         *  A lie within the sparsity pattern of the previously set      \n
+         *  dense matrix, the symbolic analysis is reused and only the   \n
+         *  numerical factorization is recomputed.                       \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR               \n
+         */
+        virtual returnValue setDenseMatrix( const int &n, const double *A_ );
+
+
+
         /**  Solves the system  A*x = b  for the specified data.       \n
          *                                                             \n
          *   \return SUCCESSFUL_RETURN                                 \n
@@ -167,6 +181,14 @@ class ACADOcsparse : public SparseSolver{
     //
     protected:
 
+        /** Frees the symbolic and numeric factorization as well as the  \n
+         *  stored sparsity pattern.                                     \n
+         */
+        void clearFactorization( );
+
+        /** Frees the numeric factorization only. */
+        void clearNumericFactorization( );
+
 
 
     //
@@ -193,6 +215,10 @@ class ACADOcsparse : public SparseSolver{
     cs_symbolic         *S;          // pointer to a struct, which contains symbolic information about the matrix
     cs_numeric          *N;          // pointer to a struct, which contains numeric information about the matrix
 
+    cs_sparse           *D;          // the compressed matrix (only kept if set via setDenseMatrix)
+    int          *denseIdx;          // position of each entry of D in the dense matrix
+    int        *patternIdx;          // position of each dense entry in D (or -1)
+
 
     double             TOL;          // The required tolerance. (default 10^(-10))
     PrintLevel  printLevel;          // The PrintLevel.
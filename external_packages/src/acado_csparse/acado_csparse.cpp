@@ -57,6 +57,9 @@ ACADOcsparse::ACADOcsparse()
 	x = 0;
 	S = 0;
 	N = 0;
+	D = 0;
+	denseIdx = 0;
+	patternIdx = 0;
 	TOL = 1e-14;
 	printLevel = LOW;
 }
@@ -81,6 +84,9 @@ ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 
 	S = 0;
 	N = 0;
+	D = 0;
+	denseIdx = 0;
+	patternIdx = 0;
 
 	TOL = arg.TOL;
 	printLevel = arg.printLevel;
@@ -95,21 +101,7 @@ ACADOcsparse::~ACADOcsparse()
 	if (x != 0)
 		delete[] x;
 
-	if (S != 0)
-		cs_free(S);
-	if (N != 0)
-	{
-
-		if (N->L != 0)
-			cs_spfree(N->L);
-		if (N->U != 0)
-			cs_spfree(N->U);
-		if (N->pinv != 0)
-			free(N->pinv);
-		if (N->B != 0)
-			free(N->B);
-		free(N);
-	}
+	clearFactorization();
 }
 
 ACADOcsparse* ACADOcsparse::clone() const
@@ -128,6 +120,8 @@ returnValue ACADOcsparse::solve(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (S == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
 
 	// CASE: LU
 
@@ -149,6 +143,8 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (S == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
 
 	// CASE: LU
 
@@ -210,18 +206,112 @@ returnValue ACADOcsparse::setMatrix(double *A_)
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-	cs *C, *D;
+	clearFactorization();
+
+	cs *C, *E;
 	C = cs_spalloc(0, 0, 1, 1, 1);
 
 	for (run1 = 0; run1 < nDense; run1++)
 		cs_entry(C, index1[run1], index2[run1], A_[run1]);
 
+	E = cs_compress(C);
+	S = cs_sqr(order, E, 0);
+	N = cs_lu(E, S, TOL);
+
+	cs_spfree(C);
+	cs_spfree(E);
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ACADOcsparse::setDenseMatrix(const int &n, const double *A_)
+{
+	int run1, run2;
+	int order = 0;
+	const double ZERO_TOL = 1.e-12;
+
+	if (n <= 0)
+		return ACADOERROR(RET_INVALID_ARGUMENTS);
+
+	// REUSE THE SYMBOLIC ANALYSIS IF THE SPARSITY PATTERN IS COVERED:
+	// ----------------------------------------------------------------
+
+	if ((n == dim) && (D != 0) && (S != 0))
+	{
+		for (run1 = 0; run1 < n * n; run1++)
+			if ((patternIdx[run1] < 0) && (fabs(A_[run1]) > ZERO_TOL))
+				break;
+
+		if (run1 == n * n)
+		{
+			for (run1 = 0; run1 < nDense; run1++)
+				D->x[run1] = A_[denseIdx[run1]];
+
+			clearNumericFactorization();
+			N = cs_lu(D, S, TOL);
+
+			if (N == 0)
+				return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
+
+			return SUCCESSFUL_RETURN;
+		}
+	}
+
+	// OTHERWISE ANALYSE THE NEW SPARSITY PATTERN:
+	// -------------------------------------------
+
+	clearFactorization();
+
+	if (n != dim || x == 0)
+		setDimension(n);
+
+	nDense = 0;
+	for (run1 = 0; run1 < n * n; run1++)
+		if (fabs(A_[run1]) > ZERO_TOL)
+			nDense++;
+
+	if (nDense <= 0)
+		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+	cs *C = cs_spalloc(n, n, nDense, 1, 1);
+
+	for (run1 = 0; run1 < n; run1++)
+		for (run2 = 0; run2 < n; run2++)
+			if (fabs(A_[run1 * n + run2]) > ZERO_TOL)
+				cs_entry(C, run1, run2, A_[run1 * n + run2]);
+
 	D = cs_compress(C);
+	cs_spfree(C);
+
+	if (index1 != 0)
+		delete[] index1;
+	if (index2 != 0)
+		delete[] index2;
+
+	index1 = new int[nDense];
+	index2 = new int[nDense];
+	denseIdx = new int[nDense];
+	patternIdx = new int[n * n];
+
+	for (run1 = 0; run1 < n * n; run1++)
+		patternIdx[run1] = -1;
+
+	for (run2 = 0; run2 < n; run2++)
+	{
+		for (run1 = D->p[run2]; run1 < D->p[run2 + 1]; run1++)
+		{
+			index1[run1] = D->i[run1];
+			index2[run1] = run2;
+			denseIdx[run1] = D->i[run1] * n + run2;
+			patternIdx[denseIdx[run1]] = run1;
+		}
+	}
+
 	S = cs_sqr(order, D, 0);
 	N = cs_lu(D, S, TOL);
 
-	cs_spfree(C);
-	cs_spfree(D);
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -247,6 +337,38 @@ returnValue ACADOcsparse::setPrintLevel(PrintLevel printLevel_)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void ACADOcsparse::clearFactorization()
+{
+	clearNumericFactorization();
+
+	if (S != 0)
+		cs_sfree(S);
+	S = 0;
+
+	if (D != 0)
+		cs_spfree(D);
+	D = 0;
+
+	if (denseIdx != 0)
+		delete[] denseIdx;
+	denseIdx = 0;
+
+	if (patternIdx != 0)
+		delete[] patternIdx;
+	patternIdx = 0;
+}
+
+void ACADOcsparse::clearNumericFactorization()
+{
+	if (N != 0)
+		cs_nfree(N);
+	N = 0;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #else // __MATLAB__
@@ -298,6 +420,11 @@ returnValue ACADOcsparse::setMatrix( double *A_ )
 	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 }
 
+returnValue ACADOcsparse::setDenseMatrix( const int &n, const double *A_ )
+{
+	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+}
+
 returnValue ACADOcsparse::solveTranspose( double *b )
 {
 	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
@@ -318,6 +445,12 @@ returnValue ACADOcsparse::setPrintLevel( PrintLevel printLevel_ )
 	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 }
 
+void ACADOcsparse::clearFactorization( )
+{}
+
+void ACADOcsparse::clearNumericFactorization( )
+{}
+
 CLOSE_NAMESPACE_ACADO
 
 #endif // __MATLAB__
@@ -127,6 +127,16 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 
 	//printf( "nV: %d,  nC: %d \n",qp->getNV(),qp->getNC() );
 
+	/* the reduced-allocation feedback mode of real-time iterations always hotstarts */
+	int useRealtimeIterations = 0;
+	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
+
+	int reduceFeedbackAllocations = 0;
+	get( REDUCE_FEEDBACK_ALLOCATIONS,reduceFeedbackAllocations );
+
+	if ( (BooleanType)useRealtimeIterations == BT_FALSE )
+		reduceFeedbackAllocations = BT_FALSE;
+
 	if ( qp->isInitialised( ) == qpOASES::BT_FALSE )
 	{
 		returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
@@ -136,7 +146,7 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 		int performHotstart = 0;
 		get( HOTSTART_QP,performHotstart );
 
-		if ( (BooleanType)performHotstart == BT_TRUE )
+		if ( ( (BooleanType)performHotstart == BT_TRUE ) || ( (BooleanType)reduceFeedbackAllocations == BT_TRUE ) )
 		{
 			 returnvalue = qp->hotstart( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
 		}
@@ -147,7 +157,10 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 			returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
 		}
 	}
-	setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
+
+	/* in the reduced-allocation feedback mode, the number of iterations is logged by the CP solver */
+	if ( (BooleanType)reduceFeedbackAllocations == BT_FALSE )
+		setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
 
 //	acadoPrintf( "nEC: %d\n", qp->getNEC( ) );
 
@@ -211,20 +224,16 @@ returnValue QPsolver_qpOASES::getPrimalSolution( Vector& xOpt ) const
 	if ( qp == 0 )
 		return ACADOERROR( RET_INITIALIZE_FIRST );
 
+	/* write the solution directly into xOpt (only resized if necessary) */
 	uint dim = qp->getNV( );
-	double* xOptTmp = new double[dim];
 
-	if ( qp->getPrimalSolution( xOptTmp ) == qpOASES::SUCCESSFUL_RETURN )
-	{
-		xOpt.init( dim,xOptTmp );
-		delete[] xOptTmp;
+	if ( xOpt.getDim( ) != dim )
+		xOpt.init( dim );
+
+	if ( qp->getPrimalSolution( xOpt.getDoublePointer( ) ) == qpOASES::SUCCESSFUL_RETURN )
 		return SUCCESSFUL_RETURN;
-	}
 	else
-	{
-		delete[] xOptTmp;
 		return ACADOERROR( RET_QP_NOT_SOLVED );
-	}
 }
 
 
@@ -233,20 +242,16 @@ returnValue QPsolver_qpOASES::getDualSolution( Vector& yOpt ) const
 	if ( qp == 0 )
 		return ACADOERROR( RET_INITIALIZE_FIRST );
 
+	/* write the solution directly into yOpt (only resized if necessary) */
 	uint dim = qp->getNV( ) + qp->getNC( );
-	double* yOptTmp = new double[dim];
 
-	if ( qp->getDualSolution( yOptTmp ) == qpOASES::SUCCESSFUL_RETURN )
-	{
-		yOpt.init( dim,yOptTmp );
-		delete[] yOptTmp;
+	if ( yOpt.getDim( ) != dim )
+		yOpt.init( dim );
+
+	if ( qp->getDualSolution( yOpt.getDoublePointer( ) ) == qpOASES::SUCCESSFUL_RETURN )
 		return SUCCESSFUL_RETURN;
-	}
 	else
-	{
-		delete[] yOptTmp;
 		return ACADOERROR( RET_QP_NOT_SOLVED );
-	}
 }
 
 
@@ -204,6 +204,27 @@ class ExportArithmeticStatement : public ExportStatement
 										int _precision = 16
 										) const;
 
+		/** Exports source code for a large multiplication to given file.
+		 *  The product is computed in register-blocked tiles: each tile of
+		 *  the left-hand side is accumulated in local variables, which are
+		 *  written back only once. Blocks of rows (columns) of the first
+		 *  (second) factor that are known to be zero are skipped.
+		 *
+		 *	@param[in] file				Name of file to be used to export statement.
+		 *	@param[in] transposeRhs1	Flag indicating whether rhs1 shall be transposed.
+		 *	@param[in] _assignString	String of the assignment operation ("=", "+=" or "-=").
+		 *	@param[in] _sign			Sign of the product ("+" or "-").
+		 *	@param[in] _realString		String to be used to declare real variables.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCodeMultiplyTiled(	FILE* file,
+												BooleanType transposeRhs1,
+												const String& _assignString,
+												const String& _sign,
+												const String& _realString = "real_t"
+												) const;
+
 		/** Exports source code for an assignment to given file. 
 		 *  Its appearance can be adjusted by various options.
 		 *
@@ -135,6 +135,16 @@ class BandedCPsolver: public AlgorithmicBase
 		virtual returnValue unfreezeCondensing( );
 
 
+		/** Sets the barrier parameter used by an interior point NLP method \n
+		 *  (only supported by solvers working on the sparse KKT system).   \n
+		 *                                                                  \n
+		 *  \return SUCCESSFUL_RETURN                                       \n
+		 *          RET_NOT_IMPLEMENTED_IN_BASE_CLASS                       \n
+		 */
+		virtual returnValue setBarrierParameter(	double mu
+													);
+
+
 
 	protected:
 
@@ -175,6 +175,20 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         virtual returnValue solveCPsubproblem( );
 
 
+        /** Returns whether the QP statistics of a feedback step are logged \n
+         *  only by finalizeSolve( ), i.e. whether real-time iterations use  \n
+         *  the reduced-allocation feedback mode                            \n
+         *  (REDUCE_FEEDBACK_ALLOCATIONS).                                  \n
+         */
+        BooleanType isLoggingDeferred( ) const;
+
+        /** Writes the statistics of the last QP solution to the logs. \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         */
+        returnValue logQPstatistics( );
+
+
 
         /** Checks whether the Hessian is positive definite and projects \n
          *  the Hessian based on a heuristic damping factor. If this     \n
@@ -274,6 +288,10 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 
 		Vector deltaX;
 		Vector deltaP;
+
+		double      timeQP;           /**< time for solving the last QP              */
+		double      timeRelaxedQP;    /**< time for solving the last relaxed QP      */
+		BooleanType isQPrelaxed;      /**< whether the last QP had to be relaxed     */
 };
 
 
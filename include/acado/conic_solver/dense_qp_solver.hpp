@@ -233,6 +233,9 @@ class DenseQPsolver : public DenseCPsolver
 
         QPStatus qpStatus;
         int numberOfSteps;
+
+        Vector xOptWorkspace;   /**< Workspace for the primal solution of the last QP. */
+        Vector yOptWorkspace;   /**< Workspace for the dual solution of the last QP.   */
 };
 
 
@@ -0,0 +1,358 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/conic_solver/sparse_based_cp_solver.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ */
+
+
+#ifndef ACADO_TOOLKIT_SPARSE_BASED_CP_SOLVER_HPP
+#define ACADO_TOOLKIT_SPARSE_BASED_CP_SOLVER_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/conic_solver/banded_cp_solver.hpp>
+#include <acado/sparse_solver/sparse_solver.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves banded conic programs arising in optimal control without condensing.
+ *
+ *	\ingroup NumericalAlgorithm
+ *
+ *  The class sparse based CP solver is a special solver for band structured
+ *  quadratic programs that keeps the states as optimization variables.
+ *  The QP is solved by a primal-dual (Mehrotra predictor-corrector) interior
+ *  point method. The variables and the multipliers of the dynamic constraints
+ *  are ordered stage by stage, such that the KKT matrix of each iteration is
+ *  banded and its sparse LU factorization costs O(N) operations for N
+ *  shooting intervals (condensing costs O(N^2) to O(N^3) operations).
+ *
+ *  \author Boris Houska, Hans Joachim Ferreau
+ */
+
+class SparseBasedCPsolver: public BandedCPsolver {
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        SparseBasedCPsolver( );
+
+        SparseBasedCPsolver(	UserInteraction* _userInteraction,
+								uint nConstraints_,
+								const Vector& blockDims_
+								);
+
+        /** Copy constructor (deep copy). */
+        SparseBasedCPsolver( const SparseBasedCPsolver& rhs );
+
+        /** Destructor. */
+        virtual ~SparseBasedCPsolver( );
+
+        /** Assignment operator (deep copy). */
+        SparseBasedCPsolver& operator=( const SparseBasedCPsolver& rhs );
+
+
+        /** Clone constructor (deep copy). */
+        virtual BandedCPsolver* clone() const;
+
+
+        /** initializes the banded conic solver */
+        virtual returnValue init( const OCPiterate &iter_ );
+
+
+        /** Assembles the sparse QP data of a given banded conic program. */
+        virtual returnValue prepareSolve(	BandedCP& cp
+											);
+
+		/** Solves a given banded conic program (in feedback mode, if real-time \n
+         *  parameters have been set).                                          \n
+         *                                                                      \n
+         *  \return SUCCESSFUL_RETURN   (if successful)                         \n
+         *          RET_BANDED_CP_SOLUTION_FAILED                               \n
+         */
+        virtual returnValue solve(	BandedCP& cp
+									);
+
+        /** Writes the solution of the sparse QP back into the banded conic program. */
+        virtual returnValue finalizeSolve(	BandedCP& cp
+											);
+
+
+		inline uint getNX( ) const;
+		inline uint getNXA( ) const;
+		inline uint getNP( ) const;
+		inline uint getNU( ) const;
+		inline uint getNW( ) const;
+
+		inline uint getNC( ) const;
+
+		inline uint getNumPoints( ) const;
+
+		/** Returns the number of interior point iterations of the last solve. */
+		inline int getNumberOfIterations( ) const;
+
+
+		virtual returnValue getParameters        ( Vector        &p_  ) const;
+		virtual returnValue getFirstControl      ( Vector        &u0_ ) const;
+
+
+		virtual returnValue setRealTimeParameters(	const Vector& DeltaX,
+													const Vector& DeltaP = emptyConstVector
+													);
+
+		inline BooleanType areRealTimeParametersDefined( ) const;
+
+
+		virtual returnValue freezeCondensing( );
+
+		virtual returnValue unfreezeCondensing( );
+
+
+		/** Sets the barrier parameter used by an interior point NLP method. \n
+		 *  For mu > 0, the QP iterations stop close to the central path     \n
+		 *  with complementarity mu; for mu >= 0, each solve is warm-started \n
+		 *  from the slacks and multipliers of the previous one. A negative  \n
+		 *  value (default) solves each QP from scratch to full accuracy.    \n
+		 *                                                                   \n
+		 *  \return SUCCESSFUL_RETURN                                        \n
+		 */
+		virtual returnValue setBarrierParameter(	double mu
+													);
+
+		inline double getBarrierParameter( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Sets all arrays of the sparse QP and the KKT system to zero   \n
+         *  pointers (without freeing them).                                \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        returnValue initializeArrays( );
+
+        /** Frees all arrays of the sparse QP and the KKT system.         \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        returnValue clear( );
+
+        /** Assigns the positions of the (sparse) QP variables to the blocks \n
+         *  of the banded conic program.                                     \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        returnValue setupVariables( );
+
+        /** Returns the dimension of the given block column of the banded CP. */
+        uint getBlockDim( uint idx ) const;
+
+        /** Returns the first QP variable (or -1) and the dimension of the \n
+         *  given bound block of the banded CP.                             \n
+         */
+        int getBoundOffset( uint idx, uint &dim ) const;
+
+        /** Extracts Hessian, gradient, equalities and inequalities of the  \n
+         *  sparse QP from the banded conic program.                         \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_QP_HAS_INCONSISTENT_BOUNDS                           \n
+         */
+        returnValue setupQPdata(	BandedCP& cp
+									);
+
+        /** Adds the bounds on the initial state and on the parameters,   \n
+         *  which are fixed to the real-time parameters if these are set.   \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_QP_HAS_INCONSISTENT_BOUNDS                           \n
+         */
+        returnValue setupInitialValueRows( );
+
+        /** Adds a row  lb <= a'z <= ub  with the multiplier index dualIdx   \n
+         *  either as equality or as (up to two) inequalities.                \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_QP_HAS_INCONSISTENT_BOUNDS                           \n
+         */
+        returnValue addRow(	uint nEntries,
+							const uint* idx,
+							const double* val,
+							double lb,
+							double ub,
+							uint dualIdx
+							);
+
+        /** Adds the inequality  sign*a'z >= rhs  with the multiplier index  \n
+         *  dualIdx.                                                         \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        returnValue addInequality(	uint nEntries,
+									const uint* idx,
+									const double* val,
+									double sign,
+									double rhs,
+									uint dualIdx
+									);
+
+        /** Computes the ordering of the rows and columns of the KKT matrix. */
+        returnValue setupKKTordering( );
+
+        /** Determines the (unique) entries of the KKT matrix, which keep  \n
+         *  their positions during all iterations of a QP solution, and    \n
+         *  passes them to the sparse solver.                               \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        returnValue setupKKTpattern( );
+
+        /** Assembles and factorizes the KKT matrix of the current iterate. */
+        returnValue factorizeKKT(	const Vector& sigma,
+									double regularisation
+									);
+
+        /** Solves the QP by a primal-dual interior point method using not \n
+         *  more than the given number of iterations.                       \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         *          RET_QP_SOLUTION_REACHED_LIMIT                           \n
+         *          RET_QP_SOLUTION_FAILED                                  \n
+         */
+        returnValue solveQP(	uint maxIter
+								);
+
+        /** Writes the primal and dual solution into the banded CP. */
+        returnValue expand(		BandedCP& cp
+								);
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        OCPiterate iter;
+        Vector blockDims;
+        uint nConstraints;
+
+        // LAYOUT OF THE SPARSE QP:
+        // ----------------------------------------------------------------------
+        uint    nV;                          /**< number of QP variables                      */
+        int*    blockOffset;                 /**< first QP variable of each of the 5N blocks  */
+        uint*   varStage;                    /**< stage of each QP variable (N: parameters)   */
+        uint    maxRowLength;                /**< maximum number of entries of a QP row       */
+        uint*   rowIdx;                      /**< workspace for a single row                  */
+        double* rowVal;
+
+
+        // SPARSE QP DATA:
+        // ----------------------------------------------------------------------
+        uint    nH;                          /**< Hessian entries (triplets)                  */
+        uint    maxH;
+        uint*   hRow;
+        uint*   hCol;
+        double* hVal;
+        Vector  g;                           /**< objective gradient                          */
+
+        uint    nE;                          /**< equalities  E z = e  (row-wise)             */
+        uint    maxE;
+        uint    maxEnz;
+        uint*   eqStart;
+        uint*   eqIdx;
+        double* eqVal;
+        double* eqRhs;
+        uint*   eqDual;                      /**< multiplier index of each equality           */
+        uint*   eqStage;                     /**< stage of each equality                      */
+
+        uint    nI;                          /**< inequalities  A z >= b  (row-wise)          */
+        uint    maxI;
+        uint    maxInz;
+        uint*   inStart;
+        uint*   inIdx;
+        double* inVal;
+        double* inRhs;
+        uint*   inDual;                      /**< multiplier index of each inequality         */
+        double* inSign;                      /**< +1 (lower) or -1 (upper) side               */
+
+        uint nEqPrepared;                    /**< rows not depending on real-time parameters  */
+        uint nInPrepared;
+
+        Vector  initialLb;                   /**< bounds on the initial state and parameters  */
+        Vector  initialUb;
+
+
+        // KKT SYSTEM:
+        // ----------------------------------------------------------------------
+        uint*   kktPos;                      /**< KKT position of variables and equalities    */
+        uint    nKKTterms;                   /**< number of terms summed up in the KKT matrix */
+        uint*   kktMap;                      /**< KKT entry each term is added to             */
+        uint    nKKTentries;                 /**< number of (unique) KKT entries              */
+        int*    kktRow;
+        int*    kktCol;
+        double* kktVal;
+        SparseSolver* kktSolver;             /**< sparse LU factorization of the KKT matrix   */
+
+
+        // SOLUTION:
+        // ----------------------------------------------------------------------
+        Vector  z;                           /**< primal solution                             */
+        Vector  y;                           /**< multipliers of the equalities               */
+        Vector  s;                           /**< slacks of the inequalities                  */
+        Vector  lambda;                      /**< multipliers of the inequalities             */
+        int     numberOfIterations;
+        double  barrierParameter;            /**< central path target (< 0: solve to optimality) */
+
+		Vector deltaX;
+		Vector deltaP;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/conic_solver/sparse_based_cp_solver.ipp>
+
+
+#endif  // ACADO_TOOLKIT_SPARSE_BASED_CP_SOLVER_HPP
+
+/*
+ *  end of file
+ */
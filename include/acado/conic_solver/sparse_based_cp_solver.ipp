@@ -24,82 +24,80 @@
 
 
 /**
- *    \file src/nlp_solver/ip_method.cpp
+ *    \file include/acado/conic_solver/sparse_based_cp_solver.ipp
  *    \author Boris Houska, Hans Joachim Ferreau
- *
  */
 
 
-#include <nlp_solver/ip_method.hpp>
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
 
 
 
 BEGIN_NAMESPACE_ACADO
 
 
-//
-// PUBLIC MEMBER FUNCTIONS:
-//
-
-IPmethod::IPmethod( ) : NLPsolver( )
+inline uint SparseBasedCPsolver::getNX( ) const
 {
+	return iter.getNX();
 }
 
 
-IPmethod::IPmethod( UserInteraction* _userInteraction ) : NLPsolver( _userInteraction )
+inline uint SparseBasedCPsolver::getNXA( ) const
 {
+	return iter.getNXA();
 }
 
 
-IPmethod::IPmethod( const NLP& nlp_ ) : NLPsolver()
+inline uint SparseBasedCPsolver::getNP( ) const
 {
+	return iter.getNP();
 }
 
-
-IPmethod::IPmethod( const IPmethod& rhs ) : NLPsolver( )
+inline uint SparseBasedCPsolver::getNU( ) const
 {
+	return iter.getNU();
 }
 
 
-IPmethod::~IPmethod( )
+inline uint SparseBasedCPsolver::getNW( ) const
 {
+	return iter.getNW();
 }
 
 
-IPmethod& IPmethod::operator=( const IPmethod& rhs )
+inline uint SparseBasedCPsolver::getNC( ) const
 {
-	if ( this != &rhs )
-	{
-		NLPsolver::operator=( rhs );
-    }
-	return *this;
+	return nConstraints;
 }
 
 
-returnValue IPmethod::init(VariablesGrid    *xd,
-                                 VariablesGrid    *xa,
-                                 VariablesGrid    *p,
-                                 VariablesGrid    *u,
-                                 VariablesGrid    *w   )
+inline uint SparseBasedCPsolver::getNumPoints( ) const
 {
-    return THROWERROR( RET_NOT_IMPLEMENTED_YET );
+	return iter.getNumPoints();
 }
 
 
-returnValue IPmethod::start( int maxNumSteps )
+inline int SparseBasedCPsolver::getNumberOfIterations( ) const
 {
-	return THROWERROR( RET_NOT_IMPLEMENTED_YET );
+	return numberOfIterations;
 }
 
 
+inline double SparseBasedCPsolver::getBarrierParameter( ) const
+{
+	return barrierParameter;
+}
 
 
-//
-// PROTECTED MEMBER FUNCTIONS:
-//
-
-
-
+inline BooleanType SparseBasedCPsolver::areRealTimeParametersDefined( ) const
+{
+	if ( ( deltaX.isEmpty( ) == BT_TRUE ) && ( deltaP.isEmpty( ) == BT_TRUE ) )
+		return BT_FALSE;
+	else
+		return BT_TRUE;
+}
 
 
 CLOSE_NAMESPACE_ACADO
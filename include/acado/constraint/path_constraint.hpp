@@ -128,8 +128,26 @@ class PathConstraint : public ConstraintElement{
 
 		inline BooleanType isBoxConstraint( ) const;
 
+
+	protected:
+
+        /** Evaluates the constraint at all grid points of the last     \n
+          * (batched) evaluation again, storing the intermediate results \n
+          * that are needed for second order automatic differentiation   \n
+          * (first order derivatives are based on the batch trace).      \n
+          *                                                              \n
+          * \return SUCESSFUL_RETURN                                     \n
+          */
+        returnValue bufferIntermediateResults( );
+
+
 	protected:
 
+        Matrix              zBatch;          /**< evaluation points of all grid points (one column each) */
+        Matrix              fBatch;          /**< constraint values at all grid points (one column each) */
+        EvaluationWorkspace batchWorkspace;  /**< trace of the last batched evaluation                  */
+        BooleanType         hasBatchTrace;   /**< whether the last evaluation was batched               */
+        BooleanType         needsBuffering;  /**< whether the AD buffers of the tree are out of date    */
 };
 
 
@@ -117,6 +117,16 @@ class Controller : public SimulationBlock
         Controller& operator=(	const Controller& rhs
 								);
 
+		/** Returns a copy of the controller that owns its own copies of the
+		 *	control law, the estimator and the reference trajectory. In contrast
+		 *	to the copy constructor, the copy does not share these components
+		 *	with this controller, hence both can be run independently (e.g. within
+		 *	different members of a simulation ensemble).
+		 *
+		 *	\return Pointer to independent copy of the controller (to be deleted by the caller)
+		 */
+		Controller* clone( ) const;
+
 
 		/** Assigns new control law to be used for computing control/parameter signals.
 		 *
@@ -425,6 +435,7 @@ class Controller : public SimulationBlock
 		ReferenceTrajectory* referenceTrajectory;	/**< Reference trajectory to be used by the control law. */
 		
 		BooleanType isEnabled;						/**< Flag indicating whether controller is enabled or not. */
+		BooleanType ownsComponents;					/**< Flag indicating whether control law, estimator and reference trajectory are deleted by the controller. */
 		
 		RealClock controlLawClock;					/**< Clock required to determine runtime of control law. */
 };
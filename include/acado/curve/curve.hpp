@@ -202,6 +202,24 @@ class Curve{
         returnValue evaluate( double t, double *result ) const;
 
 
+        /** Evaluates the curve at a given time point like the routine above, but  \n
+         *  searches the interval containing  t  starting from the interval given   \n
+         *  by the cursor (see Grid::getFloorIndex). Evaluating the curve at a      \n
+         *  sequence of increasing time points thus costs O(1) per time point.      \n
+         *                                                                          \n
+         *  \param  t      (input) the time at which the curve should be evaluated. \n
+         *  \param  result (output) the result of the evaluation.                   \n
+         *  \param  cursor (input/output) interval index of the previous evaluation \n
+         *                 (0 initially).                                           \n
+         *                                                                          \n
+         *  \return SUCCESSFUL_RETURN           (if the evaluation was successful.) \n
+         *          RET_INVALID_ARGUMENTS       (if the double* result is NULL.)    \n
+         *          RET_INVALID_TIME_POINT      (if the time point t is out of range.) \n
+         *          RET_MEMBER_NOT_INITIALISED  (if the curve is empty)             \n
+         */
+        returnValue evaluate( double t, double *result, uint &cursor ) const;
+
+
          /** Evaluates the curve at a given time point. This routine will store            \n
           *  the result of the evaluation into the Vector &result.                         \n
           *                                                                                \n
@@ -236,11 +254,30 @@ class Curve{
          returnValue evaluate( double tStart, double tEnd, VariablesGrid &result ) const;
 
 
+         /** Evaluates the curve at a given time interval like the routine above, but      \n
+          *  starts the interval lookup at the cursor (see Grid::getFloorIndex). Callers    \n
+          *  evaluating consecutive time intervals can thus keep the cursor between calls.  \n
+          *                                                                                \n
+          *  \param  tStart (input) the start time at which the curve should be evaluated. \n
+          *  \param  tEnd   (input) the end time at which the curve should be evaluated.   \n
+          *  \param  result (output) the result of the evaluation.                         \n
+          *  \param  cursor (input/output) interval index of the previous evaluation       \n
+          *                 (0 initially).                                                 \n
+          *                                                                                \n
+          *  \return SUCCESSFUL_RETURN              (if the evaluation was successful.)    \n
+          *          RET_INVALID_TIME_POINT         (if the time point t is out of domain.)\n
+          *          RET_MEMBER_NOT_INITIALISED     (if the curve is empty)                \n
+          */
+         returnValue evaluate( double tStart, double tEnd, VariablesGrid &result, uint &cursor ) const;
+
+
 
          /** Evaluates the curve at specified grid points and stores the result in form of a             \n
           *  VariablesGrid. Note that all time points of the grid, at which the curve should be          \n
           *  evaluated, must be contained in the domain of the curve. This domain can be                 \n 
           *  obtained with the routine  "getTimeDomain( double tStart, double tEnd )".                 \n
+          *  As the grid points are ordered, the curve intervals are looked up incrementally, i.e.        \n
+          *  the costs are linear in the number of grid points and curve intervals.                       \n
           *                                                                                              \n
           *  \param  discretizationGrid  (input) the grid points at which the curve should be evaluated. \n
           *  \param  result              (output) the result of the evaluation.                          \n
@@ -253,6 +290,21 @@ class Curve{
          returnValue discretize( const Grid &discretizationGrid, VariablesGrid &result ) const;
 
 
+         /** Evaluates the curve at specified grid points like the routine above, but      \n
+          *  starts the interval lookup at the cursor (see Grid::getFloorIndex).            \n
+          *                                                                                \n
+          *  \param  discretizationGrid  (input) the grid points at which the curve should be evaluated. \n
+          *  \param  result              (output) the result of the evaluation.            \n
+          *  \param  cursor              (input/output) interval index of the previous     \n
+          *                              evaluation (0 initially).                         \n
+          *                                                                                \n
+          *  \return SUCCESSFUL_RETURN           (if the evaluation was successful.)       \n
+          *          RET_INVALID_TIME_POINT      (if at least one of the grid points is out of domain.) \n
+          *          RET_MEMBER_NOT_INITIALISED  (if the curve is empty)                   \n
+          */
+         returnValue discretize( const Grid &discretizationGrid, VariablesGrid &result, uint &cursor ) const;
+
+
 
          /** Returns the time domain of the curve, i.e. the time points tStart and tEnd between    \n
           *  which the curve is defined.                                                           \n
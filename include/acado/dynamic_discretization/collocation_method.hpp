@@ -47,6 +47,25 @@ BEGIN_NAMESPACE_ACADO
  *  The class CollocationMethod allows to discretize a DifferentialEquation 
  *	for use in optimal control algorithms by means of a collocation scheme.
  *
+ *	Each interval of the union grid is divided into a fixed number of steps
+ *	(option NUM_INTEGRATOR_STEPS) and the states at the collocation points of
+ *	a Radau IIA or Gauss-Legendre scheme (option COLLOCATION_SCHEME) are
+ *	determined by Newton's method. The collocation equations are eliminated
+ *	interval by interval, such that the discretization provides the same
+ *	banded block structure as multiple shooting: the residuum and the
+ *	sensitivities of each interval only depend on the variables of this
+ *	interval and are evaluated independently (and concurrently, if the option
+ *	DISCRETIZATION_THREADS is larger than one and OpenMP is available). The
+ *	sensitivities are exact derivatives of the discrete collocation map
+ *	obtained by the implicit function theorem.
+ *
+ *	In contrast to the adaptive integrators of the ShootingMethod, the step
+ *	size is fixed, which makes the method well suited for stiff systems.
+ *	Only explicit ordinary differential equations are supported and no second
+ *	order sensitivities are provided, i.e. DAEs, implicit or discretized
+ *	differential equations, stage transitions and exact Hessians are rejected
+ *	with RET_NOT_IMPLEMENTED_YET.
+ *
  *	\author Boris Houska, Hans Joachim Ferreau
  */
 class CollocationMethod : public DynamicDiscretization
@@ -78,12 +97,12 @@ public:
 
 
 
-        /** Set the Differential Equations stage by stage. */
+        /** Set the Differential Equations stage by stage. The integrator type is ignored. */
         virtual returnValue addStage( const DynamicSystem  &dynamicSystem_,
                                       const Grid           &stageIntervals,
                                       const IntegratorType &integratorType_ = INT_UNKNOWN );
 
-		/** Set the Transition stages. */
+		/** Set the Transition stages (not supported). */
 		virtual returnValue addTransition( const Transition& transition_ );
 
 
@@ -116,7 +135,8 @@ public:
     virtual returnValue evaluateSensitivities( );
 
 
-		/** Evaluates the sensitivities.                                      \n
+		/** Evaluates the sensitivities (the same as evaluateSensitivities(), \n
+		*  as the collocation method provides exact sensitivities anyway).   \n
 		*                                                                    \n
 		*  \return SUCCESSFUL_RETURN                                         \n
 		*          RET_NOT_FROZEN                                            \n
@@ -124,10 +144,9 @@ public:
 		virtual returnValue evaluateSensitivitiesLifted( );
 
 
-    /** Evaluates the sensitivities and the hessian.  \n
+    /** Evaluates the sensitivities and the hessian (not supported). \n
      *                                                \n
-     *  \return SUCCESSFUL_RETURN                     \n
-     *          RET_NOT_FROZEN                        \n
+     *  \return RET_NOT_IMPLEMENTED_YET               \n
      */
     virtual returnValue evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian );
 
@@ -142,7 +161,77 @@ public:
 
 protected:
 
+    returnValue deleteAll( );
+
+    void copy( const CollocationMethod &arg );
+
+    /** Sets up the Butcher tableau of the given collocation scheme. */
+    returnValue setupScheme( CollocationScheme scheme_ );
+
+    /** Returns the number of collocation steps per interval. */
+    int getNumSteps( ) const;
+
+    /** Writes the differential states (in the order of the differential    \n
+     *  equation) and the time into the variable array of the given interval. \n
+     */
+    void setupVariables( int idx, double t, const double *xLocal, double *z ) const;
+
+    /** Solves the collocation equations of the given interval for the    \n
+     *  initial value x and overwrites x by the state at the end of the     \n
+     *  interval. The states at all collocation points are stored for the  \n
+     *  computation of sensitivities.                                       \n
+     *                                                                      \n
+     *  \return SUCCESSFUL_RETURN                                           \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                              \n
+     */
+    returnValue solveInterval( int idx, double t0, double t1, Vector &x,
+                               const Vector &p, const Vector &u, const Vector &w );
+
+    /** Evaluates the Jacobians of the right-hand side at all collocation  \n
+     *  points of the given step and factorizes the Newton matrix           \n
+     *  I - h*(A x J) of the collocation equations.                         \n
+     */
+    returnValue factorizeStep( int idx, int step, double h, double *M, int *pivot );
+
+    /** Computes the directional derivatives of the state at the end of the    \n
+     *  given interval with respect to x, p, u and w in the directions given by \n
+     *  the columns of the seeds dX, dP, dU and dW, respectively (an empty seed \n
+     *  results in an empty derivative). The Newton matrices of all steps are   \n
+     *  factorized only once for all directions.                                \n
+     *                                                                          \n
+     *  \return SUCCESSFUL_RETURN                                               \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                                  \n
+     */
+    returnValue differentiateForward( int idx,
+                                      const Matrix &dX,
+                                      const Matrix &dP,
+                                      const Matrix &dU,
+                                      const Matrix &dW,
+                                            Matrix &DX,
+                                            Matrix &DP,
+                                            Matrix &DU,
+                                            Matrix &DW  );
+
+    /** Writes the differential states at the collocation steps and the   \n
+     *  controls to the logging object.                                    \n
+     */
+    returnValue logTrajectory( const OCPiterate &iter );
+
+
+protected:
+
+    DifferentialEquation **rhs;   /**< copies of the differential equation (one for each interval) */
+
+    Matrix  A;                    /**< Butcher tableau of the collocation scheme */
+    Vector  b;
+    Vector  c;
+    int     numStages;            /**< number of collocation points per step     */
 
+    Matrix *stepStates;           /**< states at the beginning of each step (one row per step)  */
+    Matrix *stageStates;          /**< states at the collocation points (one row per point)    */
+    Vector *pInterval;            /**< parameters of each interval  */
+    Vector *uInterval;            /**< controls of each interval    */
+    Vector *wInterval;            /**< disturbances of each interval */
 };
 
 
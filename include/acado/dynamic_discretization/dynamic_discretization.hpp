@@ -258,6 +258,16 @@ class DynamicDiscretization : public AlgorithmicBase
 
         uint getNumEvaluationPoints() const;
 
+        /** Returns whether the initial values of all intervals are known before  \n
+         *  evaluating, i.e. whether the intervals can be evaluated               \n
+         *  independently. This is not the case in simulation mode or if the      \n
+         *  differential or algebraic states are auto-initialized at a node.      \n
+         */
+        BooleanType areIntervalsDecoupled( const OCPiterate &iter ) const;
+
+        /** Returns the number of threads requested via DISCRETIZATION_THREADS. */
+        int getNumThreads( ) const;
+
 
 	//
 	// PROTECTED MEMBERS:
@@ -89,6 +89,18 @@ class ShootingMethod : public DynamicDiscretization
         /** Deletes all stages and transitions and resets the DynamicDiscretization. */
         virtual returnValue clear();
 
+        /** Moves a discretization consisting of a single stage onto new
+         *  stage intervals with the same number of intervals. The integrators
+         *  are kept alive (but unfrozen and without seeds), such that repeated
+         *  simulations of the same stage do not need to call clear() and
+         *  addStage() each time.
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_INVALID_ARGUMENTS (without error message) if the
+         *          discretization can not be moved.
+         */
+        virtual returnValue moveStage( const Grid &stageIntervals );
+
 
 
 		/** Evaluates the discretized DifferentialEquation at a specified     \n
@@ -159,6 +171,42 @@ class ShootingMethod : public DynamicDiscretization
             returnValue allocateIntegrator( uint idx, IntegratorType type_ );
 
 
+            /** Passes the current options to the integrator of the given interval and  \n
+             *  determines the grid on which this integrator has to be evaluated.        \n
+             *                                                                           \n
+             *  \return SUCCESSFUL_RETURN                                                \n
+             */
+            returnValue prepareInterval( uint                idx           ,
+                                         const OCPiterate   &iter          ,
+                                         Grid               &evaluationGrid,
+                                         Grid               &outputGrid      );
+
+            /** Writes the integration result of the given interval back into the     \n
+             *  iterate and the residuum (the vectors x, xa, p, u and w are updated   \n
+             *  in the same way as in a sequential sweep over all intervals).         \n
+             *                                                                        \n
+             *  \return SUCCESSFUL_RETURN                                             \n
+             */
+            returnValue mergeInterval( uint                idx           ,
+                                       OCPiterate         &iter          ,
+                                       const Grid         &evaluationGrid,
+                                       const Grid         &outputGrid    ,
+                                       Vector             &x             ,
+                                       Vector             &xa            ,
+                                       Vector             &p             ,
+                                       Vector             &u             ,
+                                       Vector             &w               );
+
+            /** Integrates all intervals concurrently using the given number of       \n
+             *  threads. The results are merged sequentially in the order of the      \n
+             *  intervals, i.e. the result does not depend on the number of threads.  \n
+             *                                                                        \n
+             *  \return SUCCESSFUL_RETURN                                             \n
+             *          RET_UNABLE_TO_INTEGRATE_SYSTEM                                \n
+             */
+            returnValue evaluateParallel( OCPiterate &iter, int nThreads );
+
+
             returnValue differentiateBackward( const int    &idx ,
                                                const Matrix &seed,
                                                      Matrix &Gx  ,
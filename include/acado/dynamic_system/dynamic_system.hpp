@@ -174,6 +174,16 @@ class DynamicSystem
 		inline const OutputFcn& getOutputFcn(	uint stageIdx = 0
 										) const;
 
+		/** Returns output function at given stage (writable, e.g. for
+		 *	evaluating it without copying it first).
+		 *
+		 *	@param[in]  stageIdx	Index of stage.
+		 *
+		 *	\return Output function at given stage
+		 */
+		inline OutputFcn& getOutputFcn(	uint stageIdx = 0
+										);
+
 		/** (not yet documented)
 		 *
 		 *	@param[in] _switchFcn		.
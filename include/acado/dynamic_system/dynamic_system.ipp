@@ -77,6 +77,16 @@ inline const OutputFcn& DynamicSystem::getOutputFcn(	uint stageIdx
 }
 
 
+inline OutputFcn& DynamicSystem::getOutputFcn(	uint stageIdx
+										)
+{
+	ASSERT( outputFcn != 0 );
+	ASSERT( ( stageIdx >= 0 ) && ( stageIdx < nDiffEqn ) );
+
+	return *(outputFcn[stageIdx]);
+}
+
+
 inline returnValue DynamicSystem::getSwitchFunction(	uint idx,
 														Function& _switchFcn
 														) const
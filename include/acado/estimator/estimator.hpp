@@ -89,6 +89,16 @@ class Estimator : public SimulationBlock
 									) = 0;
 
 
+		/** Sets the controls that have been applied to the process since
+		 *	the previous step.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		inline returnValue setControls(	const Vector& _u
+										);
+
+
 		/** Returns all estimator outputs. */
         inline returnValue getOutputs(	Vector& _x,			/**< Estimated differential states. */
 										Vector& _xa,		/**< Estimated algebraic states. */
@@ -38,6 +38,19 @@ BEGIN_NAMESPACE_ACADO
 // PUBLIC MEMBER FUNCTIONS:
 //
 
+inline returnValue Estimator::setControls(	const Vector& _u
+											)
+{
+	if ( _u.getDim( ) != u.getDim( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	for( uint i=0; i<u.getDim( ); ++i )
+		u(i) = _u(i);
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 inline returnValue Estimator::getOutputs(	Vector& _x,
 											Vector& _xa,
 											Vector& _u,
@@ -35,6 +35,8 @@
 
 #include <acado/utils/acado_utils.hpp>
 #include <acado/estimator/estimator.hpp>
+#include <acado/dynamic_system/dynamic_system.hpp>
+#include <acado/integrator/integrator.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -47,6 +49,27 @@ BEGIN_NAMESPACE_ACADO
  *
  *  The class KalmanFilter provides a Kalman filter for state estimation.
  *
+ *	The filter estimates the differential states of a DynamicSystem whose
+ *	differential equation is disturbed by white process noise with covariance
+ *	Q and whose output function is disturbed by white measurement noise with
+ *	covariance R. If no output function is given, all differential states are
+ *	measured. The two available variants are:
+ *
+ *	EXTENDED_KALMAN_FILTER: The prediction integrates the differential equation
+ *	and propagates the covariance with the forward sensitivities of the
+ *	integrator; the update linearizes the output function by automatic
+ *	differentiation.
+ *
+ *	UNSCENTED_KALMAN_FILTER: A square-root unscented Kalman filter, which
+ *	propagates 2*nx+1 sigma points through the integrator and the output
+ *	function and updates the Cholesky factor of the covariance by QR
+ *	decompositions and rank-one updates (alpha = 1, beta = 2, kappa = 0).
+ *
+ *	All matrices needed by the filter are allocated in init(), so the filter
+ *	equations themselves do not allocate memory (the integrator still does).
+ *	The controls applied to the process since the last step are passed by
+ *	setControls(); the Controller does so automatically.
+ *
  *	\author Hans Joachim Ferreau, Boris Houska
  */
 class KalmanFilter : public Estimator
@@ -59,6 +82,23 @@ class KalmanFilter : public Estimator
         KalmanFilter(	double _samplingTime = DEFAULT_SAMPLING_TIME
 						);
 
+		/** Constructor taking the dynamic system to be observed and the noise covariances.
+		 *
+		 *	@param[in] _dynamicSystem	Dynamic system (ODE and output function).
+		 *	@param[in] _Q				Covariance of the process noise (nx x nx).
+		 *	@param[in] _R				Covariance of the measurement noise (ny x ny).
+		 *	@param[in] _type			Variant of the Kalman filter.
+		 *	@param[in] _integratorType	Integrator used for the prediction.
+		 *	@param[in] _samplingTime	Sampling time.
+		 */
+        KalmanFilter(	const DynamicSystem& _dynamicSystem,
+						const Matrix& _Q,
+						const Matrix& _R,
+						KalmanFilterType _type = EXTENDED_KALMAN_FILTER,
+						IntegratorType _integratorType = INT_RK45,
+						double _samplingTime = DEFAULT_SAMPLING_TIME
+						);
+
         /** Copy constructor (deep copy). */
         KalmanFilter( const KalmanFilter& rhs );
 
@@ -77,23 +117,114 @@ class KalmanFilter : public Estimator
 									const Vector &p_  = emptyConstVector
 									);
 
-        /** Executes next single step. */
+        /** Executes next single step, i.e. predicts the state from the time
+		 *	of the previous step to currentTime and corrects the prediction
+		 *	by the measurement _y.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_BLOCK_NOT_READY, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH, \n
+		 *	        RET_ESTIMATOR_STEP_FAILED
+		 */
         virtual returnValue step(	double currentTime,
 									const Vector& _y
 									);
 
 
-   //
+		/** Sets the covariance of the initial state estimate (default: Q).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue setCovariance(	const Matrix& _P
+									);
+
+		/** Returns the covariance of the current state estimate. */
+		returnValue getCovariance(	Matrix& _P
+									) const;
+
+		/** Returns number of process outputs.
+		 *  \return Number of process outputs */
+		inline uint getNY( ) const;
+
+
+    //
     // PROTECTED MEMBER FUNCTIONS:
     //
     protected:
 
+		/** Allocates the integrator of the given type. */
+		returnValue allocateIntegrator(	IntegratorType _integratorType
+										);
+
+		/** Allocates all matrices of the filter equations. */
+		returnValue allocateWorkspace( );
+
+		/** Evaluates the output function at the differential state _x (and,
+		 *	for the EKF, stores its transposed Jacobian in Ct). */
+		returnValue evaluateOutput(	const double* const _x,
+									double* _y,
+									BooleanType computeJacobian
+									);
+
+		/** Integrates the differential state _x from t0 to t1. */
+		returnValue integrate(	double t0,
+								double t1,
+								const double* const _x,
+								double* _xEnd
+								);
+
+		returnValue predictEKF(	double t0,
+								double t1
+								);
+
+		returnValue updateEKF(	const Vector& _y
+								);
+
+		/** Stores the sigma points of the current estimate in the rows of X. */
+		returnValue computeSigmaPoints( );
+
+		returnValue predictUKF(	double t0,
+								double t1
+								);
+
+		returnValue updateUKF(	const Vector& _y
+								);
 
 
     //
     // DATA MEMBERS:
     //
     protected:
+		KalmanFilterType type;			/**< Variant of the Kalman filter. */
+		Integrator* integrator;			/**< Integrator of the differential equation. */
+		OutputFcn outputFcn;			/**< Output function (empty: all states are measured). */
+
+		Matrix Q;						/**< Covariance of the process noise. */
+		Matrix R;						/**< Covariance of the measurement noise. */
+		Matrix P;						/**< Covariance of the estimate (EKF) or its lower Cholesky factor (UKF). */
+		Matrix P0;						/**< Covariance of the initial estimate. */
+		double lastTime;				/**< Time of the last step. */
+
+		// WORKSPACE OF THE FILTER EQUATIONS:
+		// ---------------------------------------------------------------------
+		Vector xTmp;					/**< Predicted differential state.                      */
+		Vector xSeed;					/**< Forward seed of the integrator.                    */
+		Vector dx;						/**< Forward sensitivities of the integrator.           */
+		Vector yTmp;					/**< Predicted output.                                  */
+		Vector e;						/**< Innovation.                                        */
+		Vector z;						/**< Variables of the output function.                  */
+		Vector zSeed;					/**< Forward seed of the output function.               */
+		Matrix At;						/**< Transposed state transition matrix.                */
+		Matrix Ct;						/**< Transposed output Jacobian.                        */
+		Matrix T;						/**< Temporary matrix (nx x nx).                        */
+		Matrix PCt;						/**< P*C' (EKF) or cross covariance (UKF).              */
+		Matrix S;						/**< Cholesky factor of the innovation covariance.      */
+		Matrix sqrtQ;					/**< Lower Cholesky factor of Q (UKF).                  */
+		Matrix sqrtR;					/**< Lower Cholesky factor of R (UKF).                  */
+		Matrix X;						/**< Sigma points of the state (UKF).                   */
+		Matrix Y;						/**< Sigma points of the output (UKF).                  */
+		Matrix QR;						/**< Compound matrix for the QR decompositions (UKF).   */
 };
 
 
@@ -101,7 +232,7 @@ CLOSE_NAMESPACE_ACADO
 
 
 
-//#include <acado/estimator/kalman_filter.ipp>
+#include <acado/estimator/kalman_filter.ipp>
 
 
 #endif  // ACADO_TOOLKIT_KALMAN_FILTER_HPP
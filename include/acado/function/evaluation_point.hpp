@@ -133,6 +133,27 @@ public:
     inline returnValue setZ ( const uint       &idx ,
                               const OCPiterate &iter  );
 
+    /** Sets the evaluation point to the point idx of a batch of  \n
+     *  nPoints points stored as structure of arrays (see gatherZ). \n
+     *                                                              \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    inline returnValue setZ ( const uint   &idx    ,
+                              const double *zBatch ,
+                              const uint   &nPoints  );
+
+    /** Writes the first nPoints points of the iterate into zBatch, \n
+     *  which is stored as structure of arrays: the variable that    \n
+     *  setZ would write into z[k] is written into                   \n
+     *  zBatch[k*nPoints+j] for point j. Entries which do not belong \n
+     *  to the iterate (e.g. intermediate states) are not touched.   \n
+     *                                                              \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue gatherZ( const OCPiterate &iter   ,
+                         double           *zBatch ,
+                         const uint       &nPoints  ) const;
+
 	inline returnValue setZero( );
 
 
@@ -161,6 +182,7 @@ public:
 protected:
 
     inline returnValue copy( const int *order, const Vector &rhs );
+    inline returnValue copy( const int *order, const VectorView<const double> &rhs );
 
     void copy( const EvaluationPoint &rhs );
     void deleteAll();
@@ -49,6 +49,15 @@ inline returnValue EvaluationPoint::copy( const int *order, const Vector &rhs ){
 }
 
 
+inline returnValue EvaluationPoint::copy( const int *order, const VectorView<const double> &rhs ){
+
+    uint i;
+    for( i = 0; i < rhs.getDim(); i++ )
+        z[order[i]] = rhs(i);
+    return SUCCESSFUL_RETURN;
+}
+
+
 inline Vector EvaluationPoint::backCopy( const int *order, const uint &dim ) const{
 
     Vector tmp(dim);
@@ -70,12 +79,14 @@ inline returnValue EvaluationPoint::setDX( const Vector &dx ){ return copy( idx[
 inline returnValue EvaluationPoint::setZ ( const uint       &idx_,
                                            const OCPiterate &iter  ){
 
-    setT ( iter.getTime (idx_) );
-    setX ( iter.getX    (idx_) );
-    setXA( iter.getXA   (idx_) );
-    setP ( iter.getP    (idx_) );
-    setU ( iter.getU    (idx_) );
-    setW ( iter.getW    (idx_) );
+    z[idx[0][0]] = iter.getTime(idx_);
+
+    // the values are read in place, i.e. without copying them into temporary vectors
+    if( iter.x  != 0 ) copy( idx[1], iter.x ->getPointView(idx_) );
+    if( iter.xa != 0 ) copy( idx[2], iter.xa->getPointView(idx_) );
+    if( iter.p  != 0 ) copy( idx[3], iter.p ->getPointView(idx_) );
+    if( iter.u  != 0 ) copy( idx[4], iter.u ->getPointView(idx_) );
+    if( iter.w  != 0 ) copy( idx[5], iter.w ->getPointView(idx_) );
 
     return SUCCESSFUL_RETURN;
 }
@@ -83,6 +94,18 @@ inline returnValue EvaluationPoint::setZ ( const uint       &idx_,
 
 
 
+inline returnValue EvaluationPoint::setZ ( const uint   &idx_   ,
+                                           const double *zBatch ,
+                                           const uint   &nPoints  ){
+
+    uint run1;
+    for( run1 = 0; run1 < N; run1++ )
+        z[run1] = zBatch[run1*nPoints+idx_];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 inline returnValue EvaluationPoint::setZero( )
 {
 	if ( z != 0 ) 
@@ -236,6 +236,118 @@ public:
 
 
 
+    /** Evaluates the function without storing intermediate       \n
+     *  results for automatic differentiation. If the function    \n
+     *  has been compiled, the flat instruction tape is used.     \n
+     *  \return SUCCESFUL_RETURN                   \n
+     *          RET_NAN                            \n
+     * */
+    returnValue evaluate( double *x         /**< the input variable x */,
+                          double *_result    /**< the result           */  );
+
+
+    /** Evaluates the function at nPoints points at once without    \n
+     *  storing intermediate results for automatic differentiation. \n
+     *  The points are stored as structure of arrays, i.e. the       \n
+     *  variable k of point j is x[k*nPoints+j] and component i of   \n
+     *  its result is written into _result[i*nPoints+j]. If the      \n
+     *  function has been compiled, the tape is run through only     \n
+     *  once for all points.                                         \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     *          RET_NAN                                              \n
+     * */
+    returnValue evaluateBatch( int     nPoints   /**< the number of points */,
+                               double *x         /**< the input variables  */,
+                               double *_result   /**< the results          */  );
+
+
+    /** Evaluates the compiled function at nPoints points at once  \n
+     *  (stored as above) using a workspace owned by the caller,    \n
+     *  which keeps the trace needed for the backward derivatives   \n
+     *  at each of the points (see AD_backward).                    \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_INVALID_USE_OF_FUNCTION                         \n
+     *          RET_INVALID_ARGUMENTS                               \n
+     * */
+    returnValue evaluateBatch( int     nPoints         /**< the number of points */,
+                               double *x               /**< the input variables  */,
+                               double *_result         /**< the results          */,
+                               EvaluationWorkspace& ws /**< the workspace        */ ) const;
+
+
+    /** Replaces all structurally identical subexpressions of the \n
+     *  function by intermediate states that are local to the     \n
+     *  function, such that they are evaluated (and exported)     \n
+     *  only once. No further components can be added afterwards. \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS          \n
+     */
+    returnValue eliminateCommonSubexpressions( );
+
+
+    /** Compiles the symbolic expression into a flat instruction  \n
+     *  tape, which speeds up subsequent calls of the non-buffered \n
+     *  evaluate routine. The results are identical to the ones    \n
+     *  obtained by evaluating the expression tree. Subexpressions \n
+     *  that occur several times are evaluated only once.          \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS          \n
+     */
+    returnValue compile( );
+
+
+    /** Returns the number of instructions of the compiled         \n
+     *  function (zero if it has not been compiled).               \n
+     */
+    int getNumTapeInstructions( ) const;
+
+
+    /** Returns whether the function has been compiled. */
+    BooleanType isCompiled( ) const;
+
+
+    /** Compiles the symbolic expression into native code using   \n
+     *  the compiler of the local system (the library is cached on \n
+     *  disk, see NativeCode). Afterwards, all evaluation and      \n
+     *  first order derivative routines run through native code.   \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS          \n
+     *          RET_UNABLE_TO_COMPILE_NATIVE_CODE                  \n
+     *          RET_UNABLE_TO_LOAD_NATIVE_CODE                     \n
+     */
+    returnValue compileNative( const char *compiler       = 0 /**< the compiler command, default: "c++ -O2 -fPIC -shared" */,
+                               const char *cacheDirectory = 0 /**< the cache directory, default: $TMPDIR/acado_native_code-<uid> */ );
+
+
+    /** Returns whether the function runs through native code. */
+    BooleanType isNative( ) const;
+
+
+    /** Allocates a workspace for the reentrant evaluation and     \n
+     *  differentiation routines (for propagating nDirections      \n
+     *  forward directions at once or for evaluating nPoints       \n
+     *  points at once). The function has to be compiled before.   \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_INVALID_USE_OF_FUNCTION                         \n
+     */
+    returnValue initWorkspace( EvaluationWorkspace& ws /**< the workspace            */,
+                               int nDirections = 1     /**< the number of directions */,
+                               int nPoints     = 1     /**< the number of points     */ ) const;
+
+
+    /** Evaluates the compiled function using a workspace owned by \n
+     *  the caller. The function object itself is not modified,    \n
+     *  i.e. several threads can evaluate the same function at     \n
+     *  once as long as each of them uses its own workspace.       \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_INVALID_USE_OF_FUNCTION                         \n
+     * */
+    returnValue evaluate( double *x               /**< the input variable x */,
+                          double *_result         /**< the result           */,
+                          EvaluationWorkspace& ws /**< the workspace        */ ) const;
+
+
+
     /** Substitutes var(index) with the double sub.               \n
      *  \return The substituted expression.                       \n
      *
@@ -277,6 +389,20 @@ public:
 
 
 
+    /** Determines the sparsity pattern of the Jacobian of the    \n
+     *  function w.r.t. the given variables (pattern[i*nVar+j]    \n
+     *  is BT_TRUE if the i-th component of the function might    \n
+     *  depend on the j-th variable).                             \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *
+     */
+     returnValue getDependencyPattern( int           nVar     ,
+                                       VariableType *varType  ,
+                                       int          *component,
+                                       BooleanType  *pattern    );
+
+
+
     /** Checks whether the function is polynomial in              \n
      *  the variable var(index)                                   \n
      *  \return BT_FALSE if the expression is not  polynomial     \n
@@ -364,6 +490,39 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode based on the     \n
+     *  compiled function and a workspace owned by the caller      \n
+     *  (reentrant version).                                       \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INVALID_USE_OF_FUNCTION                        \n
+     */
+     returnValue AD_forward(  double *x       /**< the evaluation point */,
+                              double *seed    /**< the seed             */,
+                              double *f       /**< the function value   */,
+                              double *df      /**< the derivative of
+                                                   the expression       */,
+                              EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
+    /** Automatic Differentiation in forward mode for several      \n
+     *  directions at once, based on the compiled function and a   \n
+     *  workspace owned by the caller (reentrant version). The     \n
+     *  seed of variable k in direction j is stored at             \n
+     *  seed[k*nDirections+j], likewise for df.                    \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INVALID_USE_OF_FUNCTION                        \n
+     */
+     returnValue AD_forward(  int     nDirections /**< the number of directions */,
+                              double *x       /**< the evaluation point */,
+                              double *seed    /**< the seeds            */,
+                              double *f       /**< the function value   */,
+                              double *df      /**< the derivatives of
+                                                   the expression       */,
+                              EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
     /** Automatic Differentiation in backward mode.                \n
      *                                                             \n
      *  \param seed    the backward seed                           \n
@@ -390,6 +549,36 @@ public:
 
 
 
+    /** Automatic Differentiation in backward mode based on the    \n
+     *  compiled function and a workspace owned by the caller      \n
+     *  (reentrant version). The function is evaluated at x first, \n
+     *  the result is added to df.                                 \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INVALID_USE_OF_FUNCTION                        \n
+     */
+     returnValue AD_backward( double *x       /**< the evaluation point */,
+                              double *seed    /**< the seed             */,
+                              double *df      /**< the derivative of
+                                                   the expression       */,
+                              EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+    /** Automatic Differentiation in backward mode at one point of \n
+     *  the last batched evaluation into the given workspace (see  \n
+     *  evaluateBatch). The function is not evaluated again, the   \n
+     *  result is added to df.                                     \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INVALID_USE_OF_FUNCTION                        \n
+     *          RET_INVALID_ARGUMENTS                              \n
+     */
+     returnValue AD_backward( int     point   /**< the index of the point */,
+                              double *seed    /**< the seed             */,
+                              double *df      /**< the derivative of
+                                                   the expression       */,
+                              EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
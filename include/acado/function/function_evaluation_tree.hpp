@@ -78,6 +78,18 @@ public:
     virtual returnValue operator<<( const Expression& arg );
 
 
+    /** Replaces all structurally identical subexpressions of all          \n
+     *  components by intermediate states, such that they are evaluated     \n
+     *  (and exported) only once. The new intermediate states are local to   \n
+     *  this function, i.e. they do not take global indices. Hence, no       \n
+     *  further components can be added afterwards. The indices of all      \n
+     *  other variables are kept (see index()).                             \n
+     *  \return SUCCESSFUL_RETURN                                           \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS                   \n
+     */
+    virtual returnValue eliminateCommonSubexpressions( );
+
+
     /** Returns the dimension of the symbolic expression  \n
      *  \return The requested dimension.
      */
@@ -166,6 +178,50 @@ public:
 										) const;
 
 
+    /** Lowers the expression tree (including the intermediate     \n
+     *  states) into a flat instruction tape. Afterwards, the      \n
+     *  non-buffered evaluate routine runs through the tape        \n
+     *  instead of walking the operator tree. Structurally         \n
+     *  identical subexpressions of all intermediate states and     \n
+     *  components are evaluated only once by the tape. The tape   \n
+     *  is dropped as soon as the expression is modified.          \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS          \n
+     */
+    virtual returnValue compile( );
+
+
+    /** Returns the number of instructions of the compiled        \n
+     *  expression (zero if it has not been compiled).            \n
+     */
+    virtual int getNumTapeInstructions( ) const;
+
+
+    /** Returns whether the expression has been compiled into a   \n
+     *  flat instruction tape.                                    \n
+     */
+    virtual BooleanType isCompiled( ) const;
+
+
+    /** Compiles the expression into native code using the system  \n
+     *  compiler (see EvaluationTape::compileNative); it is lowered \n
+     *  into a tape first if necessary. Afterwards, all routines of \n
+     *  zero and first order (buffered or not) run through the     \n
+     *  native code, while the buffered second order routines are   \n
+     *  no longer available.                                        \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS           \n
+     *          RET_UNABLE_TO_COMPILE_NATIVE_CODE                   \n
+     *          RET_UNABLE_TO_LOAD_NATIVE_CODE                      \n
+     */
+    virtual returnValue compileNative( const char *compiler       = 0 /**< the compiler command */,
+                                       const char *cacheDirectory = 0 /**< the cache directory  */ );
+
+
+    /** Returns whether the expression runs through native code. */
+    virtual BooleanType isNative( ) const;
+
+
     /** Evaluates the expression
      *  \return SUCCESSFUL_RETURN                  \n
      *          RET_NAN                            \n
@@ -174,6 +230,56 @@ public:
                                   double *result    /**< the result           */  );
 
 
+    /** Evaluates the expression at nPoints points, which are stored \n
+     *  as structure of arrays: component k of point j is found at     \n
+     *  x[k*nPoints+j] (likewise for the result). A compiled           \n
+     *  expression runs through its tape only once for all points;     \n
+     *  otherwise the points are evaluated one after another.          \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_NAN                                                \n
+     */
+    virtual returnValue evaluateBatch( int     nPoints  /**< the number of points */,
+                                       double *x        /**< the input variables  */,
+                                       double *result   /**< the results          */  );
+
+
+    /** Evaluates the compiled expression at nPoints points (stored   \n
+     *  as above) using a workspace owned by the caller, which keeps   \n
+     *  the trace needed for AD_backward at each of the points.        \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_INVALID_USE_OF_FUNCTION                            \n
+     *          RET_INVALID_ARGUMENTS                                  \n
+     */
+    virtual returnValue evaluateBatch( int     nPoints         /**< the number of points */,
+                                       double *x               /**< the input variables  */,
+                                       double *result          /**< the results          */,
+                                       EvaluationWorkspace& ws /**< the workspace        */ ) const;
+
+
+    /** Allocates a workspace for the reentrant evaluation routines   \n
+     *  below (for propagating nDirections forward directions at      \n
+     *  once or for evaluating nPoints points at once). The           \n
+     *  expression has to be compiled before.                         \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_INVALID_USE_OF_FUNCTION                            \n
+     */
+    virtual returnValue initWorkspace( EvaluationWorkspace& ws    /**< the workspace            */,
+                                       int nDirections = 1        /**< the number of directions */,
+                                       int nPoints     = 1        /**< the number of points     */ ) const;
+
+
+    /** Evaluates the compiled expression using a workspace owned by  \n
+     *  the caller. As no member of the tree is modified, one         \n
+     *  expression can be evaluated from several threads at once      \n
+     *  (using one workspace per thread).                             \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_INVALID_USE_OF_FUNCTION                            \n
+     */
+    virtual returnValue evaluate( double *x                /**< the input variable x */,
+                                  double *result           /**< the result           */,
+                                  EvaluationWorkspace& ws  /**< the workspace        */ ) const;
+
+
 
     /** Evaluates the expression */
     template <typename T> returnValue evaluate( Tmatrix<T> *x, Tmatrix<T> *result );
@@ -252,6 +358,19 @@ public:
      virtual BooleanType isLinearIn( const Expression     &variable );
 
 
+    /** Determines the sparsity pattern of the Jacobian of the         \n
+     *  expression w.r.t. the given variables: pattern[i*nVar+j] is    \n
+     *  set to BT_FALSE only if the i-th component of the expression   \n
+     *  is not depending on the j-th variable.                         \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *
+     */
+     virtual returnValue getDependencyPattern( int           nVar     ,  /**< number of variables   */
+                                               VariableType *varType  ,  /**< the variable types    */
+                                               int          *component,  /**< and their components  */
+                                               BooleanType  *pattern     /**< the resulting pattern */ );
+
+
     /** Checks whether the expression is polynomial in            \n
      *  a variable.                                               \n
      *  \return BT_FALSE if the expression is not  polynomial     \n
@@ -305,6 +424,44 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode based on the    \n
+     *  compiled expression and a workspace owned by the caller   \n
+     *  (reentrant version).                                      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_INVALID_USE_OF_FUNCTION                       \n
+     */
+     virtual returnValue AD_forward( double *x     /**< The evaluation
+                                                        point x          */,
+                                     double *seed  /**< the seed         */,
+                                     double *f     /**< the value of the
+                                                        expression at x  */,
+                                     double *df    /**< the derivative of
+                                                        the expression   */,
+                                     EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
+    /** Automatic Differentiation in forward mode for several     \n
+     *  directions at once based on the compiled expression and a \n
+     *  workspace owned by the caller (reentrant version). The    \n
+     *  seed of variable k in direction j is stored at            \n
+     *  seed[k*nDirections+j], likewise for df.                   \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_INVALID_USE_OF_FUNCTION                       \n
+     */
+     virtual returnValue AD_forward( int     nDirections /**< the number of
+                                                              directions       */,
+                                     double *x     /**< The evaluation
+                                                        point x          */,
+                                     double *seed  /**< the seeds        */,
+                                     double *f     /**< the value of the
+                                                        expression at x  */,
+                                     double *df    /**< the derivatives of
+                                                        the expression   */,
+                                     EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
     /** Automatic Differentiation in forward mode.                \n
      *  This function uses the intermediate                       \n
      *  results from a buffer                                     \n
@@ -335,6 +492,38 @@ public:
                                                           the expression   */  );
 
 
+    /** Automatic Differentiation in backward mode based on the   \n
+     *  compiled expression and a workspace owned by the caller   \n
+     *  (reentrant version). The expression is evaluated at x     \n
+     *  first, the result is added to df.                         \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_INVALID_USE_OF_FUNCTION                       \n
+     */
+     virtual returnValue AD_backward( double *x    /**< The evaluation
+                                                        point x          */,
+                                      double *seed /**< the seed         */,
+                                      double  *df  /**< the derivative of
+                                                        the expression   */,
+                                      EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+    /** Automatic Differentiation in backward mode at one point of \n
+     *  the last batched evaluation into the given workspace. The  \n
+     *  expression is not evaluated again, the result is added to  \n
+     *  df.                                                        \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_INVALID_USE_OF_FUNCTION                       \n
+     *          RET_INVALID_ARGUMENTS                             \n
+     */
+     virtual returnValue AD_backward( int     point /**< the index of the
+                                                         point            */,
+                                      double *seed  /**< the seed         */,
+                                      double  *df   /**< the derivative of
+                                                         the expression   */,
+                                      EvaluationWorkspace& ws /**< the workspace */ ) const;
+
+
+
     // IMPORTANT REMARK FOR AD_BACKWARD: run evaluate first to define
     //                                   the point x and to compute f.
 
@@ -498,8 +687,35 @@ public:
 
     Expression           safeCopy ;
 
+    BooleanType          hasLocalStates; /**< Whether the function contains
+                                           *  local intermediate states (see
+                                           *  eliminateCommonSubexpressions). */
+
+    EvaluationTape       tape     ;   /**< Compiled form of the expression
+                                        *  (empty if not compiled).        */
+
+    double              *nativeX  ;   /**< Evaluation points stored by the
+                                        *  buffered routines in native mode
+                                        *  (the operator buffers are not
+                                        *  filled by native code).         */
+    int                  nNativeX ;   /**< Number of points fitting into
+                                        *  nativeX.                        */
+    double              *nativeF  ;   /**< Scratch memory for the function
+                                        *  value in native mode.           */
+    EvaluationWorkspace  nativeWorkspace; /**< Workspace of the buffered
+                                            *  routines in native mode.    */
+
     String				auxVariableName;
     String				auxVariableStructName;
+
+
+    protected:
+
+    /** Stores the evaluation point of the buffered routines (native mode). */
+    void storeNativePoint( int number, const double *x );
+
+    /** Returns the stored evaluation point (or 0 if none has been stored). */
+    double* getNativePoint( int number ) const;
 };
 
 
@@ -253,6 +253,23 @@ class Integrator : public AlgorithmicBase
 									const Vector &wSeed = emptyVector  /**< the seed w.r.t disturbances */  );
 
 
+		/** Define several first order forward seeds at once: each column of \n
+		*  the seed matrices defines one direction. Integrators that can     \n
+		*  handle multiple forward directions (cf.                           \n
+		*  canHandleMultipleForwardDirections()) propagate all directions    \n
+		*  during a single sweep over the frozen trajectory. A single column \n
+		*  is treated like the corresponding vector-valued seed.             \n
+		*  \return SUCCESFUL RETURN         \n
+		*          RET_INPUT_OUT_OF_RANGE   \n
+		*          RET_NOT_IMPLEMENTED_YET  \n
+		*/
+		returnValue setForwardSeed(	const int    &order                     /**< the order of the seed (1).  */,
+									const Matrix &xSeed                     /**< the seed w.r.t states       */,
+									const Matrix &pSeed = emptyConstMatrix  /**< the seed w.r.t parameters   */,
+									const Matrix &uSeed = emptyConstMatrix  /**< the seed w.r.t controls     */,
+									const Matrix &wSeed = emptyConstMatrix  /**< the seed w.r.t disturbances */  );
+
+
 
 		// ================================================================================
 
@@ -371,6 +388,19 @@ class Integrator : public AlgorithmicBase
 												int order ) const;
 
 
+		/** Returns the result for the forward sensitivities of all directions \n
+		*  at the time tend (one column per direction).                        \n
+		*                                                                     \n
+		*  \param Dx    the result for the forward sensitivities.             \n
+		*  \param order the order.                                            \n
+		*                                                                     \n
+		*  \return SUCCESSFUL_RETURN                                          \n
+		*          RET_INPUT_OUT_OF_RANGE                                     \n
+		*/
+		returnValue getForwardSensitivities(	Matrix &Dx,
+												int order ) const;
+
+
 		/** Returns the result for the forward sensitivities on the grid.  \n
 		*                                                                 \n
 		*  \param Dx    the result for the forward sensitivities.         \n
@@ -424,6 +454,14 @@ class Integrator : public AlgorithmicBase
 		virtual BooleanType canHandleImplicitSwitches( ) const;
 
 
+		/**  Returns if integrator is able to propagate several forward directions       \n
+		*   (as defined by the matrix-valued setForwardSeed) in a single sweep.         \n
+		*   \return BT_TRUE:  if integrator can handle multiple forward directions.     \n
+		*           BT_FALSE: otherwise
+		*/
+		virtual BooleanType canHandleMultipleForwardDirections( ) const;
+
+
 		/**  Returns if the differential equation of the integrator is defined.          \n
 		*   \return BT_TRUE:  if differential equation is defined.                      \n
 		*           BT_FALSE: otherwise
@@ -523,6 +561,22 @@ class Integrator : public AlgorithmicBase
 													const int    &order     /**< the order of the
 																			*  seed.              */ ) = 0;
 
+
+		/** Define several first order forward seeds at once (one direction  \n
+		*  per column; the state seeds are already permuted). Only called if \n
+		*  canHandleMultipleForwardDirections() returns BT_TRUE.            \n
+		*  \return SUCCESFUL RETURN         \n
+		*          RET_NOT_IMPLEMENTED_YET  \n
+		*/
+		virtual returnValue setProtectedForwardSeeds( const Matrix &xSeed     /**< the seeds w.r.t the
+																			*  initial states     */,
+													const Matrix &pSeed     /**< the seeds w.r.t the
+																			*  parameters         */,
+													const Matrix &uSeed     /**< the seeds w.r.t the
+																			*  controls           */,
+													const Matrix &wSeed     /**< the seeds w.r.t the
+																			*  disturbances       */ );
+
 		// ================================================================================
 
 
@@ -701,6 +755,7 @@ class Integrator : public AlgorithmicBase
 		Vector                    dP;
 		Vector                    dU;
 		Vector                    dW;
+		Matrix                   dXs;  /**< Forward sensitivities of all directions. */
 
 		Vector                   dXb;
 		Vector                   dPb;
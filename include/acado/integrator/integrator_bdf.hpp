@@ -375,6 +375,23 @@ protected:
     void printRKIntermediateResults();
 
 
+    /** Determines the sparsity pattern of the iteration matrix from the  \n
+     *  expression tree of the right-hand side and groups its columns     \n
+     *  such that no two columns of a group share a nonzero row           \n
+     *  (Curtis-Powell-Reid coloring).                                     \n
+     *  \return (void)                                                     \n
+     */
+    void determineJacobianStructure();
+
+
+    /** Evaluates the iteration matrix  J = xSeed*dF/dx + dxSeed*dF/ddx    \n
+     *  (and dF/dxa) using one directional derivative per column group.    \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF                \n
+     */
+    returnValue evaluateIterationMatrix( int number_, double xSeed, double dxSeed, Matrix &J );
+
+
     /** Decomposes the Jacobian J.               \n
      *  \return SUCCESSFUL_RETURN                \n
      *          RET_THE_DAE_INDEX_IS_TOO_LARGE   \n
@@ -550,6 +567,12 @@ protected:
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
 
+    int      nOfColors         ; /**< the number of column groups of the Jacobians        */
+    int     *colorStart        ; /**< the first entry of each group in colorColumn        */
+    int     *colorColumn       ; /**< the columns of the Jacobians ordered by groups      */
+    int     *patternStart      ; /**< the first entry of each column in patternRow        */
+    int     *patternRow        ; /**< the (structurally) nonzero rows of each column      */
+
     int     *nOfNewtonSteps    ; /**< the number of newton steps (for each BDF-step)      */
     double **eta               ; /**< the predictor and corrector approximations          */
     double **eta2              ; /**< the predictor and corrector approximations          */
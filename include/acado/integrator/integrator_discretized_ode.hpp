@@ -88,6 +88,13 @@ public:
 								);
 
 
+    /** Discrete-time systems always propagate their forward directions \n
+     *  one at a time.                                                  \n
+     *  \return BT_FALSE
+     */
+    virtual BooleanType canHandleMultipleForwardDirections( ) const;
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
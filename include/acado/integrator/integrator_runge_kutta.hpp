@@ -212,6 +212,15 @@ public:
     /** Returns the current step size */
     virtual double getStepSize() const;
 
+
+    /**  Returns if the integrator is able to propagate several forward      \n
+     *   directions in a single sweep. This is the case if the right-hand   \n
+     *   side could be compiled and no transition is defined.               \n
+     *   \return BT_TRUE:  if multiple forward directions can be handled.   \n
+     *           BT_FALSE: otherwise
+     */
+    virtual BooleanType canHandleMultipleForwardDirections( ) const;
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -268,6 +277,20 @@ protected:
                                                  const int    &order    /**< the order of the
                                                                           *  seed.              */ );
 
+
+    /** Define several first order forward seeds at once (one direction per column). \n
+     *  \return SUCCESFUL RETURN         \n
+     *          RET_INPUT_OUT_OF_RANGE   \n
+     */
+    virtual returnValue setProtectedForwardSeeds( const Matrix &xSeed     /**< the seeds w.r.t the
+                                                                           *  initial states     */,
+                                                  const Matrix &pSeed     /**< the seeds w.r.t the
+                                                                           *  parameters         */,
+                                                  const Matrix &uSeed     /**< the seeds w.r.t the
+                                                                           *  controls           */,
+                                                  const Matrix &wSeed     /**< the seeds w.r.t the
+                                                                           *  disturbances       */ );
+
     // ================================================================================
 
 
@@ -374,6 +397,18 @@ protected:
     void determineEtaGForward( int number );
 
 
+    /** Propagates all forward directions in a single sweep over the      \n
+     *  frozen mesh (only for internal use). The nominal trajectory is     \n
+     *  re-evaluated once per stage based on the compiled right-hand side, \n
+     *  while the derivatives of all directions are updated in contiguous  \n
+     *  blocks.                                                            \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45               \n
+     *          RET_MAX_NUMBER_OF_STEPS_EXCEEDED                           \n
+     */
+    returnValue determineEtaGForwardAll( );
+
+
     /** computes etaG and etaG2 in forward direction                       \n
      *  (only for internal use)                                            \n
      */
@@ -469,6 +504,15 @@ protected:
     double    *etaG2           ;  /**< Sensitivity matrix (only internal use)             */
     double    *etaG3           ;  /**< Sensitivity matrix (only internal use)             */
 
+    Matrix     fseeds          ;  /**< The forward seeds of all directions (only internal use) */
+    double    *Gv              ;  /**< Seeds of all directions (only internal use)        */
+    double    *etaGv           ;  /**< Sensitivities of all directions (only internal use) */
+    double    *kGv             ;  /**< Stage derivatives of all directions (only internal use) */
+    double    *xN              ;  /**< Nominal point of the sweep (only internal use)     */
+    double    *etaN            ;  /**< Nominal state of the sweep (only internal use)     */
+    double    *kN              ;  /**< Nominal stages of the sweep (only internal use)    */
+    EvaluationWorkspace rhsWorkspace; /**< Workspace for the compiled right-hand side  */
+
     double    *H               ;  /**< Sensitivity matrix (only internal use)             */
     double    *etaH            ;  /**< Sensitivity matrix (only internal use)             */
 
@@ -546,7 +546,7 @@ class Matrix : public VectorspaceElement{
 
         /**  Computes the QR decomposition of the matrix.                 \n
          *   The result of the decomposition will be strored in this      \n
-         *   matrix which will be increased by one column. The matrix     \n
+         *   matrix which will be increased by one row. The matrix        \n
          *   can then be used via the routine "solveQR".                  \n
          *                                                                \n
          *   \return  The matrix decomposition  A = QR  in an efficient   \n
@@ -571,8 +571,31 @@ class Matrix : public VectorspaceElement{
         Vector solveTransposeQR( const Vector &b ) const;
 
 
+        /**  Solves the system  A x = b  provided that the routine        \n
+         *   computeQRdecomposition() has been used before. The           \n
+         *   right-hand side b is overwritten by the solution x, i.e.     \n
+         *   no memory is allocated.                                      \n
+         *                                                                \n
+         *   \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue solveQR( double *b ) const;
 
-        /**  Computes the sparse LU decomposition of the matrix.          \n
+
+        /**  Solves the system  A^T x = b  provided that the routine      \n
+         *   computeQRdecomposition() has been used before. The           \n
+         *   right-hand side b is overwritten by the solution x, i.e.     \n
+         *   no memory is allocated.                                      \n
+         *                                                                \n
+         *   \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue solveTransposeQR( double *b ) const;
+
+
+
+        /**  Computes the sparse LU decomposition of the matrix. If the   \n
+         *   decomposition has been computed before and the sparsity      \n
+         *   pattern did not grow, only the numerical factorization is    \n
+         *   recomputed.                                                  \n
          *                                                                \n
          *   \return  The matrix decomposition  A = LU  in an efficient   \n
          *            sparse storage format.                              \n
@@ -596,6 +619,28 @@ class Matrix : public VectorspaceElement{
         Vector solveTransposeSparseLU( const Vector &b ) const;
 
 
+        /**  Solves the system  A x = b  provided that the routine        \n
+         *   computeSparseLUdecomposition() has been used before. The     \n
+         *   right-hand side b is overwritten by the solution x, i.e.     \n
+         *   no memory is allocated.                                      \n
+         *                                                                \n
+         *   \return SUCCESSFUL_RETURN                                    \n
+         *           RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR               \n
+         */
+        returnValue solveSparseLU( double *b ) const;
+
+
+        /**  Solves the system  A^T x = b  provided that the routine      \n
+         *   computeSparseLUdecomposition() has been used before. The     \n
+         *   right-hand side b is overwritten by the solution x, i.e.     \n
+         *   no memory is allocated.                                      \n
+         *                                                                \n
+         *   \return SUCCESSFUL_RETURN                                    \n
+         *           RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR               \n
+         */
+        returnValue solveTransposeSparseLU( double *b ) const;
+
+
         /** Prints the matrix into a file. \n
          *
          *  \return SUCCESSFUL_RETURN            \n
@@ -818,6 +863,55 @@ class Matrix : public VectorspaceElement{
 typedef std::tr1::shared_ptr< Matrix > matrixPtr;
 
 
+/** Computes C = A*B without creating a temporary object. C is only
+ *  (re-)allocated if it does not have the required dimensions and
+ *  must not be the same object as A or B.
+ *
+ *  \return SUCCESSFUL_RETURN, \n
+ *          RET_VECTOR_DIMENSION_MISMATCH
+ */
+returnValue multiplyInto(	Matrix& C,
+							const Matrix& A,
+							const Matrix& B
+							);
+
+/** Computes C = A^T*B without creating a temporary object. C is only
+ *  (re-)allocated if it does not have the required dimensions and
+ *  must not be the same object as A or B.
+ *
+ *  \return SUCCESSFUL_RETURN, \n
+ *          RET_VECTOR_DIMENSION_MISMATCH
+ */
+returnValue multiplyTransposeInto(	Matrix& C,
+									const Matrix& A,
+									const Matrix& B
+									);
+
+/** Computes y = A*x without creating a temporary object. y is only
+ *  (re-)allocated if it does not have the required dimension and
+ *  must not be the same object as x.
+ *
+ *  \return SUCCESSFUL_RETURN, \n
+ *          RET_VECTOR_DIMENSION_MISMATCH
+ */
+returnValue multiplyInto(	Vector& y,
+							const Matrix& A,
+							const Vector& x
+							);
+
+/** Computes y = A^T*x without creating a temporary object. y is only
+ *  (re-)allocated if it does not have the required dimension and
+ *  must not be the same object as x.
+ *
+ *  \return SUCCESSFUL_RETURN, \n
+ *          RET_VECTOR_DIMENSION_MISMATCH
+ */
+returnValue multiplyTransposeInto(	Vector& y,
+									const Matrix& A,
+									const Vector& x
+									);
+
+
 CLOSE_NAMESPACE_ACADO
 
 
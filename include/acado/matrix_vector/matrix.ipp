@@ -184,17 +184,8 @@ inline Matrix Matrix::operator*(	const Matrix& arg
 {
 	ASSERT( getNumCols( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
-
-	uint newNumRows = getNumRows( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
-	result.setZero( );
-
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumCols( ); ++k )
-				result( i,j ) += operator()( i,k ) * arg( k,j );
+	Matrix result( getNumRows( ),arg.getNumCols( ) );
+	acadoMultiply( getNumRows( ),arg.getNumCols( ),getNumCols( ), element,arg.element,result.element );
 
 	return result;
 }
@@ -205,17 +196,8 @@ inline Matrix Matrix::operator^(	const Matrix& arg
 {
 	ASSERT( getNumRows( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
-
-	uint newNumRows = getNumCols( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
-	result.setZero( );
-
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumRows( ); ++k )
-				result( i,j ) += operator()( k,i ) * arg( k,j );
+	Matrix result( getNumCols( ),arg.getNumCols( ) );
+	acadoMultiplyTranspose( getNumCols( ),arg.getNumCols( ),getNumRows( ), element,arg.element,result.element );
 
 	return result;
 }
@@ -226,15 +208,8 @@ inline Vector Matrix::operator*(	const Vector& arg
 {
 	ASSERT( getNumCols( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumRows( );
-	Vector result( newNumRows );
-	result.setZero( );
-
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<getNumCols( ); ++j )
-			result( i ) += operator()( i,j ) * arg( j );
+	Vector result( getNumRows( ) );
+	acadoMultiplyVector( getNumRows( ),getNumCols( ), element,arg.getDoublePointer( ),result.getDoublePointer( ) );
 
 	return result;
 }
@@ -246,15 +221,8 @@ inline Vector Matrix::operator^(	const Vector& arg
 {
 	ASSERT( getNumRows( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumCols( );
-	Vector result( newNumRows );
-	result.setZero( );
-
-	for( j=0; j<getNumRows( ); ++j )
-		for( i=0; i<newNumRows; ++i )
-			result( i ) += operator()( j,i ) * arg( j );
+	Vector result( getNumCols( ) );
+	acadoMultiplyTransposeVector( getNumRows( ),getNumCols( ), element,arg.getDoublePointer( ),result.getDoublePointer( ) );
 
 	return result;
 }
@@ -0,0 +1,117 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/matrix_kernels.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ */
+
+
+#ifndef ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+#define ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *  Dense linear algebra kernels operating on row-wise stored arrays.
+ *
+ *  The kernels are cache-blocked and process several rows at once such that
+ *  the innermost loops run over contiguous memory and can be vectorized by
+ *  the compiler. Each entry of a result is accumulated in the same order as
+ *  by a naive triple loop, i.e. the results are bitwise identical to those
+ *  of a straightforward implementation. None of the kernels allocates memory;
+ *  the result arrays must not overlap with the arguments.
+ */
+
+
+/** Computes C = A*B with A of size m x k, B of size k x n and C of size m x n. */
+void acadoMultiply(	uint m,
+					uint n,
+					uint k,
+					const double* A,
+					const double* B,
+					double* C
+					);
+
+/** Computes C = A^T*B with A of size k x m, B of size k x n and C of size m x n. */
+void acadoMultiplyTranspose(	uint m,
+								uint n,
+								uint k,
+								const double* A,
+								const double* B,
+								double* C
+								);
+
+/** Computes y = A*x with A of size m x n. */
+void acadoMultiplyVector(	uint m,
+							uint n,
+							const double* A,
+							const double* x,
+							double* y
+							);
+
+/** Computes y = A^T*x with A of size m x n. */
+void acadoMultiplyTransposeVector(	uint m,
+									uint n,
+									const double* A,
+									const double* x,
+									double* y
+									);
+
+/** Solves R*X = B in place for an upper triangular R of size n x n and
+ *	X, B of size n x nrhs. Only the strict upper triangle of R is read, its
+ *	diagonal is given by diag. */
+void acadoSolveUpperTriangular(	uint n,
+								uint nrhs,
+								const double* R,
+								const double* diag,
+								double* X
+								);
+
+/** Solves R^T*X = B in place for an upper triangular R of size n x n and
+ *	X, B of size n x nrhs. Only the strict upper triangle of R is read, its
+ *	diagonal is given by diag. */
+void acadoSolveTransposeUpperTriangular(	uint n,
+											uint nrhs,
+											const double* R,
+											const double* diag,
+											double* X
+											);
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+
+/*
+ *	end of file
+ */
@@ -37,13 +37,16 @@
 #include <acado/utils/acado_utils.hpp>
 
 #include <acado/matrix_vector/vectorspace_element.hpp>
+#include <acado/matrix_vector/matrix_kernels.hpp>
 
 #include <acado/matrix_vector/vector.hpp>
+#include <acado/matrix_vector/vector_view.hpp>
 #include <acado/matrix_vector/matrix.hpp>
 #include <acado/matrix_vector/t_matrix.hpp>
 #include <acado/matrix_vector/block_matrix.hpp>
 
 #include <acado/matrix_vector/vector.ipp>
+#include <acado/matrix_vector/vector_view.ipp>
 #include <acado/matrix_vector/matrix.ipp>
 #include <acado/matrix_vector/block_matrix.ipp>
 
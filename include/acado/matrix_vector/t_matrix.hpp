@@ -87,52 +87,40 @@ public:
    */
   //! @brief Default constructor
   Tmatrix():
-    _nr(0), _nc(0), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(0), _nc(0), _data(0), _inc(1), _sub(false), _pcol(0), _prow(0), _pblock(0)
     {}
   //! @brief Constructor doing size assignment
   Tmatrix
     ( const unsigned int nr, const unsigned int nc=1, const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _data(0), _inc(1), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
     {
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      if( alloc ) _alloc();
     }
   //! @brief Constructor doing size assignment and element initialization
   template <typename U> Tmatrix
     ( const unsigned int nr, const unsigned int nc, const U&v,
       const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _data(0), _inc(1), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
     {
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T(v): 0 );
-        _data.push_back( pvall );
-      }
+      if( !alloc ) return;
+      _alloc();
+      for( unsigned int ie=0; ie<nr*nc; ie++ ) _data[ie] = T( v );
     }
   //! @brief Copy Constructor
   Tmatrix
     ( const Tmatrix<T>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _data(0), _inc(1), _sub(false), _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<T*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
-      }
+      _alloc();
+      for( unsigned int ie=0; ie<_nr*_nc; ie++ ) _data[ie] = M._val(ie);
     }
   //! @brief Copy Constructor doing type conversion
   template <typename U> Tmatrix
     ( const Tmatrix<U>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _data(0), _inc(1), _sub(false), _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<U*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
-      }
+      _alloc();
+      for( unsigned int ie=0; ie<_nr*_nc; ie++ ) _data[ie] = T( M._val(ie) );
     }
   //! @brief Destructor
   ~Tmatrix()
@@ -153,11 +141,8 @@ public:
       if( !_sub ) _reset();
       _nr = nr; _nc = nc; _sub = !alloc;
       _pcol = _prow = _pblock = 0;
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      _data = 0; _inc = 1;
+      if( alloc ) _alloc();
     }
   //! @brief Sets/retrieves value of column ic
   Tmatrix<T>& col
@@ -165,8 +150,8 @@ public:
   //! @brief Sets/retrieves value of row ir
   Tmatrix<T>& row
     ( const unsigned int ir );
-  //! @brief Sets/retrieves pointer to entry (ir,ic)
-  T*& pval
+  //! @brief Retrieves pointer to entry (ir,ic)
+  T* pval
     ( const unsigned int ir, const unsigned int ic );
   //! @brief Retrieves number of columns
   unsigned int col() const
@@ -220,8 +205,10 @@ private:
   unsigned int _nr;
   //! @brief Number of columns
   unsigned int _nc;
-  //! @brief Vector of pointers to elements (column-wise storage)
-  std::vector<T*> _data;
+  //! @brief Elements (contiguous column-wise storage, strided for rows/columns of other matrices)
+  T* _data;
+  //! @brief Distance between two consecutive elements in _data
+  unsigned int _inc;
   //! @brief Flag indicating whether the current object is a submatrix
   bool _sub;
   //! @brief Pointer to Tmatrix<T> container storing column
@@ -240,10 +227,9 @@ private:
     ( const unsigned int ie );
   const T& _val
     ( const unsigned int ie ) const;
-  //! @brief Returns a pointer to actual value at position ie
-  T*& _pval
-    ( const unsigned int ie );
-  //! @brief Resets the entries in vector _data
+  //! @brief Allocates the (contiguous) elements
+  void _alloc();
+  //! @brief Deletes the elements
   void _reset();
   //! @brief Returns the number of digits of an unsigned int value
   static unsigned int _digits
@@ -299,7 +285,7 @@ Tmatrix<T>::_val
 ( const unsigned int ie )
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  return _data[ie*_inc];
 }
 
 template <typename T> inline const T&
@@ -307,29 +293,28 @@ Tmatrix<T>::_val
 ( const unsigned int ie ) const
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  return _data[ie*_inc];
 }
 
-template <typename T> inline T*&
+template <typename T> inline T*
 Tmatrix<T>::pval
 ( const unsigned int ir, const unsigned int ic )
 {
-  return _pval(ic*_nr+ir);
+  return &_val(ic*_nr+ir);
 }
 
-template <typename T> inline T*&
-Tmatrix<T>::_pval
-( const unsigned int ie )
+template <typename T> inline void
+Tmatrix<T>::_alloc()
 {
-  ASSERT( ie<_nr*_nc && ie>=0 );
-  return _data[ie];
+  _data = ( _nr*_nc > 0 ? new T[_nr*_nc] : 0 );
+  _inc  = 1;
 }
 
 template <typename T> inline void
 Tmatrix<T>::_reset()
 {
-  typename std::vector<T*>::iterator it = _data.begin();
-  for( ; it!=_data.end(); it++ ) delete *it;
+  delete[] _data;
+  _data = 0;
 }
 
 template <typename T> inline Tmatrix<T>&
@@ -338,16 +323,8 @@ Tmatrix<T>::col
 {
   ASSERT( ic<_nc && ic>=0 );
   if( !_pcol ) _pcol = new Tmatrix<T>( _nr, 1, false );
-  for( unsigned int ir=0; ir<_nr; ir++ ){
-    _pcol->pval(ir,0) = pval(ir,ic);
-#ifdef DEBUG__MATRIX_COL
-    std::cout << ir << " , 0 : " << pval(ir,ic) << " "
-              << _pcol->pval(ir,0) << std::endl;
-#endif
-  }
-#ifdef DEBUG__MATRIX_COL
-  std::cout << std::endl;
-#endif
+  _pcol->_data = _nr > 0 ? pval(0,ic) : 0;
+  _pcol->_inc  = _inc;
   return *_pcol;
 }
 
@@ -357,16 +334,8 @@ Tmatrix<T>::row
 {
   ASSERT( ir<_nr && ir>=0 );
   if( !_prow ) _prow = new Tmatrix<T>( 1, _nc, false );
-  for( unsigned int ic=0; ic<_nc; ic++ ){
-    _prow->pval(0,ic) = pval(ir,ic);
-#ifdef DEBUG__MATRIX_ROW
-    std::cout << "0 , " << ic << " : " << pval(ir,ic) << " "
-              << _prow->pval(0,ic) << std::endl;
-#endif
-  }
-#ifdef DEBUG__MATRIX_ROW
-  std::cout << std::endl;
-#endif
+  _prow->_data = _nc > 0 ? pval(ir,0) : 0;
+  _prow->_inc  = _inc*_nr;
   return *_prow;
 }
 
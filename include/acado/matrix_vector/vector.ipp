@@ -129,13 +129,8 @@ inline Vector Vector::operator*(	const Matrix& arg
 {
 	ASSERT( getDim( ) == arg.getNumRows( ) );
 
-	uint i,j;
 	Vector result( arg.getNumCols( ) );
-	result.setZero( );
-
-	for( i=0; i<arg.getNumCols( ); ++i )
-		for( j=0; j<arg.getNumRows( ); ++j )
-			result( i ) += operator()( j ) * arg( j,i );
+	acadoMultiplyTransposeVector( arg.getNumRows( ),arg.getNumCols( ), arg.getDoublePointer( ),element,result.element );
 
 	return result;
 }
@@ -0,0 +1,177 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/vector_view.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ */
+
+
+#ifndef ACADO_TOOLKIT_VECTOR_VIEW_HPP
+#define ACADO_TOOLKIT_VECTOR_VIEW_HPP
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Provides a non-owning view on (strided) values of a vector.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class VectorView gives access to dim values that are stored with a
+ *	constant stride in memory owned by another object, e.g. to all values at
+ *	one grid point of a VariablesGrid (stride one) or to one component at all
+ *	grid points (stride equal to the number of values per grid point).
+ *	Copying a view does not copy any values. Read-only views are obtained
+ *	by instantiating the class with "const double".
+ *
+ *	A view becomes invalid as soon as the memory of the viewed object is
+ *	re-allocated, e.g. when grid points are added.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+template <typename T>
+class VectorView
+{
+	//
+	// PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor, creates an empty view. */
+		VectorView( );
+
+		/** Constructor which takes the viewed values.
+		 *
+		 *	@param[in] _values	Pointer to the first value.
+		 *	@param[in] _dim		Number of values.
+		 *	@param[in] _stride	Distance between two consecutive values in memory.
+		 */
+		VectorView(	T* _values,
+					uint _dim,
+					uint _stride = 1
+					);
+
+		/** Constructor converting a view on modifiable values into a read-only view.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		template <typename U>
+		VectorView(	const VectorView<U>& rhs
+					);
+
+
+		/** Access operator returning the value with given index.
+		 *
+		 *	@param[in] idx	Index of the value.
+		 *
+		 *	\return Reference to the value
+		 */
+		inline T& operator()(	uint idx
+								) const;
+
+
+		/** Returns the number of values.
+		 *
+		 *	\return Number of values
+		 */
+		inline uint getDim( ) const;
+
+		/** Returns the distance between two consecutive values in memory.
+		 *
+		 *	\return Stride of the view
+		 */
+		inline uint getStride( ) const;
+
+		/** Returns a pointer to the first value.
+		 *
+		 *	\return Pointer to the first value
+		 */
+		inline T* getDoublePointer( ) const;
+
+		/** Returns whether the view is empty.
+		 *
+		 *	\return BT_TRUE  iff view is empty, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isEmpty( ) const;
+
+		/** Returns whether the values are stored contiguously.
+		 *
+		 *	\return BT_TRUE  iff values are stored contiguously, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isContiguous( ) const;
+
+
+		/** Returns a copy of the viewed values.
+		 *
+		 *	\return Vector containing the viewed values
+		 */
+		inline Vector getVector( ) const;
+
+		/** Assigns the entries of given vector to the viewed values
+		 *	(only available for views on modifiable values).
+		 *
+		 *	@param[in] arg	New values.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		inline returnValue setVector(	const Vector& arg
+										) const;
+
+		/** Assigns given value to all viewed values
+		 *	(only available for views on modifiable values).
+		 *
+		 *	@param[in] _value	New value.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		inline returnValue setAll(	double _value
+									) const;
+
+
+	//
+	// DATA MEMBERS:
+	//
+	protected:
+
+		T* values;						/**< Pointer to the first value (not owned). */
+		uint dim;						/**< Number of values. */
+		uint stride;					/**< Distance between two consecutive values in memory. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_VECTOR_VIEW_HPP
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,174 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/vector_view.ipp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ */
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+template <typename T>
+VectorView<T>::VectorView( )
+{
+	values = 0;
+	dim    = 0;
+	stride = 1;
+}
+
+
+template <typename T>
+VectorView<T>::VectorView(	T* _values,
+							uint _dim,
+							uint _stride
+							)
+{
+	values = _values;
+	dim    = _dim;
+	stride = _stride;
+}
+
+
+template <typename T>
+template <typename U>
+VectorView<T>::VectorView(	const VectorView<U>& rhs
+							)
+{
+	values = rhs.getDoublePointer( );
+	dim    = rhs.getDim( );
+	stride = rhs.getStride( );
+}
+
+
+
+template <typename T>
+inline T& VectorView<T>::operator()(	uint idx
+										) const
+{
+	ASSERT( idx < dim );
+	return values[idx*stride];
+}
+
+
+
+template <typename T>
+inline uint VectorView<T>::getDim( ) const
+{
+	return dim;
+}
+
+
+template <typename T>
+inline uint VectorView<T>::getStride( ) const
+{
+	return stride;
+}
+
+
+template <typename T>
+inline T* VectorView<T>::getDoublePointer( ) const
+{
+	return values;
+}
+
+
+template <typename T>
+inline BooleanType VectorView<T>::isEmpty( ) const
+{
+	if ( dim == 0 )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+template <typename T>
+inline BooleanType VectorView<T>::isContiguous( ) const
+{
+	if ( ( stride == 1 ) || ( dim <= 1 ) )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+
+template <typename T>
+inline Vector VectorView<T>::getVector( ) const
+{
+	if ( dim == 0 )
+		return Vector( );
+
+	if ( stride == 1 )
+		return Vector( dim,values );
+
+	Vector tmp( dim );
+
+	for( uint i=0; i<dim; ++i )
+		tmp( i ) = values[i*stride];
+
+	return tmp;
+}
+
+
+template <typename T>
+inline returnValue VectorView<T>::setVector(	const Vector& arg
+												) const
+{
+	if ( arg.getDim( ) != dim )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	for( uint i=0; i<dim; ++i )
+		values[i*stride] = arg( i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+template <typename T>
+inline returnValue VectorView<T>::setAll(	double _value
+											) const
+{
+	for( uint i=0; i<dim; ++i )
+		values[i*stride] = _value;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
@@ -458,6 +458,9 @@ class VectorspaceElement
 
 		double* getDoublePointer( );
 
+		/** Returns a pointer to the (constant) elements. */
+		const double* getDoublePointer( ) const;
+
 
 
     //
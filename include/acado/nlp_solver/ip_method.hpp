@@ -35,23 +35,35 @@
 
 
 #include <acado/utils/acado_utils.hpp>
-#include <acado/nlp_solver/nlp_solver.hpp>
+#include <acado/nlp_solver/scp_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
 
 
 /**
- *	\brief Implements different interior-point methods for solving NLPs.
+ *	\brief Implements a primal-dual interior-point method for solving NLPs.
  *
  *	\ingroup NumericalAlgorithms
  *
- *  The class IPmethod implements different interior-point methods 
- *  for solving nonlinear programming problems.
+ *  The class IPmethod implements a primal-dual interior-point method 
+ *  for solving nonlinear programming problems arising from the
+ *  discretization of optimal control problems.
+ *
+ *  The inequalities are handled by a barrier parameter that is driven to
+ *  zero over the NLP iterations (instead of solving each QP subproblem to
+ *  optimality). In each iteration, the NLP is linearized like within the
+ *  SCPmethod and a few primal-dual Newton steps on the barrier subproblem
+ *  are performed, which are warm-started from the slacks and multipliers
+ *  of the previous iteration. All steps work on the sparse (stage-wise
+ *  ordered) KKT system of the SparseBasedCPsolver, i.e. the cost per
+ *  iteration grows with the number of nonzeros rather than with the
+ *  density of the condensed QP. Globalization, Hessian approximation and
+ *  convergence check are inherited from the SCPmethod.
  *
  *	 \author Boris Houska, Hans Joachim Ferreau
  */
-class IPmethod : public NLPsolver
+class IPmethod : public SCPmethod
 {
     //
     // PUBLIC MEMBER FUNCTIONS:
@@ -61,32 +73,42 @@ class IPmethod : public NLPsolver
         /** Default constructor. */
         IPmethod( );
 
-        IPmethod(	UserInteraction* _userInteraction
-					);
-					
         /** Default constructor. */
-        IPmethod( const NLP& nlp_ );
+        IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_             ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP = BT_FALSE
+					);
 
         /** Copy constructor (deep copy). */
         IPmethod( const IPmethod& rhs );
 
         /** Destructor. */
-        ~IPmethod( );
+        virtual ~IPmethod( );
 
         /** Assignment operator (deep copy). */
         IPmethod& operator=( const IPmethod& rhs );
 
+        virtual NLPsolver* clone() const;
+
 
-        /** Initialization. */
-        virtual returnValue init(VariablesGrid    *xd,
-                                 VariablesGrid    *xa,
-                                 VariablesGrid    *p,
-                                 VariablesGrid    *u,
-                                 VariablesGrid    *w   );
+        /** Initialization. The option SPARSE_QP_SOLUTION must be set to \n
+         *  SPARSE_SOLVER, otherwise RET_INVALID_OPTION is returned.      \n
+         */
+		virtual returnValue init(	VariablesGrid* x_init ,
+									VariablesGrid* xa_init,
+									VariablesGrid* p_init ,
+									VariablesGrid* u_init ,
+									VariablesGrid* w_init  );
 
 
-        /** Starts execution. */
-        virtual returnValue solve( int maxNumSteps );
+		/** Performs the current step and reduces the barrier parameter. */
+		virtual returnValue performCurrentStep( );
+
+
+		/** Returns the current barrier parameter. */
+		inline double getBarrierParameter( ) const;
 
 
     //
@@ -94,13 +116,26 @@ class IPmethod : public NLPsolver
     //
     protected:
 
+		/** Convergence is only checked once the barrier parameter has \n
+		 *  reached zero, i.e. for the original (non-perturbed) NLP.    \n
+		 */
+		virtual returnValue checkForConvergence( );
 
+		/** Reduces the barrier parameter (superlinearly) once the KKT  \n
+		 *  tolerance of the current barrier subproblem is small enough  \n
+		 *  and passes it to the sparse QP solver.                       \n
+		 *                                                               \n
+		 *  \return SUCCESSFUL_RETURN                                    \n
+		 */
+		returnValue updateBarrierParameter( );
 
 
     //
     // DATA MEMBERS:
     //
     protected:
+
+		double barrierParameter;
 };
 
 
@@ -42,6 +42,7 @@
 #include <acado/conic_solver/dense_qp_solver.hpp>
 #include <acado/conic_solver/banded_cp_solver.hpp>
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/sparse_based_cp_solver.hpp>
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
@@ -183,7 +184,7 @@ class SCPmethod : public NLPsolver
 
 		returnValue printIteration( );
 		
-        returnValue checkForConvergence( );
+        virtual returnValue checkForConvergence( );
 		
 
 		returnValue computeHessianMatrix(	const BlockMatrix& oldLagrangeGradient,
@@ -272,6 +273,9 @@ class SCPmethod : public NLPsolver
 		BooleanType hasPerformedStep;
 		BooleanType isInRealTimeMode;
 		BooleanType needToReevaluate;
+
+		Vector deltaX0;								/**< Workspace for embedding the initial value in a feedback step. */
+		Vector deltaP0;								/**< Workspace for embedding the parameters in a feedback step. */
 };
 
 
@@ -156,6 +156,21 @@ class Noise
 		inline BlockStatus getStatus( ) const;
 
 
+		/** Derives the seed of an independent pseudo-random number stream from a
+		 *	given seed and a stream index (e.g. the index of a noise component or
+		 *	of a member of a simulation ensemble). Equal arguments always yield
+		 *	equal seeds; a zero seed is kept (i.e. the system clock is used).
+		 *
+		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *	@param[in] idx		Index of stream.
+		 *
+		 *  \return Seed of stream with given index
+		 */
+		static uint deriveSeed(	uint seed,
+								uint idx
+								);
+
+
 
 	//
 	//  PROTECTED MEMBER FUNCTIONS:
@@ -181,7 +196,20 @@ class Noise
 		 */
 		inline double getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const;
+												);
+
+		/** Initializes the pseudo-random number generator of this noise block.
+		 *	Each noise block draws from its own generator, hence noise blocks
+		 *	seeded equally generate equal noise, independently of each other and
+		 *	of the thread they are running in. If seed is 0, a seed is obtained
+		 *	from the system clock.
+		 *
+		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue initializeRandomNumberGenerator(	uint seed
+														);
 
 
 	//
@@ -191,6 +219,8 @@ class Noise
 		BlockStatus status;				/**< Current status of the noise. */
 
 		VariablesGrid w;				/**< Sequence of most recently generated noise. */
+
+		uint randomState;				/**< State of the pseudo-random number generator. */
 };
 
 
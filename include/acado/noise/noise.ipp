@@ -74,15 +74,17 @@ inline returnValue Noise::setStatus(	BlockStatus _status
 
 inline double Noise::getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const
+												)
 {
 	double halfAmplitude = ( _upperLimit - _lowerLimit ) / 2.0;
 
-	/* Random number between -RAND_MAX and RAND_MAX */
-	int randomNumber = ( rand( ) - RAND_MAX/2 ) * 2;
+	/* Next state of xorshift generator (never zero) */
+	randomState ^= ( randomState << 13 ) & 0xFFFFFFFFu;
+	randomState ^= ( randomState >> 17 );
+	randomState ^= ( randomState <<  5 ) & 0xFFFFFFFFu;
 
 	/* Random number between -1 and 1 */
-	double scaledRandomNumber = ((double) randomNumber) / ((double) RAND_MAX);
+	double scaledRandomNumber = 2.0 * ((double) randomState) / 4294967295.0 - 1.0;
 
 	return ( halfAmplitude*scaledRandomNumber + _lowerLimit+halfAmplitude );
 }
@@ -172,6 +172,11 @@ class LSQTerm : public ObjectiveElement{
                                               *  to be stored for backward     \n
                                               *  differentiation               \n
                                               */
+
+    Matrix               zBatch         ;    /**< evaluation points of all grid points (one column each) */
+    Matrix               hBatch         ;    /**< LSQ function values at all grid points               */
+    EvaluationWorkspace  batchWorkspace ;    /**< trace of the last batched evaluation                 */
+    BooleanType          hasBatchTrace  ;    /**< whether the last evaluation was batched              */
 };
 
 
@@ -232,6 +232,22 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
                                   Expression **arg   );
 
 
+        /** Solves the subproblems of all weights concurrently using   \n
+         *  the given number of threads (see PARETO_FRONT_THREADS).     \n
+         *  The points are split into contiguous chunks, one per        \n
+         *  thread, and every subproblem is hot-started from the        \n
+         *  nearest (w.r.t. the weights) point that has already been    \n
+         *  solved in its chunk or by a single objective optimization.  \n
+         *  The objectives are evaluated in the order of the weights    \n
+         *  afterwards, hence the results do not depend on scheduling.  \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         */
+        returnValue solveConcurrently( const Matrix      &Weights ,
+                                       int                nThreads,
+                                       Expression       **arg       );
+
+
         /**  Evaluates the objectives.                                  \n
          *                                                              \n
          *  \return SUCCESSFUL_RETURN                                   \n
@@ -40,6 +40,7 @@
 #include <acado/ocp/ocp.hpp>
 #include <acado/nlp_solver/nlp_solver.hpp>
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/nlp_solver/ip_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -171,6 +172,14 @@ class OptimizationAlgorithmBase
 
 		returnValue clear( );
 
+		/** Waits until the NLP solver may be accessed by the calling thread. All getters  \n
+		 *  call this function first. It returns immediately by default; derived classes \n
+		 *  running NLP solver steps on a separate thread wait for them.                 \n
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue waitForNlpSolver( ) const;
+
 		/** Initializes everything. */
 		returnValue init(	UserInteraction* _userIteraction
 							);
@@ -200,12 +200,29 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 		 *	@param[in]  nextTime	Time at next step.
 		 *	@param[in]  _yRef		Piece of reference trajectory for next step (required for hotstarting).
 		 *
-		 *  \return SUCCESSFUL_RETURN
+		 *	If the option USE_ASYNCHRONOUS_PREPARATION is set, the preparation step
+		 *	is only started on a separate thread and this function returns immediately.
+		 *	All member functions accessing the NLP solver or its iterate (e.g. shift(),
+		 *	setReference(), getDifferentialStates() or getControls()) wait for the
+		 *	preparation to finish; the next feedback step (or waitForPreparationStep())
+		 *	additionally reports its result.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
 		 */
 		virtual returnValue preparationStep(	double nextTime = 0.0,
 												const VariablesGrid& _yRef = emptyConstVariablesGrid
 												);
 
+		/** Waits until a preparation step that has been started on a separate
+		 *	thread (see option USE_ASYNCHRONOUS_PREPARATION) has finished. Returns
+		 *	immediately if no preparation step is pending.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
+		 */
+		returnValue waitForPreparationStep( );
+
 
 		/** (not yet documented).
 		 *
@@ -387,6 +404,40 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 											BooleanType isLastIteration = BT_TRUE
 											);
 
+		/** Starts the preparation step on the separate thread, which is
+		 *	created at the first call.
+		 *
+		 *	@param[in]  _yRef		Piece of reference trajectory for next step.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
+		 */
+		returnValue startPreparationThread(	const VariablesGrid& _yRef
+											);
+
+		/** Waits for a pending preparation step and terminates the separate thread.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue stopPreparationThread( );
+
+		/** Waits until a preparation step running on the separate thread has
+		 *	finished, such that the NLP solver may be accessed. In contrast to
+		 *	waitForPreparationStep( ), its return value is kept.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue waitForNlpSolver( ) const;
+
+		/** Main loop of the separate thread performing the preparation steps.
+		 *
+		 *	@param[in]  _algorithm	Pointer to the real-time algorithm.
+		 *
+		 *  \return 0
+		 */
+		static void* runPreparationThread(	void* _algorithm
+											);
+
 
 	//
 	// DATA MEMBERS:
@@ -398,6 +449,9 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 
 		VariablesGrid* reference;		/**< Deep copy of the most recent reference. */
 
+		struct PreparationThread;
+		PreparationThread* preparationThread;	/**< Separate thread for asynchronous preparation steps (if started). */
+
 };
 
 
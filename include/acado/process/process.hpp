@@ -187,6 +187,20 @@ class Process : public SimulationBlock
 											);
 
 
+		/** Sets the seed from which the additive noise of the actuator and of the
+		 *	sensor is generated. Simulations of equally seeded processes with equal
+		 *	inputs yield equal outputs. A seed of 0 (default) uses the system clock.
+		 *
+		 *	@param[in]  _noiseSeed		Noise seed.
+		 *
+		 *	\note Takes effect at the next call of init().
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setNoiseSeed(	uint _noiseSeed
+									);
+
+
 		/** Initializes simulation with given start values.
 		 *
 		 *	@param[in]  _xStart		Initial value for differential states.
@@ -592,6 +606,20 @@ class Process : public SimulationBlock
 											VariablesGrid& _output
 											) const;
 
+		/** Copies given input trajectory into a grid of the simulation iterate.
+		 *	If both have the same dimensions, only time points and values are
+		 *	copied into the existing grid; otherwise it is re-allocated. An
+		 *	empty input trajectory deletes the grid.
+		 *
+		 *	@param[in,out] _target		Grid of the simulation iterate.
+		 *	@param[in]     _source		Input trajectory.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue updateIterateGrid(	VariablesGrid*& _target,
+										const VariablesGrid& _source
+										) const;
+
 
 	//
 	//  PROTECTED MEMBERS:
@@ -605,15 +633,18 @@ class Process : public SimulationBlock
 		DynamicSystem** dynamicSystems;				/**< Dynamic system to be used for simulation. */
 
 		ShootingMethod* integrationMethod;			/**< Integration method to be used for simulation. */
+		OCPiterate simulationIterate;				/**< Iterate re-used by all simulation steps. */
 	
 		Actuator* actuator;							/**< Actuator. */
 		Sensor* sensor;								/**< Sensor. */
 		Curve* processDisturbance;					/**< Process disturbance block. */
+		uint disturbanceCursor;						/**< Process disturbance interval of the last step. */
 
 		VariablesGrid y;
 
 		double lastTime;
 
+		uint noiseSeed;								/**< Seed for generating actuator and sensor noise (0 = system clock). */
 
 		IntegratorType integratorType;  // sorry -- quick hack.
 
@@ -127,6 +127,16 @@ class PeriodicReferenceTrajectory : public StaticReferenceTrajectory
 	//
 	protected:
 
+		/** Returns the time of the reference grid which corresponds to the given
+		 *	time, i.e. the time shifted into the first cycle.
+		 *
+		 *	@param[in]  _time	Time to be mapped.
+		 *
+		 *  \return Time of the reference grid
+		 */
+		virtual double getGridTime(	double _time
+									) const;
+
 
 
 	//
@@ -188,6 +188,16 @@ class StaticReferenceTrajectory : public ReferenceTrajectory
 	//
 	protected:
 
+		/** Returns the time of the reference grid which corresponds to the given
+		 *	time; for a static reference trajectory, this is the time itself.
+		 *
+		 *	@param[in]  _time	Time to be mapped.
+		 *
+		 *  \return Time of the reference grid
+		 */
+		virtual double getGridTime(	double _time
+									) const;
+
 
 
 	//
@@ -197,6 +207,7 @@ class StaticReferenceTrajectory : public ReferenceTrajectory
 
 // 		Curve yRef;
  		VariablesGrid yRef;				/** Pre-defined static reference trajectory. */
+		uint cursor;					/**< Reference interval of the current time (lookup start of getReference). */
 };
 
 
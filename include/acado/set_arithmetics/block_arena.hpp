@@ -0,0 +1,146 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+/**
+ *    \file   include/acado/set_arithmetics/block_arena.hpp
+ *    \author Boris Houska, Mario Villanueva, Benoit Chachuat
+ *    \date   2013
+ */
+
+
+#ifndef ACADO_TOOLKIT_BLOCK_ARENA_HPP
+#define ACADO_TOOLKIT_BLOCK_ARENA_HPP
+
+#include <vector>
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+//! @brief C++ template class providing fixed-size arrays from contiguous chunks
+////////////////////////////////////////////////////////////////////////
+//! BlockArena<U> hands out arrays ("blocks") of a fixed number of elements
+//! of type U. The blocks are carved from a few large chunks and released
+//! blocks are recycled via a free list, such that the TaylorVariables of a
+//! TaylorModel (which all have coefficient arrays of the same length) do
+//! not call new/delete in each arithmetic operation. The elements of the
+//! chunks are constructed once and are not reset when recycled.
+//!
+//! The arena is owned by a TaylorModel, but blocks may still be in use
+//! when their model is destroyed. The owner therefore calls detach()
+//! instead of deleting the arena, which deletes itself after its last
+//! block has been released.
+////////////////////////////////////////////////////////////////////////
+template <typename U>
+class BlockArena
+////////////////////////////////////////////////////////////////////////
+{
+public:
+
+  //! @brief Constructor for blocks of <a>nelem</a> elements
+  BlockArena
+    ( const unsigned int nelem ):
+    _nelem( nelem>0? nelem: 1 ), _nused(0), _ichunk(0), _iblock(0),
+    _detached(false)
+    {}
+
+  //! @brief Returns a block of <a>nelem()</a> elements
+  U* allocate()
+    {
+      _nused++;
+      if( !_free.empty() ){
+        U*p = _free.back();
+        _free.pop_back();
+        return p;
+      }
+      if( _ichunk < _chunks.size() && _iblock == _chunkSize( _ichunk ) ){
+        _ichunk++; _iblock = 0;
+      }
+      if( _ichunk == _chunks.size() )
+        _chunks.push_back( new U[ _chunkSize( _ichunk )*_nelem ] );
+      return _chunks[_ichunk] + (_iblock++)*_nelem;
+    }
+
+  //! @brief Returns a block to the arena
+  void release
+    ( U*p )
+    {
+      if( !p ) return;
+      _free.push_back( p );
+      if( --_nused == 0 && _detached ) delete this;
+    }
+
+  //! @brief Deletes the arena once the last block has been released
+  void detach()
+    {
+      if( !_nused ) delete this;
+      else _detached = true;
+    }
+
+  //! @brief Number of elements per block
+  unsigned int nelem() const
+    { return _nelem; }
+  //! @brief Number of blocks in use
+  unsigned int nused() const
+    { return _nused; }
+
+private:
+
+  //! @brief Destructor (see detach)
+  ~BlockArena()
+    {
+      for( unsigned int i=0; i<_chunks.size(); i++ ) delete[] _chunks[i];
+    }
+
+  BlockArena
+    ( const BlockArena<U>& );
+  BlockArena<U>& operator=
+    ( const BlockArena<U>& );
+
+  //! @brief Number of blocks in chunk <a>i</a> (doubling up to 1024)
+  static unsigned int _chunkSize
+    ( const unsigned int i )
+    { return i<6? 32u<<i: 1024u; }
+
+  //! @brief Number of elements per block
+  unsigned int _nelem;
+  //! @brief Number of blocks in use
+  unsigned int _nused;
+  //! @brief Chunk and block that are carved next
+  unsigned int _ichunk, _iblock;
+  //! @brief Flag indicating that the owner has gone
+  bool _detached;
+  //! @brief Allocated chunks
+  std::vector<U*> _chunks;
+  //! @brief Released blocks
+  std::vector<U*> _free;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+#endif  // ACADO_TOOLKIT_BLOCK_ARENA_HPP
+
+/*
+ *	end of file
+ */
@@ -34,6 +34,7 @@
 #define ACADO_TOOLKIT_TAYLOR_MODEL_HPP
 
 #include <acado/utils/acado_utils.hpp>
+#include <acado/set_arithmetics/block_arena.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -182,6 +183,11 @@ private:
   //! @brief Taylor variable to speed-up computations and reduce dynamic allocation
   TaylorVariable<T>* _TV;
 
+  //! @brief Storage of the monomial coefficients of the Taylor variables
+  BlockArena<double>* _coefarena;
+  //! @brief Storage of the term bounds of the Taylor variables
+  BlockArena<T>* _bndarena;
+
   //! @brief Set the order (nord) and number of variables (nvar)
   void _size
     ( const unsigned int nvar, const unsigned int nord );
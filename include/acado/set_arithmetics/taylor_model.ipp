@@ -54,6 +54,9 @@ TaylorModel<T>::_size
   _scaling = new double[_nvar];
   _modvar = true;
 
+  _coefarena = new BlockArena<double>( _nmon );
+  _bndarena  = new BlockArena<T>( _nord+2 );
+
   _TV = new TaylorVariable<T>( this );
 }
 
@@ -232,6 +235,9 @@ TaylorModel<T>::_cleanup()
   delete[] _scaling;
   delete[] _binom;
   delete _TV;
+  // (the coefficient arrays of remaining Taylor variables stay valid)
+  _coefarena->detach();
+  _bndarena->detach();
 }
 
 template <typename T> template< typename U > inline void
@@ -203,7 +203,7 @@ public:
 
   //! @brief Class destructor
   ~TaylorVariable()
-    { delete [] _coefmon; delete [] _bndord; }
+    { _clean(); }
 
   //! @brief Set the index and range for the variable <a>ivar</a>, that belongs to the interval <a>X</a>.
   TaylorVariable<T>& set
@@ -334,6 +334,10 @@ private:
   T * _bndrem;
   //! @brief Interval bound evaluated in T arithmetic
   T _bndT;
+  //! @brief Arena of _coefmon (null if not linked to a TaylorModel)
+  BlockArena<double> *_coefarena;
+  //! @brief Arena of _bndord (null if not linked to a TaylorModel)
+  BlockArena<T> *_bndarena;
 
   //! @brief Initialize private members
   void _init();
@@ -253,20 +253,30 @@ template <typename T> inline void
 TaylorVariable<T>::_init()
 {
   if( !_TM ){
+    _coefarena = 0;
+    _bndarena  = 0;
     _coefmon = new double[1];
     _bndord  = new T[1];
     _bndrem  = _bndord;
     return;
   }
-  _coefmon = new double[_nmon()];
-  _bndord  = new T[_nord()+2];
+  _coefarena = _TM->_coefarena;
+  _bndarena  = _TM->_bndarena;
+  _coefmon = _coefarena->allocate();
+  _bndord  = _bndarena->allocate();
   _bndrem  = _bndord + _nord()+1;
 }
 
 template <typename T> inline void
 TaylorVariable<T>::_clean()
 {
-  delete [] _coefmon; delete [] _bndord;
+  if( _coefarena ){
+    _coefarena->release( _coefmon );
+    _bndarena->release( _bndord );
+  }
+  else{
+    delete [] _coefmon; delete [] _bndord;
+  }
   _coefmon = 0; _bndord = _bndrem = 0;
 }
 
@@ -0,0 +1,263 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/simulation_environment/ensemble_statistics.hpp
+*    \author Hans Joachim Ferreau, Boris Houska
+*/
+
+
+#ifndef ACADO_TOOLKIT_ENSEMBLE_STATISTICS_HPP
+#define ACADO_TOOLKIT_ENSEMBLE_STATISTICS_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/variables_grid/variables_grid.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+/**
+ *	\brief Accumulates statistics of the trajectories of a simulation ensemble.
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	The class EnsembleStatistics accumulates the mean, the variance and a number
+ *	of quantiles of trajectories that are given on a common time grid, e.g. the
+ *	process outputs of all members of a Monte-Carlo simulation ensemble (see
+ *	SimulationEnvironment::runEnsemble).
+ *
+ *	The trajectories are not stored: mean and variance are updated by Welford's
+ *	method and the quantiles are estimated by the P-square algorithm of Jain and
+ *	Chlamtac, i.e. the memory required does not depend on the ensemble size. The
+ *	quantile estimates are exact for up to five members and depend on the order
+ *	in which the members are added.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class EnsembleStatistics
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor.
+		 */
+		EnsembleStatistics( );
+
+		/** Constructor which takes the time grid of the trajectories and the
+		 *	probabilities of the quantiles to be estimated.
+		 *
+		 *	@param[in] _grid			Time grid of the trajectories.
+		 *	@param[in] _probabilities	Probabilities of the quantiles (each in [0,1]).
+		 */
+		EnsembleStatistics(	const Grid& _grid,
+							const Vector& _probabilities = emptyConstVector
+							);
+
+		/** Copy constructor (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		EnsembleStatistics(	const EnsembleStatistics& rhs
+							);
+
+		/** Destructor.
+		 */
+		~EnsembleStatistics( );
+
+		/** Assignment operator (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		EnsembleStatistics& operator=(	const EnsembleStatistics& rhs
+										);
+
+
+		/** Initializes the statistics for trajectories on the given time grid,
+		 *	discarding all members added so far.
+		 *
+		 *	@param[in] _grid			Time grid of the trajectories.
+		 *	@param[in] _probabilities	Probabilities of the quantiles (each in [0,1]).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue init(	const Grid& _grid,
+							const Vector& _probabilities = emptyConstVector
+							);
+
+
+		/** Adds the trajectory of one ensemble member to the statistics. The first
+		 *	trajectory added determines the dimension of all further ones.
+		 *
+		 *	@param[in] member	Trajectory given on the time grid of the statistics.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue add(	const VariablesGrid& member
+							);
+
+
+		/** Returns the mean of all trajectories added so far.
+		 *
+		 *	@param[out] _mean	Mean trajectory.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue getMean(	VariablesGrid& _mean
+								) const;
+
+		/** Returns the (unbiased) sample variance of all trajectories added so far.
+		 *
+		 *	@param[out] _variance	Variance at each grid point.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue getVariance(	VariablesGrid& _variance
+									) const;
+
+		/** Returns the estimate of the quantile with given index.
+		 *
+		 *	@param[in]  idx			Index of the quantile (in the order of the probabilities).
+		 *	@param[out] _quantile	Quantile at each grid point.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		returnValue getQuantile(	uint idx,
+									VariablesGrid& _quantile
+									) const;
+
+
+		/** Returns the time grid of the trajectories.
+		 *
+		 *	\return Time grid of the trajectories
+		 */
+		inline const Grid& getGrid( ) const;
+
+		/** Returns the dimension of the trajectories (0 before the first member has been added).
+		 *
+		 *	\return Dimension of the trajectories
+		 */
+		inline uint getDim( ) const;
+
+		/** Returns the number of members added so far.
+		 *
+		 *	\return Number of members
+		 */
+		inline uint getNumMembers( ) const;
+
+		/** Returns the number of quantiles estimated.
+		 *
+		 *	\return Number of quantiles
+		 */
+		inline uint getNumQuantiles( ) const;
+
+
+
+	//
+	//  PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Frees all memory and resets the statistics to an empty state.
+		 */
+		void clear( );
+
+		/** Copies all members of the given object.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		void copy(	const EnsembleStatistics& rhs
+					);
+
+		/** Updates the P-square markers of one quantile of one component
+		 *	with a new observation.
+		 *
+		 *	@param[in]     p			Probability of the quantile.
+		 *	@param[in,out] heights		Heights of the five markers.
+		 *	@param[in,out] positions	Positions of the five markers.
+		 *	@param[in]     x			New observation.
+		 */
+		void updateQuantile(	double p,
+								double* heights,
+								int* positions,
+								double x
+								) const;
+
+		/** Returns the current estimate of one quantile of one component.
+		 *
+		 *	@param[in] p			Probability of the quantile.
+		 *	@param[in] heights		Heights of the five markers.
+		 *
+		 *	\return Estimate of the quantile
+		 */
+		double evaluateQuantile(	double p,
+									const double* heights
+									) const;
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+
+		Grid grid;									/**< Time grid of the trajectories. */
+		Vector probabilities;						/**< Probabilities of the quantiles to be estimated. */
+
+		uint dim;									/**< Dimension of the trajectories. */
+		uint nMembers;								/**< Number of members added so far. */
+
+		double* mean;								/**< Mean of each component at each grid point. */
+		double* squaredDeviations;					/**< Sum of squared deviations from the mean of each component at each grid point. */
+
+		double* markerHeights;						/**< Heights of the five P-square markers of each quantile of each component at each grid point. */
+		int*    markerPositions;					/**< Positions of the five P-square markers of each quantile of each component at each grid point. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/simulation_environment/ensemble_statistics.ipp>
+
+
+#endif	// ACADO_TOOLKIT_ENSEMBLE_STATISTICS_HPP
+
+
+/*
+ *	end of file
+ */
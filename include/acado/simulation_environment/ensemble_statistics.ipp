@@ -0,0 +1,69 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/simulation_environment/ensemble_statistics.ipp
+*    \author Hans Joachim Ferreau, Boris Houska
+*/
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+//  PUBLIC MEMBER FUNCTIONS:
+//
+
+inline const Grid& EnsembleStatistics::getGrid( ) const
+{
+	return grid;
+}
+
+
+inline uint EnsembleStatistics::getDim( ) const
+{
+	return dim;
+}
+
+
+inline uint EnsembleStatistics::getNumMembers( ) const
+{
+	return nMembers;
+}
+
+
+inline uint EnsembleStatistics::getNumQuantiles( ) const
+{
+	return probabilities.getDim( );
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
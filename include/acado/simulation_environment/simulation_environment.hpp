@@ -36,6 +36,7 @@
 #include <acado/utils/acado_utils.hpp>
 
 #include <acado/simulation_environment/simulation_block.hpp>
+#include <acado/simulation_environment/ensemble_statistics.hpp>
 
 #include <acado/clock/clock.hpp>
 #include <acado/curve/curve.hpp>
@@ -206,6 +207,60 @@ class SimulationEnvironment : public SimulationBlock
 		returnValue run( );
 
 
+		/** Runs a Monte-Carlo ensemble of complete simulations, one for each row of
+		 *	the given matrix of initial values, and accumulates the statistics of the
+		 *	process outputs on the grid of the given statistics. Each member simulates
+		 *	copies of the process and of the controller (including control law, estimator
+		 *	and reference trajectory), whose noise is generated from the stream
+		 *	Noise::deriveSeed( _seed,memberIdx ); hence, member k can be reproduced by
+		 *	a single simulation after calling process.setNoiseSeed( Noise::deriveSeed( _seed,k ) ).
+		 *
+		 *	The members are simulated concurrently by the number of threads given by the
+		 *	option ENSEMBLE_THREADS (if OpenMP is available), but they are always added to
+		 *	the statistics in the order of their indices. Thus, the results do not depend
+		 *	on the number of threads. Members whose simulation fails are not added.
+		 *
+		 *	@param[in]     _x0					Initial values for differential states (one row per member).
+		 *	@param[in,out] _outputStatistics	Statistics of the process outputs (initialized with time grid).
+		 *	@param[in]     _seed				Seed for generating the noise of the ensemble (0 = system clock).
+		 *
+		 *	\note The statistics are accumulated, i.e. members of previous calls are kept.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_NO_CONTROLLER_SPECIFIED, \n
+		 *	        RET_NO_PROCESS_SPECIFIED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue runEnsemble(	const Matrix& _x0,
+									EnsembleStatistics& _outputStatistics,
+									uint _seed = 0
+									);
+
+		/** Runs a Monte-Carlo ensemble of complete simulations, one for each row of
+		 *	the given matrix of initial values, and accumulates the statistics of the
+		 *	process outputs and of the feedback controls (see above).
+		 *
+		 *	@param[in]     _x0					Initial values for differential states (one row per member).
+		 *	@param[in,out] _outputStatistics	Statistics of the process outputs (initialized with time grid).
+		 *	@param[in,out] _controlStatistics	Statistics of the feedback controls (initialized with time grid).
+		 *	@param[in]     _seed				Seed for generating the noise of the ensemble (0 = system clock).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_NO_CONTROLLER_SPECIFIED, \n
+		 *	        RET_NO_PROCESS_SPECIFIED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue runEnsemble(	const Matrix& _x0,
+									EnsembleStatistics& _outputStatistics,
+									EnsembleStatistics& _controlStatistics,
+									uint _seed = 0
+									);
+
+
 		/** Returns number of process outputs.
 		 *
 		 *	\return Number of process outputs
@@ -347,6 +402,27 @@ class SimulationEnvironment : public SimulationBlock
 											) const;
 
 
+		/** Runs a Monte-Carlo ensemble of complete simulations (see runEnsemble).
+		 *
+		 *	@param[in]     _x0					Initial values for differential states (one row per member).
+		 *	@param[in,out] _outputStatistics	Statistics of the process outputs.
+		 *	@param[in,out] _controlStatistics	Statistics of the feedback controls (optional, may be 0).
+		 *	@param[in]     _seed				Seed for generating the noise of the ensemble.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_NO_CONTROLLER_SPECIFIED, \n
+		 *	        RET_NO_PROCESS_SPECIFIED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue simulateEnsemble(	const Matrix& _x0,
+										EnsembleStatistics* _outputStatistics,
+										EnsembleStatistics* _controlStatistics,
+										uint _seed
+										);
+
+
 	//
 	//  PROTECTED MEMBERS:
 	//
@@ -106,14 +106,17 @@ inline returnValue SimulationEnvironment::getSampledProcessOutput(	VariablesGrid
 inline returnValue SimulationEnvironment::getProcessDifferentialStates(	VariablesGrid& _diffStates
 																		)
 {
-	MatrixVariablesGrid tmp;
+	VariablesGrid tmp, lastStep;
 	if ( process->getAll( LOG_DIFFERENTIAL_STATES,tmp ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
-	_diffStates.init( );
-	
-	for( int i=0; i<(int)tmp.getNumPoints()-1; ++i )
-		_diffStates.appendTimes( tmp.getMatrix( i ) );
+	process->getLast( LOG_DIFFERENTIAL_STATES,lastStep );
+
+	// trajectories of all but the last process step (which may differ in their number of points)
+	if ( tmp.getNumPoints( ) > lastStep.getNumPoints( ) )
+		_diffStates = tmp.getTimeSubGrid( 0,tmp.getNumPoints( )-lastStep.getNumPoints( )-1 );
+	else
+		_diffStates.init( );
 
 	_diffStates.setType( VT_DIFFERENTIAL_STATE );
 	
@@ -124,14 +127,17 @@ inline returnValue SimulationEnvironment::getProcessDifferentialStates(	Variable
 inline returnValue SimulationEnvironment::getProcessAlgebraicStates(	VariablesGrid& _algStates
 																		)
 {
-	MatrixVariablesGrid tmp;
+	VariablesGrid tmp, lastStep;
 	if( process->getAll( LOG_ALGEBRAIC_STATES,tmp ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
-	_algStates.init( );
-	
-	for( int i=0; i<(int)tmp.getNumPoints()-1; ++i )
-		_algStates.appendTimes( tmp.getMatrix( i ) );
+	process->getLast( LOG_ALGEBRAIC_STATES,lastStep );
+
+	// trajectories of all but the last process step (which may differ in their number of points)
+	if ( tmp.getNumPoints( ) > lastStep.getNumPoints( ) )
+		_algStates = tmp.getTimeSubGrid( 0,tmp.getNumPoints( )-lastStep.getNumPoints( )-1 );
+	else
+		_algStates.init( );
 
 	_algStates.setType( VT_ALGEBRAIC_STATE );
 	
@@ -142,14 +148,17 @@ inline returnValue SimulationEnvironment::getProcessAlgebraicStates(	VariablesGr
 inline returnValue SimulationEnvironment::getProcessIntermediateStates(	VariablesGrid& _interStates
 																		)
 {
-	MatrixVariablesGrid tmp;
+	VariablesGrid tmp, lastStep;
 	if( process->getAll( LOG_INTERMEDIATE_STATES,tmp ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
-	_interStates.init( );
+	process->getLast( LOG_INTERMEDIATE_STATES,lastStep );
 
-	for( int i=0; i<(int)tmp.getNumPoints()-1; ++i )
-		_interStates.appendTimes( tmp.getMatrix( i ) );
+	// trajectories of all but the last process step (which may differ in their number of points)
+	if ( tmp.getNumPoints( ) > lastStep.getNumPoints( ) )
+		_interStates = tmp.getTimeSubGrid( 0,tmp.getNumPoints( )-lastStep.getNumPoints( )-1 );
+	else
+		_interStates.init( );
 
 	_interStates.setType( VT_INTERMEDIATE_STATE );
 	
@@ -111,6 +111,19 @@ class SparseSolver{
         virtual returnValue setMatrix( double *A_ ) = 0;
 
 
+        /** Sets the matrix A \in R^{n \times n} from a dense, row-wise  \n
+         *  stored array. All entries with an absolute value larger    \n
+         *  than  ZERO_TOL  are treated as non-zero elements.           \n
+         *                                                             \n
+         *  Solvers which are able to reuse the analysis of a previous \n
+         *  matrix with the same sparsity pattern should overload this \n
+         *  routine.                                                   \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         */
+        virtual returnValue setDenseMatrix( const int &n, const double *A_ );
+
+
 
         /**  Solves the system  A*x = b  for the specified data.       \n
          *                                                             \n
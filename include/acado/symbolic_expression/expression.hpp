@@ -265,6 +265,14 @@ class Expression{
         Expression ADbackward( const Expression &arg, const Expression &seed ) const;
 
 
+        /** Returns an equivalent expression in which all structurally identical \n
+         *  subexpressions (of all components) are computed only once, i.e.      \n
+         *  they are replaced by shared intermediate states.                      \n
+         *  \return The expression with shared subexpressions.                   \n
+         */
+        Expression shareSubexpressions( ) const;
+
+
         ConstraintComponent operator<=( const double& ub ) const;
         ConstraintComponent operator>=( const double& lb ) const;
         ConstraintComponent operator==( const double&  b ) const;
@@ -0,0 +1,518 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/symbolic_operator/evaluation_tape.hpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#ifndef ACADO_TOOLKIT_EVALUATION_TAPE_HPP
+#define ACADO_TOOLKIT_EVALUATION_TAPE_HPP
+
+
+#include <acado/symbolic_operator/evaluation_base.hpp>
+#include <acado/symbolic_operator/native_code.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief A single instruction of an EvaluationTape.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+struct TapeInstruction{
+
+	TapeInstructionCode code;	/**< The instruction code.                                */
+	int                 dest;	/**< Target register (or target index for stores).        */
+	int                 arg1;	/**< First argument register (or index into x for loads). */
+	int                 arg2;	/**< Second argument register (or integer exponent).      */
+	double              value;	/**< Constant value (TIC_LOAD_CONSTANT only).             */
+};
+
+
+class EvaluationTape;
+
+
+/**
+ *	\brief Caller-owned work memory for evaluating an EvaluationTape.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class EvaluationWorkspace holds all registers, derivative registers
+ *	and the value trace needed for evaluating a compiled function including
+ *	its first order derivatives. As the tape itself is never written during
+ *	evaluation, a single function can be evaluated concurrently from several
+ *	threads as long as each thread uses its own workspace. A workspace for
+ *	several points additionally keeps the trace of a batched evaluation,
+ *	such that backward derivatives can be computed at each of the points
+ *	without evaluating the function again.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class EvaluationWorkspace{
+
+friend class EvaluationTape;
+
+public:
+
+	/** Default constructor. */
+	EvaluationWorkspace();
+
+	/** Constructor which allocates the memory needed by the given tape. */
+	EvaluationWorkspace(	const EvaluationTape& tape,
+							int nDirections_ = 1,
+							int nPoints_ = 1
+							);
+
+	/** Copy constructor (deep copy). */
+	EvaluationWorkspace( const EvaluationWorkspace& rhs );
+
+	/** Destructor. */
+	virtual ~EvaluationWorkspace();
+
+	/** Assignment operator (deep copy). */
+	EvaluationWorkspace& operator=( const EvaluationWorkspace& rhs );
+
+
+	/** Allocates the memory needed by the given tape for propagating
+	 *  nDirections_ forward directions at once or for evaluating it at
+	 *  nPoints_ points at once (see EvaluationTape::evaluateBatch).
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue init(	const EvaluationTape& tape,
+						int nDirections_ = 1,
+						int nPoints_ = 1
+						);
+
+
+	/** Returns whether the workspace is large enough for the given tape,
+	 *  number of forward directions and number of points. */
+	BooleanType fits(	const EvaluationTape& tape,
+						int nDirections_ = 1,
+						int nPoints_ = 1
+						) const;
+
+
+protected:
+
+	void allocate(	int nRegisters_,
+					int nTrace_,
+					int nDirections_ = 1,
+					int nPoints_ = 1
+					);
+
+	void copy( const EvaluationWorkspace& rhs );
+
+
+protected:
+
+	int     nRegisters;	/**< Number of (derivative) registers.        */
+	int     nTrace;		/**< Length of the value trace.               */
+	int     nDirections;	/**< Number of derivative registers per register. */
+	int     nPoints;		/**< Number of points the registers and the trace are allocated for. */
+	int     nTracedPoints;	/**< Number of points of the trace recorded by the last batched evaluation. */
+
+	double *w;			/**< Registers.                               */
+	double *dw;			/**< Derivative (or adjoint) registers.       */
+	double *trace;		/**< Argument values recorded for backward AD. */
+};
+
+
+/**
+ *	\brief Flat, register-based instruction tape for evaluating symbolic expressions.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class EvaluationTape lowers operator trees into a linear sequence of
+ *	instructions operating on a dense work array of registers. It is filled
+ *	by visiting the operator trees (it implements the EvaluationBase
+ *	interface for this purpose) and afterwards evaluates the whole function
+ *	in a single loop without virtual function calls and without touching the
+ *	evaluation buffers of the operators. The arithmetic is carried out in the
+ *	same way as by Operator::evaluate, hence results are bitwise identical.
+ *
+ *	Registers are assigned in stack order, i.e. the work array only needs to
+ *	be as large as the depth of the deepest expression. Subexpressions that
+ *	are used several times (see shareSubexpressions) are kept in shared
+ *	registers below the stack, such that they are evaluated only once.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class EvaluationTape : public EvaluationBase{
+
+public:
+
+	/** Default constructor. */
+	EvaluationTape();
+
+	/** Copy constructor (deep copy). */
+	EvaluationTape( const EvaluationTape& rhs );
+
+	/** Destructor. */
+	virtual ~EvaluationTape();
+
+	/** Assignment operator (deep copy). */
+	EvaluationTape& operator=( const EvaluationTape& rhs );
+
+
+	/** Removes all instructions from the tape.
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue clear( );
+
+
+	/** Declares nShared_ subexpressions which are used several times by the
+	 *  expressions added afterwards; they are referred to by projections onto
+	 *  the indices firstIndex_, ..., firstIndex_+nShared_-1 (like the ones
+	 *  created by a SubexpressionTable). Each of them is evaluated once at
+	 *  its first use and kept in a shared register for all further uses.
+	 *  The tape keeps copies of the arguments until it is cleared.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_USE_OF_FUNCTION
+	 */
+	returnValue shareSubexpressions(	int firstIndex_,
+										int nShared_,
+										Operator **args
+										);
+
+
+	/** Appends the instructions for evaluating the given expression and
+	 *  writing its value back into x[xIndex] (intermediate state).
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS
+	 */
+	returnValue addIntermediateState(	Operator& arg,
+										int xIndex
+										);
+
+	/** Appends the instructions for evaluating the given expression and
+	 *  writing its value into result[component].
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS
+	 */
+	returnValue addComponent(	Operator& arg,
+								int component
+								);
+
+
+	/** Evaluates the tape using the internal work array.
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue evaluate(	double *x,
+							double *result
+							);
+
+	/** Evaluates the tape using a work array provided by the caller which
+	 *  must have at least getWorkspaceSize() entries.
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue evaluate(	double *x,
+							double *result,
+							double *work
+							) const;
+
+
+	/** Evaluates the tape using a workspace provided by the caller.
+	 *  This routine does not modify the tape and can be called
+	 *  concurrently with distinct workspaces.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue evaluate(	double *x,
+							double *result,
+							EvaluationWorkspace& ws
+							) const;
+
+	/** Evaluates the tape at nPoints points at once using the internal
+	 *  batch work array (which grows as needed). The points are stored as
+	 *  a structure of arrays, i.e. component k of point j is found at
+	 *  x[k*nPoints+j] (and is written into result[k*nPoints+j]).
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue evaluateBatch(	int nPoints,
+								double *x,
+								double *result
+								);
+
+	/** Evaluates the tape at nPoints points at once using a work array
+	 *  provided by the caller which must have at least
+	 *  nPoints*getWorkspaceSize() entries. Each instruction is applied to
+	 *  all points in one contiguous loop, such that the compiler can
+	 *  vectorize across the points. The results are identical to the ones
+	 *  of nPoints calls of evaluate().
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue evaluateBatch(	int nPoints,
+								double *x,
+								double *result,
+								double *work
+								) const;
+
+	/** Evaluates the tape at nPoints points at once using a workspace
+	 *  provided by the caller (which has to be initialized for at least
+	 *  nPoints points). In addition, the arguments of all instructions
+	 *  are recorded in the trace of the workspace, such that backward
+	 *  derivatives at each of the points can be computed afterwards
+	 *  without evaluating the tape again (see AD_backward).
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue evaluateBatch(	int nPoints,
+								double *x,
+								double *result,
+								EvaluationWorkspace& ws
+								) const;
+
+
+	/** Automatic differentiation in forward mode using a workspace
+	 *  provided by the caller. The directional derivatives of the
+	 *  intermediate states are written into seed (like for the
+	 *  operator tree).
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue AD_forward(	double *x,
+							double *seed,
+							double *f,
+							double *df,
+							EvaluationWorkspace& ws
+							) const;
+
+	/** Automatic differentiation in forward mode for nDirections
+	 *  directions at once using a workspace provided by the caller
+	 *  (which has to be initialized for at least nDirections directions).
+	 *  The directions are stored contiguously, i.e. the seed of variable k
+	 *  in direction j is found at seed[k*nDirections+j] (likewise for df).
+	 *  Each instruction computes its value only once and then updates the
+	 *  derivatives of all directions in one contiguous loop. The results
+	 *  are identical to the ones of nDirections single-direction calls.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue AD_forward(	int nDirections,
+							double *x,
+							double *seed,
+							double *f,
+							double *df,
+							EvaluationWorkspace& ws
+							) const;
+
+	/** Automatic differentiation in backward mode using a workspace
+	 *  provided by the caller. The function is evaluated at x first,
+	 *  afterwards the adjoint seed is propagated backwards and added
+	 *  to df.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue AD_backward(	double *x,
+								double *seed,
+								double *df,
+								EvaluationWorkspace& ws
+								) const;
+
+	/** Automatic differentiation in backward mode at the given point of
+	 *  the last batched evaluation into the workspace (see evaluateBatch).
+	 *  Only the backward sweep is carried out, based on the recorded
+	 *  trace; the adjoint seed is propagated backwards and added to df.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_ARGUMENTS
+	 */
+	returnValue AD_backward(	int point,
+								double *seed,
+								double *df,
+								EvaluationWorkspace& ws
+								) const;
+
+
+	/** Exports the tape as C++ source defining the (extern "C") routines
+	 *  acado_native_evaluate, acado_native_forward and acado_native_backward,
+	 *  which carry out the same arithmetic as evaluate(), the multi-direction
+	 *  AD_forward() and AD_backward(), respectively.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_UNABLE_TO_EXPORT_CODE
+	 */
+	returnValue exportCode(	FILE *file
+							) const;
+
+	/** Compiles the tape into native code using the system compiler and
+	 *  loads it (see NativeCode::load). Afterwards, all evaluation and
+	 *  derivative routines of the tape run through the native code. The
+	 *  native code is dropped together with the instructions.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_USE_OF_FUNCTION, \n
+	 *          RET_UNABLE_TO_COMPILE_NATIVE_CODE, \n
+	 *          RET_UNABLE_TO_LOAD_NATIVE_CODE, \n
+	 *          RET_NATIVE_CODE_CACHE_NOT_SECURE
+	 */
+	returnValue compileNative(	const char *compiler = 0,
+								const char *cacheDirectory = 0
+								);
+
+	/** Returns whether the tape runs through native code. */
+	inline BooleanType isNative( ) const;
+
+
+	/** Returns whether the tape holds any instructions. */
+	inline BooleanType isEmpty( ) const;
+
+	/** Returns the number of instructions on the tape. */
+	inline int getNumInstructions( ) const;
+
+	/** Returns the number of registers needed for evaluating the tape. */
+	inline int getWorkspaceSize( ) const;
+
+
+	/** Visitor interface used while lowering operator trees. */
+	virtual void addition   ( Operator &arg1, Operator &arg2 );
+	virtual void subtraction( Operator &arg1, Operator &arg2 );
+	virtual void product    ( Operator &arg1, Operator &arg2 );
+	virtual void quotient   ( Operator &arg1, Operator &arg2 );
+	virtual void power      ( Operator &arg1, Operator &arg2 );
+	virtual void powerInt   ( Operator &arg1, int      &arg2 );
+
+	virtual void project    ( int      &idx );
+	virtual void set        ( double   &arg );
+	virtual void Acos       ( Operator &arg );
+	virtual void Asin       ( Operator &arg );
+	virtual void Atan       ( Operator &arg );
+	virtual void Cos        ( Operator &arg );
+	virtual void Exp        ( Operator &arg );
+	virtual void Log        ( Operator &arg );
+	virtual void Sin        ( Operator &arg );
+	virtual void Tan        ( Operator &arg );
+
+
+protected:
+
+	/** Lowers the expression arg into register reg_. */
+	returnValue record(	Operator& arg,
+						int reg_
+						);
+
+	/** Visits arg such that its value ends up in register reg_. */
+	void visit(	Operator& arg,
+				int reg_
+				);
+
+	void unary(	TapeInstructionCode code_,
+				Operator& arg
+				);
+
+	void binary(	TapeInstructionCode code_,
+					Operator& arg1,
+					Operator& arg2
+					);
+
+	void append(	TapeInstructionCode code_,
+					int dest_,
+					int arg1_,
+					int arg2_,
+					double value_ = 0.0
+					);
+
+	/** Evaluates the tape at nPoints points at once and, if trace is
+	 *  not null, records the arguments of all instructions (the trace
+	 *  entry k of instruction i at point j is trace[(2*i+k)*nPoints+j]). */
+	void batchSweep(	int nPoints,
+						double *x,
+						double *result,
+						double *w,
+						double *trace
+						) const;
+
+	/** Propagates the adjoint seed backwards based on a recorded trace,
+	 *  whose entries of consecutive instructions are stride apart. */
+	void backwardSweep(	const double *trace,
+						int stride,
+						double *seed,
+						double *df,
+						double *adj
+						) const;
+
+	/** Exports the plain evaluation statement of a single instruction. */
+	void exportInstruction(	FILE *file,
+							const TapeInstruction &it
+							) const;
+
+	void copy( const EvaluationTape& rhs );
+
+	/** Deletes the arguments of the shared subexpressions. */
+	void clearShared( );
+
+
+protected:
+
+	TapeInstruction *instructions;		/**< The instructions.                         */
+	int              nInstructions;		/**< Number of instructions on the tape.       */
+	int              maxInstructions;	/**< Allocated length of the instruction array. */
+
+	int              nRegisters;		/**< Size of the work array.                   */
+	double          *work;				/**< Internal work array.                      */
+	double          *batchWork;		/**< Internal work array for batched evaluation. */
+	int              nBatchWork;		/**< Allocated length of the batch work array.  */
+
+	int              reg;				/**< Current target register while recording.  */
+	BooleanType      isValid;			/**< Whether all visited operators were lowered. */
+
+	int              firstShared;		/**< Index of the first shared subexpression.    */
+	int              nShared;			/**< Number of shared subexpressions (registers). */
+	Operator       **shared;			/**< Arguments of the shared subexpressions.     */
+	BooleanType     *isStored;			/**< Whether a shared register has been written. */
+
+	NativeCode       native;			/**< Compiled form of the tape (if any).         */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/symbolic_operator/evaluation_tape.ipp>
+
+
+#endif
+
+// end of file.
@@ -0,0 +1,188 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/symbolic_operator/native_code.hpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#ifndef ACADO_TOOLKIT_NATIVE_CODE_HPP
+#define ACADO_TOOLKIT_NATIVE_CODE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+class EvaluationTape;
+
+
+/** Signature of the generated routine evaluating a tape. */
+typedef void (*NativeEvaluateFcn)(	double *x, double *f );
+
+/** Signature of the generated routine for forward AD (nDirections at once). */
+typedef void (*NativeForwardFcn)(	int nDirections, double *x, double *seed,
+									double *f, double *df, double *dw );
+
+/** Signature of the generated routine for backward AD. */
+typedef void (*NativeBackwardFcn)(	double *x, double *seed, double *df,
+									double *adj, double *trace );
+
+
+/**
+ *	\brief Native machine code of an EvaluationTape, compiled and loaded at run time.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class NativeCode exports an EvaluationTape as C++ source (see
+ *	EvaluationTape::exportCode), compiles it into a shared library using
+ *	the compiler of the local system and loads the result. Libraries are
+ *	cached on disk under a name derived from a hash of the generated source
+ *	and of the compiler command, hence every model is compiled only once.
+ *
+ *	Copies share the library (which is reference counted by the dynamic
+ *	loader). Native code is only available if ACADO has been built with
+ *	ACADO_WITH_DLOPEN.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class NativeCode{
+
+public:
+
+	/** Default constructor. */
+	NativeCode();
+
+	/** Copy constructor (loads the same library again). */
+	NativeCode( const NativeCode& rhs );
+
+	/** Destructor. */
+	virtual ~NativeCode();
+
+	/** Assignment operator (loads the same library again). */
+	NativeCode& operator=( const NativeCode& rhs );
+
+
+	/** Exports the given tape, compiles it (unless a cached library
+	 *  exists) and loads the result. The compiler command is invoked as
+	 *  "<compiler> -o <library> <source>"; it defaults to
+	 *  "c++ -O2 -fPIC -shared". The cache directory defaults to the
+	 *  per-user directory "$TMPDIR/acado_native_code-<uid>" (or
+	 *  "/tmp/acado_native_code-<uid>"), which is created with mode 0700.
+	 *  The cache directory and any library found in it are only used if
+	 *  they are owned by the current user and are neither group- nor
+	 *  world-writable. After a failed attempt, no further attempt is made
+	 *  until unload() is called.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_UNABLE_TO_EXPORT_CODE, \n
+	 *          RET_UNABLE_TO_COMPILE_NATIVE_CODE, \n
+	 *          RET_UNABLE_TO_LOAD_NATIVE_CODE, \n
+	 *          RET_NATIVE_CODE_CACHE_NOT_SECURE, \n
+	 *          RET_AVAILABLE_WITH_LINUX_ONLY
+	 */
+	returnValue load(	const EvaluationTape& tape,
+						const char *compiler = 0,
+						const char *cacheDirectory = 0
+						);
+
+	/** Releases the library (if any).
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue unload( );
+
+
+	/** Returns whether native code is loaded. */
+	inline BooleanType isLoaded( ) const;
+
+	/** Returns the file name of the loaded library (or 0). */
+	inline const char* getLibraryName( ) const;
+
+
+	/** Evaluates the tape (cf. EvaluationTape::evaluate). */
+	inline void evaluate(	double *x,
+							double *f
+							) const;
+
+	/** Forward AD for nDirections directions (cf. EvaluationTape::AD_forward);
+	 *  dw must hold nDirections times the number of registers. */
+	inline void AD_forward(	int nDirections,
+							double *x,
+							double *seed,
+							double *f,
+							double *df,
+							double *dw
+							) const;
+
+	/** Backward AD (cf. EvaluationTape::AD_backward); adj must hold the
+	 *  number of registers, trace twice the number of instructions. */
+	inline void AD_backward(	double *x,
+								double *seed,
+								double *df,
+								double *adj,
+								double *trace
+								) const;
+
+
+protected:
+
+	/** Opens the given library and looks up the generated routines. */
+	returnValue open( const char *libraryName_ );
+
+	/** Returns whether the given file is a directory (isDirectory = BT_TRUE)
+	 *  or a regular file that is owned by the current user and is neither
+	 *  group- nor world-writable. Symbolic links are not followed. */
+	BooleanType isSecure(	const char *fileName,
+							BooleanType isDirectory
+							) const;
+
+	void copy( const NativeCode& rhs );
+
+
+protected:
+
+	char              *libraryName;		/**< File name of the loaded library.         */
+	void              *handle;			/**< Handle returned by the dynamic loader.   */
+	BooleanType        hasFailed;		/**< Whether the last attempt to load failed. */
+
+	NativeEvaluateFcn  evaluateFcn;		/**< Generated evaluation routine.            */
+	NativeForwardFcn   forwardFcn;		/**< Generated forward AD routine.            */
+	NativeBackwardFcn  backwardFcn;		/**< Generated backward AD routine.           */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/symbolic_operator/native_code.ipp>
+
+
+#endif
+
+// end of file.
@@ -0,0 +1,74 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/symbolic_operator/native_code.ipp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline BooleanType NativeCode::isLoaded( ) const{
+
+    if( handle == 0 ) return BT_FALSE;
+    return BT_TRUE;
+}
+
+
+inline const char* NativeCode::getLibraryName( ) const{
+
+    return libraryName;
+}
+
+
+inline void NativeCode::evaluate( double *x, double *f ) const{
+
+    evaluateFcn( x,f );
+}
+
+
+inline void NativeCode::AD_forward( int nDirections, double *x, double *seed,
+                                    double *f, double *df, double *dw ) const{
+
+    forwardFcn( nDirections,x,seed,f,df,dw );
+}
+
+
+inline void NativeCode::AD_backward( double *x, double *seed, double *df,
+                                     double *adj, double *trace ) const{
+
+    backwardFcn( x,seed,df,adj,trace );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
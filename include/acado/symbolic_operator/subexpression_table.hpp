@@ -0,0 +1,235 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/symbolic_operator/subexpression_table.hpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#ifndef ACADO_TOOLKIT_SUBEXPRESSION_TABLE_HPP
+#define ACADO_TOOLKIT_SUBEXPRESSION_TABLE_HPP
+
+
+#include <acado/symbolic_operator/evaluation_base.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Hash-consing table for eliminating common subexpressions of operator trees.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class SubexpressionTable assigns the same number to all structurally
+ *	identical subexpressions of a set of operator trees. Intermediate states
+ *	contained in the trees are treated like variables, i.e. they are kept. Operator trees are
+ *	registered by add(); afterwards, share() returns a copy of a registered
+ *	tree in which every non-trivial subexpression that is used more than once
+ *	is replaced by an intermediate state (TreeProjection). As intermediate
+ *	states are evaluated only once by the FunctionEvaluationTree (and are
+ *	exported as auxiliary variables), duplicated subtrees are evaluated and
+ *	exported only once.
+ *
+ *	If a first index is passed to the constructor, the intermediate states
+ *	created by the table do not take global indices; they are numbered
+ *	consecutively from this index, i.e. they are only valid within the
+ *	function whose trees are shared (see FunctionEvaluationTree::compile and
+ *	FunctionEvaluationTree::eliminateCommonSubexpressions). Otherwise, they
+ *	are global intermediate states (see Expression::shareSubexpressions).
+ *
+ *	The table visits the operators via the EvaluationBase interface. Operators
+ *	which do not report back to the visitor (e.g. nonsmooth operators) are
+ *	never shared but copied as they are.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class SubexpressionTable : public EvaluationBase{
+
+public:
+
+	/** Constructor which takes the index of the first intermediate state
+	 *  created by the table (or -1 for global intermediate states). */
+	SubexpressionTable(	int firstIndex_ = -1
+						);
+
+	/** Destructor. */
+	virtual ~SubexpressionTable();
+
+
+	/** Removes all entries from the table.
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue clear( );
+
+
+	/** Enters all subexpressions of the given expression into the table.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS
+	 */
+	returnValue add( Operator& arg );
+
+
+	/** Returns a copy of a previously added expression in which all
+	 *  subexpressions that occur more than once in the added expressions
+	 *  are replaced by intermediate states. The intermediate states are
+	 *  created only once, i.e. the copies of all expressions share them.
+	 *
+	 *  \return The shared copy of the expression (to be deleted by the caller).
+	 */
+	Operator* share( Operator& arg );
+
+
+	/** Returns the number of structurally different subexpressions. */
+	int getNumEntries( ) const;
+
+	/** Returns the number of subexpressions that are shared. */
+	int getNumSharedEntries( ) const;
+
+	/** Returns the number of intermediate states created by share(). */
+	int getNumStates( ) const;
+
+	/** Writes the arguments of the (local) intermediate states created by
+	 *  share() into args, ordered by their indices. The arguments remain
+	 *  owned by the table.
+	 *
+	 *  \return SUCCESSFUL_RETURN, \n
+	 *          RET_INVALID_USE_OF_FUNCTION
+	 */
+	returnValue getStateArguments( Operator **args ) const;
+
+
+	/** Visitor interface used while hashing and copying operator trees. */
+	virtual void addition   ( Operator &arg1, Operator &arg2 );
+	virtual void subtraction( Operator &arg1, Operator &arg2 );
+	virtual void product    ( Operator &arg1, Operator &arg2 );
+	virtual void quotient   ( Operator &arg1, Operator &arg2 );
+	virtual void power      ( Operator &arg1, Operator &arg2 );
+	virtual void powerInt   ( Operator &arg1, int      &arg2 );
+
+	virtual void project    ( int      &idx );
+	virtual void set        ( double   &arg );
+	virtual void Acos       ( Operator &arg );
+	virtual void Asin       ( Operator &arg );
+	virtual void Atan       ( Operator &arg );
+	virtual void Cos        ( Operator &arg );
+	virtual void Exp        ( Operator &arg );
+	virtual void Log        ( Operator &arg );
+	virtual void Sin        ( Operator &arg );
+	virtual void Tan        ( Operator &arg );
+
+
+protected:
+
+	/** A single (structurally unique) subexpression. */
+	struct Entry{
+
+		OperatorName    name;		/**< The kind of the operator.                             */
+		int             arg1;		/**< First argument (or variable type of a leaf).          */
+		int             arg2;		/**< Second argument, exponent (or component of a leaf).   */
+		double          value;		/**< Value of a constant.                                  */
+		int             nRefs;		/**< Number of distinct parents (and roots) using it.      */
+		TreeProjection *shared;		/**< Intermediate state representing it (if shared).       */
+	};
+
+
+	/** Enters the subexpression arg (and all its arguments) into the
+	 *  table and returns its number. */
+	int enter( Operator& arg );
+
+	/** Returns the copy of arg (sharing repeated subexpressions). */
+	Operator* copy( Operator& arg );
+
+	/** Replaces the copy arg of the subexpression idx by an intermediate
+	 *  state (which takes over the given curvature and monotonicity). */
+	Operator* makeShared(	int idx,
+							Operator* arg,
+							CurvatureType curvature_,
+							MonotonicityType monotonicity_
+							);
+
+	void unary(	OperatorName name_,
+				Operator& arg
+				);
+
+	void binary(	OperatorName name_,
+					Operator& arg1,
+					Operator& arg2
+					);
+
+	/** Returns the number of the entry with the given key, a new entry is
+	 *  created if no such entry exists. */
+	int find(	OperatorName name_,
+				int arg1_,
+				int arg2_,
+				double value_
+				);
+
+	/** Returns the number of the entry that has been entered for the
+	 *  operator at the given address (or -1). */
+	int findAddress( const Operator* arg ) const;
+
+	BooleanType isLeaf( int idx ) const;
+
+	void rehash( );
+
+
+protected:
+
+	Entry            *entries;		/**< The subexpressions.                                 */
+	int               nEntries;		/**< Number of subexpressions.                           */
+	int               maxEntries;	/**< Allocated length of the entry array.                */
+
+	int              *table;		/**< Hash table mapping keys to entries (-1 if empty).   */
+	const Operator  **addresses;	/**< Hash table of the visited operator addresses.       */
+	int              *addressIdx;	/**< Entries belonging to the visited addresses.         */
+	int               tableSize;	/**< Length of the hash tables (a power of two).         */
+	int               nAddresses;	/**< Number of visited operator addresses.               */
+
+	int               firstIndex;	/**< Index of the first intermediate state (-1 if global). */
+	int               nextIndex;	/**< Index of the next intermediate state to be created. */
+	int               nStates;		/**< Number of intermediate states created by share().   */
+
+	BooleanType       isCopying;	/**< Whether the visitor copies or hashes the operators. */
+	int               current;		/**< Entry of the last visited operator.                 */
+	Operator         *result;		/**< Copy of the last visited operator.                  */
+
+
+private:
+
+	SubexpressionTable( const SubexpressionTable& rhs );
+	SubexpressionTable& operator=( const SubexpressionTable& rhs );
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif
+
+// end of file.
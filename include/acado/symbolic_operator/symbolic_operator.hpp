@@ -35,6 +35,8 @@
     // -------------------------------------------------------
     #include <acado/symbolic_operator/evaluation_base.hpp>
     #include <acado/symbolic_operator/evaluation_template.hpp>
+    #include <acado/symbolic_operator/evaluation_tape.hpp>
+    #include <acado/symbolic_operator/native_code.hpp>
     
     #include <acado/symbolic_operator/operator.hpp>
     #include <acado/symbolic_operator/smooth_operator.hpp>
@@ -61,6 +63,7 @@
     #include <acado/symbolic_operator/tan.hpp>
     #include <acado/symbolic_operator/projection.hpp>
     #include <acado/symbolic_operator/tree_projection.hpp>
+    #include <acado/symbolic_operator/subexpression_table.hpp>
 
 
     // -------------------------------------------------------
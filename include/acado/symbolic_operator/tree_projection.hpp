@@ -73,6 +73,15 @@ public:
     /** Assignment Operator (deep copy). */
     TreeProjection& operator=( const Operator &arg );
 
+    /** Sets the argument like the assignment operator, but assigns the    \n
+     *  given index instead of a new global one. This is meant for          \n
+     *  intermediate states that are local to a single function (see        \n
+     *  FunctionEvaluationTree::eliminateCommonSubexpressions).             \n
+     *  \return A reference to the intermediate state.                      \n
+     */
+    TreeProjection& setArgument( const Operator &arg,
+                                 int             index );
+
 
     /** Sets the argument (note that arg should have dimension 1). */
     virtual TreeProjection& operator=( const Expression  & arg );
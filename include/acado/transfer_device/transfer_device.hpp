@@ -130,6 +130,18 @@ class TransferDevice : public SimulationBlock
 		inline BooleanType hasDeadTime( ) const;
 
 
+		/** Sets the seed from which the random number generators of all additive
+		 *	noise components are initialised (one independent stream per component).
+		 *	A seed of 0 (default) initialises them from the system clock.
+		 *
+		 *	@param[in] _noiseSeed	Noise seed.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue setNoiseSeed(	uint _noiseSeed
+											);
+
+
 
 	//
 	// PROTECTED MEMBER FUNCTIONS:
@@ -175,6 +187,7 @@ class TransferDevice : public SimulationBlock
 
 		Noise** additiveNoise;						/**< Array of additive noise for each component of the transfer device signal. */
 		Vector  noiseSamplingTimes;					/**< Noise sampling times for each component of the transfer device signal. */
+		uint    noiseSeed;							/**< Seed for initialising the additive noise (0 = system clock). */
 
 		Vector  deadTimes;							/**< Dead times for each component of the transfer device signal. */
 };
@@ -80,6 +80,14 @@ inline BooleanType TransferDevice::hasDeadTime( ) const
 }
 
 
+inline returnValue TransferDevice::setNoiseSeed(	uint _noiseSeed
+													)
+{
+	noiseSeed = _noiseSeed;
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
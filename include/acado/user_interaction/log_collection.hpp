@@ -152,7 +152,8 @@ class LogCollection
 		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		inline returnValue getAll(	LogName _name,
 									MatrixVariablesGrid& values
@@ -169,12 +170,51 @@ class LogCollection
 		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		inline returnValue getAll(	const Expression& _name,
 									MatrixVariablesGrid& values
 									) const;
 
+		/** Gets all numerical values at all time instants of the item
+		 *	with given name (converts internally used Matrices into one
+		 *	VariablesGrid by appending them one after another). If this item
+		 *	exists in more than one record, the first one is choosen as they
+		 *	are expected to have identical values anyhow.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		inline returnValue getAll(	LogName _name,
+									VariablesGrid& values
+									) const;
+
+		/** Gets all numerical values at all time instants of the item
+		 *	with given name (converts internally used Matrices into one
+		 *	VariablesGrid by appending them one after another). If this item
+		 *	exists in more than one record, the first one is choosen as they
+		 *	are expected to have identical values anyhow.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		inline returnValue getAll(	const Expression& _name,
+									VariablesGrid& values
+									) const;
+
 
 		/** Gets numerical value at first time instant of the item
 		 *	with given name. If this item exists in more than one record,
@@ -626,13 +666,35 @@ class LogCollection
 		 *	\note All <em>public</em> getAll member functions make use of this protected function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		returnValue getAll(	uint _name,
 							LogRecordItemType _type,
 							MatrixVariablesGrid& values
 							) const;
 
+		/** Gets all numerical values at all time instants of the item
+		 *	with given internal name and internal type, appended into one
+		 *	VariablesGrid. If this item exists in more than one record, the
+		 *	first one is choosen as they are expected to have identical values
+		 *	anyhow.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[in]  _type	Internal type of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All <em>public</em> getAll member functions make use of this protected function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue getAll(	uint _name,
+							LogRecordItemType _type,
+							VariablesGrid& values
+							) const;
+
 		/** Gets numerical value at first time instant of the item
 		 *	with given internal name and internal type. If this item exists in 
 		 *	more than one record, the first one is choosen as they are expected 
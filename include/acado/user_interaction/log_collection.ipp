@@ -79,6 +79,22 @@ inline returnValue LogCollection::getAll(	const Expression& _name,
 }
 
 
+inline returnValue LogCollection::getAll(	LogName _name,
+											VariablesGrid& values
+											) const
+{
+	return getAll( (uint)_name,LRT_ENUM,values );
+}
+
+
+inline returnValue LogCollection::getAll(	const Expression& _name,
+											VariablesGrid& values
+											) const
+{
+	return getAll( _name.getComponent( 0 ),LRT_VARIABLE,values );
+}
+
+
 
 inline returnValue LogCollection::getFirst(	LogName _name,
 											Matrix& firstValue
@@ -184,6 +200,9 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
@@ -194,6 +213,9 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
@@ -204,6 +226,9 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
@@ -214,6 +239,9 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
@@ -224,6 +252,9 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( (int)_name,LRT_ENUM,tmp,time );
 }
@@ -234,6 +265,9 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name.getComponent( 0 ),LRT_VARIABLE,tmp,time );
 }
@@ -262,6 +296,9 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
@@ -272,6 +309,9 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
+	if ( find( _name ) == 0 )
+		return SUCCESSFUL_RETURN;
+
 	Matrix tmp( lastValue );
 	return setLast( _name,tmp,time );
 }
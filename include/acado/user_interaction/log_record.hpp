@@ -40,6 +40,8 @@
 
 #include <acado/user_interaction/log_record_item.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -59,7 +61,8 @@ BEGIN_NAMESPACE_ACADO
  *	singly-linked list. Within these items, the actual numerical values of the 
  *	algorithmic to be logged as well as settings defining their output format is
  *	stored. Several commonly-used output formats are pre-defined within so-called 
- *	PrintSchemes.
+ *	PrintSchemes. The items are additionally indexed by their internal name such
+ *	that they can be accessed without traversing the list.
  *
  *	Additionally, a log record stores two important settings: (i) the LogFrequency
  *	defining whether the information is stored at each iteration or only at the 
@@ -374,7 +377,8 @@ class LogRecord
 		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		inline returnValue getAll(	LogName _name,
 									MatrixVariablesGrid& values
@@ -389,12 +393,47 @@ class LogRecord
 		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		inline returnValue getAll(	const Expression& _name,
 									MatrixVariablesGrid& values
 									) const;
 
+		/** Gets all numerical values at all time instants of the item
+		 *	with given name (converts internally used Matrices into one
+		 *	VariablesGrid by appending them one after another).
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		inline returnValue getAll(	LogName _name,
+									VariablesGrid& values
+									) const;
+
+		/** Gets all numerical values at all time instants of the item
+		 *	with given name (converts internally used Matrices into one
+		 *	VariablesGrid by appending them one after another).
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All public getAll member functions make use of the <em>protected</em> getAll function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		inline returnValue getAll(	const Expression& _name,
+									VariablesGrid& values
+									) const;
+
 
 		/** Gets numerical value at first time instant of the item
 		 *	with given name.
@@ -829,13 +868,33 @@ class LogRecord
 		 *	\note All <em>public</em> getAll member functions make use of this protected function.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values differ in their dimensions)
 		 */
 		returnValue getAll(	uint _name,
 							LogRecordItemType _type,
 							MatrixVariablesGrid& values
 							) const;
 
+		/** Gets all numerical values at all time instants of the item
+		 *	with given internal name and internal type, appended into one
+		 *	VariablesGrid.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[in]  _type	Internal type of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *	\note All <em>public</em> getAll member functions make use of this protected function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue getAll(	uint _name,
+							LogRecordItemType _type,
+							VariablesGrid& values
+							) const;
+
 		/** Gets numerical value at first time instant of the item
 		 *	with given internal name and internal type.
 		 *
@@ -978,6 +1037,17 @@ class LogRecord
 										LogRecordItemType _type
 										) const;
 
+		/** Appends a new item to the singly-linked list and to the index
+		 *	of its internal type.
+		 *	
+		 *	@param[in] newItem	New item.
+		 *	
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_RECORD_CORRUPTED
+		 */
+		returnValue append(	LogRecordItem* newItem
+							);
+
 
 		/** Returns the length of the string containing all numerical values of all 
 		 *	items of the record in the pre-defined output format.
@@ -1003,6 +1073,9 @@ class LogRecord
 		LogRecordItem* last;			/**< Pointer to last item of the singly-linked list. */
 
 		uint number;					/**< Total number of item within the singly-linked list of the record. */
+
+		std::vector<LogRecordItem*> enumItems;		/**< Items of type LRT_ENUM indexed by their internal name (0 if not existing). */
+		std::vector<LogRecordItem*> variableItems;	/**< Items of type LRT_VARIABLE indexed by their internal name (0 if not existing). */
 };
 
 
@@ -120,6 +120,22 @@ inline returnValue LogRecord::getAll(	const Expression& _name,
 }
 
 
+inline returnValue LogRecord::getAll(	LogName _name,
+										VariablesGrid& values
+										) const
+{
+	return getAll( (uint)_name,LRT_ENUM,values );
+}
+
+
+inline returnValue LogRecord::getAll(	const Expression& _name,
+										VariablesGrid& values
+										) const
+{
+	return getAll( _name.getComponent( 0 ),LRT_VARIABLE,values );
+}
+
+
 
 inline returnValue LogRecord::getFirst(	LogName _name,
 										Matrix& firstValue
@@ -54,7 +54,8 @@ BEGIN_NAMESPACE_ACADO
  *
  *	All information is internally stored in Matrix format; as information is 
  *	usually not only stored once but at different instants, e.g. at each iteration,
- *	information is stored in a MatrixVariablesGrid. Besides the actual numerical values
+ *	one matrix is stored per instant. The matrices of different instants may differ 
+ *	in their dimensions (e.g. trajectories of an adaptive integrator). Besides the actual numerical values
  *	of the information, also the output format of these values is stored within this 
  *	class. It describes who the information is to be printed into a string by, e.g., 
  *	defining a label, separators or the decimal precision to be shown.
@@ -160,9 +161,25 @@ class LogRecordItem
 
 		/** Returns all numerical values of the item.
 		 *
-		 *  \return Matrix-valued variables grid containing all numerical values 
+		 *	@param[out] _values		Matrix-valued variables grid containing all numerical values.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH (if the values have different dimensions)
+		 */
+		returnValue getAllValues(	MatrixVariablesGrid& _values
+									) const;
+
+		/** Returns all numerical values of the item, converting each matrix
+		 *	into a VariablesGrid (see getValue) and appending them one after
+		 *	another. This also works for values of different dimensions.
+		 *
+		 *	@param[out] _values		Variables grid containing all numerical values.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
 		 */
-		inline const MatrixVariablesGrid& getAllValues( ) const;
+		returnValue getAllValues(	VariablesGrid& _values
+									) const;
 
 		/** Assigns all numerical values of the item. In case the LogFrequency
 		 *	is set to LOG_AT_EACH_ITERATION, the full matrix-valued variables grid
@@ -178,6 +195,16 @@ class LogRecordItem
 									const MatrixVariablesGrid& _values
 									);
 
+		/** Assigns all numerical values of another item of the same LogFrequency,
+		 *	including values of different dimensions.
+		 *
+		 *	@param[in] rhs	Item whose values are to be assigned.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setAllValues(	const LogRecordItem& rhs
+									);
+
 
 		/** Returns numerical value at given time instant.
 		 *
@@ -334,6 +361,23 @@ class LogRecordItem
 	//
 	protected:
 
+		/** Adds a numerical value with given time label.
+		 *
+		 *	@param[in] _value		Value to be added.
+		 *	@param[in] _time		Time label of the instant.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue addValue(	const Matrix& _value,
+								double _time
+								);
+
+		/** Deletes all numerical values.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearValues( );
+
 		/** Assigns one digit information to the other.
 		 *
 		 *	@param[out] toDigit			Reference to digit information to be assigned.
@@ -352,7 +396,10 @@ class LogRecordItem
 	// DATA MEMBERS:
 	//
 	protected:
-		MatrixVariablesGrid values;						/**< The actual numerical values at all time instants. */
+		Matrix** values;								/**< The actual numerical values at all time instants (their dimensions may differ, e.g. for trajectories of adaptive integrators). */
+		double* times;									/**< Time labels of all time instants. */
+		uint nPoints;									/**< Number of time instants. */
+		uint maxPoints;									/**< Number of time instants the arrays are allocated for. */
 
 		int name;										/**< Internal name defined by a LogName. */
 		LogRecordItemType type;							/**< Internal type of item (LogName enumeration or symbolic expression). */
@@ -40,12 +40,6 @@ BEGIN_NAMESPACE_ACADO
 // To be returned by reference
 const Matrix emptyMatrix_;
 
-inline const MatrixVariablesGrid& LogRecordItem::getAllValues( ) const
-{
-	return values;
-}
-
-
 inline Matrix LogRecordItem::getValue(	uint idx
 										) const
 {
@@ -54,7 +48,7 @@ inline Matrix LogRecordItem::getValue(	uint idx
 		return emptyMatrix_;
 	}
 
-	return values.getMatrix( idx );
+	return *(values[idx]);
 }
 
 
@@ -85,7 +79,7 @@ inline returnValue LogRecordItem::getValueString( char** valueString ) const
 	Matrix tmp;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		tmp.appendRows( values.getMatrix(i) );
+		tmp.appendRows( *(values[i]) );
 
 	return tmp.printToString( valueString, label,startString,endString,
 							  width,precision,colSeparator,rowSeparator );
@@ -99,8 +93,8 @@ inline returnValue LogRecordItem::getValueString(	char** valueString,
 	if (idx >= getNumPoints( ))
 		return SUCCESSFUL_RETURN;
 
-	return values.getMatrix( idx ).printToString( valueString, label,startString,endString,
-												  width,precision,colSeparator,rowSeparator );
+	return values[idx]->printToString( valueString, label,startString,endString,
+									  width,precision,colSeparator,rowSeparator );
 }
 
 
@@ -110,7 +104,7 @@ inline uint LogRecordItem::determineStringLength( ) const
 	Matrix tmp;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		tmp.appendRows( values.getMatrix(i) );
+		tmp.appendRows( *(values[i]) );
 
 	return tmp.determineStringLength( label,startString,endString,
 									  width,precision,colSeparator,rowSeparator );
@@ -123,8 +117,8 @@ inline uint LogRecordItem::determineStringLength(	uint idx
 	if (idx >= getNumPoints( ))
 		return SUCCESSFUL_RETURN;
 
-	return values.getMatrix( idx ).determineStringLength( label,startString,endString,
-														  width,precision,colSeparator,rowSeparator );
+	return values[idx]->determineStringLength( label,startString,endString,
+											  width,precision,colSeparator,rowSeparator );
 }
 
 
@@ -155,7 +149,7 @@ inline LogRecordItem* LogRecordItem::getNext( ) const
 
 inline uint LogRecordItem::getNumPoints( ) const
 {
-	return values.getNumPoints( );
+	return nPoints;
 }
 
 
@@ -191,7 +185,12 @@ inline BooleanType LogRecordItem::isWriteProtected( ) const
 
 inline uint LogRecordItem::getNumDoubles( ) const
 {
-	return values.getDim();
+	uint nDoubles = 0;
+
+	for( uint i=0; i<getNumPoints( ); ++i )
+		nDoubles += values[i]->getDim( );
+
+	return nDoubles;
 }
 
 
@@ -165,6 +165,22 @@ class Logging
 									MatrixVariablesGrid& values
 									) const;
 
+		/** Gets all numerical values at all time instants of the item
+		 *	with given name (converts internally used Matrices into one
+		 *	VariablesGrid by appending them one after another). If this item
+		 *	exists in more than one record, the first one is choosen as they
+		 *	are expected to have identical values anyhow.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *	@param[out] values	All numerical values at all time instants of given item.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 */
+		inline returnValue getAll(	LogName _name,
+									VariablesGrid& values
+									) const;
+
 
 		/** Gets numerical value at first time instant of the item
 		 *	with given name. If this item exists in more than one record,
@@ -49,6 +49,17 @@ inline returnValue Logging::getAll(	LogName _name,
 }
 
 
+inline returnValue Logging::getAll(	LogName _name,
+									VariablesGrid& _values
+									) const
+{
+	if ( logCollection.hasNonEmptyItem( _name ) == BT_TRUE )
+		return logCollection.getAll( _name,_values );
+	else
+		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+}
+
+
 inline returnValue Logging::getFirst(	LogName _name,
 										Matrix& _firstValue
 										) const
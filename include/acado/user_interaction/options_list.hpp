@@ -36,6 +36,8 @@
 #include <acado/utils/acado_utils.hpp>
 #include <acado/user_interaction/options_item.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -52,6 +54,8 @@ BEGIN_NAMESPACE_ACADO
  *  For each option, an object of type OptionsItem is appended to a basic 
  *  singly-linked list. For each possible variable type of an option value, a
  *  special variant of OptionsItem needs to be derived from the base class.
+ *  Additionally, the items are indexed by their name, such that reading or
+ *  writing an option does not require to traverse the list.
  *
  *	\note Parts of the public functionality of the OptionsList class are tunnelled 
  *	via the Options class into the AlgorithmicBase class to be used in derived classes. 
@@ -243,6 +247,33 @@ class OptionsList
 							OptionsItemType type
 							) const;
 
+		/** Appends a new item to the list and to the index of its type.
+		 *
+		 *	@param[in] newItem	New option item.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *          RET_OPTIONS_LIST_CORRUPTED
+		 */
+		returnValue append(	OptionsItem* newItem
+							);
+
+		/** Determines whether the list comprises the same options
+		 *	(in the same order) as a given list.
+		 *
+		 *	@param[in] rhs	Options list to compare with.
+		 *
+		 *  \return BT_TRUE  iff both lists comprise the same options, \n
+		 *	        BT_FALSE otherwise
+		 */
+		BooleanType hasSameItems(	const OptionsList& rhs
+									) const;
+
+		/** Deletes all option items.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clear( );
+
 
     //
     // DATA MEMBERS:
@@ -253,6 +284,9 @@ class OptionsList
 
 		uint number;								/**< Total number of item within the singly-linked list of the list. */
 
+		std::vector<OptionsItem*> intItems;			/**< Items of integer type indexed by their name (0 if not existing). */
+		std::vector<OptionsItem*> doubleItems;		/**< Items of double type indexed by their name (0 if not existing). */
+
 		BooleanType optionsHaveChanged;				/**< Flag indicating whether the value of at least one option item has been changed. */
 };
 
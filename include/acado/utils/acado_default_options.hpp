@@ -55,6 +55,8 @@ const int 		defaultObjectiveSensitivity = BACKWARD_SENSITIVITY;					/**< Default
 const int 		defaultConstraintSensitivity = BACKWARD_SENSITIVITY;				/**< Default value for generating sensitivities of the constraints (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultDiscretizationType = MULTIPLE_SHOOTING;						/**< Default value for specifying how to discretize the OCP in time (possible values: SINGLE_SHOOTING, MULTIPLE_SHOOTING, COLLOCATION). */
 const int 		defaultSparseQPsolution = CONDENSING;								/**< Default value for specifying how to solve the sparse sub-QP (possible values: SPARSE_SOLVER, CONDENSING, FULL_CONDENSING). */
+const int 		defaultNLPsolution = SEQUENTIAL_CONVEX_PROGRAMMING;					/**< Default value for specifying which algorithm solves the NLP (possible values: SEQUENTIAL_CONVEX_PROGRAMMING, INTERIOR_POINT_METHOD). */
+const double 	defaultConicSolverBarrierTuning = 0.2;								/**< Default value for the factor by which the interior point method reduces the barrier parameter in each iteration (possible values: any real number in (0,1)). */
 const int 		defaultGlobalizationStrategy = GS_LINESEARCH;						/**< Default value for specifying which globablization strategy is used within the NLP solver (possible values: GS_FULLSTEP, GS_LINESEARCH). */
 const double 	defaultLinesearchTolerance = 1.0e-5;								/**< Default value for the tolerance of the line-search globalization (possible values: any positive real number). */
 const double 	defaultMinLinesearchParameter = 0.5;								/**< Default value for the minimum stepsize of the line-search globalization (possible values: any positive real number). */
@@ -65,6 +67,9 @@ const int 		defaultInfeasibleQPhandling = IQH_RELAX_L2;							/**< Default value
 const int 		defaultUseRealtimeIterations = BT_FALSE;							/**< Default value for specifying whether real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseRealtimeShifts = BT_FALSE;								/**< Default value for specifying whether shifted real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseImmediateFeedback = BT_FALSE;								/**< Default value for specifying whether immediate feedback shall be used (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultReduceFeedbackAllocations = BT_FALSE;						/**< Default value for specifying whether the feedback step of real-time iterations shall reuse preallocated workspaces to reduce heap allocations; the bundled qpOASES still allocates during hotstarts (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseAsynchronousPreparation = BT_FALSE;						/**< Default value for specifying whether the preparation step of real-time iterations shall run on a separate thread (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseNativeCode = BT_FALSE;									/**< Default value for specifying whether symbolic right-hand sides shall be compiled into native code by the system compiler (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultTerminateAtConvergence = BT_TRUE;							/**< Default value for specifying whether to stop iterations at convergence (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseReferencePrediction = BT_TRUE;							/**< Default value for specifying whether the prediction of the reference trajectory shall be known the control law (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPrintlevel = MEDIUM;											/**< Default value for the printlevel determining the quatity of output given by the optimization algorithm (possible values: HIGH, MEDIUM, LOW, NONE). */
@@ -74,8 +79,11 @@ const int 		defaultprintSCPmethodProfile = BT_FALSE;							/**< Default value fo
 // DynamicDiscretization
 const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for specifying whether integrator should freeze all intermediate results (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
+const int 		defaultDiscretizationThreads = 1;							/**< Default value for the number of threads used for integrating the shooting intervals (possible values: any positive integer). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
+const int 		defaultCollocationScheme = RADAU_IIA5;						/**< Default value for the collocation scheme of the collocation discretization (possible values: RADAU_IIA1, RADAU_IIA3, RADAU_IIA5, GAUSS_LEGENDRE2, GAUSS_LEGENDRE4, GAUSS_LEGENDRE6). */
+const int 		defaultNumIntegratorSteps = 1;								/**< Default value for the number of collocation steps per interval of the collocation discretization (possible values: any positive integer). */
 
 // Integrator
 const int 		defaultMaxNumSteps = 1000;									/**< Default value for maximum number of integrator steps (possible values: any positive integer). */
@@ -96,11 +104,13 @@ const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
 const int 		defaultParetoFrontGeneration = PFG_WEIGHTED_SUM;			/**< Default value for specifying the scalarization method (possible values: PFG_FIRST_OBJECTIVE, PFG_SECOND_OBJECTIVE, PFG_WEIGHTED_SUM, PFG_NORMALIZED_NORMAL_CONSTRAINT, PFG_NORMAL_BOUNDARY_INTERSECTION, PFG_ENHANCED_NORMALIZED_NORMAL_CONSTRAINT, PFG_EPSILON_CONSTRAINT). */
 const int 		defaultParetoFrontHotstart = BT_TRUE;						/**< Default value for specifying whether hotstarts are to be used within the multi-objective optimization (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultParetoFrontThreads = 1;								/**< Default value for the number of threads solving the subproblems of the multi-objective optimization concurrently (possible values: any positive integer). */
 
 // SimulationEnvironment
 const int 		defaultSimulateComputationalDelay = BT_FALSE;				/**< Default value for specifying whether computational delays shall be simulated or not (possible values: BT_TRUE, BT_FALSE). */
 const double 	defaultComputationalDelayFactor = 1.0;						/**< Default value for the factor scaling the actual computation time for simulating the computational delay (possible values: any non-negative real number). */
 const double 	defaultComputationalDelayOffset = 0.0;						/**< Default value for the offset correcting the actual computation time for simulating the computational delay (possible values: any non-negative real number). */
+const int 		defaultEnsembleThreads = 1;									/**< Default value for the number of threads simulating the members of a simulation ensemble concurrently (possible values: any positive integer). */
 
 // Process
 const int 		defaultSimulationAlgorithm = SIMULATION_BY_INTEGRATION;		/**< Default value for specifying the simulation algorithm used within the process (possible values: SIMULATION_BY_INTEGRATION). */
@@ -334,7 +334,10 @@ RET_ONLY_EQUIDISTANT_GRID_FOR_CODE_EXPORT,		/**< Only equidistant evaluation gri
 RET_ONLY_BOUNDS_FOR_CODE_EXPORT,				/**< Only state and control bounds supported for code generation. */
 RET_QPOASES_EMBEDDED_NOT_FOUND,					/**< Embedded qpOASES code not found. */
 RET_UNABLE_TO_EXPORT_STATEMENT,					/**< Unable to export statement due to incomplete definition. */
-RET_INVALID_CALL_TO_EXPORTED_FUNCTION			/**< Invalid call to export functions (check number of calling arguments). */
+RET_INVALID_CALL_TO_EXPORTED_FUNCTION,			/**< Invalid call to export functions (check number of calling arguments). */
+RET_UNABLE_TO_COMPILE_NATIVE_CODE,				/**< Unable to compile native code (check the compiler command). */
+RET_UNABLE_TO_LOAD_NATIVE_CODE,					/**< Unable to load compiled native code. */
+RET_NATIVE_CODE_CACHE_NOT_SECURE				/**< Cache directory or library of native code is not owned by the user or writable by others. */
 };
 
 
@@ -103,6 +103,33 @@ enum OperatorName{
 };
 
 
+/** Defines the instruction codes of a compiled evaluation tape.
+*/
+enum TapeInstructionCode{
+
+    TIC_LOAD_VARIABLE,          /**< Copies a component of x into a register.          */
+    TIC_LOAD_CONSTANT,          /**< Copies a constant into a register.                */
+    TIC_ADDITION,
+    TIC_SUBTRACTION,
+    TIC_PRODUCT,
+    TIC_QUOTIENT,
+    TIC_POWER,
+    TIC_POWER_INT,
+    TIC_SIN,
+    TIC_COS,
+    TIC_TAN,
+    TIC_ASIN,
+    TIC_ACOS,
+    TIC_ATAN,
+    TIC_LOGARITHM,
+    TIC_EXP,
+    TIC_STORE_INTERMEDIATE,     /**< Writes a register back into x (intermediate state). */
+    TIC_STORE_RESULT,           /**< Writes a register into the result vector.           */
+    TIC_LOAD_REGISTER,          /**< Copies a shared register into a register.          */
+    TIC_STORE_REGISTER          /**< Copies a register into a shared register.          */
+};
+
+
 
 /** Defines the names of all implemented variable types. */
 enum VariableType{
@@ -208,11 +235,25 @@ enum StateDiscretizationType{
 
     SINGLE_SHOOTING,        /**< Single shooting discretisation.   */
     MULTIPLE_SHOOTING,      /**< Multiple shooting discretisation. */
-    COLLOCATION,            /**< Collocation discretisation.       */
+    COLLOCATION,            /**< Collocation discretisation; restricted to explicit ODEs
+                             *   and to Hessian approximations other than EXACT_HESSIAN
+                             *   (otherwise, RET_NOT_IMPLEMENTED_YET is returned). */
     UNKNOWN_DISCRETIZATION  /**< Discretisation type unknown.      */
 };
 
 
+/** Summarises all collocation schemes available for the collocation discretisation. */
+enum CollocationScheme{
+
+    RADAU_IIA1,             /**< Radau IIA collocation of order 1 (implicit Euler). */
+    RADAU_IIA3,             /**< Radau IIA collocation of order 3.                  */
+    RADAU_IIA5,             /**< Radau IIA collocation of order 5.                  */
+    GAUSS_LEGENDRE2,        /**< Gauss-Legendre collocation of order 2.             */
+    GAUSS_LEGENDRE4,        /**< Gauss-Legendre collocation of order 4.             */
+    GAUSS_LEGENDRE6         /**< Gauss-Legendre collocation of order 6.             */
+};
+
+
 /** Summarises all possible ways of discretising the system's states. */
 enum ControlParameterizationType{
 
@@ -401,23 +442,31 @@ enum OptionsName
 	USE_REALTIME_ITERATIONS,
 	USE_REALTIME_SHIFTS,
 	USE_IMMEDIATE_FEEDBACK,
+	REDUCE_FEEDBACK_ALLOCATIONS,
+	USE_ASYNCHRONOUS_PREPARATION,
+	USE_NATIVE_CODE,
 	TERMINATE_AT_CONVERGENCE,
 	USE_REFERENCE_PREDICTION,
 	FREEZE_INTEGRATOR,
+	DISCRETIZATION_THREADS,
 	INTEGRATOR_TYPE,
+	COLLOCATION_SCHEME,
 	MEASUREMENT_GRID,
 	SAMPLING_TIME,
 	SIMULATE_COMPUTATIONAL_DELAY,
 	COMPUTATIONAL_DELAY_FACTOR,
 	COMPUTATIONAL_DELAY_OFFSET,
+	ENSEMBLE_THREADS,
 	PARETO_FRONT_DISCRETIZATION,
 	PARETO_FRONT_GENERATION,
 	PARETO_FRONT_HOTSTART,
+	PARETO_FRONT_THREADS,
 	SIMULATION_ALGORITHM,
 	CONTROL_PLOTTING,
 	PARAMETER_PLOTTING,
 	OUTPUT_PLOTTING,
 	SPARSE_QP_SOLUTION,
+	NLP_SOLUTION,
 	GLOBALIZATION_STRATEGY,
 	CONIC_SOLVER_MAXIMUM_NUMBER_OF_STEPS,
 	CONIC_SOLVER_TOLERANCE,
@@ -616,6 +665,14 @@ enum ProcessSimulationAlgorithm
 };
 
 
+/** Summarizes all available variants of the Kalman filter. */
+enum KalmanFilterType
+{
+	EXTENDED_KALMAN_FILTER,			/**< Extended Kalman filter.                 */
+	UNSCENTED_KALMAN_FILTER			/**< Square-root unscented Kalman filter.    */
+};
+
+
 
 /** Definition of several Hessian approximation modes. */
 enum HessianApproximationMode{
@@ -784,6 +841,16 @@ enum SparseQPsolutionMethods
 
 
 
+/** Defines the algorithms for solving the NLP of an OCP. \n
+ */
+enum NLPsolutionMethods
+{
+	SEQUENTIAL_CONVEX_PROGRAMMING,		/**< Sequential (convex) quadratic programming (SCPmethod).          */
+	INTERIOR_POINT_METHOD				/**< Primal-dual interior point method on the sparse KKT system (IPmethod, requires SPARSE_QP_SOLUTION = SPARSE_SOLVER). */
+};
+
+
+
 /** Defines . \n
  */
 enum ExportStatementOperator
@@ -478,6 +478,21 @@ class Grid
 		uint getFloorIndex(	double time
 							) const;
 
+		/** Returns index of grid point with greatest time smaller or equal to given time.
+		 *	The interval given by cursor (and its successor) is checked first before
+		 *	falling back to a binary search; the cursor is then set to the returned index.
+		 *	Thus, a sequence of queries with monotonically increasing times costs O(1)
+		 *	per query.
+		 *
+		 *	@param[in]     _time	Time greater or equal than that of the time point to be found.
+		 *	@param[in,out] cursor	Index returned by the previous query (0 initially).
+		 *
+		 *  \return Index of grid point with greatest time smaller or equal to given time
+		 */
+		uint getFloorIndex(	double time,
+							uint& cursor
+							) const;
+
 		/** Returns index of grid point with smallest time greater or equal to given time.
 		 *
 		 *	@param[in] _time	Time smaller or equal than that of the time point to be found.
@@ -54,8 +54,15 @@ class VariablesGrid;
  *	matrix-valued optimization variables at each grid point, as they 
  *	usually occur when discretizing optimal control problems.
  *
- *	The class inherits from the Grid class and stores the matrix-valued
- *	optimization variables in an re-allocatable array of MatrixVariables.
+ *	The class inherits from the Grid class and stores the values of the
+ *	matrix-valued optimization variables in one contiguous, re-allocatable
+ *	array: the matrices at all grid points are stored one after another,
+ *	each of them row-wise. All matrices have the same dimensions. Type, name
+ *	and unit labels are shared by all grid points, while scaling, bounds and
+ *	the auto initialization flag can be set individually at each grid point.
+ *
+ *	The values at one grid point or the values of one component at all grid
+ *	points can be accessed via non-owning views, i.e. without copying them.
  *
  *	\author Hans Joachim Ferreau, Boris Houska
  */
@@ -518,6 +525,47 @@ class MatrixVariablesGrid : public Grid
 		Matrix getLastMatrix( ) const;
 
 
+		/** Returns a view on the (row-wise stored) values of the matrix at grid
+		 *	point with given index. The view is invalidated by adding grid points.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return View on values at given grid point (empty if index is out of bounds)
+		 */
+		inline VectorView<double> getPointView(	uint pointIdx
+												);
+
+		/** Returns a read-only view on the (row-wise stored) values of the matrix
+		 *	at grid point with given index. The view is invalidated by adding grid points.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return View on values at given grid point (empty if index is out of bounds)
+		 */
+		inline VectorView<const double> getPointView(	uint pointIdx
+														) const;
+
+		/** Returns a view on the values of the component with given index (counted
+		 *	row-wise) at all grid points. The view is invalidated by adding grid points.
+		 *
+		 *	@param[in] valueIdx		Index of component.
+		 *
+		 *  \return View on values of given component (empty if index is out of bounds)
+		 */
+		inline VectorView<double> getComponentView(	uint valueIdx
+													);
+
+		/** Returns a read-only view on the values of the component with given index
+		 *	(counted row-wise) at all grid points. The view is invalidated by adding grid points.
+		 *
+		 *	@param[in] valueIdx		Index of component.
+		 *
+		 *  \return View on values of given component (empty if index is out of bounds)
+		 */
+		inline VectorView<const double> getComponentView(	uint valueIdx
+															) const;
+
+
 		/** Returns total dimension of MatrixVariablesGrid, i.e. the sum
 		 *	of dimensions of matrices at all grid point.
 		 *
@@ -598,6 +646,7 @@ class MatrixVariablesGrid : public Grid
 										) const;
 
 		/** Assigns new variable type to MatrixVariable at grid point with given index.
+		 *	As the type is shared by all grid points, this changes the type at all grid points.
 		 *
 		 *	@param[in] pointIdx		Index of grid point.
 		 *	@param[in] _type		New type of the variable(s).
@@ -626,6 +675,7 @@ class MatrixVariablesGrid : public Grid
 									) const;
 
 		/** Assigns new name label to given component of MatrixVariable at grid point with given index.
+		 *	As name labels are shared by all grid points, this changes the label at all grid points.
 		 *
 		 *	@param[in]  pointIdx	Index of grid point.
 		 *	@param[in]  idx			Index of component.
@@ -656,7 +706,8 @@ class MatrixVariablesGrid : public Grid
 									char* const _unit
 									) const;
 
-		/** Assigns new name label to given component of MatrixVariable at grid point with given index.
+		/** Assigns new unit label to given component of MatrixVariable at grid point with given index.
+		 *	As unit labels are shared by all grid points, this changes the label at all grid points.
 		 *
 		 *	@param[in]  pointIdx	Index of grid point.
 		 *	@param[in]  idx			Index of component.
@@ -1342,16 +1393,36 @@ class MatrixVariablesGrid : public Grid
     //
     protected:
 
-		/** Clears all MatrixVariables on the grid. Note that the grid itself
-		 *	is not cleared.
+		/** Frees the values and all settings of the grid points. Note that
+		 *	the grid itself is not cleared.
 		 *
 		 *	\return SUCCESSFUL_RETURN
 		 */
 		returnValue clearValues( );
 
+		/** Copies the values and all settings of the grid points of given
+		 *	grid. Note that the grid itself is not copied.
+		 *
+		 *	@param[in] rhs	Grid whose values are to be copied.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue copyValues(	const MatrixVariablesGrid& rhs
+								);
+
+		/** Ensures that memory for the values and settings of at least the given
+		 *	number of grid points is allocated. When growing, the memory is at least
+		 *	doubled such that adding grid points one by one has linear complexity.
+		 *
+		 *	@param[in] _nPoints		Number of grid points.
+		 */
+		void reservePoints(	uint _nPoints
+							);
+
 
-		/** Initializes array of MatrixVariables with given information.
-		 *	Note that this function assumes that the grid has already been setup.
+		/** Initializes the values (set to zero) and settings at all grid points
+		 *	with given information. Note that this function assumes that the grid
+		 *	has already been setup.
 		 *
 		 *	@param[in] _nRows		Number of rows of each matrix.
 		 *	@param[in] _nCols		Number of columns of each matrix.
@@ -1376,25 +1447,105 @@ class MatrixVariablesGrid : public Grid
 											const BooleanType* const _autoInit = 0
 											);
 
-		/** Adds a new grid point with given MatrixVariable and time to grid.
+
+		/** Adds a new grid point with given time to the grid, ensures that memory
+		 *	for its values and settings is allocated and resets its settings to
+		 *	default values. If the grid was empty, the dimensions of the matrices
+		 *	are set to the given ones.
 		 *
-		 *	@param[in] newMatrix	MatrixVariable of grid point to be added.
+		 *	@param[in] _nRows		Number of rows of the matrix at the new grid point.
+		 *	@param[in] _nCols		Number of columns of the matrix at the new grid point.
 		 *	@param[in] newTime		Time of grid point to be added.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_INVALID_ARGUMENTS
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
 		 */
-		returnValue addMatrix(	const MatrixVariable& newMatrix,
-								double newTime = -INFTY
+		returnValue addPoint(	uint _nRows,
+								uint _nCols,
+								double newTime
 								);
 
+		/** Adds a new grid point with given time to grid whose values and settings
+		 *	are copied from the grid point with given index of another grid.
+		 *	If the grid was empty, also the shared settings are copied.
+		 *
+		 *	@param[in] arg			Grid whose grid point is to be copied.
+		 *	@param[in] pointIdx		Index of grid point to be copied.
+		 *	@param[in] newTime		Time of grid point to be added.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue addPoint(	const MatrixVariablesGrid& arg,
+								uint pointIdx,
+								double newTime
+								);
+
+		/** Copies values and settings of the grid point with given index
+		 *	of another grid (with matrices of the same dimensions) to the
+		 *	grid point with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point to be overwritten.
+		 *	@param[in] arg			Grid whose grid point is to be copied.
+		 *	@param[in] argIdx		Index of grid point to be copied.
+		 */
+		void copyPoint(	uint pointIdx,
+						const MatrixVariablesGrid& arg,
+						uint argIdx
+						);
+
+		/** Resets scaling, bounds and auto initialization flag at grid point
+		 *	with given index to their default values.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 */
+		void resetPointSettings(	uint pointIdx
+									);
+
+		/** Returns a (lazily allocated) array of per-point settings with given
+		 *	default value, e.g. the lower bounds at all grid points.
+		 *
+		 *	@param[in,out] array			Array of settings.
+		 *	@param[in]     defaultValue		Default value of the settings.
+		 *
+		 *	\return Pointer to the array
+		 */
+		double* allocatePointSettings(	double*& array,
+										double defaultValue
+										);
+
+		/** Returns the rows between given indices of the matrices at all grid
+		 *	points as new grid (with default settings).
+		 *
+		 *	@param[in]  startIdx	Index of first row to be included.
+		 *	@param[in]  endIdx		Index of last row to be included.
+		 *	@param[out] result		Grid containing the desired rows.
+		 */
+		void getRows(	uint startIdx,
+						uint endIdx,
+						MatrixVariablesGrid& result
+						) const;
+
 
     //
     // DATA MEMBERS:
     //
     protected:
 
-		MatrixVariable** values;				/**< Matrix-valued optimization variable at all grid points. */
+		uint nRows;								/**< Number of rows of the matrices at all grid points. */
+		uint nCols;								/**< Number of columns of the matrices at all grid points. */
+		uint nAllocatedPoints;					/**< Number of grid points for which memory is allocated. */
+
+		double* values;							/**< Values of the matrices at all grid points (one after another, each stored row-wise). */
+
+		VariableSettings settings;				/**< Type, name and unit labels shared by all grid points. */
+
+		double* scaling;						/**< Scaling of all components at all grid points (only allocated if set). */
+		double* lb;								/**< Lower bounds of all components at all grid points (only allocated if set). */
+		double* ub;								/**< Upper bounds of all components at all grid points (only allocated if set). */
+		BooleanType* autoInit;					/**< Auto initialization flag at all grid points. */
 };
 
 
@@ -49,8 +49,9 @@ inline double& MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint
 {
 	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+	return values[ ( pointIdx*nRows + rowIdx )*nCols + colIdx ];
 }
 
 
@@ -58,8 +59,9 @@ inline double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint
 {
 	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+	return values[ ( pointIdx*nRows + rowIdx )*nCols + colIdx ];
 }
 
 
@@ -67,7 +69,7 @@ inline double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint
 inline MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 															) const
 {
-    ASSERT( values != 0 );
+	ASSERT( values != 0 );
 	if ( rowIdx >= getNumRows( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -79,17 +81,17 @@ inline MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 
 	MatrixVariablesGrid rowGrid( 1,1,tmpGrid,getType( ) );
 
-    for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0,0 ) = values[run1]->operator()( rowIdx,0 );
+	for( uint run1 = 0; run1 < getNumPoints(); run1++ )
+		rowGrid( run1,0,0 ) = operator()( run1,rowIdx,0 );
 
-    return rowGrid;
+	return rowGrid;
 }
 
 
 inline MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 															) const
 {
-    ASSERT( values != 0 );
+	ASSERT( values != 0 );
 	if ( pointIdx >= getNumPoints( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -97,9 +99,9 @@ inline MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 	}
 
 	MatrixVariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addPoint( *this,pointIdx,getTime( pointIdx ) );
 
-    return pointGrid;
+	return pointGrid;
 }
 
 
@@ -107,27 +109,23 @@ inline MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 inline MatrixVariablesGrid MatrixVariablesGrid::operator+(	const MatrixVariablesGrid& arg
 															) const
 {
-	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
-
 	MatrixVariablesGrid tmp( *this );
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) += *(arg.values[i]);
+	tmp += arg;
 
 	return tmp;
 }
 
 
-
-
-
 inline MatrixVariablesGrid& MatrixVariablesGrid::operator+=(	const MatrixVariablesGrid& arg
 																)
 {
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
+	ASSERT( getNumValues( ) == arg.getNumValues( ) );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) += *(arg.values[i]);
+	uint nTotal = getNumPoints( )*getNumValues( );
+
+	for( uint i=0; i<nTotal; ++i )
+		values[i] += arg.values[i];
 
 	return *this;
 }
@@ -137,12 +135,8 @@ inline MatrixVariablesGrid& MatrixVariablesGrid::operator+=(	const MatrixVariabl
 inline MatrixVariablesGrid MatrixVariablesGrid::operator-(	const MatrixVariablesGrid& arg
 															) const
 {
-	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
-
 	MatrixVariablesGrid tmp( *this );
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) -= *(arg.values[i]);
+	tmp -= arg;
 
 	return tmp;
 }
@@ -152,87 +146,117 @@ inline MatrixVariablesGrid& MatrixVariablesGrid::operator-=(	const MatrixVariabl
 																)
 {
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
+	ASSERT( getNumValues( ) == arg.getNumValues( ) );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) -= *(arg.values[i]);
+	uint nTotal = getNumPoints( )*getNumValues( );
+
+	for( uint i=0; i<nTotal; ++i )
+		values[i] -= arg.values[i];
 
 	return *this;
 }
 
 
 
-inline uint MatrixVariablesGrid::getDim( ) const
+inline VectorView<double> MatrixVariablesGrid::getPointView(	uint pointIdx
+																)
 {
-	uint totalDim = 0;
+	if ( pointIdx >= getNumPoints( ) )
+		return VectorView<double>( );
+
+	return VectorView<double>( &(values[pointIdx*nRows*nCols]),nRows*nCols );
+}
+
+
+inline VectorView<const double> MatrixVariablesGrid::getPointView(	uint pointIdx
+																	) const
+{
+	if ( pointIdx >= getNumPoints( ) )
+		return VectorView<const double>( );
+
+	return VectorView<const double>( &(values[pointIdx*nRows*nCols]),nRows*nCols );
+}
+
+
+inline VectorView<double> MatrixVariablesGrid::getComponentView(	uint valueIdx
+																	)
+{
+	if ( ( getNumPoints( ) == 0 ) || ( valueIdx >= nRows*nCols ) )
+		return VectorView<double>( );
+
+	return VectorView<double>( &(values[valueIdx]),getNumPoints( ),nRows*nCols );
+}
+
+
+inline VectorView<const double> MatrixVariablesGrid::getComponentView(	uint valueIdx
+																		) const
+{
+	if ( ( getNumPoints( ) == 0 ) || ( valueIdx >= nRows*nCols ) )
+		return VectorView<const double>( );
+
+	return VectorView<const double>( &(values[valueIdx]),getNumPoints( ),nRows*nCols );
+}
+
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		totalDim += values[i]->getDim( );
 
-	return totalDim;
+inline uint MatrixVariablesGrid::getDim( ) const
+{
+	return getNumPoints( )*getNumValues( );
 }
 
 
 
 inline uint MatrixVariablesGrid::getNumRows( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumRows( 0 );
+	return nRows;
 }
 
 
 inline uint MatrixVariablesGrid::getNumCols( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumCols( 0 );
+	return nCols;
 }
 
 
 inline uint MatrixVariablesGrid::getNumValues( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumValues( 0 );
+	return nRows*nCols;
 }
 
 
 inline uint MatrixVariablesGrid::getNumRows(	uint pointIdx
 												) const
 {
-	if( values == 0 )
-		return 0;
-
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumRows( );
+	return getNumRows( );
 }
 
 
 inline uint MatrixVariablesGrid::getNumCols(	uint pointIdx
 												) const
 {
-	if( values == 0 )
-		return 0;
-
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumCols( );
+	return getNumCols( );
 }
 
 
 inline uint MatrixVariablesGrid::getNumValues(	uint pointIdx
 												) const
 {
-	if( values == 0 )
-		return 0;
-
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getDim( );
+	return getNumValues( );
 }
 
 
@@ -242,17 +266,17 @@ inline VariableType MatrixVariablesGrid::getType( ) const
 	if ( getNumPoints() == 0 )
 		return VT_UNKNOWN;
 
-	return getType( 0 );
+	return settings.getType( );
 }
 
 
 inline returnValue MatrixVariablesGrid::setType(	VariableType _type
 													)
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-		setType( i,_type );
+	if ( getNumPoints() == 0 )
+		return SUCCESSFUL_RETURN;
 
-	return SUCCESSFUL_RETURN;
+	return settings.setType( _type );
 }
 
 
@@ -262,7 +286,7 @@ inline VariableType MatrixVariablesGrid::getType(	uint pointIdx
 	if ( pointIdx >= getNumPoints( ) )
 		return VT_UNKNOWN;
 
-	return values[pointIdx]->getType( );
+	return settings.getType( );
 }
 
 
@@ -273,7 +297,7 @@ inline returnValue MatrixVariablesGrid::setType(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 	
-	return values[pointIdx]->setType( _type );
+	return settings.setType( _type );
 }
 
 
@@ -286,7 +310,7 @@ inline returnValue MatrixVariablesGrid::getName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getName( idx,_name );
+	return settings.getName( idx,_name );
 }
 
 
@@ -298,7 +322,7 @@ inline returnValue MatrixVariablesGrid::setName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setName( idx,_name );
+	return settings.setName( idx,_name );
 }
 
 
@@ -311,7 +335,7 @@ inline returnValue MatrixVariablesGrid::getUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getUnit( idx,_unit );
+	return settings.getUnit( idx,_unit );
 }
 
 
@@ -323,7 +347,7 @@ inline returnValue MatrixVariablesGrid::setUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setUnit( idx,_unit );
+	return settings.setUnit( idx,_unit );
 }
 
 
@@ -334,7 +358,17 @@ inline VectorspaceElement MatrixVariablesGrid::getScaling(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVectorspaceElement;
 
-	return values[pointIdx]->getScaling( );
+	VectorspaceElement tmp( getNumValues( ) );
+
+	if ( scaling != 0 )
+	{
+		for( uint i=0; i<getNumValues( ); ++i )
+			tmp( i ) = scaling[pointIdx*getNumValues( )+i];
+	}
+	else
+		tmp.setAll( defaultScaling );
+
+	return tmp;
 }
 
 
@@ -342,10 +376,21 @@ inline returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
 													const VectorspaceElement& _scaling
 													)
 {
-    if ( pointIdx >= getNumPoints( ) )
-        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+	if ( pointIdx >= getNumPoints( ) )
+		return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+	if ( _scaling.getDim( ) != getNumValues( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( acadoIsSmaller( _scaling.getMin( ),0.0 ) == BT_TRUE )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	double* pointScaling = allocatePointSettings( scaling,defaultScaling ) + pointIdx*getNumValues( );
+
+	for( uint i=0; i<getNumValues( ); ++i )
+		pointScaling[i] = _scaling( i );
 
-    return values[pointIdx]->setScaling( _scaling );
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -353,10 +398,13 @@ inline double MatrixVariablesGrid::getScaling(	uint pointIdx,
 												uint valueIdx
 												) const
 {
-    if( pointIdx >= getNumPoints( ) )
-        return -1.0;
+	if( ( pointIdx >= getNumPoints( ) ) || ( valueIdx >= getNumValues( ) ) )
+		return -1.0;
+
+	if ( scaling == 0 )
+		return defaultScaling;
 
-	return values[pointIdx]->getScaling( valueIdx );
+	return scaling[pointIdx*getNumValues( )+valueIdx];
 }
 
 
@@ -368,11 +416,14 @@ inline returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setScaling( valueIdx,_scaling );
-    return SUCCESSFUL_RETURN;
+	if ( acadoIsSmaller( _scaling,0.0 ) == BT_TRUE )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	allocatePointSettings( scaling,defaultScaling )[pointIdx*getNumValues( )+valueIdx] = _scaling;
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -383,7 +434,17 @@ inline VectorspaceElement MatrixVariablesGrid::getLowerBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVectorspaceElement;
 
-	return values[pointIdx]->getLowerBounds( );
+	VectorspaceElement tmp( getNumValues( ) );
+
+	if ( lb != 0 )
+	{
+		for( uint i=0; i<getNumValues( ); ++i )
+			tmp( i ) = lb[pointIdx*getNumValues( )+i];
+	}
+	else
+		tmp.setAll( defaultLowerBound );
+
+	return tmp;
 }
 
 
@@ -391,10 +452,18 @@ inline returnValue MatrixVariablesGrid::setLowerBounds(	uint pointIdx,
 														const VectorspaceElement& _lb
 														)
 {
-    if( pointIdx >= nPoints )
-        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+	if( pointIdx >= getNumPoints( ) )
+		return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+	if ( _lb.getDim( ) != getNumValues( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	double* pointLb = allocatePointSettings( lb,defaultLowerBound ) + pointIdx*getNumValues( );
 
-    return values[pointIdx]->setLowerBounds( _lb );
+	for( uint i=0; i<getNumValues( ); ++i )
+		pointLb[i] = _lb( i );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -402,10 +471,16 @@ inline double MatrixVariablesGrid::getLowerBound(	uint pointIdx,
 													uint valueIdx
 													) const
 {
-    if( pointIdx >= getNumPoints( ) )
-        return -INFTY;
+	if( pointIdx >= getNumPoints( ) )
+		return -INFTY;
+
+	if ( valueIdx >= getNumValues( ) )
+		return INFTY;
 
-	return values[pointIdx]->getLowerBound( valueIdx );
+	if ( lb == 0 )
+		return defaultLowerBound;
+
+	return lb[pointIdx*getNumValues( )+valueIdx];
 }
 
 
@@ -417,11 +492,11 @@ inline returnValue MatrixVariablesGrid::setLowerBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	values[pointIdx]->setLowerBound( valueIdx,_lb );
-    return SUCCESSFUL_RETURN;
+	allocatePointSettings( lb,defaultLowerBound )[pointIdx*getNumValues( )+valueIdx] = _lb;
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -432,7 +507,17 @@ inline VectorspaceElement MatrixVariablesGrid::getUpperBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVectorspaceElement;
 
-	return values[pointIdx]->getUpperBounds( );
+	VectorspaceElement tmp( getNumValues( ) );
+
+	if ( ub != 0 )
+	{
+		for( uint i=0; i<getNumValues( ); ++i )
+			tmp( i ) = ub[pointIdx*getNumValues( )+i];
+	}
+	else
+		tmp.setAll( defaultUpperBound );
+
+	return tmp;
 }
 
 
@@ -440,10 +525,18 @@ inline returnValue MatrixVariablesGrid::setUpperBounds(	uint pointIdx,
 														const VectorspaceElement& _ub
 														)
 {
-    if( pointIdx >= getNumPoints( ) )
-        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+	if( pointIdx >= getNumPoints( ) )
+		return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setUpperBounds( _ub );
+	if ( _ub.getDim( ) != getNumValues( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	double* pointUb = allocatePointSettings( ub,defaultUpperBound ) + pointIdx*getNumValues( );
+
+	for( uint i=0; i<getNumValues( ); ++i )
+		pointUb[i] = _ub( i );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -451,10 +544,16 @@ inline double MatrixVariablesGrid::getUpperBound(	uint pointIdx,
 													uint valueIdx
 													) const
 {
-    if( pointIdx >= getNumPoints( ) )
-        return INFTY;
+	if( pointIdx >= getNumPoints( ) )
+		return INFTY;
+
+	if ( valueIdx >= getNumValues( ) )
+		return -INFTY;
 
-	return values[pointIdx]->getUpperBound( valueIdx );
+	if ( ub == 0 )
+		return defaultUpperBound;
+
+	return ub[pointIdx*getNumValues( )+valueIdx];
 }
 
 
@@ -466,11 +565,11 @@ inline returnValue MatrixVariablesGrid::setUpperBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setUpperBound( valueIdx,_ub );
-    return SUCCESSFUL_RETURN;
+	allocatePointSettings( ub,defaultUpperBound )[pointIdx*getNumValues( )+valueIdx] = _ub;
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -484,7 +583,7 @@ inline BooleanType MatrixVariablesGrid::getAutoInit(	uint pointIdx
 		return defaultAutoInit;
 	}
 
-	return values[pointIdx]->getAutoInit( );
+	return autoInit[pointIdx];
 }
 
 
@@ -495,14 +594,15 @@ inline returnValue MatrixVariablesGrid::setAutoInit(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setAutoInit( _autoInit );
+	autoInit[pointIdx] = _autoInit;
+	return SUCCESSFUL_RETURN;
 }
 
 
 inline returnValue MatrixVariablesGrid::disableAutoInit( )
 { 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_FALSE );
+		autoInit[i] = BT_FALSE;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -511,7 +611,7 @@ inline returnValue MatrixVariablesGrid::disableAutoInit( )
 inline returnValue MatrixVariablesGrid::enableAutoInit( )
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_TRUE );
+		autoInit[i] = BT_TRUE;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -520,61 +620,46 @@ inline returnValue MatrixVariablesGrid::enableAutoInit( )
 
 inline BooleanType MatrixVariablesGrid::hasNames( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasNames( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return settings.hasNames( );
 }
 
 
 inline BooleanType MatrixVariablesGrid::hasUnits( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasUnits( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return settings.hasUnits( );
 }
 
 
 inline BooleanType MatrixVariablesGrid::hasScaling( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasScaling( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( ( getNumPoints( ) == 0 ) || ( scaling == 0 ) )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return BT_TRUE;
 }
 
 
 inline BooleanType MatrixVariablesGrid::hasLowerBounds( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasLowerBounds( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( ( getNumPoints( ) == 0 ) || ( lb == 0 ) )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return BT_TRUE;
 }
 
 
 inline BooleanType MatrixVariablesGrid::hasUpperBounds( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasUpperBounds( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( ( getNumPoints( ) == 0 ) || ( ub == 0 ) )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return BT_TRUE;
 }
 
 
@@ -583,10 +668,10 @@ inline double MatrixVariablesGrid::getMax( ) const
 {
 	double maxValue = -INFTY;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
+	for( uint i=0; i<getDim( ); ++i )
 	{
-		if ( values[i]->getMax( ) > maxValue )
-			maxValue = values[i]->getMax( );
+		if ( values[i] > maxValue )
+			maxValue = values[i];
 	}
 
 	return maxValue;
@@ -597,10 +682,10 @@ inline double MatrixVariablesGrid::getMin( ) const
 {
 	double minValue = INFTY;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
+	for( uint i=0; i<getDim( ); ++i )
 	{
-		if ( values[i]->getMin( ) < minValue )
-			minValue = values[i]->getMin( );
+		if ( values[i] < minValue )
+			minValue = values[i];
 	}
 
 	return minValue;
@@ -614,8 +699,18 @@ inline double MatrixVariablesGrid::getMean( ) const
 	if ( getNumPoints( ) == 0 )
 		return meanValue;
 
+	if ( getNumValues( ) == 0 )
+		return meanValue;
+
 	for( uint i=0; i<getNumPoints( ); ++i )
-		meanValue += values[i]->getMean( );
+	{
+		double pointMean = 0.0;
+
+		for( uint j=0; j<getNumValues( ); ++j )
+			pointMean += values[i*getNumValues( )+j];
+
+		meanValue += pointMean / (double)getNumValues( );
+	}
 
 	return ( meanValue / (double)getNumPoints( ) );
 }
@@ -624,20 +719,17 @@ inline double MatrixVariablesGrid::getMean( ) const
 
 inline returnValue MatrixVariablesGrid::setZero( )
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setZero( );
-
-	return SUCCESSFUL_RETURN;
+	return setAll( 0.0 );
 }
 
 
 inline returnValue MatrixVariablesGrid::setAll(	double _value
 												)
 {
-    for( uint i = 0; i<getNumPoints( ); ++i )
-		values[i]->setAll( _value );
+	for( uint i = 0; i<getDim( ); ++i )
+		values[i] = _value;
 
-    return SUCCESSFUL_RETURN;
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -651,9 +743,9 @@ inline returnValue MatrixVariablesGrid::getGrid(	Grid& _grid
 
 inline Grid MatrixVariablesGrid::getTimePoints( ) const
 {
-    Grid tmp;
-    getGrid( tmp );
-    return tmp;
+	Grid tmp;
+	getGrid( tmp );
+	return tmp;
 }
 
 
@@ -605,6 +605,23 @@ class VariablesGrid : public MatrixVariablesGrid
 										double endTime
 										) const;
 
+		/** Returns the sub grid in time starting and ending at given
+		 *	times like the routine above, but looks up both times starting
+		 *	at the cursor (see Grid::getFloorIndex). The cursor is left at the
+		 *	interval of the end time, such that consecutive sub grids are
+		 *	found in O(1).
+		 *
+		 *	@param[in]     startTime	Time of first grid point to be included in sub grid.
+		 *	@param[in]     endTime		Time of last grid point to be included in sub grid.
+		 *	@param[in,out] cursor		Index returned by the previous lookup (0 initially).
+		 *
+		 *	\return Sub grid in time
+		 */
+		VariablesGrid getTimeSubGrid(	double startTime,
+										double endTime,
+										uint& cursor
+										) const;
+
 		/** Returns the sub grid of values. It comprises all grid points of the 
 		 *	object, but comprises at each grid point only the compenents starting and 
 		 *	ending at given indices.
@@ -53,6 +53,7 @@
 #include <acado/curve/curve.hpp>
 #include <acado/controller/controller.hpp>
 #include <acado/estimator/estimator.hpp>
+#include <acado/estimator/kalman_filter.hpp>
 #include <acado/control_law/control_law.hpp>
 #include <acado/control_law/pid_controller.hpp>
 #include <acado/control_law/dynamic_feedback_law.hpp>
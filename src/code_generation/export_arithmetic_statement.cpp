@@ -41,6 +41,24 @@ BEGIN_NAMESPACE_ACADO
 
 using namespace std;
 
+
+/** Number of rows of the register-blocked tiles of large matrix products. */
+static const uint TILE_ROWS = 4;
+
+/** Number of columns of the register-blocked tiles of large matrix products. */
+static const uint TILE_COLS = 4;
+
+
+/** Returns the size of the given block of a dimension that is split into tiles. */
+static uint getTileSize( uint block, uint tileSize, uint dim )
+{
+	if ( ( block+1 )*tileSize <= dim )
+		return tileSize;
+	else
+		return dim - block*tileSize;
+}
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -544,80 +562,219 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	FILE* file,
 	else
 	{
 		//
-		// Keep rolled first two outer loops
+		// Keep rolled loops over register-blocked tiles
 		//
 
-		memAllocator->acquire( ii );
-		memAllocator->acquire( jj );
+		return exportCodeMultiplyTiled( file,transposeRhs1,assignString,sign,_realString );
+	}
 
-		// First loop
-		acadoFPrintf(file, "for (%s = 0; ", ii.getName().getName());
-		acadoFPrintf(file, "%s < %d; ", ii.getName().getName(), getNumRows());
-		acadoFPrintf(file, "++%s)\n{\n", ii.getName().getName());
+	return SUCCESSFUL_RETURN;
+}
 
-		// Second loop
 
-		acadoFPrintf(file, "for (%s = 0; ", jj.getName().getName());
-		acadoFPrintf(file, "%s < %d; ", jj.getName().getName(), getNumCols());
-		acadoFPrintf(file, "++%s)\n{\n", jj.getName().getName());
+returnValue ExportArithmeticStatement::exportCodeMultiplyTiled(	FILE* file,
+																BooleanType transposeRhs1,
+																const String& _assignString,
+																const String& _sign,
+																const String& _realString
+																) const
+{
+	uint nRows  = getNumRows( );
+	uint nCols  = getNumCols( );
+	uint nInner = rhs2->getNumRows( );
 
-		allZero = BT_TRUE;
+	uint nRowBlocks = ( nRows + TILE_ROWS - 1 ) / TILE_ROWS;
+	uint nColBlocks = ( nCols + TILE_COLS - 1 ) / TILE_COLS;
 
-		acadoFPrintf( file,"%s %s", lhs->get(ii,jj).getName(), assignString.getName() );
+	uint i, j, k, r, c;
 
-		for(uint k = 0; k < nColsRhs1; ++k)
-		{
-			kk = k;
-			if ( transposeRhs1 == BT_FALSE )
+	//
+	// Determine for each block of rows of rhs1 (columns of rhs2) the range
+	// of the inner index outside of which all entries are known to be zero
+	//
+	uint* rowBegin = new uint[nRowBlocks];
+	uint* rowEnd   = new uint[nRowBlocks];
+	uint* colBegin = new uint[nColBlocks];
+	uint* colEnd   = new uint[nColBlocks];
+
+	for( r = 0; r < nRowBlocks; ++r )
+	{
+		rowBegin[r] = nInner;
+		rowEnd[r]   = 0;
+
+		for( i = r*TILE_ROWS; ( i < nRows ) && ( i < (r+1)*TILE_ROWS ); ++i )
+			for( k = 0; k < nInner; ++k )
 			{
-				iiRhs1 = ii;
-				kkRhs1 = kk;
+				BooleanType isZeroEntry;
+				if ( transposeRhs1 == BT_FALSE )
+					isZeroEntry = rhs1->isZero( i,k );
+				else
+					isZeroEntry = rhs1->isZero( k,i );
+
+				if ( isZeroEntry == BT_FALSE )
+				{
+					if ( k < rowBegin[r] )
+						rowBegin[r] = k;
+					if ( k+1 > rowEnd[r] )
+						rowEnd[r] = k+1;
+				}
 			}
+	}
+
+	for( c = 0; c < nColBlocks; ++c )
+	{
+		colBegin[c] = nInner;
+		colEnd[c]   = 0;
+
+		for( j = c*TILE_COLS; ( j < nCols ) && ( j < (c+1)*TILE_COLS ); ++j )
+			for( k = 0; k < nInner; ++k )
+				if ( rhs2->isZero( k,j ) == BT_FALSE )
+				{
+					if ( k < colBegin[c] )
+						colBegin[c] = k;
+					if ( k+1 > colEnd[c] )
+						colEnd[c] = k+1;
+				}
+	}
+
+	ExportIndex ii, jj, kk;
+	memAllocator->acquire( ii );
+	memAllocator->acquire( jj );
+	memAllocator->acquire( kk );
+
+	//
+	// Consecutive blocks of the same size and with the same range of the
+	// inner index are exported as one rolled loop over tiles
+	//
+	uint r0, r1, c0, c1;
+
+	for( r0 = 0; r0 < nRowBlocks; r0 = r1 )
+	{
+		uint mr = getTileSize( r0,TILE_ROWS,nRows );
+
+		r1 = r0+1;
+		while ( ( r1 < nRowBlocks ) && ( rowBegin[r1] == rowBegin[r0] ) && ( rowEnd[r1] == rowEnd[r0] ) &&
+				( getTileSize( r1,TILE_ROWS,nRows ) == mr ) )
+			++r1;
+
+		for( c0 = 0; c0 < nColBlocks; c0 = c1 )
+		{
+			uint nr = getTileSize( c0,TILE_COLS,nCols );
+
+			c1 = c0+1;
+			while ( ( c1 < nColBlocks ) && ( colBegin[c1] == colBegin[c0] ) && ( colEnd[c1] == colEnd[c0] ) &&
+					( getTileSize( c1,TILE_COLS,nCols ) == nr ) )
+				++c1;
+
+			uint kBegin = ( rowBegin[r0] > colBegin[c0] ) ? rowBegin[r0] : colBegin[c0];
+			uint kEnd   = ( rowEnd[r0] < colEnd[c0] ) ? rowEnd[r0] : colEnd[c0];
+			BooleanType isZeroTile = ( kBegin >= kEnd ) ? BT_TRUE : BT_FALSE;
+
+			// a zero product does not change the left-hand side
+			if ( ( isZeroTile == BT_TRUE ) && ( op0 != ESO_ASSIGN ) && ( op2 == ESO_UNDEFINED ) )
+				continue;
+
+			ExportIndex iBase, jBase, kBase;
+
+			if ( r1 - r0 == 1 )
+				iBase = r0*TILE_ROWS;
 			else
 			{
-				iiRhs1 = kk;
-				kkRhs1 = ii;
+				iBase = ii;
+				acadoFPrintf( file,"for (%s = %d; ", ii.getName().getName(),r0*TILE_ROWS );
+				acadoFPrintf( file,"%s < %d; ", ii.getName().getName(),r0*TILE_ROWS + (r1-r0)*mr );
+				acadoFPrintf( file,"%s += %d)\n{\n", ii.getName().getName(),mr );
 			}
 
-			if ( ( rhs1->isZero(iiRhs1,kkRhs1) == BT_FALSE ) &&
-					( rhs2->isZero(kk,jj) == BT_FALSE ) )
+			if ( c1 - c0 == 1 )
+				jBase = c0*TILE_COLS;
+			else
 			{
-				allZero = BT_FALSE;
+				jBase = jj;
+				acadoFPrintf( file,"for (%s = %d; ", jj.getName().getName(),c0*TILE_COLS );
+				acadoFPrintf( file,"%s < %d; ", jj.getName().getName(),c0*TILE_COLS + (c1-c0)*nr );
+				acadoFPrintf( file,"%s += %d)\n{\n", jj.getName().getName(),nr );
+			}
+
+			acadoFPrintf( file,"{\n" );
 
-				if ( rhs1->isOne(iiRhs1,kkRhs1) == BT_FALSE )
+			if ( isZeroTile == BT_FALSE )
+			{
+				// accumulators and operands of the tile (to be kept in registers)
+				acadoFPrintf( file,"%s ",_realString.getName() );
+				for( r = 0; r < mr; ++r )
+					for( c = 0; c < nr; ++c )
+						acadoFPrintf( file,"tileAcc%d%d = 0.0, ",r,c );
+				for( r = 0; r < mr; ++r )
+					acadoFPrintf( file,"tileA%d, ",r );
+				for( c = 0; c < nr; ++c )
+					acadoFPrintf( file,( c+1 < nr ) ? "tileB%d, " : "tileB%d;\n",c );
+
+				if ( kEnd - kBegin == 1 )
+					kBase = kBegin;
+				else
 				{
-					acadoFPrintf( file," %s %s", sign,rhs1->get(iiRhs1,kkRhs1).getName() );
-					if ( rhs2->isOne(kk,jj) == BT_FALSE )
-						acadoFPrintf( file,"*%s", rhs2->get(kk,jj).getName() );
+					kBase = kk;
+					acadoFPrintf( file,"for (%s = %d; ", kk.getName().getName(),kBegin );
+					acadoFPrintf( file,"%s < %d; ", kk.getName().getName(),kEnd );
+					acadoFPrintf( file,"++%s)\n{\n", kk.getName().getName() );
 				}
-				else
+
+				for( r = 0; r < mr; ++r )
 				{
-					if ( rhs2->isOne(kk,jj) == BT_FALSE )
-						acadoFPrintf( file," %s %s", sign,rhs2->get(kk,jj).getName() );
+					if ( transposeRhs1 == BT_FALSE )
+						acadoFPrintf( file,"tileA%d = %s;\n",r,rhs1->get( iBase+r,kBase ).getName() );
 					else
-						acadoFPrintf( file," %s 1.0", sign );
+						acadoFPrintf( file,"tileA%d = %s;\n",r,rhs1->get( kBase,iBase+r ).getName() );
 				}
+				for( c = 0; c < nr; ++c )
+					acadoFPrintf( file,"tileB%d = %s;\n",c,rhs2->get( kBase,jBase+c ).getName() );
+
+				for( r = 0; r < mr; ++r )
+					for( c = 0; c < nr; ++c )
+						acadoFPrintf( file,"tileAcc%d%d += tileA%d*tileB%d;\n",r,c,r,c );
+
+				if ( kEnd - kBegin > 1 )
+					acadoFPrintf( file,"}\n" );
 			}
-		}
 
-		if ( ( op2 == ESO_ADD ) || ( op2 == ESO_SUBTRACT ) )
-			acadoFPrintf( file," + %s;\n", rhs3->get(ii,jj).getName() );
+			for( r = 0; r < mr; ++r )
+				for( c = 0; c < nr; ++c )
+				{
+					acadoFPrintf( file,"%s %s", lhs->get( iBase+r,jBase+c ).getName(),_assignString.getName() );
 
-		if ( op2 == ESO_UNDEFINED )
-		{
-			if ( allZero == BT_TRUE )
-				acadoFPrintf( file," 0.0;\n" );
-			else
-				acadoFPrintf( file,";\n" );
-		}
+					if ( isZeroTile == BT_FALSE )
+						acadoFPrintf( file," %s tileAcc%d%d",_sign.getName(),r,c );
 
-		acadoFPrintf( file,"\n}\n" );
-		acadoFPrintf( file,"\n}\n" );
+					if ( ( op2 == ESO_ADD ) || ( op2 == ESO_SUBTRACT ) )
+						acadoFPrintf( file," + %s;\n", rhs3->get( iBase+r,jBase+c ).getName() );
+					else
+					{
+						if ( isZeroTile == BT_TRUE )
+							acadoFPrintf( file," 0.0;\n" );
+						else
+							acadoFPrintf( file,";\n" );
+					}
+				}
 
-		memAllocator->release( ii );
-		memAllocator->release( jj );
+			acadoFPrintf( file,"}\n" );
+
+			if ( c1 - c0 > 1 )
+				acadoFPrintf( file,"}\n" );
+			if ( r1 - r0 > 1 )
+				acadoFPrintf( file,"}\n" );
+		}
 	}
 
+	memAllocator->release( ii );
+	memAllocator->release( jj );
+	memAllocator->release( kk );
+
+	delete[] colEnd;
+	delete[] colBegin;
+	delete[] rowEnd;
+	delete[] rowBegin;
+
 	return SUCCESSFUL_RETURN;
 }
 
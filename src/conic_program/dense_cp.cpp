@@ -201,23 +201,34 @@ returnValue DenseCP::init( uint nV_, uint nC_ ){
 
 returnValue DenseCP::setQPsolution( const Vector &x_, const Vector &y_ ){
 
-    uint run1;
-    clean();
+    uint run1, run2;
 
     ASSERT( x_.getDim() == getNV()           );
     ASSERT( y_.getDim() == getNV() + getNC() );
 
 
+    // REUSE THE SOLUTION VECTORS OF THE PREVIOUS CALL IF POSSIBLE:
+    // ------------------------------------------------------------
+    if( ( nS > 0 ) || ( x == 0 ) || ( ylbA == 0 ) ||
+        ( x->getDim() != getNV() ) || ( ylbA->getDim() != getNC() ) ){
+
+        clean();
+
+        x    = new Vector( getNV() );
+        ylb  = new Vector( getNV() );
+        yub  = new Vector( getNV() );
+        ylbA = new Vector( getNC() );
+        yubA = new Vector( getNC() );
+    }
+
+
     // SET THE PRIMAL SOLUTION:
     // ------------------------
-    x = new Vector(x_);
+    *x = x_;
 
 
     // SET THE DUAL SOLUTION FOR THE BOUNDS:
     // -------------------------------------
-    ylb = new Vector( getNV() );
-    yub = new Vector( getNV() );
-
     for( run1 = 0; run1 < getNV(); run1++ ){
         if( fabs(x_(run1)-lb(run1)) <= BOUNDTOL ){
             ylb->operator()(run1) = y_(run1);
@@ -232,12 +243,13 @@ returnValue DenseCP::setQPsolution( const Vector &x_, const Vector &y_ ){
 
     // SET THE DUAL SOLUTION FOR THE CONSTRAINTS:
     // ------------------------------------------
-    Vector tmp = A*x_;
-    ylbA = new Vector( getNC() );
-    yubA = new Vector( getNC() );
-
     for( run1 = 0; run1 < getNC(); run1++ ){
-        if( fabs(tmp(run1)-lbA(run1)) <= BOUNDTOL ){
+
+        double Ax = 0.0;
+        for( run2 = 0; run2 < getNV(); run2++ )
+            Ax += A(run1,run2)*x_(run2);
+
+        if( fabs(Ax-lbA(run1)) <= BOUNDTOL ){
             ylbA->operator()(run1) = y_(getNV()+run1);
             yubA->operator()(run1) = 0.0             ;
         }
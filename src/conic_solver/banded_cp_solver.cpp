@@ -122,6 +122,13 @@ returnValue BandedCPsolver::unfreezeCondensing( )
 }
 
 
+returnValue BandedCPsolver::setBarrierParameter(	double mu
+													)
+{
+	return ACADOERROR( RET_NOT_IMPLEMENTED_IN_BASE_CLASS );
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
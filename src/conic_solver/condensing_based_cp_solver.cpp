@@ -50,6 +50,10 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( ) : BandedCPsolver( )
 
     cpSolver = 0;
     cpSolverRelaxed = 0;
+
+	timeQP        = 0.0;
+	timeRelaxedQP = 0.0;
+	isQPrelaxed   = BT_FALSE;
 }
 
 
@@ -65,6 +69,10 @@ CondensingBasedCPsolver::CondensingBasedCPsolver(	UserInteraction* _userInteract
 
     cpSolver = new QPsolver_qpOASES( _userInteraction );
     cpSolverRelaxed = new QPsolver_qpOASES( _userInteraction );
+
+	timeQP        = 0.0;
+	timeRelaxedQP = 0.0;
+	isQPrelaxed   = BT_FALSE;
 }
 
 
@@ -86,6 +94,10 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( const CondensingBasedCPsolver&
 	
 	deltaX = rhs.deltaX;
 	deltaP = rhs.deltaP;
+
+	timeQP        = rhs.timeQP;
+	timeRelaxedQP = rhs.timeRelaxedQP;
+	isQPrelaxed   = rhs.isQPrelaxed;
 }
 
 
@@ -120,6 +132,10 @@ CondensingBasedCPsolver& CondensingBasedCPsolver::operator=( const CondensingBas
 
 		deltaX = rhs.deltaX;
 		deltaP = rhs.deltaP;
+
+		timeQP        = rhs.timeQP;
+		timeRelaxedQP = rhs.timeRelaxedQP;
+		isQPrelaxed   = rhs.isQPrelaxed;
     }
     return *this;
 }
@@ -264,6 +280,9 @@ returnValue CondensingBasedCPsolver::finalizeSolve(	BandedCP& cp
 
 	clock.stop( );
 	setLast( LOG_TIME_EXPAND,clock.getTime() );
+
+	if ( isLoggingDeferred( ) == BT_TRUE )
+		logQPstatistics( );
 	
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		acadoPrintf( "<-- Expanding condensed QP solution done.\n" );
@@ -448,24 +467,22 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 	returnvalue = solveQP( maxQPiter );
 
 	clock.stop( );
-	setLast( LOG_TIME_QP,clock.getTime() );
+	timeQP = clock.getTime( );
+
+	timeRelaxedQP = 0.0;
+	isQPrelaxed   = BT_FALSE;
 
 	switch( returnvalue )
 	{
 		case SUCCESSFUL_RETURN:
-			setLast( LOG_TIME_RELAXED_QP,0.0 );
-			setLast( LOG_IS_QP_RELAXED, BT_FALSE );
 			break;
 
 		case RET_QP_SOLUTION_REACHED_LIMIT:
-			setLast( LOG_TIME_RELAXED_QP,0.0 );
-			setLast( LOG_IS_QP_RELAXED, BT_FALSE );
 			ACADOWARNING( RET_QP_SOLUTION_REACHED_LIMIT );
 			break;
 
 		case RET_QP_UNBOUNDED:
-			setLast( LOG_TIME_RELAXED_QP,0.0 );
-			setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+			logQPstatistics( );
 			return ACADOERROR( RET_QP_UNBOUNDED );
 			break;
 
@@ -477,11 +494,10 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 			{
 
 				case IQH_STOP:
+					logQPstatistics( );
 					return ACADOERROR( RET_QP_INFEASIBLE );
 
 				case IQH_IGNORE:
-					setLast( LOG_TIME_RELAXED_QP,0.0 );
-					setLast( LOG_IS_QP_RELAXED, BT_FALSE );
 					break;
 
 				default:
@@ -493,20 +509,58 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
                     if ( solveQP(	maxQPiter - cpSolver->getNumberOfIterations( ),
 									(InfeasibleQPhandling) infeasibleQPhandling
 									) != SUCCESSFUL_RETURN )
+					{
+						logQPstatistics( );
 						return ACADOERROR( RET_QP_SOLUTION_FAILED );
+					}
 
 					clock.stop( );
-					setLast( LOG_TIME_RELAXED_QP,clock.getTime() );
-					setLast( LOG_IS_QP_RELAXED, BT_TRUE );
+					timeRelaxedQP = clock.getTime( );
+					isQPrelaxed   = BT_TRUE;
 			}
 			break;
 	}
 
+	// in the reduced-allocation feedback mode, the QP statistics are logged
+	// by finalizeSolve( ) as appending to the logs allocates memory
+	if ( isLoggingDeferred( ) == BT_FALSE )
+		logQPstatistics( );
+
     return SUCCESSFUL_RETURN;
 }
 
 
 
+BooleanType CondensingBasedCPsolver::isLoggingDeferred( ) const
+{
+	int useRealtimeIterations = BT_FALSE;
+	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
+
+	int reduceFeedbackAllocations = BT_FALSE;
+	get( REDUCE_FEEDBACK_ALLOCATIONS,reduceFeedbackAllocations );
+
+	if ( ( (BooleanType)useRealtimeIterations == BT_TRUE ) && ( (BooleanType)reduceFeedbackAllocations == BT_TRUE ) )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+returnValue CondensingBasedCPsolver::logQPstatistics( )
+{
+	setLast( LOG_TIME_QP,timeQP );
+	setLast( LOG_TIME_RELAXED_QP,timeRelaxedQP );
+	setLast( LOG_IS_QP_RELAXED,isQPrelaxed );
+
+	// the QP solver itself does not log in the reduced-allocation feedback mode
+	if ( ( isLoggingDeferred( ) == BT_TRUE ) && ( cpSolver != 0 ) )
+		setLast( LOG_NUM_QP_ITERATIONS,(int)cpSolver->getNumberOfIterations( ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 												)
 {
@@ -1381,6 +1435,7 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 	Matrix  Gx;
 	Matrix   G;
 	Matrix tmp;
+	Matrix product;
 
 	for( run1 = 0; run1 < N-1; run1++ )
 	{
@@ -1392,7 +1447,8 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 		{
 			T             .getSubBlock( run1, 0, tmp );   // get the corresponding  C_i .
 
-			T.setDense( run1+1, 0, Gx*tmp );		   // compute C_{i+1} := G_x^i * C_i
+			multiplyInto( product, Gx, tmp );
+			T.setDense( run1+1, 0, product );		   // compute C_{i+1} := G_x^i * C_i
 
 			// ALGEBRAIC STATES:
 			// --------------------
@@ -1406,7 +1462,10 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 				if( G.getDim() != 0 ){
 
 					if( run1 == run2 ) T.setDense( run1+1, run2+1, G      );
-					else               T.setDense( run1+1, run2+1, Gx*tmp );
+					else{
+						multiplyInto( product, Gx, tmp );
+						T.setDense( run1+1, run2+1, product );
+					}
 				}
 			}
 
@@ -1417,8 +1476,11 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 			T             .getSubBlock( run1, N+1, tmp ); // get the corresponding  D_p^i.
 
 			if( tmp.getDim() != 0 ){
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1, Gx*tmp + G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+				if( G.getDim() != 0 ){
+					multiplyInto( product, Gx, tmp );
+					product += G;
+					T.setDense( run1+1, N+1, product );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+				}
 			}
 			else{
 				if( G.getDim() != 0 )
@@ -1436,7 +1498,10 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 				if( G.getDim() != 0 ){
 
 					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, G      );
-					else               T.setDense( run1+1, run2+2+N, Gx*tmp );
+					else{
+						multiplyInto( product, Gx, tmp );
+						T.setDense( run1+1, run2+2+N, product );
+					}
 				}
 			}
 
@@ -1452,7 +1517,10 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 				if( G.getDim() != 0 ){
 
 					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, G      );
-					else               T.setDense( run1+1, run2+1+2*N, Gx*tmp );
+					else{
+						multiplyInto( product, Gx, tmp );
+						T.setDense( run1+1, run2+1+2*N, product );
+					}
 				}
 			}
 		}
@@ -1464,8 +1532,11 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 		d             .getSubBlock( run1, 0, tmp );   // get the corresponding  d^i.
 
 		if( tmp.getDim() != 0 ){
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, Gx*tmp + G );   // compute  d^{i+1} := G_x^i d^i + b^i
+			if( G.getDim() != 0 ){
+				multiplyInto( product, Gx, tmp );
+				product += G;
+				d.setDense( run1+1, 0, product );   // compute  d^{i+1} := G_x^i d^i + b^i
+			}
 		}
 		else{
 			if( G.getDim() != 0 )
@@ -121,17 +121,16 @@ returnValue DenseQPsolver::solve( DenseCP *cp )
 
 
     // GET THE PRIMAL AND DUAL SOLUTION FROM THE QP SOLVER AND
-    // STORE THEM IN THE RIGHT FORMAT:
+    // STORE THEM IN THE RIGHT FORMAT (THE WORKSPACES KEEP THEIR
+    // STORAGE, SUCH THAT REPEATED SOLUTIONS DO NOT ALLOCATE):
     // -------------------------------------------------------
-    Vector xOpt, yOpt;
+    getPrimalSolution( xOptWorkspace );
+    getDualSolution  ( yOptWorkspace );
 
-    getPrimalSolution( xOpt );
-    getDualSolution  ( yOpt );
+// 	xOptWorkspace.print("xOpt");
+// 	yOptWorkspace.print("yOpt");
 
-// 	xOpt.print("xOpt");
-// 	yOpt.print("yOpt");
-
-    cp->setQPsolution( xOpt,yOpt );
+    cp->setQPsolution( xOptWorkspace,yOptWorkspace );
 	
     return returnvalue;
 }
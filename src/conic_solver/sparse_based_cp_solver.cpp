@@ -0,0 +1,1482 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/conic_solver/sparse_based_cp_solver.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ */
+
+#include <acado/conic_solver/sparse_based_cp_solver.hpp>
+#include <acado/clock/real_clock.hpp>
+#include <include/acado_csparse/acado_csparse.hpp>
+
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Accuracy of the interior point method (residuals and duality gap). */
+static const double SPARSE_CP_TOL = 1.0e-10;
+
+/** Regularisation of the KKT matrix (relative to the residuals, the \n
+ *  iterates are corrected by the subsequent iterations). */
+static const double SPARSE_CP_REGULARISATION = 1.0e-11;
+
+/** Fraction to the boundary of the interior point steps. */
+static const double SPARSE_CP_STEP_FRACTION = 0.995;
+
+/** Distance to the central path (relative to the barrier parameter) \n
+ *  at which the iterations of a barrier subproblem are stopped. */
+static const double SPARSE_CP_CENTRAL_PATH_TOL = 10.0;
+
+/** Lower bound on warm-started slacks and multipliers. */
+static const double SPARSE_CP_WARM_START_MIN = 1.0e-8;
+
+/** Pivoting threshold of the sparse LU factorization. */
+static const double SPARSE_CP_PIVOT_TOL = 0.1;
+
+
+/** Resizes an array allocated by realloc (keeping its first entries). */
+template< class T >
+static void reallocArray( T*& array, uint size )
+{
+	array = (T*) realloc( array,size*sizeof(T) );
+}
+
+
+/** Returns a copy of the first size entries of an array (allocated by realloc). */
+template< class T >
+static T* copyArray( const T* array, uint size )
+{
+	if ( ( array == 0 ) || ( size == 0 ) )
+		return 0;
+
+	T* copy = (T*) malloc( size*sizeof(T) );
+	memcpy( copy,array,size*sizeof(T) );
+
+	return copy;
+}
+
+
+/** Returns the largest step in [0,1] keeping v + alpha*dv nonnegative. */
+static double getMaxStep( const Vector& v, const Vector& dv )
+{
+	double alpha = 1.0;
+
+	for( uint i = 0; i < v.getDim(); i++ )
+		if ( ( dv(i) < 0.0 ) && ( v(i) + alpha*dv(i) < 0.0 ) )
+			alpha = -v(i)/dv(i);
+
+	return alpha;
+}
+
+
+static double getMaxAbs( const double* v, uint dim )
+{
+	double maxAbs = 0.0;
+
+	for( uint i = 0; i < dim; i++ )
+		if ( fabs( v[i] ) > maxAbs )
+			maxAbs = fabs( v[i] );
+
+	return maxAbs;
+}
+
+
+static double getMaxAbs( const Vector& v )
+{
+	double maxAbs = 0.0;
+
+	for( uint i = 0; i < v.getDim(); i++ )
+		if ( fabs( v(i) ) > maxAbs )
+			maxAbs = fabs( v(i) );
+
+	return maxAbs;
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SparseBasedCPsolver::SparseBasedCPsolver( ) : BandedCPsolver( )
+{
+	nConstraints = 0;
+	blockDims = 0;
+
+	initializeArrays( );
+	numberOfIterations = 0;
+	barrierParameter = -1.0;
+
+	kktSolver = 0;
+}
+
+
+SparseBasedCPsolver::SparseBasedCPsolver(	UserInteraction* _userInteraction,
+											uint nConstraints_,
+											const Vector& blockDims_
+											) : BandedCPsolver( _userInteraction )
+{
+	nConstraints = nConstraints_;
+	blockDims = blockDims_;
+
+	initializeArrays( );
+	numberOfIterations = 0;
+	barrierParameter = -1.0;
+
+	kktSolver = new ACADOcsparse( );
+	kktSolver->setTolerance( SPARSE_CP_PIVOT_TOL );
+}
+
+
+SparseBasedCPsolver::SparseBasedCPsolver( const SparseBasedCPsolver& rhs )
+					:BandedCPsolver( rhs )
+{
+	initializeArrays( );
+	kktSolver = 0;
+	operator=( rhs );
+}
+
+
+SparseBasedCPsolver::~SparseBasedCPsolver( ){
+
+	clear( );
+	if( kktSolver != 0 ) delete kktSolver;
+}
+
+
+SparseBasedCPsolver& SparseBasedCPsolver::operator=( const SparseBasedCPsolver& rhs ){
+
+	if ( this != &rhs ){
+
+		if( kktSolver != 0 ) delete kktSolver;
+		clear( );
+
+		BandedCPsolver::operator=( rhs );
+
+		iter         = rhs.iter;
+		nConstraints = rhs.nConstraints;
+		blockDims    = rhs.blockDims;
+
+		// (the arrays are copied without spare capacity)
+		nV           = rhs.nV;
+		blockOffset  = copyArray( rhs.blockOffset,5*rhs.getNumPoints() );
+		varStage     = copyArray( rhs.varStage,rhs.nV );
+		maxRowLength = rhs.maxRowLength;
+		rowIdx       = copyArray( rhs.rowIdx,rhs.maxRowLength );
+		rowVal       = copyArray( rhs.rowVal,rhs.maxRowLength );
+
+		nH   = maxH = rhs.nH;
+		hRow = copyArray( rhs.hRow,rhs.nH );
+		hCol = copyArray( rhs.hCol,rhs.nH );
+		hVal = copyArray( rhs.hVal,rhs.nH );
+		g    = rhs.g;
+
+		nE = maxE = rhs.nE;
+		if ( rhs.eqStart != 0 )
+		{
+			maxEnz  = rhs.eqStart[rhs.nE];
+			eqStart = copyArray( rhs.eqStart,rhs.nE+1 );
+			eqIdx   = copyArray( rhs.eqIdx,maxEnz );
+			eqVal   = copyArray( rhs.eqVal,maxEnz );
+			eqRhs   = copyArray( rhs.eqRhs,rhs.nE );
+			eqDual  = copyArray( rhs.eqDual,rhs.nE );
+			eqStage = copyArray( rhs.eqStage,rhs.nE );
+		}
+
+		nI = maxI = rhs.nI;
+		if ( rhs.inStart != 0 )
+		{
+			maxInz  = rhs.inStart[rhs.nI];
+			inStart = copyArray( rhs.inStart,rhs.nI+1 );
+			inIdx   = copyArray( rhs.inIdx,maxInz );
+			inVal   = copyArray( rhs.inVal,maxInz );
+			inRhs   = copyArray( rhs.inRhs,rhs.nI );
+			inDual  = copyArray( rhs.inDual,rhs.nI );
+			inSign  = copyArray( rhs.inSign,rhs.nI );
+		}
+
+		nEqPrepared = rhs.nEqPrepared;
+		nInPrepared = rhs.nInPrepared;
+		initialLb   = rhs.initialLb;
+		initialUb   = rhs.initialUb;
+
+		// (the KKT ordering and pattern are set up again by each solve)
+		if( rhs.kktSolver != 0 ) kktSolver = rhs.kktSolver->clone();
+		else                     kktSolver = 0;
+
+		z      = rhs.z;
+		y      = rhs.y;
+		s      = rhs.s;
+		lambda = rhs.lambda;
+		numberOfIterations = rhs.numberOfIterations;
+		barrierParameter   = rhs.barrierParameter;
+
+		deltaX = rhs.deltaX;
+		deltaP = rhs.deltaP;
+	}
+	return *this;
+}
+
+
+BandedCPsolver* SparseBasedCPsolver::clone() const
+{
+	return new SparseBasedCPsolver(*this);
+}
+
+
+
+returnValue SparseBasedCPsolver::init(	const OCPiterate &iter_
+										)
+{
+	iter = iter_;
+
+	if ( kktSolver == 0 )
+	{
+		kktSolver = new ACADOcsparse( );
+		kktSolver->setTolerance( SPARSE_CP_PIVOT_TOL );
+	}
+
+	return setupVariables( );
+}
+
+
+
+returnValue SparseBasedCPsolver::prepareSolve(	BandedCP& cp
+												)
+{
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		acadoPrintf( "--> Setting up sparse QP ...\n" );
+
+	returnValue returnvalue = setupQPdata( cp );
+	if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		acadoPrintf( "<-- Setting up sparse QP done.\n" );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::solve(	BandedCP& cp
+										)
+{
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		returnValue returnvalue = prepareSolve( cp );
+		if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	// ADD THE (POSSIBLY FIXED) INITIAL VALUE AND PARAMETERS:
+	// -------------------------------------------------------
+	if ( setupInitialValueRows( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+
+
+	// SOLVE THE SPARSE QP:
+	// ------------------------------------
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		acadoPrintf( "--> Solving sparse QP ...\n" );
+
+	int maxQPiter;
+	get( MAX_NUM_QP_ITERATIONS, maxQPiter );
+
+	RealClock clock;
+	clock.start( );
+
+	returnValue returnvalue = solveQP( maxQPiter );
+
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	switch( returnvalue )
+	{
+		case SUCCESSFUL_RETURN:
+			break;
+
+		case RET_QP_SOLUTION_REACHED_LIMIT:
+			ACADOWARNING( RET_QP_SOLUTION_REACHED_LIMIT );
+			break;
+
+		default:
+			return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		acadoPrintf( "<-- Solving sparse QP done.\n" );
+
+	// Expand the KKT-System if neccessary:
+	// ------------------------------------
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+		return finalizeSolve( cp );
+	else
+		return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::finalizeSolve(	BandedCP& cp
+												)
+{
+	RealClock clock;
+
+	clock.reset( );
+	clock.start( );
+
+	returnValue returnvalue = expand( cp );
+	if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+	clock.stop( );
+	setLast( LOG_TIME_EXPAND,clock.getTime() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SparseBasedCPsolver::getParameters( Vector &p_  ) const
+{
+	if ( p_.getDim( ) != getNP( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( getNP( ) == 0 )
+		return SUCCESSFUL_RETURN;
+
+	if ( z.getDim( ) != nV )
+		return ACADOERROR( RET_QP_NOT_SOLVED );
+
+	uint startIdx = blockOffset[2*getNumPoints()];
+
+	for( uint i=0; i<getNP(); ++i )
+		p_( i ) = z( startIdx+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::getFirstControl( Vector &u0_ ) const
+{
+	if ( u0_.getDim( ) != getNU( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( ( getNU( ) == 0 ) || ( blockOffset[3*getNumPoints()] < 0 ) )
+		return SUCCESSFUL_RETURN;
+
+	if ( z.getDim( ) != nV )
+		return ACADOERROR( RET_QP_NOT_SOLVED );
+
+	uint startIdx = blockOffset[3*getNumPoints()];
+
+	for( uint i=0; i<getNU(); ++i )
+		u0_( i ) = z( startIdx+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SparseBasedCPsolver::setRealTimeParameters(	const Vector& DeltaX,
+														const Vector& DeltaP
+														)
+{
+	deltaX = DeltaX;
+	deltaP = DeltaP;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SparseBasedCPsolver::freezeCondensing( )
+{
+	// nothing to freeze: the QP is not condensed
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::unfreezeCondensing( )
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::setBarrierParameter( double mu )
+{
+	barrierParameter = mu;
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue SparseBasedCPsolver::initializeArrays( )
+{
+	nV = 0;
+	blockOffset  = 0;
+	varStage     = 0;
+	maxRowLength = 0;
+	rowIdx       = 0;
+	rowVal       = 0;
+
+	nH = maxH = 0;
+	hRow = 0;
+	hCol = 0;
+	hVal = 0;
+
+	nE = maxE = maxEnz = 0;
+	eqStart = 0;
+	eqIdx   = 0;
+	eqVal   = 0;
+	eqRhs   = 0;
+	eqDual  = 0;
+	eqStage = 0;
+
+	nI = maxI = maxInz = 0;
+	inStart = 0;
+	inIdx   = 0;
+	inVal   = 0;
+	inRhs   = 0;
+	inDual  = 0;
+	inSign  = 0;
+
+	nEqPrepared = 0;
+	nInPrepared = 0;
+
+	kktPos      = 0;
+	nKKTterms   = 0;
+	kktMap      = 0;
+	nKKTentries = 0;
+	kktRow      = 0;
+	kktCol      = 0;
+	kktVal      = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::clear( )
+{
+	free( blockOffset );
+	free( varStage );
+	free( rowIdx );
+	free( rowVal );
+
+	free( hRow );
+	free( hCol );
+	free( hVal );
+
+	free( eqStart );
+	free( eqIdx );
+	free( eqVal );
+	free( eqRhs );
+	free( eqDual );
+	free( eqStage );
+
+	free( inStart );
+	free( inIdx );
+	free( inVal );
+	free( inRhs );
+	free( inDual );
+	free( inSign );
+
+	free( kktPos );
+	free( kktMap );
+	free( kktRow );
+	free( kktCol );
+	free( kktVal );
+
+	return initializeArrays( );
+}
+
+
+returnValue SparseBasedCPsolver::setupVariables( )
+{
+	uint run1, run2;
+	uint N = getNumPoints();
+
+	// the QP variables are ordered stage by stage:
+	// (x_0,xa_0,u_0,w_0, x_1,xa_1,u_1,w_1, ..., x_{N-1},xa_{N-1}, p)
+	nV = N*( getNX() + getNXA() ) + getNP();
+	if ( N > 1 )
+		nV += (N-1)*( getNU() + getNW() );
+
+	reallocArray( blockOffset,5*N );
+	reallocArray( varStage,nV );
+
+	for( run1 = 0; run1 < 5*N; run1++ )
+		blockOffset[run1] = -1;
+
+	uint offset = 0;
+
+	for( run1 = 0; run1 < N; run1++ ){
+
+		uint stageOffset = offset;
+
+		if( getNX() != 0 ){
+			blockOffset[run1] = offset;
+			offset += getNX();
+		}
+		if( getNXA() != 0 ){
+			blockOffset[N+run1] = offset;
+			offset += getNXA();
+		}
+		if( ( getNU() != 0 ) && ( run1+1 < N ) ){
+			blockOffset[3*N+run1] = offset;
+			offset += getNU();
+		}
+		if( ( getNW() != 0 ) && ( run1+1 < N ) ){
+			blockOffset[4*N+run1] = offset;
+			offset += getNW();
+		}
+		for( run2 = stageOffset; run2 < offset; run2++ )
+			varStage[run2] = run1;
+	}
+
+	if( getNP() != 0 ){
+		for( run1 = 0; run1 < N; run1++ )
+			blockOffset[2*N+run1] = offset;
+		for( run2 = offset; run2 < nV; run2++ )
+			varStage[run2] = N;
+	}
+
+	// the controls of the last node coincide with the previous ones
+	if ( N > 1 ){
+		blockOffset[4*N-1] = blockOffset[4*N-2];
+		blockOffset[5*N-1] = blockOffset[5*N-2];
+	}
+
+	// a row has at most one entry per column of each block (plus the
+	// state of the next stage in case of the dynamic constraints)
+	maxRowLength = 1;
+	for( run1 = 0; run1 < 5*N; run1++ )
+		if ( blockOffset[run1] >= 0 )
+			maxRowLength += getBlockDim( run1 );
+
+	reallocArray( rowIdx,maxRowLength );
+	reallocArray( rowVal,maxRowLength );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+uint SparseBasedCPsolver::getBlockDim( uint idx ) const
+{
+	switch( idx/getNumPoints() )
+	{
+		case 0:  return getNX();
+		case 1:  return getNXA();
+		case 2:  return getNP();
+		case 3:  return getNU();
+		default: return getNW();
+	}
+}
+
+
+int SparseBasedCPsolver::getBoundOffset( uint idx, uint &dim ) const
+{
+	uint N = getNumPoints();
+
+	// bounds are ordered as (x_0..x_{N-1}, xa_0..xa_{N-1}, p,
+	// u_0..u_{N-1}, w_0..w_{N-1}), the last controls are not used
+	if ( idx < 2*N ){
+		dim = getBlockDim( idx );
+		return blockOffset[idx];
+	}
+	if ( idx == 2*N ){
+		dim = getNP();
+		return blockOffset[2*N];
+	}
+	if ( ( idx > 2*N ) && ( idx < 3*N ) ){
+		dim = getNU();
+		return blockOffset[idx+N-1];
+	}
+	if ( ( idx > 3*N ) && ( idx < 4*N ) ){
+		dim = getNW();
+		return blockOffset[idx+N-1];
+	}
+
+	dim = 0;
+	return -1;
+}
+
+
+returnValue SparseBasedCPsolver::setupQPdata( BandedCP& cp )
+{
+	uint run1, run2, run3, run4;
+	uint N = getNumPoints();
+	uint nX = getNX();
+
+	Matrix tmp, tmp2;
+
+
+	// HESSIAN AND OBJECTIVE GRADIENT:
+	// -------------------------------
+	nH = 0;
+	g.init( nV );
+	g.setZero( );
+
+	uint nBlocks = acadoMin( (int)cp.hessian.getNumRows(), (int)(5*N) );
+
+	for( run1 = 0; run1 < nBlocks; run1++ ){
+		if ( blockOffset[run1] < 0 ) continue;
+
+		for( run2 = 0; run2 < nBlocks; run2++ ){
+			if ( blockOffset[run2] < 0 ) continue;
+
+			cp.hessian.getSubBlock( run1, run2, tmp );
+
+			for( run3 = 0; run3 < tmp.getNumRows(); run3++ ){
+				for( run4 = 0; run4 < tmp.getNumCols(); run4++ ){
+					if ( acadoIsZero( tmp(run3,run4) ) == BT_FALSE ){
+
+						if ( nH == maxH ){
+							maxH = 2*maxH + 16;
+							reallocArray( hRow,maxH );
+							reallocArray( hCol,maxH );
+							reallocArray( hVal,maxH );
+						}
+
+						hRow[nH] = blockOffset[run1]+run3;
+						hCol[nH] = blockOffset[run2]+run4;
+						hVal[nH] = tmp(run3,run4);
+						nH++;
+					}
+				}
+			}
+		}
+	}
+
+	if ( cp.objectiveGradient.getNumRows() > 0 ){
+		nBlocks = acadoMin( (int)cp.objectiveGradient.getNumCols(), (int)(5*N) );
+
+		for( run2 = 0; run2 < nBlocks; run2++ ){
+			if ( blockOffset[run2] < 0 ) continue;
+
+			cp.objectiveGradient.getSubBlock( 0, run2, tmp );
+			for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+				g( blockOffset[run2]+run4 ) += tmp(0,run4);
+		}
+	}
+
+
+	nE = 0;
+	if ( eqStart == 0 )
+		reallocArray( eqStart,maxE+1 );
+	eqStart[0] = 0;
+
+	nI = 0;
+	if ( inStart == 0 )
+		reallocArray( inStart,maxI+1 );
+	inStart[0] = 0;
+
+
+	// DYNAMIC CONSTRAINTS:  x_{k+1} - Gx x_k - Gxa xa_k - Gp p - Gu u_k - Gw w_k = b_k
+	// --------------------------------------------------------------------------------
+	uint dualOffset = nV + getNC();
+
+	if ( nX > 0 ){
+		for( run1 = 0; run1+1 < N; run1++ ){
+
+			Matrix G[5];
+			for( run2 = 0; run2 < 5; run2++ )
+				if ( ( run1 < cp.dynGradient.getNumRows() ) && ( run2 < cp.dynGradient.getNumCols() ) )
+					cp.dynGradient.getSubBlock( run1, run2, G[run2] );
+
+			tmp.init( 0, 0 );
+			if ( run1 < cp.dynResiduum.getNumRows() )
+				cp.dynResiduum.getSubBlock( run1, 0, tmp );
+
+			for( run3 = 0; run3 < nX; run3++ ){
+
+				uint nEntries = 0;
+
+				for( run2 = 0; run2 < 5; run2++ ){
+					int offset = blockOffset[run2*N+run1];
+					if ( ( offset < 0 ) || ( G[run2].getNumRows() <= run3 ) ) continue;
+
+					for( run4 = 0; run4 < G[run2].getNumCols(); run4++ ){
+						if ( acadoIsZero( G[run2](run3,run4) ) == BT_FALSE ){
+							rowIdx[nEntries] = offset+run4;
+							rowVal[nEntries] = -G[run2](run3,run4);
+							nEntries++;
+						}
+					}
+				}
+				rowIdx[nEntries] = blockOffset[run1+1]+run3;
+				rowVal[nEntries] = 1.0;
+				nEntries++;
+
+				double b = ( tmp.getNumRows() > run3 ) ? tmp(run3,0) : 0.0;
+
+				if ( addRow( nEntries,rowIdx,rowVal, b,b, dualOffset+run1*nX+run3 ) != SUCCESSFUL_RETURN )
+					return RET_QP_HAS_INCONSISTENT_BOUNDS;
+			}
+		}
+	}
+
+
+	// SIMPLE BOUNDS (EXCEPT ON THE INITIAL STATE AND THE PARAMETERS):
+	// ----------------------------------------------------------------
+	initialLb.init( nX+getNP() );
+	initialLb.setAll( -INFTY );
+	initialUb.init( nX+getNP() );
+	initialUb.setAll(  INFTY );
+
+	for( run1 = 0; run1 < 4*N+1; run1++ ){
+
+		uint dim;
+		int offset = getBoundOffset( run1, dim );
+		if ( ( offset < 0 ) || ( dim == 0 ) ) continue;
+
+		if ( run1 < cp.lowerBoundResiduum.getNumRows() )
+			cp.lowerBoundResiduum.getSubBlock( run1, 0, tmp, dim, 1 );
+		else
+			tmp.init( 0, 0 );
+
+		if ( run1 < cp.upperBoundResiduum.getNumRows() )
+			cp.upperBoundResiduum.getSubBlock( run1, 0, tmp2, dim, 1 );
+		else
+			tmp2.init( 0, 0 );
+
+		for( run3 = 0; run3 < dim; run3++ ){
+
+			double lb = ( tmp.getNumRows()  > run3 ) ? tmp (run3,0) : -INFTY;
+			double ub = ( tmp2.getNumRows() > run3 ) ? tmp2(run3,0) :  INFTY;
+
+			if ( run1 == 0 ){
+				initialLb(run3) = lb;
+				initialUb(run3) = ub;
+				continue;
+			}
+			if ( run1 == 2*N ){
+				initialLb(nX+run3) = lb;
+				initialUb(nX+run3) = ub;
+				continue;
+			}
+
+			rowIdx[0] = offset+run3;
+			rowVal[0] = 1.0;
+
+			if ( addRow( 1,rowIdx,rowVal, lb,ub, offset+run3 ) != SUCCESSFUL_RETURN )
+				return RET_QP_HAS_INCONSISTENT_BOUNDS;
+		}
+	}
+
+
+	// GENERAL CONSTRAINTS:
+	// --------------------
+	uint rowOffset = 0;
+
+	nBlocks = acadoMin( (int)cp.constraintGradient.getNumCols(), (int)(5*N) );
+	Matrix* G = new Matrix[nBlocks];
+
+	for( run1 = 0; run1 < cp.constraintGradient.getNumRows(); run1++ ){
+
+		uint nRows = ( run1 < blockDims.getDim() ) ? (uint)blockDims(run1) : 0;
+
+		for( run2 = 0; run2 < nBlocks; run2++ )
+			if ( blockOffset[run2] >= 0 )
+				cp.constraintGradient.getSubBlock( run1, run2, G[run2] );
+
+		cp.lowerConstraintResiduum.getSubBlock( run1, 0, tmp  );
+		cp.upperConstraintResiduum.getSubBlock( run1, 0, tmp2 );
+
+		for( run3 = 0; run3 < nRows; run3++ ){
+
+			uint nEntries = 0;
+
+			for( run2 = 0; run2 < nBlocks; run2++ ){
+				if ( ( blockOffset[run2] < 0 ) || ( G[run2].getNumRows() <= run3 ) ) continue;
+
+				for( run4 = 0; run4 < G[run2].getNumCols(); run4++ ){
+					if ( acadoIsZero( G[run2](run3,run4) ) == BT_FALSE ){
+						rowIdx[nEntries] = blockOffset[run2]+run4;
+						rowVal[nEntries] = G[run2](run3,run4);
+						nEntries++;
+					}
+				}
+			}
+
+			double lb = ( tmp.getNumRows()  > run3 ) ? tmp (run3,0) : -INFTY;
+			double ub = ( tmp2.getNumRows() > run3 ) ? tmp2(run3,0) :  INFTY;
+
+			if ( addRow( nEntries,rowIdx,rowVal, lb,ub, nV+rowOffset+run3 ) != SUCCESSFUL_RETURN ){
+				delete[] G;
+				return RET_QP_HAS_INCONSISTENT_BOUNDS;
+			}
+		}
+		rowOffset += nRows;
+	}
+
+	delete[] G;
+
+	nEqPrepared = nE;
+	nInPrepared = nI;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::setupInitialValueRows( )
+{
+	uint run1;
+	uint nX = getNX();
+	uint N  = getNumPoints();
+
+	// remove the rows of the previous solve
+	nE = nEqPrepared;
+	nI = nInPrepared;
+
+	if ( initialLb.getDim() != nX+getNP() )
+		return ACADOERROR( RET_QP_NOT_SOLVED );
+
+	for( run1 = 0; run1 < nX+getNP(); run1++ ){
+
+		double lb = initialLb(run1);
+		double ub = initialUb(run1);
+
+		if ( run1 < nX ){
+			rowIdx[0] = blockOffset[0]+run1;
+			if ( deltaX.isEmpty( ) == BT_FALSE )
+				lb = ub = deltaX(run1);
+		}
+		else{
+			rowIdx[0] = blockOffset[2*N]+run1-nX;
+			if ( deltaP.isEmpty( ) == BT_FALSE )
+				lb = ub = deltaP(run1-nX);
+		}
+		rowVal[0] = 1.0;
+
+		if ( addRow( 1,rowIdx,rowVal, lb,ub, rowIdx[0] ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_QP_HAS_INCONSISTENT_BOUNDS );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::addRow(	uint nEntries,
+											const uint* idx,
+											const double* val,
+											double lb,
+											double ub,
+											uint dualIdx
+											)
+{
+	uint run1;
+	uint N = getNumPoints();
+
+	BooleanType hasLower = acadoIsFinite( lb );
+	BooleanType hasUpper = acadoIsFinite( ub );
+
+	if ( ( hasLower == BT_TRUE ) && ( hasUpper == BT_TRUE ) )
+	{
+		if ( lb > ub + BOUNDTOL )
+			return RET_QP_HAS_INCONSISTENT_BOUNDS;
+
+		if ( ub - lb < BOUNDTOL )
+		{
+			// the stage of an equality is the last stage it depends on,
+			// rows which only depend on the parameters are stored last
+			uint stage = N;
+			for( run1 = 0; run1 < nEntries; run1++ )
+				if ( ( varStage[idx[run1]] < N ) && ( ( stage == N ) || ( varStage[idx[run1]] > stage ) ) )
+					stage = varStage[idx[run1]];
+
+			if ( nE == maxE ){
+				maxE = 2*maxE + 16;
+				reallocArray( eqStart,maxE+1 );
+				reallocArray( eqRhs,maxE );
+				reallocArray( eqDual,maxE );
+				reallocArray( eqStage,maxE );
+			}
+			if ( eqStart[nE]+nEntries > maxEnz ){
+				maxEnz = 2*( eqStart[nE]+nEntries );
+				reallocArray( eqIdx,maxEnz );
+				reallocArray( eqVal,maxEnz );
+			}
+
+			for( run1 = 0; run1 < nEntries; run1++ ){
+				eqIdx[eqStart[nE]+run1] = idx[run1];
+				eqVal[eqStart[nE]+run1] = val[run1];
+			}
+			eqStart[nE+1] = eqStart[nE]+nEntries;
+			eqRhs[nE]     = 0.5*(lb+ub);
+			eqDual[nE]    = dualIdx;
+			eqStage[nE]   = stage;
+			nE++;
+
+			return SUCCESSFUL_RETURN;
+		}
+	}
+
+	if ( nEntries == 0 )
+		return SUCCESSFUL_RETURN;
+
+	// a'z >= lb  and  -a'z >= -ub:
+	if ( hasLower == BT_TRUE )
+		addInequality( nEntries,idx,val, 1.0,lb, dualIdx );
+
+	if ( hasUpper == BT_TRUE )
+		addInequality( nEntries,idx,val, -1.0,-ub, dualIdx );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::addInequality(	uint nEntries,
+													const uint* idx,
+													const double* val,
+													double sign,
+													double rhs,
+													uint dualIdx
+													)
+{
+	uint run1;
+
+	if ( nI == maxI ){
+		maxI = 2*maxI + 16;
+		reallocArray( inStart,maxI+1 );
+		reallocArray( inRhs,maxI );
+		reallocArray( inDual,maxI );
+		reallocArray( inSign,maxI );
+	}
+	if ( inStart[nI]+nEntries > maxInz ){
+		maxInz = 2*( inStart[nI]+nEntries );
+		reallocArray( inIdx,maxInz );
+		reallocArray( inVal,maxInz );
+	}
+
+	for( run1 = 0; run1 < nEntries; run1++ ){
+		inIdx[inStart[nI]+run1] = idx[run1];
+		inVal[inStart[nI]+run1] = sign*val[run1];
+	}
+	inStart[nI+1] = inStart[nI]+nEntries;
+	inRhs[nI]     = rhs;
+	inDual[nI]    = dualIdx;
+	inSign[nI]    = sign;
+	nI++;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::setupKKTordering( )
+{
+	uint run1;
+	uint N = getNumPoints();
+
+	// each stage consists of its variables followed by its equalities
+	uint* position = new uint[N+2];
+
+	for( run1 = 0; run1 < N+2; run1++ )
+		position[run1] = 0;
+	for( run1 = 0; run1 < nV; run1++ )
+		position[varStage[run1]+1]++;
+	for( run1 = 0; run1 < nE; run1++ )
+		position[eqStage[run1]+1]++;
+	for( run1 = 1; run1 < N+2; run1++ )
+		position[run1] += position[run1-1];
+
+	reallocArray( kktPos,nV+nE );
+
+	for( run1 = 0; run1 < nV; run1++ )
+		kktPos[run1] = position[varStage[run1]]++;
+	for( run1 = 0; run1 < nE; run1++ )
+		kktPos[nV+run1] = position[eqStage[run1]]++;
+
+	delete[] position;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseBasedCPsolver::setupKKTpattern( )
+{
+	uint run1, run2, run3;
+	uint nK = nV + nE;
+
+
+	// POSITIONS OF ALL TERMS (IN THE ORDER OF factorizeKKT):
+	// ------------------------------------------------------
+	nKKTterms = 2*nH + nV + 2*eqStart[nE] + nE;
+	for( run1 = 0; run1 < nI; run1++ )
+		nKKTterms += ( inStart[run1+1]-inStart[run1] )*( inStart[run1+1]-inStart[run1] );
+
+	uint* termRow = new uint[nKKTterms];
+	uint* termCol = new uint[nKKTterms];
+	uint nTerms = 0;
+
+	// (symmetrized) Hessian and regularisation
+	for( run1 = 0; run1 < nH; run1++ ){
+		termRow[nTerms] = kktPos[hRow[run1]];  termCol[nTerms] = kktPos[hCol[run1]];  nTerms++;
+		termRow[nTerms] = kktPos[hCol[run1]];  termCol[nTerms] = kktPos[hRow[run1]];  nTerms++;
+	}
+
+	for( run1 = 0; run1 < nV; run1++ ){
+		termRow[nTerms] = termCol[nTerms] = kktPos[run1];
+		nTerms++;
+	}
+
+	// A' Sigma A
+	for( run1 = 0; run1 < nI; run1++ )
+		for( run2 = inStart[run1]; run2 < inStart[run1+1]; run2++ )
+			for( run3 = inStart[run1]; run3 < inStart[run1+1]; run3++ ){
+				termRow[nTerms] = kktPos[inIdx[run2]];
+				termCol[nTerms] = kktPos[inIdx[run3]];
+				nTerms++;
+			}
+
+	// equalities
+	for( run1 = 0; run1 < nE; run1++ ){
+		for( run2 = eqStart[run1]; run2 < eqStart[run1+1]; run2++ ){
+			termRow[nTerms] = kktPos[nV+run1];      termCol[nTerms] = kktPos[eqIdx[run2]];  nTerms++;
+			termRow[nTerms] = kktPos[eqIdx[run2]];  termCol[nTerms] = kktPos[nV+run1];      nTerms++;
+		}
+		termRow[nTerms] = termCol[nTerms] = kktPos[nV+run1];
+		nTerms++;
+	}
+
+
+	// UNIQUE ENTRIES:
+	// ---------------
+	// (counting sorts by rows and then by columns order the terms by
+	//  columns and rows, such that duplicate terms become adjacent)
+	uint* count  = new uint[nK+1];
+	uint* byRow  = new uint[nKKTterms];
+	uint* byCol  = new uint[nKKTterms];
+
+	for( run1 = 0; run1 <= nK; run1++ )
+		count[run1] = 0;
+	for( run1 = 0; run1 < nKKTterms; run1++ )
+		count[termRow[run1]+1]++;
+	for( run1 = 0; run1 < nK; run1++ )
+		count[run1+1] += count[run1];
+	for( run1 = 0; run1 < nKKTterms; run1++ )
+		byRow[count[termRow[run1]]++] = run1;
+
+	for( run1 = 0; run1 <= nK; run1++ )
+		count[run1] = 0;
+	for( run1 = 0; run1 < nKKTterms; run1++ )
+		count[termCol[run1]+1]++;
+	for( run1 = 0; run1 < nK; run1++ )
+		count[run1+1] += count[run1];
+	for( run1 = 0; run1 < nKKTterms; run1++ )
+		byCol[count[termCol[byRow[run1]]]++] = byRow[run1];
+
+	reallocArray( kktMap,nKKTterms );
+	reallocArray( kktRow,nKKTterms );
+	reallocArray( kktCol,nKKTterms );
+	reallocArray( kktVal,nKKTterms );
+
+	nKKTentries = 0;
+
+	for( run1 = 0; run1 < nKKTterms; run1++ ){
+
+		uint term = byCol[run1];
+
+		if ( ( nKKTentries == 0 ) ||
+			 ( kktRow[nKKTentries-1] != (int)termRow[term] ) ||
+			 ( kktCol[nKKTentries-1] != (int)termCol[term] ) )
+		{
+			kktRow[nKKTentries] = termRow[term];
+			kktCol[nKKTentries] = termCol[term];
+			nKKTentries++;
+		}
+		kktMap[term] = nKKTentries-1;
+	}
+
+	delete[] termRow;
+	delete[] termCol;
+	delete[] count;
+	delete[] byRow;
+	delete[] byCol;
+
+	kktSolver->setDimension( nK );
+	kktSolver->setNumberOfEntries( nKKTentries );
+
+	return kktSolver->setIndices( kktRow,kktCol );
+}
+
+
+returnValue SparseBasedCPsolver::factorizeKKT(	const Vector& sigma,
+												double regularisation
+												)
+{
+	uint run1, run2, run3;
+	uint nTerms = 0;
+
+	// (the terms are summed up in the order of setupKKTpattern)
+	for( run1 = 0; run1 < nKKTentries; run1++ )
+		kktVal[run1] = 0.0;
+
+	// (symmetrized) Hessian and regularisation
+	for( run1 = 0; run1 < nH; run1++ ){
+		kktVal[kktMap[nTerms++]] += 0.5*hVal[run1];
+		kktVal[kktMap[nTerms++]] += 0.5*hVal[run1];
+	}
+
+	for( run1 = 0; run1 < nV; run1++ )
+		kktVal[kktMap[nTerms++]] += regularisation;
+
+	// A' Sigma A
+	for( run1 = 0; run1 < nI; run1++ )
+		for( run2 = inStart[run1]; run2 < inStart[run1+1]; run2++ )
+			for( run3 = inStart[run1]; run3 < inStart[run1+1]; run3++ )
+				kktVal[kktMap[nTerms++]] += sigma(run1)*inVal[run2]*inVal[run3];
+
+	// equalities: [ . -E' ; -E -delta ]
+	for( run1 = 0; run1 < nE; run1++ ){
+		for( run2 = eqStart[run1]; run2 < eqStart[run1+1]; run2++ ){
+			kktVal[kktMap[nTerms++]] -= eqVal[run2];
+			kktVal[kktMap[nTerms++]] -= eqVal[run2];
+		}
+		kktVal[kktMap[nTerms++]] -= SPARSE_CP_REGULARISATION;
+	}
+
+	return kktSolver->setMatrix( kktVal );
+}
+
+
+returnValue SparseBasedCPsolver::solveQP( uint maxIter )
+{
+	uint run1, run2;
+	uint nK = nV + nE;
+
+	double levenbergMarquard;
+	get( LEVENBERG_MARQUARDT, levenbergMarquard );
+	if ( levenbergMarquard < EPS )
+		levenbergMarquard = 0.0;
+
+	if ( nV == 0 ){
+		z.init( 0 );  y.init( 0 );  s.init( 0 );  lambda.init( 0 );
+		numberOfIterations = 0;
+		return SUCCESSFUL_RETURN;
+	}
+
+	// the sparsity pattern of the KKT matrix is the same in all iterations
+	setupKKTordering( );
+
+	if ( setupKKTpattern( ) != SUCCESSFUL_RETURN )
+		return RET_QP_SOLUTION_FAILED;
+
+
+	// INITIALIZATION:
+	// ---------------
+	// (within an interior point NLP method, the slacks and multipliers of
+	//  the last solution are a good starting point for the next QP)
+	BooleanType isWarmStart = BT_FALSE;
+
+	if ( ( barrierParameter >= 0.0 ) && ( y.getDim() == nE ) && ( s.getDim() == nI ) && ( lambda.getDim() == nI ) )
+		isWarmStart = BT_TRUE;
+
+	z.init( nV );
+	z.setZero( );
+
+	if ( isWarmStart == BT_TRUE ){
+		double minValue = acadoMax( barrierParameter, SPARSE_CP_WARM_START_MIN );
+		for( run1 = 0; run1 < nI; run1++ ){
+			s(run1)      = acadoMax( s(run1),      minValue );
+			lambda(run1) = acadoMax( lambda(run1), minValue );
+		}
+	}
+	else{
+		y.init( nE );
+		y.setZero( );
+		s.init( nI );
+		s.setAll( 1.0 );
+		lambda.init( nI );
+		lambda.setAll( 1.0 );
+
+		for( run1 = 0; run1 < nI; run1++ )
+			if ( -inRhs[run1] > 1.0 )
+				s(run1) = -inRhs[run1];
+	}
+
+	// the iterations stop close to the central path if a barrier parameter is given
+	double tolerance = SPARSE_CP_TOL;
+	if ( barrierParameter > 0.0 )
+		tolerance = acadoMax( SPARSE_CP_TOL, SPARSE_CP_CENTRAL_PATH_TOL*barrierParameter );
+
+	double scaleD = 1.0 + getMaxAbs( g );
+	double scaleP = 1.0 + acadoMax( getMaxAbs( eqRhs,nE ),getMaxAbs( inRhs,nI ) );
+
+	Vector rd( nV ), re( nE ), ri( nI ), sigma( nI ), t( nI );
+	Vector rhs( nK ), dz( nV ), dy( nE ), ds( nI ), dl( nI );
+	Vector dsAff( nI ), dlAff( nI );
+
+	returnValue returnvalue = RET_QP_SOLUTION_REACHED_LIMIT;
+
+	for( numberOfIterations = 0; numberOfIterations <= (int)maxIter; numberOfIterations++ ){
+
+		// RESIDUALS:
+		// ----------
+		// rd = Hz + g - E'y - A'lambda,  re = Ez - e,  ri = Az - s - b
+		for( run1 = 0; run1 < nV; run1++ )
+			rd(run1) = g(run1) + levenbergMarquard*z(run1);
+
+		for( run1 = 0; run1 < nH; run1++ ){
+			rd(hRow[run1]) += 0.5*hVal[run1]*z(hCol[run1]);
+			rd(hCol[run1]) += 0.5*hVal[run1]*z(hRow[run1]);
+		}
+
+		for( run1 = 0; run1 < nE; run1++ ){
+			re(run1) = -eqRhs[run1];
+			for( run2 = eqStart[run1]; run2 < eqStart[run1+1]; run2++ ){
+				re(run1) += eqVal[run2]*z(eqIdx[run2]);
+				rd(eqIdx[run2]) -= eqVal[run2]*y(run1);
+			}
+		}
+
+		double mu = 0.0;
+
+		for( run1 = 0; run1 < nI; run1++ ){
+			ri(run1) = -s(run1) - inRhs[run1];
+			for( run2 = inStart[run1]; run2 < inStart[run1+1]; run2++ ){
+				ri(run1) += inVal[run2]*z(inIdx[run2]);
+				rd(inIdx[run2]) -= inVal[run2]*lambda(run1);
+			}
+			mu += s(run1)*lambda(run1);
+		}
+		if ( nI > 0 )
+			mu /= (double)nI;
+
+		if ( ( getMaxAbs( rd ) <= tolerance*scaleD ) &&
+			 ( getMaxAbs( re ) <= tolerance*scaleP ) &&
+			 ( getMaxAbs( ri ) <= tolerance*scaleP ) &&
+			 ( mu <= tolerance*scaleD ) )
+		{
+			returnvalue = SUCCESSFUL_RETURN;
+			break;
+		}
+
+		if ( ( numberOfIterations == (int)maxIter ) || ( mu > 1.0/SPARSE_CP_TOL ) || ( acadoIsFinite( mu ) == BT_FALSE ) )
+			break;
+
+
+		// FACTORIZE THE KKT MATRIX:
+		// -------------------------
+		for( run1 = 0; run1 < nI; run1++ )
+			sigma(run1) = lambda(run1)/s(run1);
+
+		if ( factorizeKKT( sigma, levenbergMarquard + SPARSE_CP_REGULARISATION ) != SUCCESSFUL_RETURN )
+			return RET_QP_SOLUTION_FAILED;
+
+
+		// PREDICTOR (sigma = 0) AND CORRECTOR STEP:
+		// -----------------------------------------
+		double sigmaMu = 0.0;
+		double alpha   = 1.0;
+
+		for( int step = 0; step < 2; step++ ){
+
+			for( run1 = 0; run1 < nI; run1++ )
+				t(run1) = ( step == 0 ) ? 0.0 : sigmaMu - dsAff(run1)*dlAff(run1);
+
+			// rhs = [ -rd + A'( S^{-1} t - lambda - Sigma ri ) ; re ]
+			for( run1 = 0; run1 < nV; run1++ )
+				rhs(kktPos[run1]) = -rd(run1);
+
+			for( run1 = 0; run1 < nI; run1++ ){
+				double aux = t(run1)/s(run1) - lambda(run1) - sigma(run1)*ri(run1);
+				for( run2 = inStart[run1]; run2 < inStart[run1+1]; run2++ )
+					rhs(kktPos[inIdx[run2]]) += inVal[run2]*aux;
+			}
+
+			for( run1 = 0; run1 < nE; run1++ )
+				rhs(kktPos[nV+run1]) = re(run1);
+
+			if ( kktSolver->solve( rhs.getDoublePointer( ) ) != SUCCESSFUL_RETURN )
+				return RET_QP_SOLUTION_FAILED;
+
+			for( run1 = 0; run1 < nV; run1++ )
+				dz(run1) = rhs(kktPos[run1]);
+			for( run1 = 0; run1 < nE; run1++ )
+				dy(run1) = rhs(kktPos[nV+run1]);
+
+			// ds = A dz + ri,  dlambda = S^{-1} t - lambda - Sigma ds
+			for( run1 = 0; run1 < nI; run1++ ){
+				ds(run1) = ri(run1);
+				for( run2 = inStart[run1]; run2 < inStart[run1+1]; run2++ )
+					ds(run1) += inVal[run2]*dz(inIdx[run2]);
+				dl(run1) = t(run1)/s(run1) - lambda(run1) - sigma(run1)*ds(run1);
+			}
+
+			alpha = acadoMin( getMaxStep( s,ds ),getMaxStep( lambda,dl ) );
+
+			if ( ( step > 0 ) || ( nI == 0 ) )
+				break;
+
+			// Mehrotra's heuristic for the centering parameter
+			double muAff = 0.0;
+			for( run1 = 0; run1 < nI; run1++ )
+				muAff += ( s(run1) + alpha*ds(run1) ) * ( lambda(run1) + alpha*dl(run1) );
+			muAff /= (double)nI;
+
+			sigmaMu = acadoMax( mu * pow( muAff/mu, 3 ), barrierParameter );
+
+			for( run1 = 0; run1 < nI; run1++ ){
+				dsAff(run1) = ds(run1);
+				dlAff(run1) = dl(run1);
+			}
+		}
+
+		if ( nI > 0 )
+			alpha = acadoMin( 1.0, SPARSE_CP_STEP_FRACTION*alpha );
+
+
+		// UPDATE THE ITERATE:
+		// -------------------
+		for( run1 = 0; run1 < nV; run1++ )
+			z(run1) += alpha*dz(run1);
+		for( run1 = 0; run1 < nE; run1++ )
+			y(run1) += alpha*dy(run1);
+		for( run1 = 0; run1 < nI; run1++ ){
+			s(run1)      += alpha*ds(run1);
+			lambda(run1) += alpha*dl(run1);
+		}
+	}
+
+	if ( ( returnvalue != SUCCESSFUL_RETURN ) && ( numberOfIterations < (int)maxIter ) )
+		return RET_QP_INFEASIBLE;
+
+	return returnvalue;
+}
+
+
+returnValue SparseBasedCPsolver::expand( BandedCP& cp )
+{
+	uint run1, run2;
+	uint N  = getNumPoints();
+	uint nX = getNX();
+
+	if ( z.getDim() != nV )
+		return ACADOERROR( RET_UNABLE_TO_EXPAND );
+
+
+	// MERGE THE MULTIPLIERS:
+	// (bounds of all variables, constraints, dynamic constraints)
+	// ------------------------------------------------------------
+	Vector dual( nV + getNC() + (N-1)*nX );
+	dual.setZero( );
+
+	for( run1 = 0; run1 < y.getDim(); run1++ )
+		dual(eqDual[run1]) += y(run1);
+	for( run1 = 0; run1 < lambda.getDim(); run1++ )
+		dual(inDual[run1]) += inSign[run1]*lambda(run1);
+
+
+	// PRIMAL SOLUTION:
+	// ----------------
+	Matrix tmp;
+
+	cp.deltaX.init( 5*N, 1 );
+
+	for( run1 = 0; run1 < 5*N; run1++ ){
+		uint dim = getBlockDim( run1 );
+		if ( ( blockOffset[run1] < 0 ) || ( dim == 0 ) ) continue;
+
+		tmp.init( dim, 1 );
+		for( run2 = 0; run2 < dim; run2++ )
+			tmp(run2,0) = z(blockOffset[run1]+run2);
+		cp.deltaX.setDense( run1, 0, tmp );
+	}
+
+
+	// MULTIPLIERS OF THE DYNAMIC CONSTRAINTS:
+	// ---------------------------------------
+	if ( nX != 0 ){
+
+		int dynMode;
+		get( DYNAMIC_SENSITIVITY, dynMode );
+
+		cp.lambdaDynamic.init( N-1, 1 );
+
+		for( run1 = 0; run1 < N-1; run1++ ){
+			tmp.init( nX, 1 );
+			for( run2 = 0; run2 < nX; run2++ )
+				tmp(run2,0) = dual(nV+getNC()+run1*nX+run2);
+
+			if( dynMode == FORWARD_SENSITIVITY_LIFTED )
+				tmp.setAll( 1.0/((double) nX) );
+
+			cp.lambdaDynamic.setDense( run1, 0, tmp );
+		}
+	}
+
+
+	// MULTIPLIERS OF THE CONSTRAINTS:
+	// -------------------------------
+	cp.lambdaConstraint.init( blockDims.getDim(), 1 );
+
+	uint rowOffset = 0;
+	for( run1 = 0; run1 < (uint)blockDims.getDim(); run1++ ){
+		tmp.init( (int) blockDims(run1), 1 );
+
+		for( run2 = 0; run2 < blockDims(run1); run2++ )
+			tmp(run2,0) = dual(nV+rowOffset+run2);
+
+		cp.lambdaConstraint.setDense( run1, 0, tmp );
+		rowOffset += (int) blockDims(run1);
+	}
+
+
+	// MULTIPLIERS OF THE BOUNDS:
+	// --------------------------
+	cp.lambdaBound.init( 4*N+1, 1 );
+
+	for( run1 = 0; run1 < 4*N+1; run1++ ){
+		uint dim;
+		int offset = getBoundOffset( run1, dim );
+		if ( ( offset < 0 ) || ( dim == 0 ) ) continue;
+
+		tmp.init( dim, 1 );
+		for( run2 = 0; run2 < dim; run2++ )
+			tmp(run2,0) = dual(offset+run2);
+		cp.lambdaBound.setDense( run1, 0, tmp );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
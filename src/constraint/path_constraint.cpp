@@ -45,16 +45,25 @@ BEGIN_NAMESPACE_ACADO
 PathConstraint::PathConstraint( )
                :ConstraintElement(){
 
+    hasBatchTrace  = BT_FALSE;
+    needsBuffering = BT_FALSE;
 }
 
 PathConstraint::PathConstraint( const Grid& grid_ )
                :ConstraintElement(grid_, 1, grid_.getNumPoints() ){
 
+    hasBatchTrace  = BT_FALSE;
+    needsBuffering = BT_FALSE;
 }
 
 PathConstraint::PathConstraint( const PathConstraint& rhs )
                :ConstraintElement(rhs){
 
+    zBatch         = rhs.zBatch;
+    fBatch         = rhs.fBatch;
+    batchWorkspace = rhs.batchWorkspace;
+    hasBatchTrace  = rhs.hasBatchTrace;
+    needsBuffering = rhs.needsBuffering;
 }
 
 PathConstraint::~PathConstraint( ){
@@ -66,6 +75,12 @@ PathConstraint& PathConstraint::operator=( const PathConstraint& rhs ){
     if( this != &rhs ){
 
         ConstraintElement::operator=(rhs);
+
+        zBatch         = rhs.zBatch;
+        fBatch         = rhs.fBatch;
+        batchWorkspace = rhs.batchWorkspace;
+        hasBatchTrace  = rhs.hasBatchTrace;
+        needsBuffering = rhs.needsBuffering;
     }
     return *this;
 }
@@ -86,10 +101,50 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
     residuumL.init(T+1,1);
     residuumU.init(T+1,1);
 
-    for( run1 = 0; run1 <= T; run1++ ){
+    Matrix resL( nc, 1 );
+    Matrix resU( nc, 1 );
+
+    // SYMBOLIC FUNCTIONS ARE EVALUATED AT ALL GRID POINTS AT ONCE:
+    // ------------------------------------------------------------
+    if( fcn[0].isSymbolic() == BT_TRUE && fcn[0].isCompiled() == BT_FALSE )
+        fcn[0].compile( );
+
+    if( fcn[0].isCompiled() == BT_TRUE ){
+
+        const int nz = fcn[0].getNumberOfVariables()+1;
+
+        if( (int) zBatch.getNumRows() != nz || (int) zBatch.getNumCols() != T+1 ){
 
-        Matrix resL( nc, 1 );
-        Matrix resU( nc, 1 );
+            zBatch.init( nz, T+1 );
+            zBatch.setZero( );
+            fBatch.init( nc, T+1 );
+            ACADO_TRY( fcn[0].initWorkspace( batchWorkspace,1,T+1 ) );
+        }
+
+        z[0].gatherZ( iter, zBatch.getDoublePointer(), T+1 );
+        ACADO_TRY( fcn[0].evaluateBatch( T+1, zBatch.getDoublePointer(), fBatch.getDoublePointer(), batchWorkspace ) );
+
+        // first order derivatives are based on the trace of the batched
+        // evaluation; the AD buffers of the tree are filled only if
+        // second order derivatives are required:
+        hasBatchTrace  = BT_TRUE;
+        needsBuffering = BT_TRUE;
+
+        for( run1 = 0; run1 <= T; run1++ ){
+
+            for( run2 = 0; run2 < nc; run2++ ){
+                 resL( run2, 0 ) = lb[run1][run2] - fBatch( run2, run1 );
+                 resU( run2, 0 ) = ub[run1][run2] - fBatch( run2, run1 );
+            }
+
+            residuumL.setDense( run1, 0, resL );
+            residuumU.setDense( run1, 0, resU );
+        }
+
+        return SUCCESSFUL_RETURN;
+    }
+
+    for( run1 = 0; run1 <= T; run1++ ){
 
 		z[0].setZ( run1, iter );
 		Vector result = fcn[0].evaluate( z[0],run1 );
@@ -105,6 +160,9 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
         residuumU.setDense( run1, 0, resU );
     }
 
+    hasBatchTrace  = BT_FALSE;
+    needsBuffering = BT_FALSE;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -112,12 +170,13 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 returnValue PathConstraint::evaluateSensitivities(){
 
 
-    int run1, run3;
+    int run1, run2, run3;
     returnValue returnvalue;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     const int N  = grid.getNumPoints();
+    const int nc = fcn[0].getDim();
 
     // EVALUATION OF THE SENSITIVITIES:
     // --------------------------------
@@ -133,6 +192,10 @@ returnValue PathConstraint::evaluateSensitivities(){
 
         dBackward.init( N, 5*N );
 
+        const int nz = fcn[0].getNumberOfVariables()+1;
+
+        double *bseed = new double[nc];
+        double *J     = new double[nz];
 
         for( run3 = 0; run3 < N; run3++ )
 		{
@@ -149,15 +212,34 @@ returnValue PathConstraint::evaluateSensitivities(){
 
 			for( run1 = 0; run1 < nBDirs; run1++ )
 			{
-				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-				
-				JJ[0].setZero( );
+				// (the batched evaluation has recorded the trace already):
+				if( hasBatchTrace == BT_TRUE ){
+
+					for( run2 = 0; run2 < nc; run2++ )
+						bseed[run2] = bseed_( run1,run2 );
+					for( run2 = 0; run2 < nz; run2++ )
+						J[run2] = 0.0;
+
+					ACADO_TRY( fcn[0].AD_backward( run3,bseed,J,batchWorkspace ) );
+
+					for( run2 = 0          ; run2 < nx            ; run2++ ) Dx ( run1, run2             ) = J[y_index[0][run2]];
+					for( run2 = nx         ; run2 < nx+na         ; run2++ ) Dxa( run1, run2-nx          ) = J[y_index[0][run2]];
+					for( run2 = nx+na      ; run2 < nx+na+np      ; run2++ ) Dp ( run1, run2-nx-na       ) = J[y_index[0][run2]];
+					for( run2 = nx+na+np   ; run2 < nx+na+np+nu   ; run2++ ) Du ( run1, run2-nx-na-np    ) = J[y_index[0][run2]];
+					for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ) Dw ( run1, run2-nx-na-np-nu ) = J[y_index[0][run2]];
+				}
+				else{
+
+					ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
+
+					if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
+					if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
+					if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
+					if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
+					if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
+
+					JJ[0].setZero( );
+				}
 
             }
 
@@ -177,6 +259,9 @@ returnValue PathConstraint::evaluateSensitivities(){
 				dBackward.setDense( run3, 4*N+run3, Dw );
         }
 
+        delete[] bseed;
+        delete[] J;
+
 		return SUCCESSFUL_RETURN;
 	}
 	
@@ -195,6 +280,9 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
 
     const int nc = fcn[0].getDim();
 
+    if( needsBuffering == BT_TRUE )
+        ACADO_TRY( bufferIntermediateResults( ) );
+
     dBackward.init( N, 5*N );
 
     for( run3 = 0; run3 < N; run3++ ){
@@ -457,6 +545,30 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
     return SUCCESSFUL_RETURN;
 }
 
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue PathConstraint::bufferIntermediateResults( ){
+
+    int run1;
+
+    const int nPoints = zBatch.getNumCols();
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        z[0].setZ( run1, zBatch.getDoublePointer(), nPoints );
+        fcn[0].evaluate( z[0],run1 );
+    }
+
+    needsBuffering = BT_FALSE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
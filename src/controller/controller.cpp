@@ -51,6 +51,7 @@ Controller::Controller( ) : SimulationBlock( BN_CONTROLLER )
 	referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+	ownsComponents = BT_FALSE;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -83,6 +84,7 @@ Controller::Controller(	ControlLaw& _controlLaw,
 		referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+	ownsComponents = BT_FALSE;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -111,6 +113,7 @@ Controller::Controller(	ControlLaw& _controlLaw,
 		referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+	ownsComponents = BT_FALSE;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -134,19 +137,23 @@ Controller::Controller( const Controller& rhs ) : SimulationBlock( rhs )
 		referenceTrajectory = 0;
 	
 	isEnabled = rhs.isEnabled;
+	ownsComponents = BT_FALSE;
 }
 
 
 Controller::~Controller( )
 {
-// 	if ( controlLaw != 0 )
-// 	 	delete controlLaw;
-// 
-// 	if ( estimator != 0 )
-// 		delete estimator;
-// 
-// 	if ( referenceTrajectory != 0 )
-// 		delete referenceTrajectory;
+	if ( ownsComponents == BT_TRUE )
+	{
+		if ( controlLaw != 0 )
+			delete controlLaw;
+
+		if ( estimator != 0 )
+			delete estimator;
+
+		if ( referenceTrajectory != 0 )
+			delete referenceTrajectory;
+	}
 }
 
 
@@ -154,14 +161,17 @@ Controller& Controller::operator=( const Controller& rhs )
 {
 	if ( this != &rhs )
 	{
-// 		if ( controlLaw != 0 )
-// 			delete controlLaw;
-// 
-// 		if ( estimator != 0 )
-// 			delete estimator;
-// 
-// 		if ( referenceTrajectory != 0 )
-// 			delete referenceTrajectory;
+		if ( ownsComponents == BT_TRUE )
+		{
+			if ( controlLaw != 0 )
+				delete controlLaw;
+
+			if ( estimator != 0 )
+				delete estimator;
+
+			if ( referenceTrajectory != 0 )
+				delete referenceTrajectory;
+		}
 
 		SimulationBlock::operator=( rhs );
 
@@ -181,12 +191,32 @@ Controller& Controller::operator=( const Controller& rhs )
 			referenceTrajectory = 0;
 		
 		isEnabled = rhs.isEnabled;
+		ownsComponents = BT_FALSE;
 	}
 
     return *this;
 }
 
 
+Controller* Controller::clone( ) const
+{
+	Controller* independentCopy = new Controller( *this );
+
+	if ( controlLaw != 0 )
+		independentCopy->controlLaw = controlLaw->clone( );
+
+	if ( estimator != 0 )
+		independentCopy->estimator = estimator->clone( );
+
+	if ( referenceTrajectory != 0 )
+		independentCopy->referenceTrajectory = referenceTrajectory->clone( );
+
+	independentCopy->ownsComponents = BT_TRUE;
+
+	return independentCopy;
+}
+
+
 
 returnValue Controller::setControlLaw(	ControlLaw& _controlLaw
 										)
@@ -393,6 +423,14 @@ returnValue Controller::obtainEstimates(	double currentTime,
 	
 	if ( estimator != 0 )
 	{
+		/* Pass the controls applied since the last step to the estimator. */
+		if ( ( controlLaw != 0 ) && ( estimator->getNU( ) > 0 ) )
+		{
+			controlLaw->getU( uEst );
+			if ( uEst.getDim( ) == estimator->getNU( ) )
+				estimator->setControls( uEst );
+		}
+
 		if ( estimator->step( currentTime,_y ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_CONTROLLER_STEP_FAILED );
 
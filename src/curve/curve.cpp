@@ -312,6 +312,13 @@ returnValue Curve::add( double tStart, double tEnd, const Function &parameteriza
 
 returnValue Curve::evaluate( double t, double *result ) const{
 
+    uint cursor = 0;
+    return evaluate( t, result, cursor );
+}
+
+
+returnValue Curve::evaluate( double t, double *result, uint &cursor ) const{
+
     uint        idx        ;
     returnValue returnvalue;
 
@@ -336,7 +343,7 @@ returnValue Curve::evaluate( double t, double *result ) const{
     // OBTAIN THE INTERVAL INDEX:
     // --------------------------
 
-    idx = grid->getFloorIndex(t);
+    idx = grid->getFloorIndex(t,cursor);
     if( idx == nIntervals ) idx--;
 
 
@@ -355,53 +362,67 @@ returnValue Curve::evaluate( double t, double *result ) const{
 
 returnValue Curve::evaluate( double t, Vector &result ) const{
 
-    uint        run1       ;
-    returnValue returnvalue;
-
-    double *tmp = new double[dim];
-
-    returnvalue = evaluate( t, tmp );
-
-    if( returnvalue != SUCCESSFUL_RETURN )
-        return returnvalue;
+    // CHECK WHETHER THE CURVE IS EMPTY:
+    // ---------------------------------
+    if( isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     result.init(dim);
-    for( run1 = 0; run1 < dim; run1++ )
-        result(run1) = tmp[run1];
-
-     delete[] tmp;
 
-    return SUCCESSFUL_RETURN;
+    return evaluate( t, result.getDoublePointer() );
 }
 
 
 returnValue Curve::evaluate( double tStart, double tEnd, VariablesGrid &result ) const
 {
+	uint cursor = 0;
+	return evaluate( tStart,tEnd,result,cursor );
+}
+
+
+returnValue Curve::evaluate( double tStart, double tEnd, VariablesGrid &result, uint &cursor ) const
+{
+	if( isEmpty() == BT_TRUE )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
 	// determine sub grid of intervals with given time horizon [tStart,tEnd]
 	Grid intervalsSubGrid;
 
 	if ( grid->getSubGrid( tStart,tEnd,intervalsSubGrid ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_UNKNOWN_BUG );
 
-	return discretize( intervalsSubGrid,result );
+	return discretize( intervalsSubGrid,result,cursor );
 }
 
 
 
 returnValue Curve::discretize( const Grid &discretizationGrid, VariablesGrid &result ) const{
 
-    uint        run1       ;
+    uint cursor = 0;
+    return discretize( discretizationGrid, result, cursor );
+}
+
+
+returnValue Curve::discretize( const Grid &discretizationGrid, VariablesGrid &result, uint &cursor ) const{
+
+    uint        run1, run2 ;
     returnValue returnvalue;
-    Vector      tmp        ;
 
     result.init( dim, discretizationGrid );
 
+    double *tmp = new double[dim];
+
     for( run1 = 0; run1 < discretizationGrid.getNumPoints(); run1++ ){
-        returnvalue = evaluate( discretizationGrid.getTime(run1), tmp );
-        if( returnvalue != SUCCESSFUL_RETURN )
+        returnvalue = evaluate( discretizationGrid.getTime(run1), tmp, cursor );
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            delete[] tmp;
             return returnvalue;
-        result.setVector(run1,tmp);
+        }
+        for( run2 = 0; run2 < dim; run2++ )
+            result(run1,run2) = tmp[run2];
     }
+
+    delete[] tmp;
     return SUCCESSFUL_RETURN;
 }
 
@@ -30,7 +30,6 @@
  *
  */
 
-
 #include <acado/dynamic_discretization/collocation_method.hpp>
 
 
@@ -38,39 +37,171 @@ BEGIN_NAMESPACE_ACADO
 
 
 //
-// PUBLIC MEMBER FUNCTIONS:
+// LOCAL DENSE LINEAR ALGEBRA:
 //
 
 
-CollocationMethod::CollocationMethod( ) : DynamicDiscretization( )
-{
+/** Computes the LU factorization P*M = L*U of the n x n matrix M (row-wise)
+ *  in place using partial pivoting. Returns BT_FALSE if M is singular. */
+static BooleanType factorizeLU( int n, double *M, int *pivot ){
+
+    int i, j, k;
+
+    for( k = 0; k < n; k++ ){
+
+        int    p    = k;
+        double maxM = fabs( M[k*n+k] );
+
+        for( i = k+1; i < n; i++ ){
+            if( fabs( M[i*n+k] ) > maxM ){
+                maxM = fabs( M[i*n+k] );
+                p    = i;
+            }
+        }
+
+        pivot[k] = p;
+        if( maxM <= ZERO ) return BT_FALSE;
+
+        if( p != k ){
+            for( j = 0; j < n; j++ ){
+                double tmp = M[k*n+j];
+                M[k*n+j] = M[p*n+j];
+                M[p*n+j] = tmp;
+            }
+        }
+
+        for( i = k+1; i < n; i++ ){
+            M[i*n+k] /= M[k*n+k];
+            for( j = k+1; j < n; j++ )
+                M[i*n+j] -= M[i*n+k]*M[k*n+j];
+        }
+    }
+
+    return BT_TRUE;
 }
 
 
-CollocationMethod::CollocationMethod( UserInteraction* _userInteraction ) : DynamicDiscretization( _userInteraction )
-{
+/** Solves M*x = rhs in place using the factorization computed by factorizeLU. */
+static void solveLU( int n, const double *M, const int *pivot, double *rhs ){
+
+    int i, j;
+
+    for( i = 0; i < n; i++ ){
+        if( pivot[i] != i ){
+            double tmp = rhs[i];
+            rhs[i] = rhs[pivot[i]];
+            rhs[pivot[i]] = tmp;
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+        for( j = 0; j < i; j++ )
+            rhs[i] -= M[i*n+j]*rhs[j];
+
+    for( i = n-1; i >= 0; i-- ){
+        for( j = i+1; j < n; j++ )
+            rhs[i] -= M[i*n+j]*rhs[j];
+        rhs[i] /= M[i*n+i];
+    }
 }
 
 
-CollocationMethod::CollocationMethod( const CollocationMethod& rhs )
-                     :DynamicDiscretization ( rhs ){
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+CollocationMethod::CollocationMethod( ) : DynamicDiscretization( ){
+
+    rhs         = 0;
+    numStages   = 0;
+    stepStates  = 0;
+    stageStates = 0;
+    pInterval   = 0;
+    uInterval   = 0;
+    wInterval   = 0;
+}
 
 
+CollocationMethod::CollocationMethod( UserInteraction* _userInteraction ) : DynamicDiscretization( _userInteraction ){
+
+    rhs         = 0;
+    numStages   = 0;
+    stepStates  = 0;
+    stageStates = 0;
+    pInterval   = 0;
+    uInterval   = 0;
+    wInterval   = 0;
+}
+
+
+CollocationMethod::CollocationMethod( const CollocationMethod& arg ) : DynamicDiscretization( arg ){
+
+    CollocationMethod::copy( arg );
 }
 
 
 CollocationMethod::~CollocationMethod( ){
 
+    CollocationMethod::deleteAll();
 }
 
 
 
-CollocationMethod& CollocationMethod::operator=( const CollocationMethod& rhs ){
+CollocationMethod& CollocationMethod::operator=( const CollocationMethod& arg ){
+
+    if ( this != &arg ){
+        CollocationMethod::deleteAll();
+        DynamicDiscretization::operator=(arg);
+        CollocationMethod::copy( arg );
+    }
 
     return *this;
 }
 
 
+void CollocationMethod::copy( const CollocationMethod &arg ){
+
+    int run1;
+
+    if( arg.rhs != 0 ){
+        rhs = (DifferentialEquation**)calloc(N,sizeof(DifferentialEquation*));
+        for( run1 = 0; run1 < N; run1++ )
+            rhs[run1] = new DifferentialEquation( *(arg.rhs[run1]) );
+    }
+    else rhs = 0;
+
+    A         = arg.A;
+    b         = arg.b;
+    c         = arg.c;
+    numStages = arg.numStages;
+
+    if( arg.stepStates != 0 ){
+        stepStates  = new Matrix[N];
+        stageStates = new Matrix[N];
+        pInterval   = new Vector[N];
+        uInterval   = new Vector[N];
+        wInterval   = new Vector[N];
+
+        for( run1 = 0; run1 < N; run1++ ){
+            stepStates [run1] = arg.stepStates [run1];
+            stageStates[run1] = arg.stageStates[run1];
+            pInterval  [run1] = arg.pInterval  [run1];
+            uInterval  [run1] = arg.uInterval  [run1];
+            wInterval  [run1] = arg.wInterval  [run1];
+        }
+    }
+    else{
+        stepStates  = 0;
+        stageStates = 0;
+        pInterval   = 0;
+        uInterval   = 0;
+        wInterval   = 0;
+    }
+}
+
+
 DynamicDiscretization* CollocationMethod::clone() const{
 
     return new CollocationMethod(*this);
@@ -79,10 +210,42 @@ DynamicDiscretization* CollocationMethod::clone() const{
 
 
 returnValue CollocationMethod::addStage( const DynamicSystem  &dynamicSystem_,
-                                      const Grid           &stageIntervals,
-                                      const IntegratorType &integratorType_ ){
+                                         const Grid           &stageIntervals,
+                                         const IntegratorType &integratorType_ ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    DifferentialEquation differentialEquation_ = dynamicSystem_.getDifferentialEquation( );
+
+    if( ( differentialEquation_.getNumAlgebraicEquations() != 0 ) ||
+        ( differentialEquation_.isImplicit()    == BT_TRUE      ) ||
+        ( differentialEquation_.isDiscretized() == BT_TRUE      ) )
+        return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+    if( numStages == 0 ){
+        int scheme;
+        get( COLLOCATION_SCHEME, scheme );
+        ACADO_TRY( setupScheme( (CollocationScheme)scheme ) );
+    }
+
+    // THE STORED RESULTS DEPEND ON THE NUMBER OF INTERVALS:
+    // -----------------------------------------------------
+    delete[] stepStates ; stepStates  = 0;
+    delete[] stageStates; stageStates = 0;
+    delete[] pInterval  ; pInterval   = 0;
+    delete[] uInterval  ; uInterval   = 0;
+    delete[] wInterval  ; wInterval   = 0;
+
+    int run1 = N;
+    unionGrid = unionGrid & stageIntervals;
+    N         = unionGrid.getNumIntervals();
+
+    rhs = (DifferentialEquation**)realloc(rhs,N*sizeof(DifferentialEquation*));
+
+    while( run1 < N ){
+        rhs[run1] = new DifferentialEquation( differentialEquation_ );
+        run1++;
+    }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -95,27 +258,237 @@ returnValue CollocationMethod::addTransition( const Transition& transition_ ){
 
 returnValue CollocationMethod::clear(){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    deleteAllSeeds();
+    CollocationMethod::deleteAll();
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 returnValue CollocationMethod::evaluate( OCPiterate &iter ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    ASSERT( iter.x != 0 );
+
+    int run1;
+
+    Vector x ;  nx = iter.getNX ();
+    Vector xa;  na = iter.getNXA();
+    Vector p ;  np = iter.getNP ();
+    Vector u ;  nu = iter.getNU ();
+    Vector w ;  nw = iter.getNW ();
+
+    if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
+    if( na  >  0 ) return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+    residuum = *(iter.x);
+    residuum.setAll( 0.0 );
+
+    if( stepStates == 0 ){
+        stepStates  = new Matrix[N];
+        stageStates = new Matrix[N];
+        pInterval   = new Vector[N];
+        uInterval   = new Vector[N];
+        wInterval   = new Vector[N];
+    }
+
+    iter.getInitialData( x, xa, p, u, w );
+
+    // SOLVE THE COLLOCATION EQUATIONS OF ALL INTERVALS CONCURRENTLY IF POSSIBLE:
+    // ------------------------------------------------------------------------
+    int nThreads = getNumThreads( );
+
+    if( ( nThreads > 1 ) && ( N > 1 ) && ( areIntervalsDecoupled( iter ) == BT_TRUE ) ){
+
+        Vector *xEnd   = new Vector[N];
+        int    *status = new int   [N];
+
+        // (the updates are performed on a copy of the iterate, see ShootingMethod)
+        OCPiterate iterCopy( iter );
+        iterCopy.getInitialData( x, xa, p, u, w );
+
+        for( run1 = 0; run1 < N; run1++ ){
+
+            xEnd     [run1] = x;
+            pInterval[run1] = p;
+            uInterval[run1] = u;
+            wInterval[run1] = w;
+
+            Vector pOld = p;
+            iterCopy.updateData( unionGrid.getTime( run1+1 ), x, xa, p, u, w );
+            p = pOld;
+        }
+
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads( nThreads ) schedule( dynamic )
+        #endif
+        for( run1 = 0; run1 < N; run1++ )
+            status[run1] = solveInterval( run1, unionGrid.getTime(run1), unionGrid.getTime(run1+1), xEnd[run1],
+                                          pInterval[run1], uInterval[run1], wInterval[run1] );
+
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+
+        for( run1 = 0; run1 < N; run1++ )
+            if( status[run1] != SUCCESSFUL_RETURN )
+                returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        if( returnvalue == SUCCESSFUL_RETURN ){
+
+            iter.getInitialData( x, xa, p, u, w );
+
+            for( run1 = 0; run1 < N; run1++ ){
+
+                x = xEnd[run1];
+                Vector pOld = p;
+                iter.updateData( unionGrid.getTime( run1+1 ), x, xa, p, u, w );
+                p = pOld;
+
+                residuum.setVector( run1, xEnd[run1] - x );
+            }
+        }
+
+        delete[] xEnd;
+        delete[] status;
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            return ACADOERROR( returnvalue );
+
+        return logTrajectory( iter );
+    }
+
+    // RUN A LOOP OVER ALL INTERVALS OF THE UNION GRID:
+    // ------------------------------------------------
+    for( run1 = 0; run1 < N; run1++ ){
+
+        pInterval[run1] = p;
+        uInterval[run1] = u;
+        wInterval[run1] = w;
+
+        Vector xEnd = x;
+
+        if( solveInterval( run1, unionGrid.getTime(run1), unionGrid.getTime(run1+1), xEnd, p, u, w ) != SUCCESSFUL_RETURN )
+            return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+        x = xEnd;
+        Vector pOld = p;
+
+        iter.updateData( unionGrid.getTime( run1+1 ), x, xa, p, u, w );
+
+        if ( iter.isInSimulationMode( ) == BT_FALSE )
+            p = pOld;
+
+        residuum.setVector( run1, xEnd - x );
+    }
+
+    return logTrajectory( iter );
 }
 
 
 
 returnValue CollocationMethod::evaluateSensitivities( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    int i;
+    int nThreads = getNumThreads( );
+
+    if( stepStates == 0 ) return ACADOERROR( RET_NOT_FROZEN );
+
+    returnValue *status = new returnValue[N];
+
+    Matrix *DX = new Matrix[N];
+    Matrix *DP = new Matrix[N];
+    Matrix *DU = new Matrix[N];
+    Matrix *DW = new Matrix[N];
+
+    // COMPUTATION OF BACKWARD SENSITIVITIES:
+    // --------------------------------------
+    // (the Jacobian of each interval is computed in forward mode and
+    //  multiplied with the backward seed afterwards)
+
+    if( bSeed.isEmpty() == BT_FALSE ){
+
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads( nThreads ) schedule( dynamic ) if( nThreads > 1 )
+        #endif
+        for( i = 0; i < N; i++ ){
+
+            Matrix seed, Gx, Gp, Gu, Gw;
+            Matrix Ex, Ep, Eu, Ew;
+
+            bSeed.getSubBlock( 0, i, seed );
+
+            if( nx > 0 ) Ex = eye( nx );
+            if( np > 0 ) Ep = eye( np );
+            if( nu > 0 ) Eu = eye( nu );
+            if( nw > 0 ) Ew = eye( nw );
+
+            status[i] = differentiateForward( i, Ex, Ep, Eu, Ew, Gx, Gp, Gu, Gw );
+
+            if( status[i] == SUCCESSFUL_RETURN ){
+                if( nx > 0 ) DX[i] = seed*Gx;
+                if( np > 0 ) DP[i] = seed*Gp;
+                if( nu > 0 ) DU[i] = seed*Gu;
+                if( nw > 0 ) DW[i] = seed*Gw;
+            }
+        }
+
+        dBackward.init( N, 5 );
+    }
+
+    // COMPUTATION OF FORWARD SENSITIVITIES:
+    // -------------------------------------
+    else{
+
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads( nThreads ) schedule( dynamic ) if( nThreads > 1 )
+        #endif
+        for( i = 0; i < N; i++ ){
+
+            Matrix X, P, U, W;
+
+            if( ( nx > 0 ) && ( xSeed.isEmpty() == BT_FALSE ) ) xSeed.getSubBlock( i, 0, X );
+            if( ( np > 0 ) && ( pSeed.isEmpty() == BT_FALSE ) ) pSeed.getSubBlock( i, 0, P );
+            if( ( nu > 0 ) && ( uSeed.isEmpty() == BT_FALSE ) ) uSeed.getSubBlock( i, 0, U );
+            if( ( nw > 0 ) && ( wSeed.isEmpty() == BT_FALSE ) ) wSeed.getSubBlock( i, 0, W );
+
+            status[i] = differentiateForward( i, X, P, U, W, DX[i], DP[i], DU[i], DW[i] );
+        }
+
+        dForward.init( N, 5 );
+    }
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( i = 0; i < N; i++ ){
+
+        if( status[i] != SUCCESSFUL_RETURN ){
+            returnvalue = status[i];
+            break;
+        }
+
+        BlockMatrix &D = ( bSeed.isEmpty() == BT_FALSE ) ? dBackward : dForward;
+
+        if( DX[i].isEmpty() == BT_FALSE ) D.setDense( i, 0, DX[i] );
+        if( DP[i].isEmpty() == BT_FALSE ) D.setDense( i, 2, DP[i] );
+        if( DU[i].isEmpty() == BT_FALSE ) D.setDense( i, 3, DU[i] );
+        if( DW[i].isEmpty() == BT_FALSE ) D.setDense( i, 4, DW[i] );
+    }
+
+    delete[] DX;
+    delete[] DP;
+    delete[] DU;
+    delete[] DW;
+    delete[] status;
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR( returnvalue );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CollocationMethod::evaluateSensitivitiesLifted( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    return evaluateSensitivities( );
 }
 
 
@@ -127,28 +500,555 @@ returnValue CollocationMethod::evaluateSensitivities( const BlockMatrix &seed, B
 
 returnValue CollocationMethod::deleteAllSeeds(){
 
-//     setForwardSeed(  0, 0, 0, 0, 1 );
-//     setForwardSeed(  0, 0, 0, 0, 2 );
-//     setBackwardSeed( 0, 1 );
-//     setBackwardSeed( 0, 2 );
-
-    // delete seeds of member classes ...
-
-    return SUCCESSFUL_RETURN;
+    return DynamicDiscretization::deleteAllSeeds();
 }
 
 
 
 returnValue CollocationMethod::unfreeze( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 BooleanType CollocationMethod::isAffine( ) const
 {
-    return BT_FALSE;
+    for( int run1 = 0; run1 < N; ++run1 )
+        if ( rhs[run1]->isAffine( ) == BT_FALSE )
+            return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue CollocationMethod::deleteAll( ){
+
+    int run1;
+
+    if( rhs != 0 ){
+        for( run1 = 0; run1 < N; run1++ )
+            if( rhs[run1] != 0 )
+                delete rhs[run1];
+        free(rhs);
+        rhs = 0;
+    }
+
+    delete[] stepStates ; stepStates  = 0;
+    delete[] stageStates; stageStates = 0;
+    delete[] pInterval  ; pInterval   = 0;
+    delete[] uInterval  ; uInterval   = 0;
+    delete[] wInterval  ; wInterval   = 0;
+
+    numStages = 0;
+
+    unionGrid.init();
+    DynamicDiscretization::initializeVariables( );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::setupScheme( CollocationScheme scheme_ ){
+
+    switch( scheme_ ){
+
+        case RADAU_IIA1:
+            numStages = 1;
+            A.init( 1,1 ); b.init( 1 ); c.init( 1 );
+            A(0,0) = 1.0;
+            b(0)   = 1.0;
+            c(0)   = 1.0;
+            break;
+
+        case RADAU_IIA3:
+            numStages = 2;
+            A.init( 2,2 ); b.init( 2 ); c.init( 2 );
+            A(0,0) = 5.0/12.0;  A(0,1) = -1.0/12.0;
+            A(1,0) = 3.0/4.0;   A(1,1) =  1.0/4.0;
+            b(0)   = 3.0/4.0;   b(1)   =  1.0/4.0;
+            c(0)   = 1.0/3.0;   c(1)   =  1.0;
+            break;
+
+        case RADAU_IIA5:
+            numStages = 3;
+            A.init( 3,3 ); b.init( 3 ); c.init( 3 );
+            A(0,0) = ( 88.0 -   7.0*sqrt(6.0) )/360.0;
+            A(0,1) = ( 296.0 - 169.0*sqrt(6.0) )/1800.0;
+            A(0,2) = ( -2.0 +   3.0*sqrt(6.0) )/225.0;
+            A(1,0) = ( 296.0 + 169.0*sqrt(6.0) )/1800.0;
+            A(1,1) = ( 88.0 +   7.0*sqrt(6.0) )/360.0;
+            A(1,2) = ( -2.0 -   3.0*sqrt(6.0) )/225.0;
+            A(2,0) = ( 16.0 -       sqrt(6.0) )/36.0;
+            A(2,1) = ( 16.0 +       sqrt(6.0) )/36.0;
+            A(2,2) = 1.0/9.0;
+            b(0)   = A(2,0);  b(1) = A(2,1);  b(2) = A(2,2);
+            c(0)   = ( 4.0 - sqrt(6.0) )/10.0;
+            c(1)   = ( 4.0 + sqrt(6.0) )/10.0;
+            c(2)   = 1.0;
+            break;
+
+        case GAUSS_LEGENDRE2:
+            numStages = 1;
+            A.init( 1,1 ); b.init( 1 ); c.init( 1 );
+            A(0,0) = 1.0/2.0;
+            b(0)   = 1.0;
+            c(0)   = 1.0/2.0;
+            break;
+
+        case GAUSS_LEGENDRE4:
+            numStages = 2;
+            A.init( 2,2 ); b.init( 2 ); c.init( 2 );
+            A(0,0) = 1.0/4.0;                 A(0,1) = 1.0/4.0 - sqrt(3.0)/6.0;
+            A(1,0) = 1.0/4.0 + sqrt(3.0)/6.0; A(1,1) = 1.0/4.0;
+            b(0)   = 1.0/2.0;                 b(1)   = 1.0/2.0;
+            c(0)   = 1.0/2.0 - sqrt(3.0)/6.0; c(1)   = 1.0/2.0 + sqrt(3.0)/6.0;
+            break;
+
+        case GAUSS_LEGENDRE6:
+            numStages = 3;
+            A.init( 3,3 ); b.init( 3 ); c.init( 3 );
+            A(0,0) = 5.0/36.0;
+            A(0,1) = 2.0/9.0-1.0/15.0*sqrt(15.0);
+            A(0,2) = 5.0/36.0-1.0/30.0*sqrt(15.0);
+            A(1,0) = 5.0/36.0+1.0/24.0*sqrt(15.0);
+            A(1,1) = 2.0/9.0;
+            A(1,2) = 5.0/36.0-1.0/24.0*sqrt(15.0);
+            A(2,0) = 5.0/36.0+1.0/30.0*sqrt(15.0);
+            A(2,1) = 2.0/9.0+1.0/15.0*sqrt(15.0);
+            A(2,2) = 5.0/36.0;
+            b(0)   = 5.0/18.0;  b(1) = 4.0/9.0;  b(2) = 5.0/18.0;
+            c(0)   = 1.0/2.0-sqrt(15.0)/10.0;
+            c(1)   = 1.0/2.0;
+            c(2)   = 1.0/2.0+sqrt(15.0)/10.0;
+            break;
+
+        default:
+            return ACADOERROR( RET_INVALID_ARGUMENTS );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int CollocationMethod::getNumSteps( ) const{
+
+    int numSteps = 1;
+    get( NUM_INTEGRATOR_STEPS, numSteps );
+
+    if( numSteps < 1 ) numSteps = 1;
+
+    return numSteps;
+}
+
+
+void CollocationMethod::setupVariables( int idx, double t, const double *xLocal, double *z ) const{
+
+    int run1;
+    int m  = rhs[idx]->getDim();
+    int nv = rhs[idx]->getNumberOfVariables();
+
+    for( run1 = 0; run1 < m; run1++ ){
+        int k = rhs[idx]->getStateEnumerationIndex( run1 );
+        if( k == nv ) k = nv + 1 + run1;
+        z[k] = xLocal[run1];
+    }
+
+    z[ rhs[idx]->index( VT_TIME, 0 ) ] = t;
+}
+
+
+returnValue CollocationMethod::factorizeStep( int idx, int step, double h, double *M, int *pivot ){
+
+    int i, j, k, l;
+    int m   = rhs[idx]->getDim();
+    int nv  = rhs[idx]->getNumberOfVariables();
+    int s   = numStages;
+    int dim = s*m;
+
+    double *seed = new double[nv+1+m];
+    double *J    = new double[m];
+
+    for( k = 0; k < nv+1+m; k++ )
+        seed[k] = 0.0;
+
+    for( i = 0; i < dim*dim; i++ )
+        M[i] = 0.0;
+
+    for( i = 0; i < dim; i++ )
+        M[i*dim+i] = 1.0;
+
+    // M := I - h*(A x J), where J is the Jacobian at the collocation points:
+    for( j = 0; j < s; j++ ){
+        for( k = 0; k < m; k++ ){
+
+            int kk = rhs[idx]->getStateEnumerationIndex( k );
+            if( kk == nv ) kk = nv + 1 + k;
+
+            seed[kk] = 1.0;
+            rhs[idx]->AD_forward( j, seed, J );
+            seed[kk] = 0.0;
+
+            for( i = 0; i < m; i++ )
+                for( l = 0; l < s; l++ )
+                    M[(j*m+i)*dim + l*m+k] -= h*A(j,l)*J[i];
+        }
+    }
+
+    delete[] seed;
+    delete[] J;
+
+    if( factorizeLU( dim, M, pivot ) == BT_FALSE )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::solveInterval( int idx, double t0, double t1, Vector &x,
+                                              const Vector &p, const Vector &u, const Vector &w ){
+
+    int run1, i, j, l, e;
+
+    int m        = rhs[idx]->getDim();
+    int nv       = rhs[idx]->getNumberOfVariables();
+    int s        = numStages;
+    int dim      = s*m;
+    int numSteps = getNumSteps();
+    double h     = (t1-t0)/((double)numSteps);
+
+    double tol;
+    get( CORRECTOR_TOLERANCE, tol );
+    tol = acadoMax( tol, 100.0*EPS );
+
+    const int maxNumNewtonIterations = 20;
+
+    Vector components = rhs[idx]->getDifferentialStateComponents();
+
+    double *z     = new double[nv+1+m];
+    double *xl    = new double[m];
+    double *F     = new double[m];
+    double *K     = new double[dim];
+    double *G     = new double[dim];
+    double *M     = new double[dim*dim];
+    int    *pivot = new int   [dim];
+
+    for( run1 = 0; run1 < nv+1+m; run1++ )
+        z[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int)p.getDim(); run1++ ) z[ rhs[idx]->index( VT_PARAMETER  , run1 ) ] = p(run1);
+    for( run1 = 0; run1 < (int)u.getDim(); run1++ ) z[ rhs[idx]->index( VT_CONTROL    , run1 ) ] = u(run1);
+    for( run1 = 0; run1 < (int)w.getDim(); run1++ ) z[ rhs[idx]->index( VT_DISTURBANCE, run1 ) ] = w(run1);
+
+    for( run1 = 0; run1 < m; run1++ )
+        xl[run1] = x( (int)components(run1) );
+
+    stepStates [idx].init( numSteps+1 , m );
+    stageStates[idx].init( numSteps*s , m );
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( e = 0; ( e < numSteps ) && ( returnvalue == SUCCESSFUL_RETURN ); e++ ){
+
+        double te = t0 + e*h;
+
+        for( i = 0; i < m; i++ )
+            stepStates[idx]( e,i ) = xl[i];
+
+        // INITIAL GUESS: CONSTANT SLOPE
+        setupVariables( idx, te, xl, z );
+        rhs[idx]->evaluate( 0, z, F );
+
+        for( j = 0; j < s; j++ )
+            for( i = 0; i < m; i++ )
+                K[j*m+i] = F[i];
+
+        // NEWTON'S METHOD FOR THE COLLOCATION EQUATIONS  K_j = f( t_j, x + h*sum_l a_jl K_l ):
+        BooleanType isConverged = BT_FALSE;
+        double      lastStep    = INFTY;
+
+        for( run1 = 0; ( run1 < maxNumNewtonIterations ) && ( isConverged == BT_FALSE ); run1++ ){
+
+            for( j = 0; j < s; j++ ){
+
+                for( i = 0; i < m; i++ ){
+                    F[i] = xl[i];
+                    for( l = 0; l < s; l++ )
+                        F[i] += h*A(j,l)*K[l*m+i];
+                }
+
+                setupVariables( idx, te + c(j)*h, F, z );
+                rhs[idx]->evaluate( j, z, F );
+
+                for( i = 0; i < m; i++ )
+                    G[j*m+i] = F[i] - K[j*m+i];
+            }
+
+            if( factorizeStep( idx, e, h, M, pivot ) != SUCCESSFUL_RETURN ){
+                returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+                break;
+            }
+
+            solveLU( dim, M, pivot, G );
+
+            double normStep = 0.0;
+            double normK    = 0.0;
+
+            for( i = 0; i < dim; i++ ){
+                K[i] += G[i];
+                normStep = acadoMax( normStep, fabs( G[i] ) );
+                normK    = acadoMax( normK   , fabs( K[i] ) );
+            }
+
+            normStep /= 1.0 + normK;
+
+            // converged, or stagnating at the level of rounding errors
+            if( ( normStep <= tol ) || ( ( normStep >= lastStep ) && ( normStep <= SQRT_EPS ) ) )
+                isConverged = BT_TRUE;
+
+            lastStep = normStep;
+        }
+
+        if( isConverged == BT_FALSE )
+            returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        // STORE THE COLLOCATION POINTS AND PROCEED TO THE NEXT STEP:
+        for( j = 0; j < s; j++ ){
+            for( i = 0; i < m; i++ ){
+                double Zji = xl[i];
+                for( l = 0; l < s; l++ )
+                    Zji += h*A(j,l)*K[l*m+i];
+                stageStates[idx]( e*s+j,i ) = Zji;
+            }
+        }
+
+        for( j = 0; j < s; j++ )
+            for( i = 0; i < m; i++ )
+                xl[i] += h*b(j)*K[j*m+i];
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        for( i = 0; i < m; i++ )
+            stepStates[idx]( numSteps,i ) = xl[i];
+
+        for( run1 = 0; run1 < m; run1++ )
+            x( (int)components(run1) ) = xl[run1];
+    }
+
+    delete[] z;
+    delete[] xl;
+    delete[] F;
+    delete[] K;
+    delete[] G;
+    delete[] M;
+    delete[] pivot;
+
+    return returnvalue;
+}
+
+
+returnValue CollocationMethod::differentiateForward( int idx,
+                                                     const Matrix &dX,
+                                                     const Matrix &dP,
+                                                     const Matrix &dU,
+                                                     const Matrix &dW,
+                                                           Matrix &DX,
+                                                           Matrix &DP,
+                                                           Matrix &DU,
+                                                           Matrix &DW  ){
+
+    int run1, i, j, k, e, d;
+
+    int m        = rhs[idx]->getDim();
+    int nv       = rhs[idx]->getNumberOfVariables();
+    int s        = numStages;
+    int dim      = s*m;
+    int numSteps = getNumSteps();
+    double t0    = unionGrid.getTime( idx   );
+    double t1    = unionGrid.getTime( idx+1 );
+    double h     = (t1-t0)/((double)numSteps);
+
+    Vector components = rhs[idx]->getDifferentialStateComponents();
+
+    // THE DIRECTIONS OF ALL SEEDS ARE PROPAGATED SIMULTANEOUSLY:
+    // (direction d belongs to block 0, 1, 2 or 3 = x, p, u or w)
+    int nDir[4];
+    nDir[0] = dX.getNumCols();
+    nDir[1] = dP.getNumCols();
+    nDir[2] = dU.getNumCols();
+    nDir[3] = dW.getNumCols();
+
+    int nDirections = nDir[0] + nDir[1] + nDir[2] + nDir[3];
+
+    // dxl(k,d): derivative of the k-th local state in direction d
+    Matrix dxl( m, nDirections );
+    dxl.setZero();
+
+    for( d = 0; d < nDir[0]; d++ )
+        for( k = 0; k < m; k++ )
+            dxl( k,d ) = dX( (int)components(k),d );
+
+    double *z     = new double[nv+1+m];
+    double *seed  = new double[nv+1+m];
+    double *dK    = new double[dim];
+    double *M     = new double[dim*dim];
+    int    *pivot = new int   [dim];
+
+    for( run1 = 0; run1 < nv+1+m; run1++ ){
+        z   [run1] = 0.0;
+        seed[run1] = 0.0;
+    }
+
+    for( run1 = 0; run1 < (int)pInterval[idx].getDim(); run1++ ) z[ rhs[idx]->index( VT_PARAMETER  , run1 ) ] = pInterval[idx](run1);
+    for( run1 = 0; run1 < (int)uInterval[idx].getDim(); run1++ ) z[ rhs[idx]->index( VT_CONTROL    , run1 ) ] = uInterval[idx](run1);
+    for( run1 = 0; run1 < (int)wInterval[idx].getDim(); run1++ ) z[ rhs[idx]->index( VT_DISTURBANCE, run1 ) ] = wInterval[idx](run1);
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( e = 0; ( e < numSteps ) && ( returnvalue == SUCCESSFUL_RETURN ); e++ ){
+
+        // EVALUATE THE RIGHT-HAND SIDE AT THE (STORED) COLLOCATION POINTS:
+        for( j = 0; j < s; j++ ){
+            setupVariables( idx, t0 + (e+c(j))*h, stageStates[idx].getDoublePointer() + (e*s+j)*m, z );
+            rhs[idx]->evaluate( j, z, dK );
+        }
+
+        if( factorizeStep( idx, e, h, M, pivot ) != SUCCESSFUL_RETURN ){
+            returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+            break;
+        }
+
+        // DIFFERENTIATE THE COLLOCATION EQUATIONS:
+        //   (I - h*(A x J)) dK = df/d(x,p,u,w) * [dx;dp;du;dw]
+        for( d = 0; d < nDirections; d++ ){
+
+            int block = 0, col = d;
+            while( col >= nDir[block] ){ col -= nDir[block]; block++; }
+
+            for( k = 0; k < m; k++ ){
+                int kk = rhs[idx]->getStateEnumerationIndex( k );
+                if( kk == nv ) kk = nv + 1 + k;
+                seed[kk] = dxl( k,d );
+            }
+
+            if( block == 1 ) for( run1 = 0; run1 < np; run1++ ) seed[ rhs[idx]->index( VT_PARAMETER  , run1 ) ] = dP( run1,col );
+            if( block == 2 ) for( run1 = 0; run1 < nu; run1++ ) seed[ rhs[idx]->index( VT_CONTROL    , run1 ) ] = dU( run1,col );
+            if( block == 3 ) for( run1 = 0; run1 < nw; run1++ ) seed[ rhs[idx]->index( VT_DISTURBANCE, run1 ) ] = dW( run1,col );
+
+            for( j = 0; j < s; j++ )
+                rhs[idx]->AD_forward( j, seed, &dK[j*m] );
+
+            for( run1 = 0; run1 < nv+1+m; run1++ )
+                seed[run1] = 0.0;
+
+            solveLU( dim, M, pivot, dK );
+
+            for( j = 0; j < s; j++ )
+                for( i = 0; i < m; i++ )
+                    dxl( i,d ) += h*b(j)*dK[j*m+i];
+        }
+    }
+
+    delete[] z;
+    delete[] seed;
+    delete[] dK;
+    delete[] M;
+    delete[] pivot;
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    // WRITE THE DERIVATIVES (STATES WITHOUT DIFFERENTIAL EQUATION REMAIN CONSTANT):
+    Matrix *D[4];
+    D[0] = &DX; D[1] = &DP; D[2] = &DU; D[3] = &DW;
+
+    int offset = 0;
+
+    for( int block = 0; block < 4; block++ ){
+
+        if( nDir[block] == 0 ){
+            D[block]->init( 0,0 );
+            continue;
+        }
+
+        D[block]->init( nx, nDir[block] );
+        D[block]->setZero();
+
+        if( block == 0 )
+            for( i = 0; i < nx; i++ )
+                for( d = 0; d < nDir[0]; d++ )
+                    (*D[0])( i,d ) = dX( i,d );
+
+        for( d = 0; d < nDir[block]; d++ )
+            for( k = 0; k < m; k++ )
+                (*D[block])( (int)components(k),d ) = dxl( k,offset+d );
+
+        offset += nDir[block];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::logTrajectory( const OCPiterate &iter ){
+
+    if( ( rhs == 0 ) || ( stepStates == 0 ) ) return SUCCESSFUL_RETURN;
+
+    int i, j, k;
+    int numSteps = getNumSteps();
+
+    VariablesGrid logX, logP, logU, logW, tmp;
+
+    Matrix intervalPoints(N+1,1);
+    intervalPoints(0,0) = 0.0;
+
+    for( i = 0; i < N; i++ ){
+
+        Vector components = rhs[i]->getDifferentialStateComponents();
+        Vector xNode = iter.x->getVector( i );
+
+        Grid stepGrid( unionGrid.getTime(i), unionGrid.getTime(i+1), numSteps+1 );
+        intervalPoints(i+1,0) = intervalPoints(i,0) + numSteps+1;
+
+        if( nx > 0 ){
+            tmp.init( nx, stepGrid );
+            for( j = 0; j <= numSteps; j++ ){
+                Vector xj = xNode;
+                for( k = 0; k < (int)components.getDim(); k++ )
+                    xj( (int)components(k) ) = stepStates[i]( j,k );
+                tmp.setVector( j, xj );
+            }
+            logX.appendTimes( tmp );
+        }
+        if( np > 0 ){ tmp.init( np, stepGrid );
+                      tmp.setAllVectors( pInterval[i] );
+                      logP.appendTimes( tmp );
+                    }
+        if( nu > 0 ){ tmp.init( nu, stepGrid );
+                      tmp.setAllVectors( uInterval[i] );
+                      logU.appendTimes( tmp );
+                    }
+        if( nw > 0 ){ tmp.init( nw, stepGrid );
+                      tmp.setAllVectors( wInterval[i] );
+                      logW.appendTimes( tmp );
+                    }
+    }
+
+    if( nx > 0 ) setLast( LOG_DIFFERENTIAL_STATES, logX );
+    if( np > 0 ) setLast( LOG_PARAMETERS         , logP );
+    if( nu > 0 ) setLast( LOG_CONTROLS           , logU );
+    if( nw > 0 ) setLast( LOG_DISTURBANCES       , logW );
+
+    setLast( LOG_DISCRETIZATION_INTERVALS, intervalPoints );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -190,8 +190,11 @@ returnValue DynamicDiscretization::setupOptions( ){
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( DISCRETIZATION_THREADS      , defaultDiscretizationThreads   );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( COLLOCATION_SCHEME          , defaultCollocationScheme       );
+	addOption( NUM_INTEGRATOR_STEPS        , defaultNumIntegratorSteps      );
 
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -206,6 +209,7 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -267,6 +271,48 @@ void DynamicDiscretization::copy( const DynamicDiscretization& arg ){
 }
 
 
+BooleanType DynamicDiscretization::areIntervalsDecoupled( const OCPiterate &iter ) const
+{
+	if ( iter.isInSimulationMode( ) == BT_TRUE )
+		return BT_FALSE;
+
+	for( uint run1 = 1; run1 < unionGrid.getNumIntervals(); run1++ )
+	{
+		double t = unionGrid.getTime( run1 );
+
+		if ( iter.x->hasTime( t ) == BT_FALSE )
+			return BT_FALSE;
+
+		if ( iter.x->getAutoInit( iter.x->getFloorIndex( t ) ) == BT_TRUE )
+			return BT_FALSE;
+
+		if ( ( iter.xa != 0 ) && ( iter.getNXA( ) > 0 ) )
+		{
+			if ( iter.xa->hasTime( t ) == BT_FALSE )
+				return BT_FALSE;
+
+			if ( iter.xa->getAutoInit( iter.xa->getFloorIndex( t ) ) == BT_TRUE )
+				return BT_FALSE;
+		}
+	}
+
+	return BT_TRUE;
+}
+
+
+int DynamicDiscretization::getNumThreads( ) const
+{
+	int nThreads = 1;
+	get( DISCRETIZATION_THREADS, nThreads );
+
+	#ifndef _OPENMP
+	nThreads = 1;
+	#endif
+
+	return nThreads;
+}
+
+
 uint DynamicDiscretization::getNumEvaluationPoints() const{
 
     uint nEvaluationPoints = 0;
@@ -423,6 +423,7 @@ returnValue IntegrationAlgorithm::setupOptions( )
 	
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , BT_FALSE                       );
+	addOption( DISCRETIZATION_THREADS      , defaultDiscretizationThreads   );
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -441,6 +442,7 @@ returnValue IntegrationAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 
 	return SUCCESSFUL_RETURN;
 }
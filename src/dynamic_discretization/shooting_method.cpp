@@ -201,6 +201,27 @@ returnValue ShootingMethod::clear(){
 
 
 
+returnValue ShootingMethod::moveStage( const Grid &stageIntervals ){
+
+    if( ( integrator == 0 ) || ( breakPoints.getNumRows() != 1 ) )
+        return RET_INVALID_ARGUMENTS;
+
+    Grid newGrid;
+    newGrid = newGrid & stageIntervals;
+
+    if( (int) newGrid.getNumIntervals() != N )
+        return RET_INVALID_ARGUMENTS;
+
+    deleteAllSeeds();
+    unfreeze();
+
+    unionGrid = newGrid;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue ShootingMethod::evaluate(	OCPiterate &iter
 										)
 {
@@ -211,7 +232,6 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     ASSERT( iter.x != 0 );
 
     uint run1;
-    double tStart, tEnd;
 
     Vector x ;  nx = iter.getNX ();
     Vector xa;  na = iter.getNXA();
@@ -219,12 +239,19 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     Vector u ;  nu = iter.getNU ();
     Vector w ;  nw = iter.getNW ();
 
-	VariablesGrid xAll;
-	VariablesGrid xaAll;
-
     residuum = *(iter.x);
     residuum.setAll( 0.0 );
 
+    // INTEGRATE ALL INTERVALS CONCURRENTLY IF THIS IS REQUESTED AND POSSIBLE:
+    // -----------------------------------------------------------------------
+    int nThreads = getNumThreads( );
+
+    if ( ( nThreads > 1 ) && ( unionGrid.getNumIntervals( ) > 1 ) && ( areIntervalsDecoupled( iter ) == BT_TRUE ) )
+    {
+        ACADO_TRY( evaluateParallel( iter,nThreads ) );
+        return logTrajectory( iter );
+    }
+
     iter.getInitialData( x, xa, p, u, w );
 // 	iter.x->print( "x" );
 // 	iter.u->print( "u" );
@@ -237,90 +264,192 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 
     for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
 
-        integrator[run1]->setOptions( getOptions( 0 ) );  // ??
-
-		int freezeIntegrator;
-		get( FREEZE_INTEGRATOR, freezeIntegrator );
-
-		if ( (BooleanType)freezeIntegrator == BT_TRUE )
-			integrator[run1]->freezeAll();
+		Grid evaluationGrid;
+        Grid outputGrid;
 
-        tStart = unionGrid.getTime( run1   );
-        tEnd   = unionGrid.getTime( run1+1 );
-		
-// 		printf("tStart = %e,   tEnd = %e\n",tStart,tEnd );
-// 		x.print("x");
-// 		u.print("u");
-// 		p.print("p");
+		prepareInterval( run1,iter,evaluationGrid,outputGrid );
 
 // 		integrator[run1]->set( INTEGRATOR_PRINTLEVEL, MEDIUM );
 
-		Grid evaluationGrid;
-		iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
-		
-        Grid outputGrid;
-		if ( acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
-			outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
-		else
-			outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
-
-// 		printf("evaluationGrid:\n");
-// 		evaluationGrid.print();
-// 		printf("outputGrid:\n");
-// 		outputGrid.print();
-// 		printf("evaluationGrid+outputGrid:\n");
-// 		(outputGrid&evaluationGrid).print();
-// 		printf("\n");
-// 		u.print("u before");
-// 		x.print("x before");
-// 		w.print("w");
         if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
 
-		
-		Vector xOld;
+		mergeInterval( run1,iter,evaluationGrid,outputGrid,x,xa,p,u,w );
+    }
+
+    // LOG THE RESULTS:
+    // ----------------
+    return logTrajectory( iter );
+}
+
+
+returnValue ShootingMethod::prepareInterval(	uint idx,
+												const OCPiterate &iter,
+												Grid &evaluationGrid,
+												Grid &outputGrid
+												)
+{
+	integrator[idx]->setOptions( 0,*userInteraction );
+
+	int freezeIntegrator;
+	get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+	if ( (BooleanType)freezeIntegrator == BT_TRUE )
+		integrator[idx]->freezeAll();
+
+	double tStart = unionGrid.getTime( idx   );
+	double tEnd   = unionGrid.getTime( idx+1 );
+
+	iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
+
+	if ( acadoIsNegative( integrator[idx]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+		outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
+	else
+		outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[idx]->getDifferentialEquationSampleTime() ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::mergeInterval(	uint idx,
+											OCPiterate &iter,
+											const Grid &evaluationGrid,
+											const Grid &outputGrid,
+											Vector &x,
+											Vector &xa,
+											Vector &p,
+											Vector &u,
+											Vector &w
+											)
+{
+	Vector xOld;
+	Vector pOld = p;
+
+	if ( evaluationGrid.getNumPoints( ) <= 2 )
+	{
+		integrator[idx]->getX ( x  );
+		integrator[idx]->getXA( xa );
+		xOld = x;
+
+		iter.updateData( unionGrid.getTime( idx+1 ), x, xa, p, u, w );
+	}
+	else
+	{
+		VariablesGrid xAll;
+		VariablesGrid xaAll;
+
+		integrator[idx]->getX (  xAll );
+		integrator[idx]->getXA( xaAll );
+
+		xOld = xAll.getLastVector( );
+
+		for( uint run2=1; run2<outputGrid.getNumPoints(); ++run2 )
+		{
+			if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
+			{
+				x  =  xAll.getVector(run2);
+				xa = xaAll.getVector(run2);
+				iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
+			}
+		}
+	}
+
+	if ( iter.isInSimulationMode( ) == BT_FALSE )
+		p = pOld;  // should be changed later...
+
+	residuum.setVector( idx, xOld - x );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::evaluateParallel(	OCPiterate &iter,
+												int nThreads
+												)
+{
+	int run1;
+	int nIntervals = (int)unionGrid.getNumIntervals( );
+
+	Grid   *evaluationGrid = new Grid  [nIntervals];
+	Grid   *outputGrid     = new Grid  [nIntervals];
+	Vector *x0             = new Vector[nIntervals];
+	Vector *xa0            = new Vector[nIntervals];
+	Vector *u0             = new Vector[nIntervals];
+	Vector *w0             = new Vector[nIntervals];
+	int    *status         = new int   [nIntervals];
+
+	Vector x, xa, p, u, w;
+
+	// DETERMINE THE INITIAL VALUES OF ALL INTERVALS:
+	// ----------------------------------------------
+	// (the updates are performed on a copy of the iterate, as the values of
+	//  auto-initialized nodes are only known after the integration)
+
+	OCPiterate iterCopy( iter );
+	iterCopy.getInitialData( x, xa, p, u, w );
+
+	for( run1 = 0; run1 < nIntervals; run1++ )
+	{
+		prepareInterval( run1,iter,evaluationGrid[run1],outputGrid[run1] );
+
+		x0 [run1] = x;
+		xa0[run1] = xa;
+		u0 [run1] = u;
+		w0 [run1] = w;
+
 		Vector pOld = p;
-		
-		if ( evaluationGrid.getNumPoints( ) <= 2 )
+
+		if ( evaluationGrid[run1].getNumPoints( ) <= 2 )
 		{
-			integrator[run1]->getX ( x  );
-			integrator[run1]->getXA( xa );
-// 			x.print("x after2");
-			xOld = x;
-			
-			iter.updateData( tEnd, x, xa, p, u, w );
+			iterCopy.updateData( unionGrid.getTime( run1+1 ), x, xa, p, u, w );
 		}
 		else
 		{
-			integrator[run1]->getX (  xAll );
-			integrator[run1]->getXA( xaAll );
-
-			xOld = xAll.getLastVector( );
-// 			xOld.print("x after");
-			
-			for( uint run2=1; run2<outputGrid.getNumPoints(); ++run2 )
-			{
-				if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
-				{
-					x  =  xAll.getVector(run2);
-					xa = xaAll.getVector(run2);
-					iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
-				}
-			}
+			for( uint run2=1; run2<outputGrid[run1].getNumPoints(); ++run2 )
+				if ( evaluationGrid[run1].hasTime( outputGrid[run1].getTime(run2) ) == BT_TRUE )
+					iterCopy.updateData( outputGrid[run1].getTime(run2), x, xa, p, u, w );
 		}
 
-		if ( iter.isInSimulationMode( ) == BT_FALSE )
-			p = pOld;  // should be changed later...
+		p = pOld;
+	}
 
-        residuum.setVector( run1, xOld - x );
-// 		(xOld - x).print("residuum");
-    }
+	// INTEGRATE ALL INTERVALS CONCURRENTLY:
+	// -------------------------------------
+	#ifdef _OPENMP
+	#pragma omp parallel for num_threads( nThreads ) schedule( dynamic )
+	#endif
+	for( run1 = 0; run1 < nIntervals; run1++ )
+		status[run1] = integrator[run1]->integrate( outputGrid[run1]&evaluationGrid[run1], x0[run1], xa0[run1], p, u0[run1], w0[run1] );
 
-    // LOG THE RESULTS:
-    // ----------------
-    return logTrajectory( iter );
-}
+	// MERGE THE RESULTS SEQUENTIALLY:
+	// -------------------------------
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	for( run1 = 0; run1 < nIntervals; run1++ )
+		if ( status[run1] != SUCCESSFUL_RETURN )
+			returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+	if ( returnvalue == SUCCESSFUL_RETURN )
+	{
+		iter.getInitialData( x, xa, p, u, w );
+
+		for( run1 = 0; run1 < nIntervals; run1++ )
+			mergeInterval( run1,iter,evaluationGrid[run1],outputGrid[run1],x,xa,p,u,w );
+	}
 
+	delete[] evaluationGrid;
+	delete[] outputGrid;
+	delete[] x0;
+	delete[] xa0;
+	delete[] u0;
+	delete[] w0;
+	delete[] status;
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( returnvalue );
+
+	return SUCCESSFUL_RETURN;
+}
 
 
 returnValue ShootingMethod::differentiateBackward( const int    &idx ,
@@ -375,6 +504,17 @@ returnValue ShootingMethod::differentiateForward(  const int     &idx,
     n = acadoMax( n, dU.getNumCols() );
     n = acadoMax( n, dW.getNumCols() );
 
+    // PROPAGATE ALL DIRECTIONS IN A SINGLE SWEEP IF THE INTEGRATOR SUPPORTS THIS:
+    // -------------------------------------------------------------------------
+    if( ( n > 1 ) && ( integrator[idx]->canHandleMultipleForwardDirections( ) == BT_TRUE ) ){
+
+        ACADO_TRY( integrator[idx]->setForwardSeed( 1, dX, dP, dU, dW ) );
+        ACADO_TRY( integrator[idx]->integrateSensitivities( )           );
+        ACADO_TRY( integrator[idx]->getForwardSensitivities( D, 1 )     );
+
+        return SUCCESSFUL_RETURN;
+    }
+
     D.init( nx, n );
 
     for( run1 = 0; run1 < n; run1++ ){
@@ -466,50 +606,110 @@ returnValue ShootingMethod::differentiateForwardBackward( const int     &idx ,
 returnValue ShootingMethod::evaluateSensitivities(){
 
     int i;
+    int nThreads = getNumThreads( );
+
+    returnValue *status = new returnValue[N];
 
     // COMPUTATION OF BACKWARD SENSITIVITIES:
     // --------------------------------------
 
     if( bSeed.isEmpty() == BT_FALSE ){
 
-        dBackward.init( N, 5 );
+        Matrix *X = new Matrix[N];
+        Matrix *P = new Matrix[N];
+        Matrix *U = new Matrix[N];
+        Matrix *W = new Matrix[N];
 
+        #ifdef _OPENMP
+        #pragma omp parallel for num_threads( nThreads ) schedule( dynamic ) if( nThreads > 1 )
+        #endif
         for( i = 0; i < N; i++ ){
 
-             Matrix seed, X, P, U, W;
+             Matrix seed;
              bSeed.getSubBlock( 0, i, seed );
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
+             status[i] = differentiateBackward( i, seed, X[i], P[i], U[i], W[i] );
+        }
+
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+
+        dBackward.init( N, 5 );
+
+        for( i = 0; i < N; i++ ){
+
+             if( status[i] != SUCCESSFUL_RETURN ){
+                 returnvalue = status[i];
+                 break;
+             }
 
-             if( nx > 0 ) dBackward.setDense( i, 0, X );
-             if( np > 0 ) dBackward.setDense( i, 2, P );
-             if( nu > 0 ) dBackward.setDense( i, 3, U );
-             if( nw > 0 ) dBackward.setDense( i, 4, W );
+             if( nx > 0 ) dBackward.setDense( i, 0, X[i] );
+             if( np > 0 ) dBackward.setDense( i, 2, P[i] );
+             if( nu > 0 ) dBackward.setDense( i, 3, U[i] );
+             if( nw > 0 ) dBackward.setDense( i, 4, W[i] );
         }
-        return SUCCESSFUL_RETURN;
+
+        delete[] X;
+        delete[] P;
+        delete[] U;
+        delete[] W;
+        delete[] status;
+
+        return returnvalue;
     }
 
 
     // COMPUTATION OF FORWARD SENSITIVITIES:
     // -------------------------------------
 
-    dForward.init( N, 5 );
+    Matrix *DX = new Matrix[N];
+    Matrix *DP = new Matrix[N];
+    Matrix *DU = new Matrix[N];
+    Matrix *DW = new Matrix[N];
 
+    #ifdef _OPENMP
+    #pragma omp parallel for num_threads( nThreads ) schedule( dynamic ) if( nThreads > 1 )
+    #endif
     for( i = 0; i < N; i++ ){
 
-        Matrix X, P, U, W, D, E;
+        Matrix X, P, U, W, E;
 
         if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
         if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
         if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
         if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+        status[i] = SUCCESSFUL_RETURN;
+
+        if( ( nx > 0 ) && ( status[i] == SUCCESSFUL_RETURN ) ) status[i] = differentiateForward( i, X, E, E, E, DX[i] );
+        if( ( np > 0 ) && ( status[i] == SUCCESSFUL_RETURN ) ) status[i] = differentiateForward( i, E, P, E, E, DP[i] );
+        if( ( nu > 0 ) && ( status[i] == SUCCESSFUL_RETURN ) ) status[i] = differentiateForward( i, E, E, U, E, DU[i] );
+        if( ( nw > 0 ) && ( status[i] == SUCCESSFUL_RETURN ) ) status[i] = differentiateForward( i, E, E, E, W, DW[i] );
     }
-    return SUCCESSFUL_RETURN;
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    dForward.init( N, 5 );
+
+    for( i = 0; i < N; i++ ){
+
+        if( status[i] != SUCCESSFUL_RETURN ){
+            returnvalue = status[i];
+            break;
+        }
+
+        if( nx > 0 ) dForward.setDense( i, 0, DX[i] );
+        if( np > 0 ) dForward.setDense( i, 2, DP[i] );
+        if( nu > 0 ) dForward.setDense( i, 3, DU[i] );
+        if( nw > 0 ) dForward.setDense( i, 4, DW[i] );
+    }
+
+    delete[] DX;
+    delete[] DP;
+    delete[] DU;
+    delete[] DW;
+    delete[] status;
+
+    return returnvalue;
 }
 
 
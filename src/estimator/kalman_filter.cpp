@@ -37,6 +37,228 @@
 BEGIN_NAMESPACE_ACADO
 
 
+//
+// LOCAL DENSE LINEAR ALGEBRA (row-wise storage, no memory allocation):
+//
+
+
+/** Overwrites the symmetric n x n matrix A by its lower Cholesky factor.
+ *  If allowSemidefinite is BT_TRUE, columns belonging to vanishing pivots
+ *  are set to zero, otherwise BT_FALSE is returned for such matrices. */
+static BooleanType choleskyLower(	uint n,
+									double* A,
+									BooleanType allowSemidefinite
+									)
+{
+	uint i,j,k;
+
+	for( j=0; j<n; ++j )
+	{
+		double d = A[j*n+j];
+		for( k=0; k<j; ++k )
+			d -= A[j*n+k]*A[j*n+k];
+
+		double tol = 100.0*EPS*( 1.0 + fabs( A[j*n+j] ) );
+
+		if ( d <= tol )
+		{
+			if ( ( allowSemidefinite == BT_FALSE ) || ( d < -tol ) )
+				return BT_FALSE;
+
+			for( i=j; i<n; ++i )
+				A[i*n+j] = 0.0;
+			continue;
+		}
+
+		d = sqrt( d );
+		A[j*n+j] = d;
+
+		for( i=j+1; i<n; ++i )
+		{
+			double s = A[i*n+j];
+			for( k=0; k<j; ++k )
+				s -= A[i*n+k]*A[j*n+k];
+			A[i*n+j] = s/d;
+		}
+	}
+
+	for( i=0; i<n; ++i )
+		for( j=i+1; j<n; ++j )
+			A[i*n+j] = 0.0;
+
+	return BT_TRUE;
+}
+
+
+/** Solves L*x = b in place for a lower triangular n x n matrix L. */
+static BooleanType solveLower(	uint n,
+								const double* L,
+								double* b
+								)
+{
+	for( uint i=0; i<n; ++i )
+	{
+		if ( fabs( L[i*n+i] ) <= ZERO )
+			return BT_FALSE;
+
+		for( uint k=0; k<i; ++k )
+			b[i] -= L[i*n+k]*b[k];
+		b[i] /= L[i*n+i];
+	}
+
+	return BT_TRUE;
+}
+
+
+/** Solves L'*x = b in place for a lower triangular n x n matrix L. */
+static BooleanType solveLowerTransposed(	uint n,
+											const double* L,
+											double* b
+											)
+{
+	for( int i=(int)n-1; i>=0; --i )
+	{
+		if ( fabs( L[i*n+i] ) <= ZERO )
+			return BT_FALSE;
+
+		for( uint k=i+1; k<n; ++k )
+			b[i] -= L[k*n+i]*b[k];
+		b[i] /= L[i*n+i];
+	}
+
+	return BT_TRUE;
+}
+
+
+/** Overwrites the first n rows of the m x n matrix A (m >= n) by the upper
+ *  triangular factor R of the QR decomposition A = Q*R (Householder
+ *  reflections, nonnegative diagonal). */
+static void triangularize(	uint m,
+							uint n,
+							double* A
+							)
+{
+	uint i,j,k;
+
+	for( k=0; k<n; ++k )
+	{
+		double norm = 0.0;
+		for( i=k; i<m; ++i )
+			norm += A[i*n+k]*A[i*n+k];
+		norm = sqrt( norm );
+
+		if ( norm <= ZERO )
+			continue;
+
+		double alpha = ( A[k*n+k] > 0.0 ) ? -norm : norm;
+		double vk    = A[k*n+k] - alpha;
+		double vtv   = norm*norm - A[k*n+k]*A[k*n+k] + vk*vk;
+
+		for( j=k+1; j<n; ++j )
+		{
+			double s = vk*A[k*n+j];
+			for( i=k+1; i<m; ++i )
+				s += A[i*n+k]*A[i*n+j];
+			s *= 2.0/vtv;
+
+			A[k*n+j] -= s*vk;
+			for( i=k+1; i<m; ++i )
+				A[i*n+j] -= s*A[i*n+k];
+		}
+
+		A[k*n+k] = alpha;
+		for( i=k+1; i<m; ++i )
+			A[i*n+k] = 0.0;
+	}
+
+	for( k=0; k<n; ++k )
+		if ( A[k*n+k] < 0.0 )
+			for( j=k; j<n; ++j )
+				A[k*n+j] = -A[k*n+j];
+}
+
+
+/** Replaces the lower Cholesky factor L of L*L' by the one of L*L' + x*x'
+ *  (isDowndate = BT_FALSE) or of L*L' - x*x' (isDowndate = BT_TRUE).
+ *  The vector x is overwritten. Returns BT_FALSE if the downdated matrix
+ *  is not positive definite. */
+static BooleanType cholUpdate(	uint n,
+								double* L,
+								double* x,
+								BooleanType isDowndate
+								)
+{
+	uint i,k;
+
+	for( k=0; k<n; ++k )
+	{
+		double Lkk = L[k*n+k];
+
+		if ( isDowndate == BT_FALSE )
+		{
+			double r = sqrt( Lkk*Lkk + x[k]*x[k] );
+			if ( r <= ZERO )
+				continue;
+
+			double c = Lkk/r;
+			double s = x[k]/r;
+			L[k*n+k] = r;
+
+			for( i=k+1; i<n; ++i )
+			{
+				double Lik = L[i*n+k];
+				L[i*n+k] = c*Lik + s*x[i];
+				x[i]     = c*x[i] - s*Lik;
+			}
+		}
+		else
+		{
+			if ( fabs( x[k] ) <= ZERO )
+				continue;
+
+			double r2 = Lkk*Lkk - x[k]*x[k];
+			if ( ( Lkk <= ZERO ) || ( r2 <= 0.0 ) )
+				return BT_FALSE;
+
+			double r = sqrt( r2 );
+			double c = r/Lkk;
+			double s = x[k]/Lkk;
+			L[k*n+k] = r;
+
+			for( i=k+1; i<n; ++i )
+			{
+				L[i*n+k] = ( L[i*n+k] - s*x[i] )/c;
+				x[i]     = c*x[i] - s*L[i*n+k];
+			}
+		}
+	}
+
+	return BT_TRUE;
+}
+
+
+/** Returns the weights and the spread of the sigma points (alpha = 1, beta = 2, kappa = 0). */
+static void getSigmaPointWeights(	uint n,
+									double& gamma,
+									double& Wm0,
+									double& Wc0,
+									double& Wi
+									)
+{
+	const double alpha = 1.0;
+	const double beta  = 2.0;
+	const double kappa = 0.0;
+
+	double lambda = alpha*alpha*( (double)n + kappa ) - (double)n;
+
+	gamma = sqrt( (double)n + lambda );
+	Wm0   = lambda / ( (double)n + lambda );
+	Wc0   = Wm0 + 1.0 - alpha*alpha + beta;
+	Wi    = 0.5 / ( (double)n + lambda );
+}
+
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -45,17 +267,90 @@ BEGIN_NAMESPACE_ACADO
 KalmanFilter::KalmanFilter(	double _samplingTime
 							) : Estimator( _samplingTime )
 {
+	type       = EXTENDED_KALMAN_FILTER;
+	integrator = 0;
+	lastTime   = 0.0;
+
+	setStatus( BS_NOT_INITIALIZED );
+}
+
+
+KalmanFilter::KalmanFilter(	const DynamicSystem& _dynamicSystem,
+							const Matrix& _Q,
+							const Matrix& _R,
+							KalmanFilterType _type,
+							IntegratorType _integratorType,
+							double _samplingTime
+							) : Estimator( _samplingTime )
+{
+	type       = _type;
+	integrator = 0;
+	lastTime   = 0.0;
+
+	outputFcn = _dynamicSystem.getOutputFcn( );
+	Q = _Q;
+	R = _R;
+
+	x.init( _dynamicSystem.getNumDynamicEquations( ) );
+	xa.init( _dynamicSystem.getNumAlgebraicEquations( ) );
+	u.init( _dynamicSystem.getNumControls( ) );
+	p.init( _dynamicSystem.getNumParameters( ) );
+	w.init( _dynamicSystem.getNumDisturbances( ) );
+
+	x.setZero( );
+	xa.setZero( );
+	u.setZero( );
+	p.setZero( );
+	w.setZero( );
+
+	if ( allocateIntegrator( _integratorType ) == SUCCESSFUL_RETURN )
+		integrator->init( _dynamicSystem.getDifferentialEquation( ) );
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
 
 KalmanFilter::KalmanFilter( const KalmanFilter& rhs ) : Estimator( rhs )
 {
+	type = rhs.type;
+
+	if ( rhs.integrator != 0 )
+		integrator = rhs.integrator->clone( );
+	else
+		integrator = 0;
+
+	outputFcn = rhs.outputFcn;
+
+	Q  = rhs.Q;
+	R  = rhs.R;
+	P  = rhs.P;
+	P0 = rhs.P0;
+	lastTime = rhs.lastTime;
+
+	xTmp  = rhs.xTmp;
+	xSeed = rhs.xSeed;
+	dx    = rhs.dx;
+	yTmp  = rhs.yTmp;
+	e     = rhs.e;
+	z     = rhs.z;
+	zSeed = rhs.zSeed;
+	At    = rhs.At;
+	Ct    = rhs.Ct;
+	T     = rhs.T;
+	PCt   = rhs.PCt;
+	S     = rhs.S;
+	sqrtQ = rhs.sqrtQ;
+	sqrtR = rhs.sqrtR;
+	X     = rhs.X;
+	Y     = rhs.Y;
+	QR    = rhs.QR;
 }
 
 
 KalmanFilter::~KalmanFilter( )
 {
+	if ( integrator != 0 )
+		delete integrator;
 }
 
 
@@ -63,9 +358,43 @@ KalmanFilter& KalmanFilter::operator=( const KalmanFilter& rhs )
 {
 	if ( this != &rhs )
 	{
+		if ( integrator != 0 )
+			delete integrator;
 
 		Estimator::operator=( rhs );
 
+		type = rhs.type;
+
+		if ( rhs.integrator != 0 )
+			integrator = rhs.integrator->clone( );
+		else
+			integrator = 0;
+
+		outputFcn = rhs.outputFcn;
+
+		Q  = rhs.Q;
+		R  = rhs.R;
+		P  = rhs.P;
+		P0 = rhs.P0;
+		lastTime = rhs.lastTime;
+
+		xTmp  = rhs.xTmp;
+		xSeed = rhs.xSeed;
+		dx    = rhs.dx;
+		yTmp  = rhs.yTmp;
+		e     = rhs.e;
+		z     = rhs.z;
+		zSeed = rhs.zSeed;
+		At    = rhs.At;
+		Ct    = rhs.Ct;
+		T     = rhs.T;
+		PCt   = rhs.PCt;
+		S     = rhs.S;
+		sqrtQ = rhs.sqrtQ;
+		sqrtR = rhs.sqrtR;
+		X     = rhs.X;
+		Y     = rhs.Y;
+		QR    = rhs.QR;
 	}
 
     return *this;
@@ -84,6 +413,55 @@ returnValue KalmanFilter::init(	double startTime,
 								const Vector &p_
 								)
 {
+	// filter without dynamic system: nothing to estimate
+	if ( integrator == 0 )
+	{
+		x = x0_;
+		p = p_;
+		setStatus( BS_READY );
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( getNXA( ) > 0 )
+		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+	uint nx = getNX( );
+	uint ny = getNY( );
+
+	if ( ( Q.getNumRows( ) != nx ) || ( Q.getNumCols( ) != nx ) ||
+		 ( R.getNumRows( ) != ny ) || ( R.getNumCols( ) != ny ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( x0_.isEmpty( ) == BT_FALSE )
+	{
+		if ( x0_.getDim( ) != nx )
+			return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+		x = x0_;
+	}
+
+	if ( p_.isEmpty( ) == BT_FALSE )
+	{
+		if ( p_.getDim( ) != getNP( ) )
+			return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+		p = p_;
+	}
+
+	if ( P0.isEmpty( ) == BT_TRUE )
+		P = Q;
+	else
+		P = P0;
+
+	if ( allocateWorkspace( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ESTIMATOR_INIT_FAILED );
+
+	if ( type == UNSCENTED_KALMAN_FILTER )
+	{
+		if ( choleskyLower( nx,P.getDoublePointer(),BT_TRUE ) == BT_FALSE )
+			return ACADOERROR( RET_ESTIMATOR_INIT_FAILED );
+	}
+
+	lastTime = startTime;
+
 	setStatus( BS_READY );
 
 	return SUCCESSFUL_RETURN;
@@ -94,6 +472,77 @@ returnValue KalmanFilter::step(	double currentTime,
 								const Vector& _y
 								)
 {
+	if ( getStatus( ) != BS_READY )
+		return ACADOERROR( RET_BLOCK_NOT_READY );
+
+	if ( integrator == 0 )
+		return SUCCESSFUL_RETURN;
+
+	if ( _y.getDim( ) != getNY( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	if ( type == UNSCENTED_KALMAN_FILTER )
+	{
+		if ( currentTime > lastTime )
+			returnvalue = predictUKF( lastTime,currentTime );
+
+		lastTime = currentTime;
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = updateUKF( _y );
+	}
+	else
+	{
+		if ( currentTime > lastTime )
+			returnvalue = predictEKF( lastTime,currentTime );
+
+		lastTime = currentTime;
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = updateEKF( _y );
+	}
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ESTIMATOR_STEP_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::setCovariance(	const Matrix& _P
+											)
+{
+	if ( ( _P.getNumRows( ) != getNX( ) ) || ( _P.getNumCols( ) != getNX( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	P0 = _P;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::getCovariance(	Matrix& _P
+											) const
+{
+	if ( type == UNSCENTED_KALMAN_FILTER )
+	{
+		uint nx = P.getNumRows( );
+		_P.init( nx,nx );
+
+		for( uint i=0; i<nx; ++i )
+			for( uint j=0; j<nx; ++j )
+			{
+				double s = 0.0;
+				for( uint k=0; k<=i && k<=j; ++k )
+					s += P(i,k)*P(j,k);
+				_P(i,j) = s;
+			}
+	}
+	else
+		_P = P;
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -104,6 +553,433 @@ returnValue KalmanFilter::step(	double currentTime,
 //
 
 
+returnValue KalmanFilter::allocateIntegrator(	IntegratorType _integratorType
+												)
+{
+	switch( _integratorType )
+	{
+		case INT_DISCRETE:   integrator = new IntegratorDiscretizedODE(); break;
+		case INT_RK12:       integrator = new IntegratorRK12();           break;
+		case INT_RK23:       integrator = new IntegratorRK23();           break;
+		case INT_RK45:       integrator = new IntegratorRK45();           break;
+		case INT_RK78:       integrator = new IntegratorRK78();           break;
+		case INT_BDF:        integrator = new IntegratorBDF();            break;
+		case INT_UNKNOWN:    integrator = new IntegratorBDF();            break;
+		case INT_LYAPUNOV45: integrator = new IntegratorLYAPUNOV45();     break;
+
+		default: return ACADOERROR( RET_UNKNOWN_BUG );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::allocateWorkspace( )
+{
+	uint nx = getNX( );
+	uint ny = getNY( );
+
+	xTmp.init( nx );
+	xSeed.init( nx );
+	dx.init( nx );
+	yTmp.init( ny );
+	e.init( ny );
+
+	if ( outputFcn.getDim( ) > 0 )
+	{
+		z.init( outputFcn.getNumberOfVariables( )+1 );
+		zSeed.init( outputFcn.getNumberOfVariables( )+1 );
+		z.setZero( );
+		zSeed.setZero( );
+	}
+
+	At.init( nx,nx );
+	T.init( nx,nx );
+	Ct.init( nx,ny );
+	PCt.init( nx,ny );
+	S.init( ny,ny );
+
+	if ( type == UNSCENTED_KALMAN_FILTER )
+	{
+		uint nq = ( nx > ny ) ? nx : ny;
+
+		sqrtQ = Q;
+		sqrtR = R;
+
+		if ( ( choleskyLower( nx,sqrtQ.getDoublePointer(),BT_TRUE ) == BT_FALSE ) ||
+			 ( choleskyLower( ny,sqrtR.getDoublePointer(),BT_TRUE ) == BT_FALSE ) )
+			return ACADOERROR( RET_NONPOSITIVE_WEIGHT );
+
+		X.init( 2*nx+1,nx );
+		Y.init( 2*nx+1,ny );
+		QR.init( 2*nx+nq,nq );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::evaluateOutput(	const double* const _x,
+											double* _y,
+											BooleanType computeJacobian
+											)
+{
+	uint i;
+	uint nx = getNX( );
+	uint ny = getNY( );
+
+	if ( outputFcn.getDim( ) == 0 )
+	{
+		for( i=0; i<nx; ++i )
+			_y[i] = _x[i];
+
+		if ( computeJacobian == BT_TRUE )
+			Ct.setIdentity( );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	double* zz = z.getDoublePointer( );
+
+	zz[ outputFcn.index( VT_TIME,0 ) ] = lastTime;
+
+	for( i=0; i<nx; ++i )
+		zz[ outputFcn.index( VT_DIFFERENTIAL_STATE,i ) ] = _x[i];
+	for( i=0; i<getNU( ); ++i )
+		zz[ outputFcn.index( VT_CONTROL,i ) ] = u(i);
+	for( i=0; i<getNP( ); ++i )
+		zz[ outputFcn.index( VT_PARAMETER,i ) ] = p(i);
+	for( i=0; i<getNW( ); ++i )
+		zz[ outputFcn.index( VT_DISTURBANCE,i ) ] = w(i);
+
+	if ( outputFcn.Function::evaluate( 0,zz,_y ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ESTIMATOR_STEP_FAILED );
+
+	if ( computeJacobian == BT_TRUE )
+	{
+		double* seed = zSeed.getDoublePointer( );
+
+		for( i=0; i<nx; ++i )
+		{
+			int idx = outputFcn.index( VT_DIFFERENTIAL_STATE,i );
+
+			seed[idx] = 1.0;
+			returnValue returnvalue = outputFcn.AD_forward( 0,seed,&(Ct.getDoublePointer()[i*ny]) );
+			seed[idx] = 0.0;
+
+			if ( returnvalue != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_ESTIMATOR_STEP_FAILED );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::integrate(	double t0,
+										double t1,
+										const double* const _x,
+										double* _xEnd
+										)
+{
+	uint nx = getNX( );
+
+	for( uint i=0; i<nx; ++i )
+		dx(i) = _x[i];
+
+	if ( integrator->integrate( t0,t1,dx,xa,p,u,w ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ESTIMATOR_STEP_FAILED );
+
+	integrator->getX( xTmp );
+
+	for( uint i=0; i<nx; ++i )
+		_xEnd[i] = xTmp(i);
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::predictEKF(	double t0,
+										double t1
+										)
+{
+	uint i,j;
+	uint nx = getNX( );
+
+	// predict the state and compute the transition matrix
+	integrator->freezeAll( );
+
+	if ( integrate( t0,t1,x.getDoublePointer(),x.getDoublePointer() ) != SUCCESSFUL_RETURN )
+	{
+		integrator->unfreeze( );
+		return RET_ESTIMATOR_STEP_FAILED;
+	}
+
+	for( i=0; i<nx; ++i )
+	{
+		xSeed.setZero( );
+		xSeed(i) = 1.0;
+
+		if ( ( integrator->setForwardSeed( 1,xSeed ) != SUCCESSFUL_RETURN ) ||
+			 ( integrator->integrateSensitivities( ) != SUCCESSFUL_RETURN ) ||
+			 ( integrator->getForwardSensitivities( dx,1 ) != SUCCESSFUL_RETURN ) )
+		{
+			integrator->deleteAllSeeds( );
+			integrator->unfreeze( );
+			return RET_ESTIMATOR_STEP_FAILED;
+		}
+
+		for( j=0; j<nx; ++j )
+			At(i,j) = dx(j);
+	}
+
+	integrator->deleteAllSeeds( );
+	integrator->unfreeze( );
+
+	// P := A*P*A' + Q
+	multiplyInto( T,P,At );
+	multiplyTransposeInto( P,At,T );
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<i; ++j )
+			P(i,j) = P(j,i) = 0.5*( P(i,j) + P(j,i) );
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<nx; ++j )
+			P(i,j) += Q(i,j);
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::updateEKF(	const Vector& _y
+										)
+{
+	uint i,j,k;
+	uint nx = getNX( );
+	uint ny = getNY( );
+
+	if ( evaluateOutput( x.getDoublePointer(),yTmp.getDoublePointer(),BT_TRUE ) != SUCCESSFUL_RETURN )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	// innovation covariance S = C*P*C' + R = L*L'
+	multiplyInto( PCt,P,Ct );
+	multiplyTransposeInto( S,Ct,PCt );
+
+	for( i=0; i<ny; ++i )
+		for( j=0; j<ny; ++j )
+			S(i,j) += R(i,j);
+
+	if ( choleskyLower( ny,S.getDoublePointer(),BT_FALSE ) == BT_FALSE )
+		return ACADOERROR( RET_NONPOSITIVE_WEIGHT );
+
+	// W = P*C'*L^-T (stored in PCt) and e = L^-1*(y-h(x))
+	for( i=0; i<nx; ++i )
+		solveLower( ny,S.getDoublePointer(),&(PCt.getDoublePointer()[i*ny]) );
+
+	for( i=0; i<ny; ++i )
+		e(i) = _y(i) - yTmp(i);
+	solveLower( ny,S.getDoublePointer(),e.getDoublePointer() );
+
+	// x := x + W*e,  P := P - W*W'
+	for( i=0; i<nx; ++i )
+		for( k=0; k<ny; ++k )
+			x(i) += PCt(i,k)*e(k);
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<=i; ++j )
+		{
+			double s = 0.0;
+			for( k=0; k<ny; ++k )
+				s += PCt(i,k)*PCt(j,k);
+
+			P(i,j) -= s;
+			if ( j < i )
+				P(j,i) = P(i,j);
+		}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::computeSigmaPoints( )
+{
+	uint i,j;
+	uint nx = getNX( );
+
+	double gamma, Wm0, Wc0, Wi;
+	getSigmaPointWeights( nx,gamma,Wm0,Wc0,Wi );
+
+	for( j=0; j<nx; ++j )
+		X(0,j) = x(j);
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<nx; ++j )
+		{
+			X(1+i,j)    = x(j) + gamma*P(j,i);
+			X(1+nx+i,j) = x(j) - gamma*P(j,i);
+		}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::predictUKF(	double t0,
+										double t1
+										)
+{
+	uint i,j,k;
+	uint nx = getNX( );
+
+	double gamma, Wm0, Wc0, Wi;
+	getSigmaPointWeights( nx,gamma,Wm0,Wc0,Wi );
+
+	// propagate the sigma points
+	computeSigmaPoints( );
+
+	for( k=0; k<2*nx+1; ++k )
+	{
+		double* Xk = &(X.getDoublePointer()[k*nx]);
+
+		if ( integrate( t0,t1,Xk,Xk ) != SUCCESSFUL_RETURN )
+			return RET_ESTIMATOR_STEP_FAILED;
+	}
+
+	for( j=0; j<nx; ++j )
+	{
+		x(j) = Wm0*X(0,j);
+		for( k=1; k<2*nx+1; ++k )
+			x(j) += Wi*X(k,j);
+	}
+
+	// P := qr( [ sqrt(Wi)*(X_k-x), sqrt(Q) ]' ), then the central sigma point
+	double  sqrtWi = sqrt( Wi );
+	double* A = QR.getDoublePointer( );
+
+	for( k=0; k<2*nx; ++k )
+		for( j=0; j<nx; ++j )
+			A[k*nx+j] = sqrtWi*( X(1+k,j) - x(j) );
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<nx; ++j )
+			A[(2*nx+i)*nx+j] = sqrtQ(j,i);
+
+	triangularize( 3*nx,nx,A );
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<nx; ++j )
+			P(i,j) = ( j <= i ) ? A[j*nx+i] : 0.0;
+
+	double sqrtWc0 = sqrt( fabs( Wc0 ) );
+	for( j=0; j<nx; ++j )
+		xTmp(j) = sqrtWc0*( X(0,j) - x(j) );
+
+	if ( cholUpdate( nx,P.getDoublePointer(),xTmp.getDoublePointer(),( Wc0 < 0.0 ) ? BT_TRUE : BT_FALSE ) == BT_FALSE )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::updateUKF(	const Vector& _y
+										)
+{
+	uint i,j,k;
+	uint nx = getNX( );
+	uint ny = getNY( );
+
+	double gamma, Wm0, Wc0, Wi;
+	getSigmaPointWeights( nx,gamma,Wm0,Wc0,Wi );
+
+	// sigma points of the output
+	computeSigmaPoints( );
+
+	for( k=0; k<2*nx+1; ++k )
+		if ( evaluateOutput( &(X.getDoublePointer()[k*nx]),&(Y.getDoublePointer()[k*ny]),BT_FALSE ) != SUCCESSFUL_RETURN )
+			return RET_ESTIMATOR_STEP_FAILED;
+
+	for( j=0; j<ny; ++j )
+	{
+		yTmp(j) = Wm0*Y(0,j);
+		for( k=1; k<2*nx+1; ++k )
+			yTmp(j) += Wi*Y(k,j);
+	}
+
+	// S := qr( [ sqrt(Wi)*(Y_k-y), sqrt(R) ]' ), then the central sigma point
+	double  sqrtWi = sqrt( Wi );
+	double* A = QR.getDoublePointer( );
+
+	for( k=0; k<2*nx; ++k )
+		for( j=0; j<ny; ++j )
+			A[k*ny+j] = sqrtWi*( Y(1+k,j) - yTmp(j) );
+
+	for( i=0; i<ny; ++i )
+		for( j=0; j<ny; ++j )
+			A[(2*nx+i)*ny+j] = sqrtR(j,i);
+
+	triangularize( 2*nx+ny,ny,A );
+
+	for( i=0; i<ny; ++i )
+		for( j=0; j<ny; ++j )
+			S(i,j) = ( j <= i ) ? A[j*ny+i] : 0.0;
+
+	double sqrtWc0 = sqrt( fabs( Wc0 ) );
+	for( j=0; j<ny; ++j )
+		e(j) = sqrtWc0*( Y(0,j) - yTmp(j) );
+
+	if ( cholUpdate( ny,S.getDoublePointer(),e.getDoublePointer(),( Wc0 < 0.0 ) ? BT_TRUE : BT_FALSE ) == BT_FALSE )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	// cross covariance (the central sigma point coincides with x)
+	for( i=0; i<nx; ++i )
+		for( j=0; j<ny; ++j )
+		{
+			double s = 0.0;
+			for( k=1; k<2*nx+1; ++k )
+				s += ( X(k,i) - x(i) )*( Y(k,j) - yTmp(j) );
+			PCt(i,j) = Wi*s;
+		}
+
+	// gain K = Pxy*(S*S')^-1 (stored in PCt)
+	for( i=0; i<nx; ++i )
+	{
+		double* Ki = &(PCt.getDoublePointer()[i*ny]);
+
+		if ( ( solveLower( ny,S.getDoublePointer(),Ki ) == BT_FALSE ) ||
+			 ( solveLowerTransposed( ny,S.getDoublePointer(),Ki ) == BT_FALSE ) )
+			return ACADOERROR( RET_NONPOSITIVE_WEIGHT );
+	}
+
+	// x := x + K*(y-yTmp)
+	for( j=0; j<ny; ++j )
+		e(j) = _y(j) - yTmp(j);
+
+	for( i=0; i<nx; ++i )
+		for( j=0; j<ny; ++j )
+			x(i) += PCt(i,j)*e(j);
+
+	// P := cholupdate( P, K*S, '-' ) (U = K*S stored in Ct)
+	for( i=0; i<nx; ++i )
+		for( j=0; j<ny; ++j )
+		{
+			double s = 0.0;
+			for( k=j; k<ny; ++k )
+				s += PCt(i,k)*S(k,j);
+			Ct(i,j) = s;
+		}
+
+	for( j=0; j<ny; ++j )
+	{
+		for( i=0; i<nx; ++i )
+			xTmp(i) = Ct(i,j);
+
+		if ( cholUpdate( nx,P.getDoublePointer(),xTmp.getDoublePointer(),BT_TRUE ) == BT_FALSE )
+			return RET_ESTIMATOR_STEP_FAILED;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
 
 
 CLOSE_NAMESPACE_ACADO
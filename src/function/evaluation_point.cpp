@@ -170,6 +170,37 @@ returnValue EvaluationPoint::print() const{
 
 
 
+returnValue EvaluationPoint::gatherZ( const OCPiterate &iter   ,
+                                      double           *zBatch ,
+                                      const uint       &nPoints  ) const{
+
+    uint run1, run2, run3;
+    double *row;
+
+    row = zBatch + idx[0][0]*nPoints;
+    for( run2 = 0; run2 < nPoints; run2++ )
+        row[run2] = iter.getTime( run2 );
+
+    const VariablesGrid *grids[5] = { iter.x, iter.xa, iter.p, iter.u, iter.w };
+
+    for( run3 = 0; run3 < 5; run3++ ){
+
+        if( grids[run3] == 0 ) continue;
+
+        for( run1 = 0; run1 < grids[run3]->getNumValues(); run1++ ){
+
+            VectorView<const double> component = grids[run3]->getComponentView( run1 );
+
+            row = zBatch + idx[run3+1][run1]*nPoints;
+            for( run2 = 0; run2 < nPoints; run2++ )
+                row[run2] = component( run2 );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -279,6 +279,102 @@ returnValue Function::evaluate( int number, double *x, double *_result ){
 
 
 
+returnValue Function::evaluate( double *x, double *_result ){
+
+    return evaluationTree.evaluate( x, _result );
+}
+
+
+returnValue Function::evaluateBatch( int nPoints, double *x, double *_result ){
+
+    return evaluationTree.evaluateBatch( nPoints, x, _result );
+}
+
+
+returnValue Function::evaluateBatch( int nPoints, double *x, double *_result,
+                                     EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.evaluateBatch( nPoints, x, _result, ws );
+}
+
+
+returnValue Function::eliminateCommonSubexpressions( ){
+
+    return evaluationTree.eliminateCommonSubexpressions( );
+}
+
+
+returnValue Function::compile( ){
+
+    return evaluationTree.compile( );
+}
+
+
+int Function::getNumTapeInstructions( ) const{
+
+    return evaluationTree.getNumTapeInstructions( );
+}
+
+
+BooleanType Function::isCompiled( ) const{
+
+    return evaluationTree.isCompiled( );
+}
+
+
+returnValue Function::compileNative( const char *compiler, const char *cacheDirectory ){
+
+    return evaluationTree.compileNative( compiler,cacheDirectory );
+}
+
+
+BooleanType Function::isNative( ) const{
+
+    return evaluationTree.isNative( );
+}
+
+
+returnValue Function::initWorkspace( EvaluationWorkspace& ws, int nDirections, int nPoints ) const{
+
+    return evaluationTree.initWorkspace( ws,nDirections,nPoints );
+}
+
+
+returnValue Function::evaluate( double *x, double *_result, EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.evaluate( x, _result, ws );
+}
+
+
+returnValue Function::AD_forward( double *x, double *seed, double *f, double *df,
+                                  EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.AD_forward( x, seed, f, df, ws );
+}
+
+
+returnValue Function::AD_forward( int nDirections, double *x, double *seed, double *f, double *df,
+                                  EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.AD_forward( nDirections, x, seed, f, df, ws );
+}
+
+
+returnValue Function::AD_backward( double *x, double *seed, double *df,
+                                   EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.AD_backward( x, seed, df, ws );
+}
+
+
+returnValue Function::AD_backward( int point, double *seed, double *df,
+                                   EvaluationWorkspace& ws ) const{
+
+    return evaluationTree.AD_backward( point, seed, df, ws );
+}
+
+
+
 returnValue Function::substitute( VariableType variableType_, int index_,
                                   double sub_ ){
 
@@ -314,6 +410,15 @@ BooleanType Function::isLinearIn( const Expression     &variable ){
 }
 
 
+returnValue Function::getDependencyPattern( int           nVar     ,
+                                            VariableType *varType  ,
+                                            int          *component,
+                                            BooleanType  *pattern     ){
+
+    return evaluationTree.getDependencyPattern( nVar, varType, component, pattern );
+}
+
+
 BooleanType Function::isPolynomialIn( const Expression     &variable ){
 
     return evaluationTree.isPolynomialIn( variable );
@@ -53,6 +53,11 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
     indexList = new SymbolicIndexList();
     dim       =  0;
     n         =  0;
+    nativeX   = NULL;
+    nNativeX  =  0;
+    nativeF   = NULL;
+
+    hasLocalStates = BT_FALSE;
 
     auxVariableName = "acado_aux";
     auxVariableStructName = "acadoWorkspace";
@@ -65,6 +70,12 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
     dim = arg.dim;
     n   = arg.n  ;
 
+    nativeX  = NULL;
+    nNativeX = 0   ;
+    nativeF  = NULL;
+
+    hasLocalStates = arg.hasLocalStates;
+
     auxVariableName = arg.auxVariableName;
     auxVariableStructName = arg.auxVariableStructName;
 
@@ -96,6 +107,12 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
     }
 
     safeCopy = arg.safeCopy;
+    tape     = arg.tape    ;
+
+    if( tape.isNative() == BT_TRUE ){
+        nativeF = (double*)calloc(dim+1,sizeof(double));
+        nativeWorkspace.init( tape );
+    }
 }
 
 
@@ -123,6 +140,9 @@ FunctionEvaluationTree::~FunctionEvaluationTree( ){
         free(lhs_comp);
     }
 
+    if( nativeX != NULL ) free(nativeX);
+    if( nativeF != NULL ) free(nativeF);
+
     delete indexList;
 }
 
@@ -151,11 +171,20 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             free(lhs_comp);
         }
 
+        if( nativeX != NULL ) free(nativeX);
+        if( nativeF != NULL ) free(nativeF);
+
+        nativeX  = NULL;
+        nNativeX = 0   ;
+        nativeF  = NULL;
+
         delete indexList;
 
         dim = arg.dim;
         n   = arg.n  ;
 
+        hasLocalStates = arg.hasLocalStates;
+
         auxVariableName = arg.auxVariableName;
         auxVariableStructName = arg.auxVariableStructName;
 
@@ -186,6 +215,12 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             }
         }
         safeCopy = arg.safeCopy;
+        tape     = arg.tape    ;
+
+        if( tape.isNative() == BT_TRUE ){
+            nativeF = (double*)calloc(dim+1,sizeof(double));
+            nativeWorkspace.init( tape );
+        }
     }
 
     return *this;
@@ -201,10 +236,25 @@ returnValue FunctionEvaluationTree::getExpression( Expression& expression ) cons
 
 returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
+    // the indices of local intermediate states might coincide with the
+    // (global) ones of intermediate states in the new components:
+    if( hasLocalStates == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
     safeCopy << arg;
+    tape.clear();
 
     uint run1;
 
+    // structurally identical subexpressions of all components are
+    // replaced by (shared) intermediate states, which are evaluated once:
+    SubexpressionTable subexpressions;
+    BooleanType isShared = BT_TRUE;
+
+    for( run1 = 0; run1 < arg.getDim(); run1++ )
+        if( subexpressions.add( *arg.element[run1] ) != SUCCESSFUL_RETURN )
+            isShared = BT_FALSE;
+
     for( run1 = 0; run1 < arg.getDim(); run1++ ){
 
         int nn;
@@ -213,7 +263,9 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         f = (Operator**)realloc(f,(dim+1)*sizeof(Operator*));
 
-        f[dim] = arg.element[run1]->clone();
+        if( isShared == BT_TRUE ) f[dim] = subexpressions.share( *arg.element[run1] );
+        else                      f[dim] = arg.element[run1]->clone();
+
         f[dim]-> loadIndices  ( indexList );
 
         sub       = (Operator**)realloc(sub,
@@ -238,10 +290,178 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
 
 
+returnValue FunctionEvaluationTree::eliminateCommonSubexpressions( ){
+
+    int run1, nn;
+
+    // the shared subexpressions become intermediate states which are local
+    // to this function, numbered after all intermediate states it contains:
+    int firstIndex = 0;
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > firstIndex )
+            firstIndex = lhs_comp[run1]+1;
+
+    SubexpressionTable subexpressions( firstIndex );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( subexpressions.add( *f[run1] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    if( subexpressions.getNumSharedEntries() == 0 )
+        return SUCCESSFUL_RETURN;
+
+    tape.clear();
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        Operator *tmp = subexpressions.share( *f[run1] );
+        delete f[run1];
+
+        f[run1] = tmp;
+        f[run1]-> loadIndices( indexList );
+    }
+
+    // the existing intermediate states are kept, the new ones are appended
+    // (in the order of their dependencies):
+    nn = n;
+
+    sub       = (Operator**)realloc(sub,
+                (indexList->getNumberOfOperators())*sizeof(Operator*));
+    lhs_comp  = (int*)realloc(lhs_comp,
+                (indexList->getNumberOfOperators())*sizeof(int));
+
+    indexList->getOperators( sub, lhs_comp, &n );
+
+    while( nn < n ){
+
+        sub[nn]-> enumerateVariables( indexList );
+        nn++;
+    }
+
+    for( run1 = 0; run1 < dim; run1++ )
+        f[run1]-> enumerateVariables( indexList );
+
+    hasLocalStates = BT_TRUE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::compile( ){
+
+    int run1;
+
+    tape.clear();
+
+    // structurally identical subexpressions of all intermediate states and
+    // components are evaluated only once by the tape; they are numbered
+    // after all variables, i.e. neither the trees nor the indices change:
+    SubexpressionTable subexpressions( getNumberOfVariables()+1 );
+    BooleanType isShared = BT_TRUE;
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( subexpressions.add( *sub[run1] ) != SUCCESSFUL_RETURN )
+            isShared = BT_FALSE;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( subexpressions.add( *f[run1] ) != SUCCESSFUL_RETURN )
+            isShared = BT_FALSE;
+
+    if( isShared == BT_TRUE && subexpressions.getNumSharedEntries() == 0 )
+        isShared = BT_FALSE;
+
+    Operator **sharedSub = (Operator**)calloc( n  +1,sizeof(Operator*) );
+    Operator **sharedF   = (Operator**)calloc( dim+1,sizeof(Operator*) );
+
+    if( isShared == BT_TRUE ){
+
+        for( run1 = 0; run1 < n; run1++ )
+            sharedSub[run1] = subexpressions.share( *sub[run1] );
+
+        for( run1 = 0; run1 < dim; run1++ )
+            sharedF[run1] = subexpressions.share( *f[run1] );
+
+        Operator **args = (Operator**)calloc( subexpressions.getNumStates()+1,sizeof(Operator*) );
+
+        subexpressions.getStateArguments( args );
+        tape.shareSubexpressions( getNumberOfVariables()+1, subexpressions.getNumStates(), args );
+
+        free( args );
+    }
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < n && returnvalue == SUCCESSFUL_RETURN; run1++ )
+        returnvalue = tape.addIntermediateState( sharedSub[run1] != 0 ? *sharedSub[run1] : *sub[run1],
+                                                 indexList->index(VT_INTERMEDIATE_STATE,lhs_comp[run1]) );
+
+    for( run1 = 0; run1 < dim && returnvalue == SUCCESSFUL_RETURN; run1++ )
+        returnvalue = tape.addComponent( sharedF[run1] != 0 ? *sharedF[run1] : *f[run1], run1 );
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( sharedSub[run1] != 0 ) delete sharedSub[run1];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( sharedF[run1] != 0 ) delete sharedF[run1];
+
+    free( sharedSub );
+    free( sharedF   );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        tape.clear();
+        return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int FunctionEvaluationTree::getNumTapeInstructions( ) const{
+
+    return tape.getNumInstructions( );
+}
+
+
+BooleanType FunctionEvaluationTree::isCompiled( ) const{
+
+    if( tape.isEmpty() == BT_TRUE ) return BT_FALSE;
+    return BT_TRUE;
+}
+
+
+returnValue FunctionEvaluationTree::compileNative( const char *compiler, const char *cacheDirectory ){
+
+    returnValue returnvalue;
+
+    if( tape.isEmpty() == BT_TRUE ){
+        returnvalue = compile( );
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+    }
+
+    returnvalue = tape.compileNative( compiler,cacheDirectory );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    if( nativeF != NULL ) free(nativeF);
+    nativeF = (double*)calloc(dim+1,sizeof(double));
+
+    return nativeWorkspace.init( tape );
+}
+
+
+BooleanType FunctionEvaluationTree::isNative( ) const{
+
+    return tape.isNative( );
+}
+
+
 returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
     int run1;
 
+    if( tape.isEmpty() == BT_FALSE )
+        return tape.evaluate( x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
         sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
@@ -255,6 +475,66 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 }
 
 
+returnValue FunctionEvaluationTree::evaluateBatch( int nPoints, double *x, double *result ){
+
+    int run1, run2;
+
+    if( tape.isEmpty() == BT_FALSE )
+        return tape.evaluateBatch( nPoints, x, result );
+
+    const int nz = getNumberOfVariables()+1;
+
+    double *xPoint      = new double[nz ];
+    double *resultPoint = new double[dim];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        for( run2 = 0; run2 < nz; run2++ )
+            xPoint[run2] = x[run2*nPoints+run1];
+
+        evaluate( xPoint, resultPoint );
+
+        for( run2 = 0; run2 < nz; run2++ )
+            x[run2*nPoints+run1] = xPoint[run2];
+        for( run2 = 0; run2 < dim; run2++ )
+            result[run2*nPoints+run1] = resultPoint[run2];
+    }
+
+    delete[] xPoint;
+    delete[] resultPoint;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::evaluateBatch( int nPoints, double *x, double *result,
+                                                   EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.evaluateBatch( nPoints, x, result, ws );
+}
+
+
+returnValue FunctionEvaluationTree::initWorkspace( EvaluationWorkspace& ws, int nDirections, int nPoints ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return ws.init( tape,nDirections,nPoints );
+}
+
+
+returnValue FunctionEvaluationTree::evaluate( double *x, double *result, EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.evaluate( x, result, ws );
+}
+
+
 returnValue FunctionEvaluationTree::evaluate( double *x, double *result, PrintLevel printL ){
 
     int run1;
@@ -294,6 +574,14 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
     int run1;
 
+    // native code does not fill the buffers of the operators, hence the
+    // evaluation point is stored for the buffered derivative routines:
+    if( tape.isNative() == BT_TRUE ){
+        tape.evaluate( x, result );
+        storeNativePoint( number, x );
+        return SUCCESSFUL_RETURN;
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
                                                              lhs_comp[run1]         ) ] );
@@ -447,7 +735,14 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    int                 nni = 0;
+
+    // intermediate states are referenced by their global index:
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType [nni];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -477,7 +772,7 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
+        implicit_dep[lhs_comp[run1]] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isDependingOn( 1, varType, component, implicit_dep ) == BT_TRUE  ){
@@ -495,12 +790,57 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getDependencyPattern( int           nVar     ,
+                                                          VariableType *varType  ,
+                                                          int          *component,
+                                                          BooleanType  *pattern     ){
+
+    int run1, run2;
+
+    // without a symbolic expression every component might depend on everything:
+    if( isSymbolic() == BT_FALSE ){
+        for( run1 = 0; run1 < dim*nVar; run1++ )
+            pattern[run1] = BT_TRUE;
+        return SUCCESSFUL_RETURN;
+    }
+
+    int nni = 0;
+
+    // intermediate states are referenced by their global index:
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType[nni];
+
+    for( run2 = 0; run2 < nVar; run2++ ){
+
+        for( run1 = 0; run1 < n; run1++ )
+            implicit_dep[lhs_comp[run1]] = sub[run1]->isDependingOn( 1, &varType[run2], &component[run2], implicit_dep );
+
+        for( run1 = 0; run1 < dim; run1++ )
+            pattern[run1*nVar+run2] = f[run1]->isDependingOn( 1, &varType[run2], &component[run2], implicit_dep );
+    }
+
+    delete[] implicit_dep;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    int                 nni = 0;
+
+    // intermediate states are referenced by their global index:
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType [nni];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -530,7 +870,7 @@ BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isLinearIn( 1, varType, component, implicit_dep );
+        implicit_dep[lhs_comp[run1]] = sub[run1]->isLinearIn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isLinearIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -553,7 +893,14 @@ BooleanType FunctionEvaluationTree::isPolynomialIn( const Expression &variable )
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    int                 nni = 0;
+
+    // intermediate states are referenced by their global index:
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType [nni];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -583,7 +930,7 @@ BooleanType FunctionEvaluationTree::isPolynomialIn( const Expression &variable )
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isPolynomialIn( 1, varType, component, implicit_dep );
+        implicit_dep[lhs_comp[run1]] = sub[run1]->isPolynomialIn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isPolynomialIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -607,7 +954,14 @@ BooleanType FunctionEvaluationTree::isRationalIn( const Expression &variable ){
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    int                 nni = 0;
+
+    // intermediate states are referenced by their global index:
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType [nni];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -637,7 +991,7 @@ BooleanType FunctionEvaluationTree::isRationalIn( const Expression &variable ){
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isRationalIn( 1, varType, component, implicit_dep );
+        implicit_dep[lhs_comp[run1]] = sub[run1]->isRationalIn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isRationalIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -737,11 +1091,40 @@ returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double
 
 
 
+returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double *ff,
+                                            double *df, EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.AD_forward( x, seed, ff, df, ws );
+}
+
+
+
+returnValue FunctionEvaluationTree::AD_forward( int nDirections, double *x, double *seed, double *ff,
+                                            double *df, EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.AD_forward( nDirections, x, seed, ff, df, ws );
+}
+
+
+
 returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *seed,
                                             double *ff, double *df  ){
 
     int run1;
 
+    if( tape.isNative() == BT_TRUE ){
+        if( tape.AD_forward( x, seed, ff, df, nativeWorkspace ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+        storeNativePoint( number, x );
+        return SUCCESSFUL_RETURN;
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -759,6 +1142,12 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
     int run1;
 
+    if( tape.isNative() == BT_TRUE ){
+        double *x = getNativePoint( number );
+        if( x == NULL ) return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+        return tape.AD_forward( x, seed, nativeF, df, nativeWorkspace );
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, seed,
                          &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
@@ -792,10 +1181,38 @@ returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
 
 
+returnValue FunctionEvaluationTree::AD_backward( double *x, double *seed, double  *df,
+                                             EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.AD_backward( x, seed, df, ws );
+}
+
+
+
+returnValue FunctionEvaluationTree::AD_backward( int point, double *seed, double  *df,
+                                             EvaluationWorkspace& ws ) const{
+
+    if( tape.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    return tape.AD_backward( point, seed, df, ws );
+}
+
+
+
 returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, double  *df ){
 
     int run1;
 
+    if( tape.isNative() == BT_TRUE ){
+        double *x = getNativePoint( number );
+        if( x == NULL ) return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+        return tape.AD_backward( x, seed, df, nativeWorkspace );
+    }
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( number, seed[run1], df );
     }
@@ -816,6 +1233,9 @@ returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
 
     int run1;
 
+    if( tape.isNative() == BT_TRUE )
+        return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward2( number, seed, dseed,
                          &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -834,6 +1254,9 @@ returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, dou
 
     int run1;
 
+    if( tape.isNative() == BT_TRUE )
+        return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
     }
@@ -1104,6 +1527,8 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
     int run1;
     int var_counter = indexList->makeImplicit(dim_);
 
+    tape.clear();
+
     for( run1 = 0; run1 < dim_; run1++ ){
 
         Operator *tmp = f[run1]->clone();
@@ -1235,6 +1660,42 @@ returnValue FunctionEvaluationTree::setAuxVariableStructName(const String& s)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void FunctionEvaluationTree::storeNativePoint( int number, const double *x ){
+
+    int run1;
+    const int nz = getNumberOfVariables()+1;
+
+    if( number < 0 ) return;
+
+    if( number >= nNativeX ){
+
+        int nNew = 2*nNativeX;
+        if( nNew <= number ) nNew = number+1;
+
+        nativeX = (double*)realloc(nativeX,nNew*nz*sizeof(double));
+        for( run1 = nNativeX*nz; run1 < nNew*nz; run1++ )
+            nativeX[run1] = 0.0;
+
+        nNativeX = nNew;
+    }
+
+    for( run1 = 0; run1 < nz; run1++ )
+        nativeX[number*nz+run1] = x[run1];
+}
+
+
+double* FunctionEvaluationTree::getNativePoint( int number ) const{
+
+    if( ( number < 0 ) || ( number >= nNativeX ) ) return NULL;
+    return &nativeX[number*(getNumberOfVariables()+1)];
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -331,6 +331,58 @@ returnValue Integrator::setForwardSeed(	const int    &order,
 }
 
 
+returnValue Integrator::setForwardSeed(	const int    &order,
+										const Matrix &xSeed,
+										const Matrix &pSeed,
+										const Matrix &uSeed,
+										const Matrix &wSeed  ){
+
+    uint run1, run2;
+    if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
+
+    int nDirs = 0;
+
+    nDirs = acadoMax( nDirs, (int)xSeed.getNumCols() );
+    nDirs = acadoMax( nDirs, (int)pSeed.getNumCols() );
+    nDirs = acadoMax( nDirs, (int)uSeed.getNumCols() );
+    nDirs = acadoMax( nDirs, (int)wSeed.getNumCols() );
+
+    // a single direction is handled by the vector-valued seed:
+    if( nDirs <= 1 ){
+
+        Vector tmpX; if( xSeed.isEmpty() == BT_FALSE ) tmpX = xSeed.getCol( 0 );
+        Vector tmpP; if( pSeed.isEmpty() == BT_FALSE ) tmpP = pSeed.getCol( 0 );
+        Vector tmpU; if( uSeed.isEmpty() == BT_FALSE ) tmpU = uSeed.getCol( 0 );
+        Vector tmpW; if( wSeed.isEmpty() == BT_FALSE ) tmpW = wSeed.getCol( 0 );
+
+        return setForwardSeed( order, tmpX, tmpP, tmpU, tmpW );
+    }
+
+    if( order != 1 )
+        return ACADOERROR( RET_INPUT_OUT_OF_RANGE );
+
+    if( canHandleMultipleForwardDirections( ) == BT_FALSE )
+        return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+    Matrix tmpX;
+    Vector components = rhs->getDifferentialStateComponents();
+
+    dP.init( 0 );
+    dU.init( 0 );
+    dW.init( 0 );
+
+    if( xSeed.isEmpty() == BT_FALSE ){
+
+        tmpX.init( components.getDim(), xSeed.getNumCols() );
+        for( run1 = 0; run1 < components.getDim(); run1++ )
+            for( run2 = 0; run2 < xSeed.getNumCols(); run2++ )
+                tmpX(run1,run2) = xSeed((int) components(run1),run2);
+    }
+
+    return setProtectedForwardSeeds( tmpX, pSeed, uSeed, wSeed );
+}
+
+
 // ======================================================================================
 
 returnValue Integrator::setBackwardSeed(	const int    &order,
@@ -354,7 +406,7 @@ returnValue Integrator::setBackwardSeed(	const int    &order,
 
 returnValue Integrator::integrateSensitivities( ){
 
-    uint run1;
+    uint run1, run2;
     returnValue returnvalue;
 
 
@@ -381,21 +433,29 @@ returnValue Integrator::integrateSensitivities( ){
     int order = 1;
     if( nFDirs2 > 0 ) order = 2;
 
-    Matrix tmp( rhs->getDim(), 1 );
+    uint nDirs = 1;
+    if( order == 1 && nFDirs > 1 ) nDirs = nFDirs;
+
+    Matrix tmp( rhs->getDim(), nDirs );
     returnvalue = getProtectedForwardSensitivities(&tmp,order);
 
     Vector components = rhs->getDifferentialStateComponents();
 
-    dX.init(rhs->getDim()-ma);
-    dX.setZero();
+    dXs.init(rhs->getDim()-ma,nDirs);
+    dXs.setZero();
 
     for( run1 = 0; run1 < components.getDim(); run1++ )
-        dX((int) components(run1)) = tmp(run1,0);
+        for( run2 = 0; run2 < nDirs; run2++ )
+            dXs((int) components(run1),run2) = tmp(run1,run2);
+
+    dX = dXs.getCol( 0 );
 
     if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
 
-    if( transition != 0 )
+    if( transition != 0 ){
         returnvalue = diffTransitionForward( dX, dP, dU, dW, order );
+        dXs.setCol( 0,dX );
+    }
 
     return returnvalue;
 }
@@ -409,6 +469,14 @@ returnValue Integrator::getForwardSensitivities(	Vector &Dx,
 }
 
 
+returnValue Integrator::getForwardSensitivities(	Matrix &Dx,
+													int order ) const{
+
+    Dx = dXs;
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Integrator::getForwardSensitivities(	VariablesGrid &Dx,
 													int order ) const{
 
@@ -460,6 +528,12 @@ BooleanType Integrator::canHandleImplicitSwitches( ) const{
 }
 
 
+BooleanType Integrator::canHandleMultipleForwardDirections( ) const{
+
+    return BT_FALSE;
+}
+
+
 BooleanType Integrator::isDifferentialEquationDefined( ) const{
 
     if ( rhs != 0 ) return BT_TRUE ;
@@ -559,6 +633,15 @@ returnValue Integrator::diffTransitionBackward( Vector &DX,
 }
 
 
+returnValue Integrator::setProtectedForwardSeeds( const Matrix &xSeed,
+                                                  const Matrix &pSeed,
+                                                  const Matrix &uSeed,
+                                                  const Matrix &wSeed  ){
+
+    return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
 
 
 returnValue Integrator::setupOptions( )
@@ -576,6 +659,7 @@ returnValue Integrator::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -592,6 +676,15 @@ void Integrator::initializeOptions(){
     get( STEPSIZE_TUNING       , tune              );
     get( INTEGRATOR_PRINTLEVEL , PrintLevel        );
     get( LINEAR_ALGEBRA_SOLVER , las               );
+
+    // compile symbolic right-hand sides into native code on request (a
+    // failed attempt is reported once, afterwards the tape is used):
+    int useNativeCode;
+    get( USE_NATIVE_CODE, useNativeCode );
+
+    if( ( useNativeCode == BT_TRUE ) && ( rhs != 0 ) )
+        if( ( rhs->isSymbolic() == BT_TRUE ) && ( rhs->isNative() == BT_FALSE ) )
+            rhs->compileNative( );
 }
 
 returnValue Integrator::setupLogging( ){
@@ -327,6 +327,8 @@ void IntegratorBDF::allocateMemory( ){
 
     time_index = rhs->index( VT_TIME, 0 );
 
+    determineJacobianStructure();
+
 
     // OTHERS:
     // -------
@@ -422,6 +424,9 @@ void IntegratorBDF::initializeVariables(){
     nOfNewtonSteps = 0;
     maxNM = 0; M = 0; M_index = 0; nOfM = 0;
 
+    nOfColors = 0; colorStart = 0; colorColumn = 0;
+    patternStart = 0; patternRow = 0;
+
     F  = 0; F2 = 0;
 
     initial_guess = 0;
@@ -670,6 +675,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     time_index = rhs->index( VT_TIME, 0 );
 
+    determineJacobianStructure();
+
 
     // OTHERS:
     // -------
@@ -923,6 +930,15 @@ void IntegratorBDF::deleteAll(){
         free(M_index);
     }
 
+    if( colorStart != NULL )
+        delete[] colorStart;
+    if( colorColumn != NULL )
+        delete[] colorColumn;
+    if( patternStart != NULL )
+        delete[] patternStart;
+    if( patternRow != NULL )
+        delete[] patternRow;
+
     if( F != NULL )
         delete[] F;
     if( F2 != NULL )
@@ -2410,34 +2426,13 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
            else{
                if( M[0] == 0 ) M[0] = new Matrix(m,m);
                M_index[stepnumber] = 0;
-               M[0]->init(m,m);
-           }
-
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
+               if( M[0]->getNumRows() != (uint)m || M[0]->getNumCols() != (uint)m )
+                   M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
-           }
+           if( evaluateIterationMatrix( 3*stepnumber+newtonsteps, 1.0, gamma[stepnumber][4],
+                                        *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
            nJacEvaluations++;
            jacComputation.stop();
@@ -2917,35 +2912,13 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
            else{
                if( M[0] == 0 ) M[0] = new Matrix(m,m);
                M_index[stepnumber] = 0;
-               M[0]->init(m,m);
-           }
-
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
+               if( M[0]->getNumRows() != (uint)m || M[0]->getNumCols() != (uint)m )
+                   M[0]->init(m,m);
            }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
 
-               iseed[diff_index[md+run1]] = 0.0;
-           }
+           if( evaluateIterationMatrix( 3*stepnumber+newtonsteps, ise, 1.0,
+                                        *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
            nJacEvaluations++;
            jacComputation.stop();
@@ -5095,6 +5068,177 @@ void IntegratorBDF::printRKIntermediateResults(){
 }
 
 
+/** Returns the component of the variable of the given type having the \n
+ *  index idx in the function f (or -1 if it does not appear in f).      \n
+ */
+static int getVariableComponent( const Function &f, VariableType type, int idx ){
+
+    int run1;
+    int n = f.getN( type );
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( f.index( type, run1 ) == idx )
+            return run1;
+
+    return -1;
+}
+
+
+void IntegratorBDF::determineJacobianStructure(){
+
+    int run1, run2, run3;
+
+
+    // SPARSITY PATTERN:
+    // -----------------
+    // column j of the iteration matrix depends on x_j and dx_j (or xa_j)
+
+    int nVar = m + md;
+
+    VariableType *varType   = new VariableType[nVar];
+    int          *component = new int         [nVar];
+    BooleanType  *pattern   = new BooleanType [m*nVar];
+
+    for( run1 = 0; run1 < md; run1++ ){
+        varType  [run1]   = VT_DIFFERENTIAL_STATE;
+        component[run1]   = getVariableComponent( *rhs, VT_DIFFERENTIAL_STATE, diff_index[run1] );
+        varType  [m+run1] = VT_DDIFFERENTIAL_STATE;
+        component[m+run1] = getVariableComponent( *rhs, VT_DDIFFERENTIAL_STATE, ddiff_index[run1] );
+    }
+    for( run1 = 0; run1 < ma; run1++ ){
+        varType  [md+run1] = VT_ALGEBRAIC_STATE;
+        component[md+run1] = getVariableComponent( *rhs, VT_ALGEBRAIC_STATE, diff_index[md+run1] );
+    }
+
+    rhs->getDependencyPattern( nVar, varType, component, pattern );
+
+    int nnz = 0;
+    for( run2 = 0; run2 < m; run2++ )
+        for( run1 = 0; run1 < m; run1++ )
+            if( pattern[run1*nVar+run2] == BT_TRUE || ( run2 < md && pattern[run1*nVar+m+run2] == BT_TRUE ) )
+                nnz++;
+
+    patternStart = new int[m+1];
+    patternRow   = new int[nnz > 0 ? nnz : 1];
+
+    nnz = 0;
+    for( run2 = 0; run2 < m; run2++ ){
+        patternStart[run2] = nnz;
+        for( run1 = 0; run1 < m; run1++ )
+            if( pattern[run1*nVar+run2] == BT_TRUE || ( run2 < md && pattern[run1*nVar+m+run2] == BT_TRUE ) )
+                patternRow[nnz++] = run1;
+    }
+    patternStart[m] = nnz;
+
+    delete[] varType  ;
+    delete[] component;
+    delete[] pattern  ;
+
+
+    // GREEDY COLUMN COLORING:
+    // -----------------------
+    // two columns may share a color only if they have no common nonzero row
+
+    int *rowStart  = new int[m+1];
+    int *rowColumn = new int[nnz > 0 ? nnz : 1];
+    int *color     = new int[m];
+    int *forbidden = new int[m];
+
+    for( run1 = 0; run1 <= m; run1++ )
+        rowStart[run1] = 0;
+    for( run1 = 0; run1 < nnz; run1++ )
+        rowStart[patternRow[run1]+1]++;
+    for( run1 = 0; run1 < m; run1++ )
+        rowStart[run1+1] += rowStart[run1];
+
+    for( run2 = 0; run2 < m; run2++ ){
+        for( run1 = patternStart[run2]; run1 < patternStart[run2+1]; run1++ )
+            rowColumn[rowStart[patternRow[run1]]++] = run2;
+    }
+    for( run1 = m; run1 > 0; run1-- )
+        rowStart[run1] = rowStart[run1-1];
+    rowStart[0] = 0;
+
+    nOfColors = 0;
+    for( run1 = 0; run1 < m; run1++ )
+        forbidden[run1] = -1;
+
+    for( run2 = 0; run2 < m; run2++ ){
+
+        for( run1 = patternStart[run2]; run1 < patternStart[run2+1]; run1++ ){
+            int row = patternRow[run1];
+            for( run3 = rowStart[row]; run3 < rowStart[row+1] && rowColumn[run3] < run2; run3++ )
+                forbidden[color[rowColumn[run3]]] = run2;
+        }
+
+        color[run2] = 0;
+        while( color[run2] < nOfColors && forbidden[color[run2]] == run2 )
+            color[run2]++;
+
+        if( color[run2] == nOfColors )
+            nOfColors++;
+    }
+
+    colorStart  = new int[nOfColors+1];
+    colorColumn = new int[m > 0 ? m : 1];
+
+    for( run1 = 0; run1 <= nOfColors; run1++ )
+        colorStart[run1] = 0;
+    for( run2 = 0; run2 < m; run2++ )
+        colorStart[color[run2]+1]++;
+    for( run1 = 0; run1 < nOfColors; run1++ )
+        colorStart[run1+1] += colorStart[run1];
+    for( run2 = 0; run2 < m; run2++ )
+        colorColumn[colorStart[color[run2]]++] = run2;
+    for( run1 = nOfColors; run1 > 0; run1-- )
+        colorStart[run1] = colorStart[run1-1];
+    colorStart[0] = 0;
+
+    delete[] rowStart ;
+    delete[] rowColumn;
+    delete[] color    ;
+    delete[] forbidden;
+}
+
+
+returnValue IntegratorBDF::evaluateIterationMatrix( int number_, double xSeed, double dxSeed, Matrix &J ){
+
+    int run1, run2, run3;
+
+    J.setZero();
+
+    for( run1 = 0; run1 < nOfColors; run1++ ){
+
+        // seed all columns of the group at once:
+        for( run2 = colorStart[run1]; run2 < colorStart[run1+1]; run2++ ){
+            int col = colorColumn[run2];
+            if( col < md ){
+                iseed[ddiff_index[col]] = dxSeed;
+                iseed[ diff_index[col]] = xSeed ;
+            }
+            else
+                iseed[ diff_index[col]] = 1.0;
+        }
+
+        if( rhs[0].AD_forward( number_, iseed, k2[0][0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+
+        // and recover the columns from the compressed derivative:
+        for( run2 = colorStart[run1]; run2 < colorStart[run1+1]; run2++ ){
+            int col = colorColumn[run2];
+            for( run3 = patternStart[col]; run3 < patternStart[col+1]; run3++ )
+                J( patternRow[run3],col ) = k2[0][0][patternRow[run3]];
+
+            if( col < md )
+                iseed[ddiff_index[col]] = 0.0;
+            iseed[diff_index[col]] = 0.0;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue IntegratorBDF::decomposeJacobian( Matrix &J ) const{
 
     switch( las ){
@@ -5116,42 +5260,42 @@ returnValue IntegratorBDF::decomposeJacobian( Matrix &J ) const{
 double IntegratorBDF::applyNewtonStep( double *etakplus1, const double *etak, const Matrix &J, const double *FFF ){
 
     int run1;
-    Vector bb(m,FFF);
-    Vector deltaX;
+    double norm = 0.0;
+
+    // solve in place, using etakplus1 as buffer for the step:
+    for( run1 = 0; run1 < m; run1++ )
+        etakplus1[run1] = FFF[run1];
 
     switch( las ){
 
-        case      HOUSEHOLDER_METHOD:  deltaX = J.solveQR      ( bb ); break;
-        case      SPARSE_LU:           deltaX = J.solveSparseLU( bb ); break;
-        default:                       deltaX.setZero          (    ); break;        
+        case      HOUSEHOLDER_METHOD:  J.solveQR      ( etakplus1 ); break;
+        case      SPARSE_LU:           J.solveSparseLU( etakplus1 ); break;
+        default:  for( run1 = 0; run1 < m; run1++ ) etakplus1[run1] = 0.0; break;
     }
 
-    for( run1 = 0; run1 < m; run1++ )
-        etakplus1[run1] = etak[run1] - deltaX(run1);
+    for( run1 = 0; run1 < m; run1++ ){
+        if( fabs( etakplus1[run1]/diff_scale(run1) ) > norm )
+            norm = fabs( etakplus1[run1]/diff_scale(run1) );
+        etakplus1[run1] = etak[run1] - etakplus1[run1];
+    }
 
-    return deltaX.getNorm( VN_LINF, diff_scale );
+    return norm;
 }
 
 
 void IntegratorBDF::applyMTranspose( double *seed1, Matrix &J, double *seed2 ){
 
     int run1;
-    Vector bb(m);
 
     for( run1 = 0; run1 < m; run1++ )
-        bb(run1) = seed1[diff_index[run1]];
-
-    Vector deltaX;
+        seed2[run1] = seed1[diff_index[run1]];
 
     switch( las ){
 
-        case      HOUSEHOLDER_METHOD:  deltaX = J.solveTransposeQR      ( bb ); break;
-        case      SPARSE_LU:           deltaX = J.solveTransposeSparseLU( bb ); break;
-        default:                       deltaX.setZero                   (    ); break;
+        case      HOUSEHOLDER_METHOD:  J.solveTransposeQR      ( seed2 ); break;
+        case      SPARSE_LU:           J.solveTransposeSparseLU( seed2 ); break;
+        default:  for( run1 = 0; run1 < m; run1++ ) seed2[run1] = 0.0; break;
     }
-
-    for( run1 = 0; run1 < m; run1++ )
-        seed2[run1] = deltaX(run1);
 }
 
 
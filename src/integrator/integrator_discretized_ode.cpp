@@ -107,6 +107,13 @@ returnValue IntegratorDiscretizedODE::init( const DifferentialEquation &rhs_ )
 
 
 
+BooleanType IntegratorDiscretizedODE::canHandleMultipleForwardDirections( ) const{
+
+    return BT_FALSE;
+}
+
+
+
 returnValue IntegratorDiscretizedODE::step(int number){
 
     // DEFINE SOME LOCAL VARIABLES:
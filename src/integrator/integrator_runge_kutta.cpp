@@ -126,6 +126,11 @@ returnValue IntegratorRK::init( const DifferentialEquation &rhs_ ){
 
     allocateMemory();
 
+    // symbolic right-hand sides are lowered into a flat tape, which is
+    // needed for propagating several forward directions at once:
+    if( rhs->isSymbolic() == BT_TRUE && rhs->isCompiled() == BT_FALSE )
+        rhs->compile( );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -139,6 +144,9 @@ void IntegratorRK::initializeVariables(){
     G = 0; etaG = 0;
     G2 = 0; G3 = 0; etaG2 = 0; etaG3 = 0;
 
+    Gv = 0; etaGv = 0; kGv = 0;
+    xN = 0; etaN = 0; kN = 0;
+
     H = 0; etaH = 0; H2 = 0; H3 = 0;
     etaH2 = 0; etaH3 = 0;
 
@@ -271,6 +279,13 @@ void IntegratorRK::allocateMemory( ){
     etaG2      = NULL;
     etaG3      = NULL;
 
+    Gv         = NULL;
+    etaGv      = NULL;
+    kGv        = NULL;
+    xN         = NULL;
+    etaN       = NULL;
+    kN         = NULL;
+
     H          = NULL;
     etaH       = NULL;
 
@@ -368,6 +383,13 @@ void IntegratorRK::deleteAll(){
     if( etaG3  != NULL )
         delete[] etaG3;
 
+    if( Gv    != NULL ) delete[] Gv   ;
+    if( etaGv != NULL ) delete[] etaGv;
+    if( kGv   != NULL ) delete[] kGv  ;
+    if( xN    != NULL ) delete[] xN   ;
+    if( etaN  != NULL ) delete[] etaN ;
+    if( kN    != NULL ) delete[] kN   ;
+
 
     // ----------------------------------------
 
@@ -581,6 +603,13 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     etaG2      = NULL;
     etaG3      = NULL;
 
+    Gv         = NULL;
+    etaGv      = NULL;
+    kGv        = NULL;
+    xN         = NULL;
+    etaN       = NULL;
+    kN         = NULL;
+
     H          = NULL;
     etaH       = NULL;
 
@@ -658,6 +687,10 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
     if( xa.getDim() != 0 )
         ACADOWARNING(RET_RK45_CAN_NOT_TREAT_DAE);
 
+    // multiple forward directions are only propagated by evaluateSensitivities():
+    if( nFDirs > 1 )
+        nFDirs = 0;
+
 
     Integrator::initializeOptions();
 
@@ -907,6 +940,76 @@ returnValue IntegratorRK::setProtectedForwardSeed( const Vector &xSeed,
 }
 
 
+returnValue IntegratorRK::setProtectedForwardSeeds( const Matrix &xSeed,
+                                                    const Matrix &pSeed,
+                                                    const Matrix &uSeed,
+                                                    const Matrix &wSeed  ){
+
+    if( nBDirs > 0 ){
+        return ACADOERROR(RET_INPUT_OUT_OF_RANGE);
+    }
+
+    if( rhs->isCompiled() == BT_FALSE ){
+        return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    }
+
+    int run1, run2;
+    int nd = 0;
+
+    nd = acadoMax( nd, (int) xSeed.getNumCols() );
+    nd = acadoMax( nd, (int) pSeed.getNumCols() );
+    nd = acadoMax( nd, (int) uSeed.getNumCols() );
+    nd = acadoMax( nd, (int) wSeed.getNumCols() );
+
+    const int nv = rhs->getNumberOfVariables()+1+m;
+
+    if( Gv    != NULL ) delete[] Gv   ;
+    if( etaGv != NULL ) delete[] etaGv;
+    if( kGv   != NULL ) delete[] kGv  ;
+    if( xN    != NULL ) delete[] xN   ;
+    if( etaN  != NULL ) delete[] etaN ;
+    if( kN    != NULL ) delete[] kN   ;
+
+    nFDirs = nd;
+
+    // the derivatives of all directions are stored contiguously:
+    Gv    = new double[nv*nd  ];
+    etaGv = new double[m*nd   ];
+    kGv   = new double[dim*m*nd];
+    xN    = new double[nv     ];
+    etaN  = new double[m      ];
+    kN    = new double[dim*m  ];
+
+    for( run1 = 0; run1 < nv*nd; run1++ )
+        Gv[run1] = 0.0;
+
+    fseeds.init( m,nd );
+    fseeds.setZero();
+
+    if( xSeed.isEmpty() == BT_FALSE )
+        for( run1 = 0; run1 < m; run1++ )
+            for( run2 = 0; run2 < nd; run2++ )
+                fseeds(run1,run2) = xSeed(run1,run2);
+
+    if( pSeed.isEmpty() == BT_FALSE )
+        for( run1 = 0; run1 < mp; run1++ )
+            for( run2 = 0; run2 < nd; run2++ )
+                Gv[parameter_index[run1]*nd+run2] = pSeed(run1,run2);
+
+    if( uSeed.isEmpty() == BT_FALSE )
+        for( run1 = 0; run1 < mu; run1++ )
+            for( run2 = 0; run2 < nd; run2++ )
+                Gv[control_index[run1]*nd+run2] = uSeed(run1,run2);
+
+    if( wSeed.isEmpty() == BT_FALSE )
+        for( run1 = 0; run1 < mw; run1++ )
+            for( run2 = 0; run2 < nd; run2++ )
+                Gv[disturbance_index[run1]*nd+run2] = wSeed(run1,run2);
+
+    return rhs->initWorkspace( rhsWorkspace,nd );
+}
+
+
 returnValue IntegratorRK::setForwardSeed2( const Vector &xSeed ,
                                            const Vector &pSeed ,
                                            const Vector &uSeed ,
@@ -1086,6 +1189,10 @@ returnValue IntegratorRK::evaluateSensitivities(){
         return ACADOERROR(RET_NOT_FROZEN);
     }
 
+    if( nFDirs > 1 ){
+        return determineEtaGForwardAll();
+    }
+
 
     if( nFDirs != 0 ){
         t = timeInterval.getFirstTime();
@@ -1475,12 +1582,19 @@ returnValue IntegratorRK::getProtectedX( Vector *xEnd ) const{
 
 returnValue IntegratorRK::getProtectedForwardSensitivities( Matrix *Dx, int order ) const{
 
-    int run1;
+    int run1, run2;
 
     if( Dx == NULL ){
         return SUCCESSFUL_RETURN;
     }
 
+    if( order == 1 && nFDirs > 1 ){
+        for( run1 = 0; run1 < m; run1++ )
+            for( run2 = 0; run2 < nFDirs; run2++ )
+                Dx[0](run1,run2) = etaGv[run1*nFDirs+run2];
+        return SUCCESSFUL_RETURN;
+    }
+
     if( order == 1 && nFDirs2 == 0 ){
         for( run1 = 0; run1 < m; run1++ ){
             Dx[0](run1,0) = etaG[run1];
@@ -1613,6 +1727,13 @@ double IntegratorRK::getStepSize() const{
 }
 
 
+BooleanType IntegratorRK::canHandleMultipleForwardDirections( ) const{
+
+    if( rhs == 0 || transition != 0 ) return BT_FALSE;
+    return rhs->isCompiled( );
+}
+
+
 returnValue IntegratorRK::setDxInitialization( double *dx0 ){
 
     return SUCCESSFUL_RETURN;
@@ -1641,7 +1762,7 @@ double IntegratorRK::determineEta45(){
            }
            functionEvaluation.start();
 
-           if( rhs[0].evaluate( 0, x, k[run1] ) != SUCCESSFUL_RETURN ){
+           if( rhs[0].evaluate( x, k[run1] ) != SUCCESSFUL_RETURN ){
                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
                return -1.0;
            }
@@ -1777,6 +1898,95 @@ void IntegratorRK::determineEtaGForward( int number_ ){
 
 
 
+returnValue IntegratorRK::determineEtaGForwardAll( ){
+
+    int run1, run2, run3, run4;
+
+    const int nd = nFDirs;
+    const int nv = rhs->getNumberOfVariables()+1+m;
+
+    // restart from the initial value; parameters, controls
+    // and disturbances are taken from the nominal run:
+    for( run1 = 0; run1 < nv; run1++ )
+        xN[run1] = x[run1];
+
+    for( run1 = 0; run1 < m; run1++ ){
+        etaN[run1] = xStore(0,run1);
+        for( run4 = 0; run4 < nd; run4++ )
+            etaGv[run1*nd+run4] = fseeds(run1,run4);
+    }
+
+    // the sensitivities are only available at the end of the interval:
+    dxStore.init();
+
+    t     = timeInterval.getFirstTime();
+    count = 1;
+
+    while( count <= maxNumberOfSteps ){
+
+        const double hh = h[count];
+
+        // determine the nominal stages and their derivatives:
+        // ---------------------------------------------------
+        for( run1 = 0; run1 < dim; run1++ ){
+
+            xN[time_index] = t + c[run1]*hh;
+
+            for( run2 = 0; run2 < m; run2++ ){
+
+                double       *g  = Gv    + diff_index[run2]*nd;
+                const double *eG = etaGv + run2*nd;
+
+                xN[diff_index[run2]] = etaN[run2];
+                for( run4 = 0; run4 < nd; run4++ )
+                    g[run4] = eG[run4];
+
+                for( run3 = 0; run3 < run1; run3++ ){
+
+                    const double  a  = A[run1][run3]*hh;
+                    const double *kG = kGv + (run3*m+run2)*nd;
+
+                    xN[diff_index[run2]] = xN[diff_index[run2]] + a*kN[run3*m+run2];
+                    for( run4 = 0; run4 < nd; run4++ )
+                        g[run4] = g[run4] + a*kG[run4];
+                }
+            }
+
+            if( rhs->AD_forward( nd, xN, Gv, &kN[run1*m], &kGv[run1*m*nd], rhsWorkspace ) != SUCCESSFUL_RETURN )
+                return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+        }
+
+        // determine etaN and etaG:
+        // ------------------------
+        for( run1 = 0; run1 < dim; run1++ ){
+
+            const double bh = b4[run1]*hh;
+
+            for( run2 = 0; run2 < m; run2++ ){
+
+                double       *eG = etaGv + run2*nd;
+                const double *kG = kGv   + (run1*m+run2)*nd;
+
+                etaN[run2] = etaN[run2] + bh*kN[run1*m+run2];
+                for( run4 = 0; run4 < nd; run4++ )
+                    eG[run4] = eG[run4] + bh*kG[run4];
+            }
+        }
+
+        t = t + hh;
+        count++;
+
+        if( t >= timeInterval.getLastTime() - EPS )
+            return SUCCESSFUL_RETURN;
+    }
+
+    if( PrintLevel != NONE )
+        return ACADOERROR(RET_MAX_NUMBER_OF_STEPS_EXCEEDED);
+
+    return RET_MAX_NUMBER_OF_STEPS_EXCEEDED;
+}
+
+
 void IntegratorRK::determineEtaGForward2( int number_ ){
 
     int run1, run2, run3;
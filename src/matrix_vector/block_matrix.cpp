@@ -387,6 +387,7 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
     uint newNumRows = getNumRows( );
     uint newNumCols = arg.getNumCols( );
     BlockMatrix result( newNumRows,newNumCols );
+    Matrix product;
 
     for( i=0; i<newNumRows; ++i ){
         for( k=0; k<getNumCols( ); ++k ){
@@ -399,9 +400,11 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
 
                         if( arg.types[k][j] == SBMT_DENSE ){
 
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k] * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[i][k] * arg.elements[k][j];
+                            if( result.types[i][j] != SBMT_ZERO ){
+                                  multiplyInto( product, elements[i][k], arg.elements[k][j] );
+                                  result.elements[i][j] += product;
+                            }
+                            else  multiplyInto( result.elements[i][j], elements[i][k], arg.elements[k][j] );
                         }
 
                         if( arg.types[k][j] == SBMT_ONE ){
@@ -467,6 +470,7 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
 	uint newNumRows = getNumCols( );
 	uint newNumCols = arg.getNumCols( );
 	BlockMatrix result( newNumRows,newNumCols );
+	Matrix product;
 
     for( i=0; i<newNumRows; ++i ){
         for( k=0; k<getNumRows( ); ++k ){
@@ -478,9 +482,11 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
                     for( j=0; j<newNumCols; ++j ){
 
                         if( arg.types[k][j] == SBMT_DENSE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i]^arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[k][i]^arg.elements[k][j];
+                            if( result.types[i][j] != SBMT_ZERO ){
+                                  multiplyTransposeInto( product, elements[k][i], arg.elements[k][j] );
+                                  result.elements[i][j] += product;
+                            }
+                            else  multiplyTransposeInto( result.elements[i][j], elements[k][i], arg.elements[k][j] );
                         }
 
                         if( arg.types[k][j] == SBMT_ONE ){
@@ -71,8 +71,8 @@ Matrix::Matrix( uint _nRows, uint _nCols, const double* const _values ) : Vector
 
 Matrix::Matrix( FILE *file ) : VectorspaceElement( )
 {
-	operator=( file );
 	solver = 0;
+	operator=( file );
 }
 
 
@@ -220,6 +220,9 @@ returnValue Matrix::init( uint _nRows, uint _nCols ){
 	VectorspaceElement::init( _nRows*_nCols );
 	nRows = _nRows;
 	nCols = _nCols;
+
+	if( solver != 0 )
+		delete solver;
 	solver = 0;
 
 	return SUCCESSFUL_RETURN;
@@ -232,6 +235,9 @@ returnValue Matrix::init( uint _nRows, uint _nCols, double* _values )
 	VectorspaceElement::init( _nRows*_nCols,_values );
 	nRows = _nRows;
 	nCols = _nCols;
+
+	if( solver != 0 )
+		delete solver;
 	solver = 0;
 
 	return SUCCESSFUL_RETURN;
@@ -1014,202 +1020,253 @@ returnValue Matrix::computeQRdecomposition(){
     double r    ;
     double h_s  ;
     double kappa;
-    double ll   ;
     double ttt  ;
     int nnn = getNumRows();
-    Matrix ddd(1,nnn);
+
+    // the decomposition is computed in the storage of the result, whose
+    // last row takes the diagonal of R. Before the diagonal entry of a
+    // column is needed, the entries to its right serve as workspace for
+    // the inner products of the Householder vector with the columns.
+    // Allocating the result is the only allocation per call (it replaces
+    // the storage of the matrix, which is one row too short):
+    double *a  = new double[(nnn+1)*nnn];
+    double *ll = a + nnn*nnn;
+
+    for(run1 = 0; run1 < nnn*nnn; run1++)
+        a[run1] = element[run1];
 
     for(run2 = 0; run2 < nnn; run2++){
         r = 0.0;
         for(run1 = run2; run1 < nnn; run1++){
-            r = r + operator()(run1,run2) * operator()(run1,run2);
+            r = r + a[run1*nnn+run2] * a[run1*nnn+run2];
         }
-        if( r < EPS )
+        if( r < EPS ){
+            delete[] a;
             return ACADOERROR(RET_DIV_BY_ZERO);
-        if( operator()(run2,run2) < 0.0 ){
-            h_s         = sqrt(r);
-            ddd(0,run2) = h_s      ;
+        }
+        if( a[run2*nnn+run2] < 0.0 ){
+            h_s      = sqrt(r);
+            ll[run2] = h_s     ;
         }
         else{
-            h_s         = -sqrt(r);
-            ddd(0,run2) = h_s     ;
+            h_s      = -sqrt(r);
+            ll[run2] = h_s     ;
         }
-        ttt = h_s * operator()(run2,run2) - r;
+        ttt = h_s * a[run2*nnn+run2] - r;
         kappa = 1.0/ttt;
-        operator()(run2,run2) -= h_s;
-        for(run3 = run2+1; run3 < nnn; run3++){
-            ll = 0;
-            for(run1 = run2; run1 < nnn; run1++)
-                ll += operator()(run1,run2) * operator()(run1,run3);
-            ll = kappa * ll;
-            for(run1 = run2; run1 < nnn; run1++)
-                operator()(run1,run3) = operator()(run1,run3) + operator()(run1,run2) * ll;
+        a[run2*nnn+run2] -= h_s;
+
+        // compute the inner products of the Householder vector with all
+        // remaining columns row by row (i.e. along contiguous memory):
+        for(run3 = run2+1; run3 < nnn; run3++)
+            ll[run3] = 0.0;
+
+        for(run1 = run2; run1 < nnn; run1++){
+            const double  v   = a[run1*nnn+run2];
+            const double *row = a + run1*nnn;
+            for(run3 = run2+1; run3 < nnn; run3++)
+                ll[run3] += v * row[run3];
+        }
+
+        for(run3 = run2+1; run3 < nnn; run3++)
+            ll[run3] = kappa * ll[run3];
+
+        for(run1 = run2; run1 < nnn; run1++){
+            const double  v   = a[run1*nnn+run2];
+            double       *row = a + run1*nnn;
+            for(run3 = run2+1; run3 < nnn; run3++)
+                row[run3] = row[run3] + v * ll[run3];
         }
     }
-    appendRows(ddd);
+
+    delete[] element;
+    element = a;
+    dim     = (nnn+1)*nnn;
+    nRows   = nnn+1;
+
     return SUCCESSFUL_RETURN;
 }
 
 
 Vector Matrix::solveQR( const Vector &b ) const{
 
-    int run1, run2;
-    double dotp, vv, cc;
-    const int m = getNumCols();
+    ASSERT( b.getDim() == getNumCols() );
+
     Vector x(b);
+    solveQR( x.getDoublePointer() );
+
+    return x;
+}
+
+
+Vector Matrix::solveTransposeQR( const Vector &b ) const{
 
     ASSERT( b.getDim() == getNumCols() );
 
+    Vector x(b);
+    solveTransposeQR( x.getDoublePointer() );
+
+    return x;
+}
+
+
+returnValue Matrix::solveQR( double *x ) const{
+
+    int run1, run2;
+    double dotp, vv, cc;
+    const int m = getNumCols();
+    const double *a = element;
+
     for( run1 = 0; run1 < m; run1++ ){
 
         dotp = 0.0;
         vv   = 0.0;
         for( run2 = run1; run2 < m; run2++ ){
-            vv   = vv   + operator()(run2,run1)*operator()(run2,run1);
-            dotp = dotp + operator()(run2,run1)*x(run2);
+            vv   = vv   + a[run2*m+run1]*a[run2*m+run1];
+            dotp = dotp + a[run2*m+run1]*x[run2];
         }
 
         cc = 2.0*dotp/vv;
 
         for( run2 = run1; run2 < m; run2++ ){
-            x(run2) -= cc*operator()(run2,run1);
+            x[run2] -= cc*a[run2*m+run1];
         }
     }
 
-    for( run1 = m-1; run1 >= 0; run1-- ){
-        for( run2 = run1+1; run2 < m; run2++ ){
-            x(run1) -= operator()(run1,run2)*x(run2);
-        }
-        x(run1) /= operator()(m,run1);
-    }
-    return x;
+    acadoSolveUpperTriangular( m, 1, a, a+m*m, x );
+
+    return SUCCESSFUL_RETURN;
 }
 
-Vector Matrix::solveTransposeQR( const Vector &b ) const{
+
+returnValue Matrix::solveTransposeQR( double *x ) const{
 
     int run1, run2;
     double dotp, vv, cc;
     const int m = getNumCols();
-    Vector x(b);
+    const double *a = element;
 
-    ASSERT( b.getDim() == getNumCols() );
+    acadoSolveTransposeUpperTriangular( m, 1, a, a+m*m, x );
 
-    for( run1 = 0; run1 < m; run1++ ){
-        x(run1) = b(run1);
-        for( run2 = 0; run2 < run1; run2++ ){
-            x(run1) -= operator()(run2,run1)*x(run2);
-        }
-        x(run1) /= operator()(m,run1);
-    }
     for( run1 = m-1; run1 >= 0; run1-- ){
         dotp = 0.0;
         vv   = 0.0;
         for( run2 = run1; run2 < m; run2++ ){
-            vv   = vv   + operator()(run2,run1)*operator()(run2,run1);
-            dotp = dotp + operator()(run2,run1)*x(run2);
+            vv   = vv   + a[run2*m+run1]*a[run2*m+run1];
+            dotp = dotp + a[run2*m+run1]*x[run2];
         }
         cc = 2.0*dotp/vv;
         for( run2 = run1; run2 < m; run2++ ){
-            x(run2) -= cc*operator()(run2,run1);
+            x[run2] -= cc*a[run2*m+run1];
         }
     }
-    return x;
+    return SUCCESSFUL_RETURN;
 }
 
 
 returnValue Matrix::computeSparseLUdecomposition(){
 
-    ASSERT( solver == 0 );
     ASSERT( getNumRows() == getNumCols() );
 
-    solver = new ACADOcsparse();
+    if( solver == 0 )
+        solver = new ACADOcsparse();
 
-    int run1,run2;
-    double ZERO_TOL = 1.e-12;
-    const int n = getNumRows();
+    return solver->setDenseMatrix( getNumRows(), element );
+}
 
-    double *A    = new double[dim];
-    int    *idx1 = new int   [dim];
-    int    *idx2 = new int   [dim];
 
-    int nDense = 0;
+Vector Matrix::solveSparseLU( const Vector &b ) const{
 
-    for( run1 = 0; run1 < n; run1++ ){
-        for( run2 = 0; run2 < n; run2++ ){
-            if( fabs( operator()(run1,run2) ) > ZERO_TOL ){
-                A  [nDense]  = operator()(run1,run2);
-                idx1[nDense] = run1;
-                idx2[nDense] = run2;
-                nDense++;
-            }
-        }
-    }
+    Vector x( b );
+    solveSparseLU( x.getDoublePointer() );
 
-    solver->setDimension      ( n          );
-    solver->setNumberOfEntries( nDense     );
-    solver->setIndices        ( idx1, idx2 );
-    solver->setMatrix         ( A          );
+    return x;
+}
 
-    delete[] A;
-    delete[] idx1;
-    delete[] idx2;
 
-    return SUCCESSFUL_RETURN;
+Vector Matrix::solveTransposeSparseLU( const Vector &b ) const{
+
+    Vector x( b );
+    solveTransposeSparseLU( x.getDoublePointer() );
+
+    return x;
 }
 
 
-Vector Matrix::solveSparseLU( const Vector &b ) const{
+returnValue Matrix::solveSparseLU( double *b ) const{
+
+    ASSERT( solver != 0 );
+
+    return solver->solve( b );
+}
+
+
+returnValue Matrix::solveTransposeSparseLU( double *b ) const{
 
     ASSERT( solver != 0 );
 
-    int run1;
-    const int n = getNumRows();
+    return solver->solveTranspose( b );
+}
 
-    double *bb = new double[n];
-    double *xx = new double[n];
 
-    Vector x(n);
 
-    for( run1 = 0; run1 < n; run1++ )
-        bb[run1] = b(run1);
+returnValue multiplyInto( Matrix& C, const Matrix& A, const Matrix& B ){
 
-    solver->solve( bb );
-    solver->getX ( xx );
+    if( A.getNumCols() != B.getNumRows() )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
-    for( run1 = 0; run1 < n; run1++ )
-        x(run1) = xx[run1];
+    if( C.getNumRows() != A.getNumRows() || C.getNumCols() != B.getNumCols() )
+        C.init( A.getNumRows(), B.getNumCols() );
 
-    delete[] bb;
-    delete[] xx;
+    acadoMultiply( A.getNumRows(), B.getNumCols(), A.getNumCols(),
+                   A.getDoublePointer(), B.getDoublePointer(), C.getDoublePointer() );
 
-    return x;
+    return SUCCESSFUL_RETURN;
 }
 
-Vector Matrix::solveTransposeSparseLU( const Vector &b ) const{
 
-    ASSERT( solver != 0 );
+returnValue multiplyTransposeInto( Matrix& C, const Matrix& A, const Matrix& B ){
 
-    int run1;
-    const int n = getNumRows();
+    if( A.getNumRows() != B.getNumRows() )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
-    double *bb = new double[n];
-    double *xx = new double[n];
+    if( C.getNumRows() != A.getNumCols() || C.getNumCols() != B.getNumCols() )
+        C.init( A.getNumCols(), B.getNumCols() );
 
-    Vector x(n);
+    acadoMultiplyTranspose( A.getNumCols(), B.getNumCols(), A.getNumRows(),
+                            A.getDoublePointer(), B.getDoublePointer(), C.getDoublePointer() );
 
-    for( run1 = 0; run1 < n; run1++ )
-        bb[run1] = b(run1);
+    return SUCCESSFUL_RETURN;
+}
 
-    solver->solveTranspose( bb );
-    solver->getX          ( xx );
 
-    for( run1 = 0; run1 < n; run1++ )
-        x(run1) = xx[run1];
+returnValue multiplyInto( Vector& y, const Matrix& A, const Vector& x ){
 
-    delete[] bb;
-    delete[] xx;
+    if( A.getNumCols() != x.getDim() )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
-    return x;
+    if( y.getDim() != A.getNumRows() )
+        y.init( A.getNumRows() );
+
+    acadoMultiplyVector( A.getNumRows(), A.getNumCols(),
+                         A.getDoublePointer(), x.getDoublePointer(), y.getDoublePointer() );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue multiplyTransposeInto( Vector& y, const Matrix& A, const Vector& x ){
+
+    if( A.getNumRows() != x.getDim() )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    if( y.getDim() != A.getNumCols() )
+        y.init( A.getNumCols() );
+
+    acadoMultiplyTransposeVector( A.getNumRows(), A.getNumCols(),
+                                  A.getDoublePointer(), x.getDoublePointer(), y.getDoublePointer() );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -0,0 +1,314 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/matrix_kernels.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ */
+
+
+#include <acado/matrix_vector/matrix_kernels.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/* Block sizes: a KB x NB panel of B (256 kB) stays in the L2 cache while four
+ * rows of C are updated. */
+const uint ACADO_KERNEL_KB = 128;
+const uint ACADO_KERNEL_NB = 256;
+
+
+/* Adds the contribution of the rows k0 <= kk < k1 of B to the columns
+ * j0 <= j < j1 of C; the coefficients of row i of C are a[i*lda + kk*ldk]. */
+static void acadoMultiplyPanel(	uint m,
+								uint n,
+								uint j0,
+								uint j1,
+								uint k0,
+								uint k1,
+								const double* A,
+								uint lda,
+								uint ldk,
+								const double* B,
+								double* C
+								)
+{
+	uint i, j, kk;
+
+	for( i=0; i+4<=m; i+=4 )
+	{
+		double* c0 = C + (i  )*n;
+		double* c1 = C + (i+1)*n;
+		double* c2 = C + (i+2)*n;
+		double* c3 = C + (i+3)*n;
+
+		for( kk=k0; kk<k1; ++kk )
+		{
+			const double a0 = A[(i  )*lda + kk*ldk];
+			const double a1 = A[(i+1)*lda + kk*ldk];
+			const double a2 = A[(i+2)*lda + kk*ldk];
+			const double a3 = A[(i+3)*lda + kk*ldk];
+			const double* b = B + kk*n;
+
+			for( j=j0; j<j1; ++j )
+			{
+				const double bj = b[j];
+				c0[j] += a0 * bj;
+				c1[j] += a1 * bj;
+				c2[j] += a2 * bj;
+				c3[j] += a3 * bj;
+			}
+		}
+	}
+
+	for( ; i<m; ++i )
+	{
+		double* c0 = C + i*n;
+
+		for( kk=k0; kk<k1; ++kk )
+		{
+			const double a0 = A[i*lda + kk*ldk];
+			const double* b = B + kk*n;
+
+			for( j=j0; j<j1; ++j )
+				c0[j] += a0 * b[j];
+		}
+	}
+}
+
+
+static void acadoMultiplyBlocked(	uint m,
+									uint n,
+									uint k,
+									const double* A,
+									uint lda,
+									uint ldk,
+									const double* B,
+									double* C
+									)
+{
+	uint i, j0, j1, k0, k1;
+
+	for( i=0; i<m*n; ++i )
+		C[i] = 0.0;
+
+	for( j0=0; j0<n; j0=j1 )
+	{
+		j1 = ( j0+ACADO_KERNEL_NB < n ) ? j0+ACADO_KERNEL_NB : n;
+
+		for( k0=0; k0<k; k0=k1 )
+		{
+			k1 = ( k0+ACADO_KERNEL_KB < k ) ? k0+ACADO_KERNEL_KB : k;
+			acadoMultiplyPanel( m,n, j0,j1, k0,k1, A,lda,ldk, B,C );
+		}
+	}
+}
+
+
+void acadoMultiply(	uint m,
+					uint n,
+					uint k,
+					const double* A,
+					const double* B,
+					double* C
+					)
+{
+	acadoMultiplyBlocked( m,n,k, A,k,1, B,C );
+}
+
+
+void acadoMultiplyTranspose(	uint m,
+								uint n,
+								uint k,
+								const double* A,
+								const double* B,
+								double* C
+								)
+{
+	acadoMultiplyBlocked( m,n,k, A,1,m, B,C );
+}
+
+
+void acadoMultiplyVector(	uint m,
+							uint n,
+							const double* A,
+							const double* x,
+							double* y
+							)
+{
+	uint i, j;
+
+	for( i=0; i+4<=m; i+=4 )
+	{
+		const double* a0 = A + (i  )*n;
+		const double* a1 = A + (i+1)*n;
+		const double* a2 = A + (i+2)*n;
+		const double* a3 = A + (i+3)*n;
+
+		double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+		for( j=0; j<n; ++j )
+		{
+			const double xj = x[j];
+			s0 += a0[j] * xj;
+			s1 += a1[j] * xj;
+			s2 += a2[j] * xj;
+			s3 += a3[j] * xj;
+		}
+
+		y[i  ] = s0;
+		y[i+1] = s1;
+		y[i+2] = s2;
+		y[i+3] = s3;
+	}
+
+	for( ; i<m; ++i )
+	{
+		const double* a0 = A + i*n;
+		double s0 = 0.0;
+
+		for( j=0; j<n; ++j )
+			s0 += a0[j] * x[j];
+
+		y[i] = s0;
+	}
+}
+
+
+void acadoMultiplyTransposeVector(	uint m,
+									uint n,
+									const double* A,
+									const double* x,
+									double* y
+									)
+{
+	uint i, j;
+
+	for( i=0; i<n; ++i )
+		y[i] = 0.0;
+
+	for( j=0; j+4<=m; j+=4 )
+	{
+		const double* a0 = A + (j  )*n;
+		const double* a1 = A + (j+1)*n;
+		const double* a2 = A + (j+2)*n;
+		const double* a3 = A + (j+3)*n;
+
+		const double x0 = x[j  ];
+		const double x1 = x[j+1];
+		const double x2 = x[j+2];
+		const double x3 = x[j+3];
+
+		for( i=0; i<n; ++i )
+		{
+			double yi = y[i];
+			yi += a0[i] * x0;
+			yi += a1[i] * x1;
+			yi += a2[i] * x2;
+			yi += a3[i] * x3;
+			y[i] = yi;
+		}
+	}
+
+	for( ; j<m; ++j )
+	{
+		const double* a0 = A + j*n;
+		const double x0 = x[j];
+
+		for( i=0; i<n; ++i )
+			y[i] += a0[i] * x0;
+	}
+}
+
+
+void acadoSolveUpperTriangular(	uint n,
+								uint nrhs,
+								const double* R,
+								const double* diag,
+								double* X
+								)
+{
+	uint i, j, k;
+
+	/* backward substitution, row by row of R */
+	for( i=n; i>0; --i )
+	{
+		const double* r  = R + (i-1)*n;
+		double*       xi = X + (i-1)*nrhs;
+
+		for( j=i; j<n; ++j )
+		{
+			const double  rij = r[j];
+			const double* xj  = X + j*nrhs;
+
+			for( k=0; k<nrhs; ++k )
+				xi[k] -= rij * xj[k];
+		}
+
+		for( k=0; k<nrhs; ++k )
+			xi[k] /= diag[i-1];
+	}
+}
+
+
+void acadoSolveTransposeUpperTriangular(	uint n,
+											uint nrhs,
+											const double* R,
+											const double* diag,
+											double* X
+											)
+{
+	uint i, j, k;
+
+	/* forward substitution; once a row of X is known, it is eliminated
+	 * from all subsequent rows along the contiguous row j of R (which
+	 * subtracts the same terms in the same order as a column-wise sweep) */
+	for( j=0; j<n; ++j )
+	{
+		const double* r  = R + j*n;
+		double*       xj = X + j*nrhs;
+
+		for( k=0; k<nrhs; ++k )
+			xj[k] /= diag[j];
+
+		for( i=j+1; i<n; ++i )
+		{
+			const double rji = r[i];
+			double*      xi  = X + i*nrhs;
+
+			for( k=0; k<nrhs; ++k )
+				xi[k] -= rji * xj[k];
+		}
+	}
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
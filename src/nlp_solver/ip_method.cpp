@@ -0,0 +1,181 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/nlp_solver/ip_method.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ */
+
+
+#include <acado/nlp_solver/ip_method.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Barrier parameter of the first iteration. */
+static const double IP_INITIAL_BARRIER = 0.1;
+
+/** Barrier parameters below this fraction of the KKT tolerance are set to zero. */
+static const double IP_MIN_BARRIER_FACTOR = 0.01;
+
+/** The barrier parameter is reduced once the KKT tolerance of the barrier
+ *  subproblem is below this multiple of it. */
+static const double IP_BARRIER_TOLERANCE_FACTOR = 10.0;
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+IPmethod::IPmethod( ) : SCPmethod( )
+{
+	barrierParameter = IP_INITIAL_BARRIER;
+}
+
+
+IPmethod::IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_          ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP
+					) : SCPmethod( _userInteraction,objective_,dynamic_discretization_,constraint_,_isCP )
+{
+	barrierParameter = IP_INITIAL_BARRIER;
+}
+
+
+IPmethod::IPmethod( const IPmethod& rhs ) : SCPmethod( rhs )
+{
+	barrierParameter = rhs.barrierParameter;
+}
+
+
+IPmethod::~IPmethod( )
+{
+}
+
+
+IPmethod& IPmethod::operator=( const IPmethod& rhs )
+{
+	if ( this != &rhs )
+	{
+		SCPmethod::operator=( rhs );
+
+		barrierParameter = rhs.barrierParameter;
+    }
+	return *this;
+}
+
+
+NLPsolver* IPmethod::clone( ) const
+{
+	return new IPmethod( *this );
+}
+
+
+
+returnValue IPmethod::init(	VariablesGrid* x_init ,
+							VariablesGrid* xa_init,
+							VariablesGrid* p_init ,
+							VariablesGrid* u_init ,
+							VariablesGrid* w_init   )
+{
+	// the barrier subproblems are solved on the sparse KKT system
+	int sparseQPsolution;
+	get( SPARSE_QP_SOLUTION,sparseQPsolution );
+
+	if ( (SparseQPsolutionMethods)sparseQPsolution != SPARSE_SOLVER )
+		return ACADOERROR( RET_INVALID_OPTION );
+
+	returnValue returnvalue = SCPmethod::init( x_init,xa_init,p_init,u_init,w_init );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	barrierParameter = IP_INITIAL_BARRIER;
+
+	return bandedCPsolver->setBarrierParameter( barrierParameter );
+}
+
+
+returnValue IPmethod::performCurrentStep( )
+{
+	returnValue returnvalue = SCPmethod::performCurrentStep( );
+
+	if ( returnvalue == CONVERGENCE_NOT_YET_ACHIEVED )
+		updateBarrierParameter( );
+
+	return returnvalue;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue IPmethod::checkForConvergence( )
+{
+	if ( barrierParameter > 0.0 )
+		return CONVERGENCE_NOT_YET_ACHIEVED;
+
+	return SCPmethod::checkForConvergence( );
+}
+
+
+returnValue IPmethod::updateBarrierParameter( )
+{
+	if ( bandedCPsolver == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	double kappa, tol, KKTmultiplierRegularisation;
+	get( CONIC_SOLVER_BARRIER_TUNING,kappa );
+	get( KKT_TOLERANCE,tol );
+	get( KKT_TOLERANCE_SAFEGUARD,KKTmultiplierRegularisation );
+
+	if ( ( kappa <= 0.0 ) || ( kappa >= 1.0 ) )
+		kappa = defaultConicSolverBarrierTuning;
+
+	// keep the barrier parameter until its subproblem is solved accurately enough
+	if ( eval->getKKTtolerance( iter,bandedCP,KKTmultiplierRegularisation ) > IP_BARRIER_TOLERANCE_FACTOR*barrierParameter )
+		return SUCCESSFUL_RETURN;
+
+	// linear decrease far from the solution, superlinear close to it
+	barrierParameter = acadoMin( kappa*barrierParameter, pow( barrierParameter,1.5 ) );
+
+	if ( barrierParameter < IP_MIN_BARRIER_FACTOR*tol )
+		barrierParameter = 0.0;
+
+	return bandedCPsolver->setBarrierParameter( barrierParameter );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -235,8 +235,11 @@ returnValue NLPsolver::setupOptions( )
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
+	addOption( REDUCE_FEEDBACK_ALLOCATIONS , defaultReduceFeedbackAllocations );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
+	addOption( NLP_SOLUTION                , defaultNLPsolution             );
+	addOption( CONIC_SOLVER_BARRIER_TUNING , defaultConicSolverBarrierTuning );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
@@ -114,6 +114,9 @@ SCPmethod::SCPmethod( const SCPmethod& rhs ) : NLPsolver( rhs )
 	hasPerformedStep = rhs.hasPerformedStep;
 	isInRealTimeMode = rhs.isInRealTimeMode;
 	needToReevaluate = rhs.needToReevaluate;
+
+	deltaX0 = rhs.deltaX0;
+	deltaP0 = rhs.deltaP0;
 }
 
 
@@ -178,6 +181,9 @@ SCPmethod& SCPmethod::operator=( const SCPmethod& rhs ){
 		hasPerformedStep = rhs.hasPerformedStep;
 		isInRealTimeMode = rhs.isInRealTimeMode;
 		needToReevaluate = rhs.needToReevaluate;
+
+		deltaX0 = rhs.deltaX0;
+		deltaP0 = rhs.deltaP0;
 	}
 
     return *this;
@@ -709,6 +715,14 @@ returnValue SCPmethod::setup( )
 		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
 		bandedCPsolver->init( iter );
 	}
+	else if ( (SparseQPsolutionMethods)sparseQPsolution == SPARSE_SOLVER )
+	{
+    	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
+    	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+
+		bandedCPsolver = new SparseBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+		bandedCPsolver->init( iter );
+	}
 	else
 	{
 		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
@@ -943,16 +957,33 @@ returnValue SCPmethod::setupRealTimeParameters(	const Vector &x0_,
 												const Vector &p_
 												)
 {
-	Vector deltaX;
-	Vector deltaP;
+	uint i;
 
+	// deltaX0 and deltaP0 keep their storage between two feedback steps,
+	// such that the embedding of x0 and p does not allocate
 	if( x0_.isEmpty( ) == BT_FALSE )
-		deltaX = x0_ - iter.x->getVector(0);
+	{
+		if ( deltaX0.getDim( ) != x0_.getDim( ) )
+			deltaX0.init( x0_.getDim( ) );
+
+		for( i=0; i<x0_.getDim( ); ++i )
+			deltaX0(i) = x0_(i) - iter.x->operator()( 0,i );
+	}
+	else
+		deltaX0.init( 0 );
 
 	if( p_ .isEmpty( ) == BT_FALSE )
-		deltaP = p_ - iter.p->getVector(0);
+	{
+		if ( deltaP0.getDim( ) != p_.getDim( ) )
+			deltaP0.init( p_.getDim( ) );
 
-	return bandedCPsolver->setRealTimeParameters( deltaX, deltaP );
+		for( i=0; i<p_.getDim( ); ++i )
+			deltaP0(i) = p_(i) - iter.p->operator()( 0,i );
+	}
+	else
+		deltaP0.init( 0 );
+
+	return bandedCPsolver->setRealTimeParameters( deltaX0, deltaP0 );
 }
 
 
@@ -1030,14 +1061,27 @@ returnValue SCPmethod::getFirstControl( Vector& u0_  ) const
     if( iter.u == 0 )
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
-    u0_ = iter.u->getVector( 0 );
-	
+	// u0_ is overwritten in place if it already has the right dimension
+	if ( u0_.getDim( ) != getNU( ) )
+		u0_.init( getNU( ) );
+
+	uint i;
+
 	if ( hasPerformedStep == BT_FALSE )
 	{
-		Vector deltaU0( getNU() );
-		bandedCPsolver->getFirstControl( deltaU0 );
-		
-		u0_ += deltaU0;
+		u0_.setZero( );
+
+		returnValue returnvalue = bandedCPsolver->getFirstControl( u0_ );
+		if ( returnvalue != SUCCESSFUL_RETURN )
+			return ACADOERROR( returnvalue );
+
+		for( i=0; i<getNU( ); ++i )
+			u0_(i) += iter.u->operator()( 0,i );
+	}
+	else
+	{
+		for( i=0; i<getNU( ); ++i )
+			u0_(i) = iter.u->operator()( 0,i );
 	}
 
     return SUCCESSFUL_RETURN;
@@ -120,6 +120,8 @@ returnValue ColoredNoise::init(	uint seed
 {
 	w.setZero( );
 
+	initializeRandomNumberGenerator( seed );
+
 	setStatus( BS_READY );
 	return SUCCESSFUL_RETURN;
 }
@@ -138,10 +138,7 @@ returnValue GaussianNoise::init(	uint seed
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
 	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	initializeRandomNumberGenerator( seed );
 
 	setStatus( BS_READY );
 
@@ -198,7 +195,7 @@ returnValue GaussianNoise::step(	VariablesGrid& _w
 
 double GaussianNoise::getGaussianRandomNumber(	double _mean,
 												double _variance
-												) const
+												)
 {
 	// Box-Muller method
 	double norm = 2.0;
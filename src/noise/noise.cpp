@@ -31,6 +31,8 @@
 
 #include <acado/noise/noise.hpp>
 
+#include <time.h>
+
 
 
 BEGIN_NAMESPACE_ACADO
@@ -38,12 +40,15 @@ BEGIN_NAMESPACE_ACADO
 
 Noise::Noise( )
 {
+	randomState = 1;
 }
 
 
 Noise::Noise( const Noise& rhs )
 {
 	w = rhs.w;
+
+	randomState = rhs.randomState;
 }
 
 
@@ -57,12 +62,55 @@ Noise& Noise::operator=( const Noise& rhs )
 	if ( this != &rhs )
 	{
 		w = rhs.w;
+
+		randomState = rhs.randomState;
 	}
 
     return *this;
 }
 
 
+uint Noise::deriveSeed(	uint seed,
+						uint idx
+						)
+{
+	if ( seed == 0 )
+		return 0;
+
+	/* mix seed and index (finalizer of MurmurHash3) */
+	uint h = ( seed ^ ( ( (idx+1) * 0x9E3779B9u ) & 0xFFFFFFFFu ) ) & 0xFFFFFFFFu;
+
+	h ^= h >> 16;
+	h  = ( h * 0x85EBCA6Bu ) & 0xFFFFFFFFu;
+	h ^= h >> 13;
+	h  = ( h * 0xC2B2AE35u ) & 0xFFFFFFFFu;
+	h ^= h >> 16;
+
+	if ( h == 0 )
+		h = 0x9E3779B9u;
+
+	return h;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue Noise::initializeRandomNumberGenerator(	uint seed
+													)
+{
+	/* seeds obtained from the system clock differ between noise blocks */
+	if ( seed == 0 )
+		seed = deriveSeed( (uint)time(0)+1,(uint)( (size_t)this ) ^ (uint)clock( ) );
+
+	randomState = deriveSeed( seed,0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -192,10 +192,7 @@ returnValue UniformNoise::init(	uint seed
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
 	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	initializeRandomNumberGenerator( seed );
 
 	setStatus( BS_READY );
 
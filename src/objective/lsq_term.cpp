@@ -52,6 +52,8 @@ LSQTerm::LSQTerm( )
     r_temp  = 0;
 
     S_h_res = 0;
+
+    hasBatchTrace = BT_FALSE;
 }
 
 
@@ -70,6 +72,8 @@ LSQTerm::LSQTerm( const MatrixVariablesGrid *S_,
 
     if( r_ != 0 ) r_temp = new VariablesGrid(*r_);
     else          r_temp = 0                     ;
+
+    hasBatchTrace = BT_FALSE;
 }
 
 
@@ -108,6 +112,12 @@ LSQTerm::LSQTerm( const LSQTerm& rhs )
             }
         }
     }
+    else S_h_res = 0;
+
+    zBatch         = rhs.zBatch;
+    hBatch         = rhs.hBatch;
+    batchWorkspace = rhs.batchWorkspace;
+    hasBatchTrace  = rhs.hasBatchTrace;
 }
 
 
@@ -191,6 +201,12 @@ LSQTerm& LSQTerm::operator=( const LSQTerm& rhs ){
                 }
             }
         }
+        else S_h_res = 0;
+
+        zBatch         = rhs.zBatch;
+        hBatch         = rhs.hBatch;
+        batchWorkspace = rhs.batchWorkspace;
+        hasBatchTrace  = rhs.hasBatchTrace;
     }
     return *this;
 }
@@ -201,11 +217,11 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 
     uint run1, run2, run3;
 
-    Vector h_res;
-
     const uint nh = fcn.getDim();
     const uint N  = grid.getNumPoints();
 
+    Vector h_res( nh );
+
     ObjectiveElement::init( x );
 
     obj = 0.0;
@@ -213,14 +229,45 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 	double currentValue;
 	VariablesGrid allValues( 1,grid );
 
+    // SYMBOLIC FUNCTIONS ARE EVALUATED AT ALL GRID POINTS AT ONCE:
+    // ------------------------------------------------------------
+    if( fcn.isSymbolic() == BT_TRUE && fcn.isCompiled() == BT_FALSE )
+        fcn.compile( );
+
+    if( fcn.isCompiled() == BT_TRUE ){
+
+        const uint nz = fcn.getNumberOfVariables()+1;
+
+        if( zBatch.getNumRows() != nz || zBatch.getNumCols() != N ){
+
+            zBatch.init( nz, N );
+            zBatch.setZero( );
+            hBatch.init( nh, N );
+            ACADO_TRY( fcn.initWorkspace( batchWorkspace,1,N ) );
+        }
+
+        z.gatherZ( x, zBatch.getDoublePointer(), N );
+        ACADO_TRY( fcn.evaluateBatch( N, zBatch.getDoublePointer(), hBatch.getDoublePointer(), batchWorkspace ) );
+
+        // the sensitivities are based on the trace of the batched evaluation:
+        hasBatchTrace = BT_TRUE;
+    }
+    else hasBatchTrace = BT_FALSE;
+
     for( run1 = 0; run1 < N; run1++ ){
 
 		currentValue = 0.0;
 
         // EVALUATE THE LSQ-FUCNTION:
         // --------------------------
-        z.setZ( run1, x );
-        h_res = fcn.evaluate( z, (int) run1 );
+        if( hasBatchTrace == BT_TRUE ){
+            for( run2 = 0; run2 < nh; run2++ )
+                h_res(run2) = hBatch( run2, run1 );
+        }
+        else{
+            z.setZ( run1, x );
+            h_res = fcn.evaluate( z, (int) run1 );
+        }
 
 	
 	#ifdef SIM_DEBUG
@@ -321,7 +368,10 @@ returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
                      J[run2][run3] = 0.0;
 
                  bseed[run2] = 1.0;
-                 fcn.AD_backward( run1, bseed, J[run2] );
+                 if( hasBatchTrace == BT_TRUE )
+                     fcn.AD_backward( run1, bseed, J[run2], batchWorkspace );
+                 else
+                     fcn.AD_backward( run1, bseed, J[run2] );
                  bseed[run2] = 0.0;
 
                  for( run3 = 0; run3 < nx; run3++ ){
@@ -475,7 +525,10 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
                      for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
                          J[run2][run3] = 0.0;
                      bseed[run2] = 1.0;
-                     fcn.AD_backward( run1, bseed, J[run2] );
+                     if( hasBatchTrace == BT_TRUE )
+                         fcn.AD_backward( run1, bseed, J[run2], batchWorkspace );
+                     else
+                         fcn.AD_backward( run1, bseed, J[run2] );
                      bseed[run2] = 0.0;
                  }
 
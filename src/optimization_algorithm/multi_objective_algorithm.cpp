@@ -323,6 +323,28 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = -acadoGetTime();
 
+    int nThreads = 1;
+    get( PARETO_FRONT_THREADS, nThreads );
+
+    #ifndef _OPENMP
+    nThreads = 1;
+    #endif
+
+    if( nThreads > 1 ){
+
+        solveConcurrently( Weights, nThreads, arg );
+
+        totalCPUtime += acadoGetTime();
+
+        for( run1 = 0; run1 < m; run1++ )
+            delete arg[run1];
+        delete[] arg;
+
+        delete[] idx;
+
+        return SUCCESSFUL_RETURN;
+    }
+
     run1 = 0;
     while( run1 < (int) Weights.getNumCols() ){
 
@@ -421,6 +443,7 @@ returnValue MultiObjectiveAlgorithm::setupOptions( )
     addOption( PARETO_FRONT_DISCRETIZATION  , defaultParetoFrontDiscretization );
     addOption( PARETO_FRONT_GENERATION      , defaultParetoFrontGeneration     );
     addOption( PARETO_FRONT_HOTSTART        , defaultParetoFrontHotstart       );
+    addOption( PARETO_FRONT_THREADS         , defaultParetoFrontThreads        );
 
 	// add optimization algorithm options
 	//OptimizationAlgorithm::setupOptions( );
@@ -621,6 +644,213 @@ returnValue MultiObjectiveAlgorithm::formulateOCP( double *idx, OCP *ocp_, Expre
 }
 
 
+returnValue MultiObjectiveAlgorithm::solveConcurrently( const Matrix      &Weights ,
+                                                        int                nThreads,
+                                                        Expression       **arg       ){
+
+    int run1, run2;
+    int nWeights = (int) Weights.getNumCols();
+
+    int paretoGeneration;
+    get( PARETO_FRONT_GENERATION, paretoGeneration );
+
+    int hotstart;
+    get( PARETO_FRONT_HOTSTART, hotstart );
+
+
+    // DETERMINE THE POINTS TO BE SOLVED (THE OTHERS ARE ADOPTED FROM THE
+    // SINGLE OBJECTIVE OPTIMIZATIONS):
+    // ------------------------------------------------------------------
+
+    int         *vertex     = new int[nWeights];
+    int         *points     = new int[nWeights];
+    int         *nSteps     = new int[nWeights];
+    BooleanType *isAdopted  = new BooleanType[nWeights];
+    BooleanType *isSolved   = new BooleanType[nWeights];
+    int          nPoints    = 0;
+
+    for( run1 = 0; run1 < nWeights; run1++ ){
+
+        vertex[run1] = -1;
+        for( run2 = 0; run2 < m; run2++ ){
+            if( fabs( Weights( run2, run1 )-1.0 ) < 100.0*EPS )
+                vertex[run1] = run2;
+        }
+
+        nSteps  [run1] = 0;
+        isSolved[run1] = BT_FALSE;
+
+        if( vertex[run1] == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
+            isAdopted[run1] = BT_FALSE;
+            points[nPoints] = run1;
+            nPoints++;
+        }
+        else{
+            isAdopted[run1] = BT_TRUE;
+        }
+    }
+
+    int nChunks = nThreads;
+    if( nChunks > nPoints ) nChunks = nPoints;
+
+    Constraint tmp_con;
+    ocp->getConstraint( tmp_con );
+
+
+    // SOLVE THE CHUNKS CONCURRENTLY:
+    // ------------------------------
+
+    int chunk;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for num_threads( nThreads ) schedule( dynamic ) private( run1, run2 )
+    #endif
+    for( chunk = 0; chunk < nChunks; chunk++ ){
+
+        int first = ( chunk   *nPoints )/nChunks;
+        int last  = ( (chunk+1)*nPoints )/nChunks;
+
+        for( run1 = first; run1 < last; run1++ ){
+
+            int point = points[run1];
+            BooleanType isReady = BT_FALSE;
+            MultiObjectiveAlgorithm *worker = 0;
+
+            // the symbolic parts (formulation, copies and initialization of
+            // the subproblems) share expression trees and are not thread-safe
+            #ifdef _OPENMP
+            #pragma omp critical( acado_multi_objective )
+            #endif
+            {
+                acadoPrintf("\n\n Multi-objective point: %d out of %d \n\n",point+1, nWeights );
+
+                double *idx = new double[m];
+                for( run2 = 0; run2 < m; run2++ )
+                    idx[run2] = Weights( run2, point );
+
+                formulateOCP( idx, ocp, arg );
+                worker = new MultiObjectiveAlgorithm( *ocp );
+                ocp->setConstraint( tmp_con );
+
+                delete[] idx;
+
+                worker->setOptions( *this );
+                worker->set( PRINT_COPYRIGHT, BT_FALSE );
+                worker->userInit = userInit;
+
+                if( hotstart == BT_TRUE ){
+
+                    // candidates are the adopted vertices and the points solved before in this chunk
+                    int    neighbour = -1;
+                    double distance  = INFTY;
+
+                    for( run2 = 0; run2 < nWeights+run1-first; run2++ ){
+
+                        int candidate;
+
+                        if( run2 < nWeights ){
+                            candidate = run2;
+                            if( isAdopted[candidate] == BT_FALSE ) continue;
+                        }
+                        else{
+                            candidate = points[first+run2-nWeights];
+                            if( isSolved[candidate] == BT_FALSE ) continue;
+                        }
+
+                        if( xResults[candidate].isEmpty() == BT_TRUE )
+                            continue;
+
+                        double tmp = ( Weights.getCol( candidate ) - Weights.getCol( point ) ).getNorm( VN_L2 );
+                        if( tmp < distance ){
+                            distance  = tmp;
+                            neighbour = candidate;
+                        }
+                    }
+
+                    if( neighbour >= 0 ){
+                        worker->initializeDifferentialStates( xResults[neighbour] );
+                        if( xaResults[neighbour].isEmpty() == BT_FALSE ) worker->initializeAlgebraicStates( xaResults[neighbour] );
+                        if( pResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeParameters     ( pResults [neighbour] );
+                        if( uResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeControls       ( uResults [neighbour] );
+                        if( wResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeDisturbances   ( wResults [neighbour] );
+                    }
+                }
+
+                if( worker->init( ) == SUCCESSFUL_RETURN )
+                    isReady = BT_TRUE;
+            }
+
+            if( isReady == BT_TRUE ){
+
+                if( worker->OptimizationAlgorithm::solve( ) == SUCCESSFUL_RETURN ){
+
+                    worker->getDifferentialStates( xResults[point]  );
+                    worker->getAlgebraicStates   ( xaResults[point] );
+                    worker->getParameters        ( pResults[point]  );
+                    worker->getControls          ( uResults[point]  );
+                    worker->getDisturbances      ( wResults[point]  );
+
+                    isSolved[point] = BT_TRUE;
+                }
+
+                if( worker->nlpSolver != 0 )
+                    nSteps[point] = worker->nlpSolver->getNumberOfSteps();
+            }
+
+            #ifdef _OPENMP
+            #pragma omp critical( acado_multi_objective )
+            #endif
+            delete worker;
+        }
+    }
+
+    set( PRINT_COPYRIGHT, BT_FALSE );
+
+
+    // COLLECT THE RESULTS IN THE ORDER OF THE WEIGHTS:
+    // ------------------------------------------------
+
+    int lastSolved = -1;
+
+    for( run1 = 0; run1 < nWeights; run1++ ){
+
+        if( isAdopted[run1] == BT_TRUE ){
+            for( run2 = 0; run2 < m; run2++ )
+                result(count,run2) = vertices(vertex[run1],run2);
+            count++;
+            continue;
+        }
+
+        totalNumberOfSQPiterations += nSteps[run1];
+
+        if( isSolved[run1] == BT_FALSE ){
+            ACADOERROR( RET_OPTALG_SOLVE_FAILED );
+            continue;
+        }
+
+        evaluateObjectives( xResults[run1], xaResults[run1], pResults[run1], uResults[run1], wResults[run1], arg );
+        lastSolved = run1;
+    }
+
+    // as in the sequential case, the last solution is used as initialization
+    if( hotstart == BT_TRUE && lastSolved >= 0 ){
+        if( userInit.x  != 0 ) *userInit.x  = xResults [lastSolved];
+        if( userInit.xa != 0 ) *userInit.xa = xaResults[lastSolved];
+        if( userInit.p  != 0 ) *userInit.p  = pResults [lastSolved];
+        if( userInit.u  != 0 ) *userInit.u  = uResults [lastSolved];
+        if( userInit.w  != 0 ) *userInit.w  = wResults [lastSolved];
+    }
+
+    delete[] vertex;
+    delete[] points;
+    delete[] nSteps;
+    delete[] isAdopted;
+    delete[] isSolved;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
                                                          VariablesGrid    &xa_ ,
                                                          VariablesGrid    &p_  ,
@@ -148,14 +148,20 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
+	addOption( REDUCE_FEEDBACK_ALLOCATIONS , defaultReduceFeedbackAllocations );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
+	addOption( NLP_SOLUTION                , defaultNLPsolution             );
+	addOption( CONIC_SOLVER_BARRIER_TUNING , defaultConicSolverBarrierTuning );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( DISCRETIZATION_THREADS      , defaultDiscretizationThreads   );
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
+	addOption( COLLOCATION_SCHEME          , defaultCollocationScheme       );
+	addOption( NUM_INTEGRATOR_STEPS        , defaultNumIntegratorSteps      );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
 	
@@ -173,6 +179,7 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -195,7 +202,13 @@ returnValue OptimizationAlgorithm::allocateNlpSolver( Objective *F, DynamicDiscr
 	if( nlpSolver != 0 )
 		delete nlpSolver;
 
-	nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+	int nlpSolution;
+	get( NLP_SOLUTION,nlpSolution );
+
+	if ( (NLPsolutionMethods)nlpSolution == INTERIOR_POINT_METHOD )
+		nlpSolver = new IPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+	else
+		nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
 
 	return SUCCESSFUL_RETURN;
 }
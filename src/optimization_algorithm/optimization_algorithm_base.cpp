@@ -217,6 +217,7 @@ returnValue OptimizationAlgorithmBase::initializeDisturbances( const VariablesGr
 
 returnValue OptimizationAlgorithmBase::getDifferentialStates( VariablesGrid &xd_ ) const{
 
+    waitForNlpSolver( );
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
     return nlpSolver->getDifferentialStates( xd_ );
 }
@@ -224,6 +225,7 @@ returnValue OptimizationAlgorithmBase::getDifferentialStates( VariablesGrid &xd_
 
 returnValue OptimizationAlgorithmBase::getAlgebraicStates( VariablesGrid &xa_ ) const{
 
+    waitForNlpSolver( );
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
     return nlpSolver->getAlgebraicStates( xa_ );
 }
@@ -231,6 +233,7 @@ returnValue OptimizationAlgorithmBase::getAlgebraicStates( VariablesGrid &xa_ )
 
 returnValue OptimizationAlgorithmBase::getParameters( VariablesGrid &p_  ) const
 {
+	waitForNlpSolver( );
 	if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 	return nlpSolver->getParameters( p_ );
 }
@@ -238,6 +241,7 @@ returnValue OptimizationAlgorithmBase::getParameters( VariablesGrid &p_  ) const
 
 returnValue OptimizationAlgorithmBase::getParameters( Vector &p_  ) const
 {
+	waitForNlpSolver( );
 	if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
 	VariablesGrid tmp;
@@ -254,6 +258,7 @@ returnValue OptimizationAlgorithmBase::getParameters( Vector &p_  ) const
 
 returnValue OptimizationAlgorithmBase::getControls( VariablesGrid &u_  ) const{
 
+    waitForNlpSolver( );
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
     return nlpSolver->getControls( u_ );
 }
@@ -261,6 +266,7 @@ returnValue OptimizationAlgorithmBase::getControls( VariablesGrid &u_  ) const{
 
 returnValue OptimizationAlgorithmBase::getDisturbances( VariablesGrid &w_  ) const{
 
+    waitForNlpSolver( );
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
     return nlpSolver->getDisturbances( w_ );
 }
@@ -268,6 +274,7 @@ returnValue OptimizationAlgorithmBase::getDisturbances( VariablesGrid &w_  ) con
 
 returnValue OptimizationAlgorithmBase::getDifferentialStates( const char* fileName ) const{
 
+    waitForNlpSolver( );
     returnValue returnvalue;
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
@@ -285,6 +292,7 @@ returnValue OptimizationAlgorithmBase::getDifferentialStates( const char* fileNa
 
 returnValue OptimizationAlgorithmBase::getAlgebraicStates( const char* fileName ) const{
 
+    waitForNlpSolver( );
     returnValue returnvalue;
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
@@ -302,6 +310,7 @@ returnValue OptimizationAlgorithmBase::getAlgebraicStates( const char* fileName
 
 returnValue OptimizationAlgorithmBase::getParameters( const char* fileName ) const{
 
+    waitForNlpSolver( );
     returnValue returnvalue;
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
@@ -319,6 +328,7 @@ returnValue OptimizationAlgorithmBase::getParameters( const char* fileName ) con
 
 returnValue OptimizationAlgorithmBase::getControls( const char* fileName ) const{
 
+    waitForNlpSolver( );
     returnValue returnvalue;
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
@@ -336,6 +346,7 @@ returnValue OptimizationAlgorithmBase::getControls( const char* fileName ) const
 
 returnValue OptimizationAlgorithmBase::getDisturbances( const char* fileName ) const{
 
+    waitForNlpSolver( );
     returnValue returnvalue;
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
 
@@ -363,6 +374,7 @@ double OptimizationAlgorithmBase::getObjectiveValue( const char* fileName ) cons
 
 double OptimizationAlgorithmBase::getObjectiveValue() const{
 
+    waitForNlpSolver( );
     if( nlpSolver == 0 ) return ACADOWARNING( RET_MEMBER_NOT_INITIALISED );
     return nlpSolver->getObjectiveValue();
 }
@@ -372,6 +384,7 @@ double OptimizationAlgorithmBase::getObjectiveValue() const{
 returnValue OptimizationAlgorithmBase::getSensitivitiesX(	BlockMatrix& _sens
 															) const
 {
+	waitForNlpSolver( );
 	return nlpSolver->getSensitivitiesX( _sens );
 }
 
@@ -379,12 +392,14 @@ returnValue OptimizationAlgorithmBase::getSensitivitiesX(	BlockMatrix& _sens
 returnValue OptimizationAlgorithmBase::getSensitivitiesXA(	BlockMatrix& _sens
 															) const
 {
+	waitForNlpSolver( );
 	return nlpSolver->getSensitivitiesXA( _sens );
 }
 
 returnValue OptimizationAlgorithmBase::getSensitivitiesP(	BlockMatrix& _sens
 															) const
 {
+	waitForNlpSolver( );
 	return nlpSolver->getSensitivitiesP( _sens );
 }
 
@@ -392,6 +407,7 @@ returnValue OptimizationAlgorithmBase::getSensitivitiesP(	BlockMatrix& _sens
 returnValue OptimizationAlgorithmBase::getSensitivitiesU(	BlockMatrix& _sens
 															) const
 {
+	waitForNlpSolver( );
 	return nlpSolver->getSensitivitiesU( _sens );
 }
 
@@ -399,6 +415,7 @@ returnValue OptimizationAlgorithmBase::getSensitivitiesU(	BlockMatrix& _sens
 returnValue OptimizationAlgorithmBase::getSensitivitiesW(	BlockMatrix& _sens
 															) const
 {
+	waitForNlpSolver( );
 	return nlpSolver->getSensitivitiesW( _sens );
 }
 
@@ -457,6 +474,12 @@ double OptimizationAlgorithmBase::getEndTime( ) const
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue OptimizationAlgorithmBase::waitForNlpSolver( ) const
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue OptimizationAlgorithmBase::clear( )
 {
 	if ( ocp != 0 )
@@ -719,7 +742,29 @@ returnValue OptimizationAlgorithmBase::setupDynamicDiscretization(	UserInteracti
 
     if( differentialEquation != 0 ){
 
-        *dynamicDiscretization = new ShootingMethod( _userIteraction );
+        int discType;
+        _userIteraction->get( DISCRETIZATION_TYPE, discType );
+
+        int hessMode, dynHessMode;
+        _userIteraction->get( HESSIAN_APPROXIMATION, hessMode );
+        _userIteraction->get( DYNAMIC_HESSIAN_APPROXIMATION, dynHessMode );
+        if( (HessianApproximationMode)dynHessMode == DEFAULT_HESSIAN_APPROXIMATION )
+            dynHessMode = hessMode;
+
+        // collocation is restricted to explicit ODEs and provides no second
+        // order sensitivities (see CollocationMethod):
+        if( (StateDiscretizationType)discType == COLLOCATION ){
+
+            if( ( (HessianApproximationMode)dynHessMode == EXACT_HESSIAN          ) ||
+                ( differentialEquation[0]->getNumAlgebraicEquations() != 0      ) ||
+                ( differentialEquation[0]->isImplicit()               == BT_TRUE ) ||
+                ( differentialEquation[0]->isDiscretized()            == BT_TRUE ) )
+                return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+            *dynamicDiscretization = new CollocationMethod( _userIteraction );
+        }
+        else
+            *dynamicDiscretization = new ShootingMethod( _userIteraction );
 
         int intType;
         _userIteraction->get( INTEGRATOR_TYPE, intType );
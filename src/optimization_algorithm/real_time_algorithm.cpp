@@ -33,6 +33,10 @@
 
 #include <acado/optimization_algorithm/real_time_algorithm.hpp>
 
+#ifdef ACADO_WITH_PTHREADS
+	#include <pthread.h>
+#endif
+
 
 
 // #define SIM_DEBUG
@@ -42,6 +46,25 @@
 BEGIN_NAMESPACE_ACADO
 
 
+#ifdef ACADO_WITH_PTHREADS
+
+/** Data of the separate thread performing asynchronous preparation steps. */
+struct RealTimeAlgorithm::PreparationThread
+{
+	pthread_t       thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t  condition;		/**< signals new requests as well as finished steps */
+
+	BooleanType     isPending;		/**< a preparation step has been started but not yet finished */
+	BooleanType     isTerminating;	/**< the thread shall terminate */
+
+	VariablesGrid   yRef;			/**< reference trajectory passed to the pending preparation step */
+	returnValue     returnvalue;	/**< return value of the last preparation step */
+};
+
+#endif
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -55,6 +78,8 @@ RealTimeAlgorithm::RealTimeAlgorithm() : OptimizationAlgorithmBase( ), ControlLa
 	p0        = 0;
     reference = 0;
 
+	preparationThread = 0;
+
 	set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
 	set( USE_REALTIME_ITERATIONS,BT_TRUE );
 	set( MAX_NUM_ITERATIONS,1 );
@@ -76,6 +101,8 @@ RealTimeAlgorithm::RealTimeAlgorithm(	const OCP& ocp_,
 	p0 = 0;
     reference = 0;
 
+	preparationThread = 0;
+
 	set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
 	set( USE_REALTIME_ITERATIONS,BT_TRUE );
 	set( MAX_NUM_ITERATIONS,1 );
@@ -87,7 +114,8 @@ RealTimeAlgorithm::RealTimeAlgorithm(	const OCP& ocp_,
 
 
 
-RealTimeAlgorithm::RealTimeAlgorithm( const RealTimeAlgorithm& rhs ) : OptimizationAlgorithmBase( rhs ), ControlLaw( rhs )
+// (a pending preparation step of rhs is awaited before its NLP solver is copied)
+RealTimeAlgorithm::RealTimeAlgorithm( const RealTimeAlgorithm& rhs ) : OptimizationAlgorithmBase( ( rhs.waitForNlpSolver( ),rhs ) ), ControlLaw( rhs )
 {
     if( rhs.x0 != 0 ) x0 = new Vector(*rhs.x0);
     else              x0 = 0                  ;
@@ -97,6 +125,8 @@ RealTimeAlgorithm::RealTimeAlgorithm( const RealTimeAlgorithm& rhs ) : Optimizat
 
     if( rhs.reference != 0 ) reference = new VariablesGrid(*rhs.reference);
     else                     reference = 0                         ;
+
+	preparationThread = 0;
 }
 
 
@@ -112,6 +142,7 @@ RealTimeAlgorithm& RealTimeAlgorithm::operator=( const RealTimeAlgorithm& rhs ){
     if( this != &rhs ){
 
 		clear( );
+		rhs.waitForNlpSolver( );
 
 		OptimizationAlgorithmBase::operator=( rhs );
 		ControlLaw::operator=( rhs );
@@ -139,6 +170,8 @@ ControlLaw* RealTimeAlgorithm::clone( ) const
 returnValue RealTimeAlgorithm::initializeAlgebraicStates(	const VariablesGrid& _xa_init
 															)
 {
+	waitForNlpSolver( );
+
 	return OptimizationAlgorithmBase::initializeAlgebraicStates( _xa_init );
 }
 
@@ -146,6 +179,8 @@ returnValue RealTimeAlgorithm::initializeAlgebraicStates(	const VariablesGrid& _
 returnValue RealTimeAlgorithm::initializeAlgebraicStates(	const char* fileName
 															)
 {
+	waitForNlpSolver( );
+
 	return OptimizationAlgorithmBase::initializeAlgebraicStates( fileName );
 }
 
@@ -153,6 +188,8 @@ returnValue RealTimeAlgorithm::initializeAlgebraicStates(	const char* fileName
 returnValue RealTimeAlgorithm::initializeControls(	const VariablesGrid& _u_init
 													)
 {
+	waitForNlpSolver( );
+
 	return OptimizationAlgorithmBase::initializeControls( _u_init );
 }
 
@@ -160,6 +197,8 @@ returnValue RealTimeAlgorithm::initializeControls(	const VariablesGrid& _u_init
 returnValue RealTimeAlgorithm::initializeControls(	const char* fileName
 													)
 {
+	waitForNlpSolver( );
+
 	return OptimizationAlgorithmBase::initializeControls( fileName );
 }
 
@@ -167,6 +206,8 @@ returnValue RealTimeAlgorithm::initializeControls(	const char* fileName
 
 returnValue RealTimeAlgorithm::init( )
 {
+	waitForNlpSolver( );
+
 	if ( ( getStatus( ) == BS_READY ) && ( haveOptionsChanged( ) == BT_FALSE ) )
 		return SUCCESSFUL_RETURN;
 
@@ -253,6 +294,9 @@ returnValue RealTimeAlgorithm::feedbackStep(	double currentTime,
 												const VariablesGrid& _yRef
 												)
 {
+	if ( waitForPreparationStep( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
 	if ( getStatus( ) != BS_READY )
 		return ACADOERROR( RET_BLOCK_NOT_READY );
 
@@ -318,6 +362,15 @@ returnValue RealTimeAlgorithm::preparationStep(	double nextTime,
 												const VariablesGrid& _yRef
 												)
 {
+	if ( waitForPreparationStep( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
+	int useAsynchronousPreparation = 0;
+	get( USE_ASYNCHRONOUS_PREPARATION,useAsynchronousPreparation );
+
+	if ( (BooleanType)useAsynchronousPreparation == BT_TRUE )
+		return startPreparationThread( _yRef );
+
 	returnValue returnvalue = performPreparationStep( _yRef,BT_TRUE );
 	if ( ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
 		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
@@ -326,6 +379,56 @@ returnValue RealTimeAlgorithm::preparationStep(	double nextTime,
 }
 
 
+returnValue RealTimeAlgorithm::waitForPreparationStep( )
+{
+	#ifdef ACADO_WITH_PTHREADS
+
+	if ( preparationThread == 0 )
+		return SUCCESSFUL_RETURN;
+
+	pthread_mutex_lock( &preparationThread->mutex );
+
+	while ( preparationThread->isPending == BT_TRUE )
+		pthread_cond_wait( &preparationThread->condition,&preparationThread->mutex );
+
+	returnValue returnvalue = preparationThread->returnvalue;
+	preparationThread->returnvalue = SUCCESSFUL_RETURN;
+
+	pthread_mutex_unlock( &preparationThread->mutex );
+
+	if ( ( returnvalue != SUCCESSFUL_RETURN ) &&
+		 ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
+	#endif
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RealTimeAlgorithm::waitForNlpSolver( ) const
+{
+	#ifdef ACADO_WITH_PTHREADS
+
+	if ( preparationThread == 0 )
+		return SUCCESSFUL_RETURN;
+
+	// (unlike waitForPreparationStep( ), the result of the step is kept
+	//  for the next feedback or preparation step)
+	pthread_mutex_lock( &preparationThread->mutex );
+
+	while ( preparationThread->isPending == BT_TRUE )
+		pthread_cond_wait( &preparationThread->condition,&preparationThread->mutex );
+
+	pthread_mutex_unlock( &preparationThread->mutex );
+
+	#endif
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue RealTimeAlgorithm::solve(	double startTime,
 										const Vector &_x,
@@ -333,6 +436,9 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 										const VariablesGrid& _yRef
 										)
 {
+	if ( waitForPreparationStep( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_NLP_SOLUTION_FAILED );
+
 	if ( getStatus( ) == BS_NOT_INITIALIZED )
 	{
 		if ( init( startTime,_x ) != SUCCESSFUL_RETURN )
@@ -378,6 +484,8 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 returnValue RealTimeAlgorithm::shift(	double timeShift
 										)
 {
+	waitForNlpSolver( );
+
 	if ( acadoIsNegative( timeShift ) == BT_TRUE )
 		timeShift = getSamplingTime( );
 	
@@ -389,6 +497,8 @@ returnValue RealTimeAlgorithm::shift(	double timeShift
 
 returnValue RealTimeAlgorithm::setReference( const VariablesGrid &ref )
 {
+	waitForNlpSolver( );
+
     if ( ( getStatus() != BS_READY ) && ( getStatus() != BS_RUNNING ) )
 		return ACADOERROR( RET_OPTALG_INIT_FAILED );
 
@@ -505,6 +615,8 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
 	addOption( USE_REALTIME_SHIFTS         , defaultUseRealtimeShifts       );
 	addOption( USE_IMMEDIATE_FEEDBACK      , defaultUseImmediateFeedback    );
+	addOption( REDUCE_FEEDBACK_ALLOCATIONS , defaultReduceFeedbackAllocations );
+	addOption( USE_ASYNCHRONOUS_PREPARATION, defaultUseAsynchronousPreparation );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
@@ -512,7 +624,10 @@ returnValue RealTimeAlgorithm::setupOptions( )
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( DISCRETIZATION_THREADS      , defaultDiscretizationThreads   );
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
+	addOption( COLLOCATION_SCHEME          , defaultCollocationScheme       );
+	addOption( NUM_INTEGRATOR_STEPS        , defaultNumIntegratorSteps      );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
 	
@@ -530,6 +645,7 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -549,6 +665,8 @@ returnValue RealTimeAlgorithm::setupLogging( )
 
 returnValue RealTimeAlgorithm::clear( )
 {
+	stopPreparationThread( );
+
 	if( x0 != 0 )
 	{
 		delete x0;
@@ -662,13 +780,15 @@ returnValue RealTimeAlgorithm::performPreparationStep(	const VariablesGrid& _yRe
 	if ( ( returnvalueStep != CONVERGENCE_ACHIEVED ) && ( returnvalueStep != CONVERGENCE_NOT_YET_ACHIEVED ) )
 		return ACADOERROR( returnvalueStep );
 
+	// (the NLP solver is accessed directly, as shift( ) and setReference( )
+	//  wait for a preparation step running on a separate thread, i.e. this one)
 	if ( isLastIteration == BT_TRUE )
 	{
 		if ( _yRef.isEmpty() == BT_FALSE )
-			setReference( _yRef );
+			nlpSolver->setReference( _yRef );
 
 		if ( (BooleanType)useRealTimeShifts == BT_TRUE )
-			shift( );
+			nlpSolver->shiftVariables( getSamplingTime( ) );
 	}
 
 	// prepare next step
@@ -678,10 +798,10 @@ returnValue RealTimeAlgorithm::performPreparationStep(	const VariablesGrid& _yRe
 	if ( ((BooleanType)terminateAtConvergence == BT_TRUE ) && ( returnvalueStep == CONVERGENCE_ACHIEVED ) )
 	{
 		if ( _yRef.isEmpty() == BT_FALSE )
-			setReference( _yRef );
+			nlpSolver->setReference( _yRef );
 		
 		if ( (BooleanType)useRealTimeShifts == BT_TRUE )
-			shift( );
+			nlpSolver->shiftVariables( getSamplingTime( ) );
 	}
 
 	returnValue returnvalue = nlpSolver->prepareNextStep( );
@@ -697,6 +817,126 @@ returnValue RealTimeAlgorithm::performPreparationStep(	const VariablesGrid& _yRe
 }
 
 
+returnValue RealTimeAlgorithm::startPreparationThread(	const VariablesGrid& _yRef
+														)
+{
+	#ifdef ACADO_WITH_PTHREADS
+
+	if ( preparationThread == 0 )
+	{
+		preparationThread = new PreparationThread;
+
+		preparationThread->isPending     = BT_FALSE;
+		preparationThread->isTerminating = BT_FALSE;
+		preparationThread->returnvalue   = SUCCESSFUL_RETURN;
+
+		pthread_mutex_init( &preparationThread->mutex,0 );
+		pthread_cond_init( &preparationThread->condition,0 );
+
+		if ( pthread_create( &preparationThread->thread,0,runPreparationThread,this ) != 0 )
+		{
+			pthread_cond_destroy( &preparationThread->condition );
+			pthread_mutex_destroy( &preparationThread->mutex );
+
+			delete preparationThread;
+			preparationThread = 0;
+
+			return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+		}
+	}
+
+	// the thread is idle, hence the reference can be copied before the request is signalled
+	pthread_mutex_lock( &preparationThread->mutex );
+
+	preparationThread->yRef = _yRef;
+	preparationThread->isPending = BT_TRUE;
+
+	pthread_cond_broadcast( &preparationThread->condition );
+	pthread_mutex_unlock( &preparationThread->mutex );
+
+	return SUCCESSFUL_RETURN;
+
+	#else
+
+	// without thread support, the preparation step is performed synchronously
+	returnValue returnvalue = performPreparationStep( _yRef,BT_TRUE );
+	if ( ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
+	return SUCCESSFUL_RETURN;
+
+	#endif
+}
+
+
+returnValue RealTimeAlgorithm::stopPreparationThread( )
+{
+	#ifdef ACADO_WITH_PTHREADS
+
+	if ( preparationThread == 0 )
+		return SUCCESSFUL_RETURN;
+
+	pthread_mutex_lock( &preparationThread->mutex );
+
+	while ( preparationThread->isPending == BT_TRUE )
+		pthread_cond_wait( &preparationThread->condition,&preparationThread->mutex );
+
+	preparationThread->isTerminating = BT_TRUE;
+
+	pthread_cond_broadcast( &preparationThread->condition );
+	pthread_mutex_unlock( &preparationThread->mutex );
+
+	pthread_join( preparationThread->thread,0 );
+
+	pthread_cond_destroy( &preparationThread->condition );
+	pthread_mutex_destroy( &preparationThread->mutex );
+
+	delete preparationThread;
+	preparationThread = 0;
+
+	#endif
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void* RealTimeAlgorithm::runPreparationThread(	void* _algorithm
+												)
+{
+	#ifdef ACADO_WITH_PTHREADS
+
+	RealTimeAlgorithm* algorithm = (RealTimeAlgorithm*)_algorithm;
+	PreparationThread* worker = algorithm->preparationThread;
+
+	pthread_mutex_lock( &worker->mutex );
+
+	while ( 1 )
+	{
+		while ( ( worker->isPending == BT_FALSE ) && ( worker->isTerminating == BT_FALSE ) )
+			pthread_cond_wait( &worker->condition,&worker->mutex );
+
+		if ( worker->isPending == BT_FALSE )
+			break;
+
+		// the caller waits for the step (see waitForNlpSolver) before touching the NLP solver
+		pthread_mutex_unlock( &worker->mutex );
+		returnValue returnvalue = algorithm->performPreparationStep( worker->yRef,BT_TRUE );
+		pthread_mutex_lock( &worker->mutex );
+
+		worker->returnvalue = returnvalue;
+		worker->isPending = BT_FALSE;
+
+		pthread_cond_broadcast( &worker->condition );
+	}
+
+	pthread_mutex_unlock( &worker->mutex );
+
+	#endif
+
+	return 0;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -60,9 +60,12 @@ Process::Process( ) : SimulationBlock( BN_PROCESS )
 	sensor   = 0;
 
 	processDisturbance = 0;
+	disturbanceCursor = 0;
 
 	lastTime = 0.0;
 
+	noiseSeed = 0;
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
@@ -83,6 +86,7 @@ Process::Process(	const DynamicSystem& _dynamicSystem,
 	sensor   = 0;
 
 	processDisturbance = 0;
+	disturbanceCursor = 0;
 
 	if ( _dynamicSystem.getNumDynamicEquations( ) > 0 )
 	{
@@ -92,6 +96,8 @@ Process::Process(	const DynamicSystem& _dynamicSystem,
 
 	lastTime = 0.0;
 
+	noiseSeed = 0;
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
@@ -114,10 +120,18 @@ Process::Process( const Process& rhs ) : SimulationBlock( rhs )
 		dynamicSystems = 0;
 	}
 
+	// the integration method is set up anew (instead of being copied),
+	// such that it uses the options and the logging of this process:
+	integrationMethod = 0;
+
 	if ( rhs.integrationMethod != 0 )
-		integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
-	else
-		integrationMethod = 0;
+	{
+		integrationMethod = new ShootingMethod( this );
+
+		Grid dummy( 0.0, 1.0 );
+		for( uint i=0; i<nDynSys; ++i )
+			integrationMethod->addStage( *(dynamicSystems[i]), dummy, rhs.integratorType );
+	}
 
 	if ( rhs.actuator != 0 )
 		actuator = new Actuator( *(rhs.actuator) );
@@ -137,6 +151,11 @@ Process::Process( const Process& rhs ) : SimulationBlock( rhs )
 	y = rhs.y;
 
 	lastTime = rhs.lastTime;
+	disturbanceCursor = rhs.disturbanceCursor;
+
+	noiseSeed = rhs.noiseSeed;
+
+	integratorType = rhs.integratorType;
 }
 
 
@@ -170,10 +189,17 @@ Process& Process::operator=( const Process& rhs )
 			dynamicSystems = 0;
 		}
 
+		// the integration method is set up anew (see copy constructor)
+		integrationMethod = 0;
+
 		if ( rhs.integrationMethod != 0 )
-			integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
-		else
-			integrationMethod = 0;
+		{
+			integrationMethod = new ShootingMethod( this );
+
+			Grid dummy( 0.0, 1.0 );
+			for( uint i=0; i<nDynSys; ++i )
+				integrationMethod->addStage( *(dynamicSystems[i]), dummy, rhs.integratorType );
+		}
 	
 		if ( rhs.actuator != 0 )
 			actuator = new Actuator( *(rhs.actuator) );
@@ -193,6 +219,11 @@ Process& Process::operator=( const Process& rhs )
 		y = rhs.y;
 
 		lastTime = rhs.lastTime;
+		disturbanceCursor = rhs.disturbanceCursor;
+
+		noiseSeed = rhs.noiseSeed;
+
+		integratorType = rhs.integratorType;
     }
 
     return *this;
@@ -324,6 +355,14 @@ returnValue Process::setProcessDisturbance(	const char* _processDisturbance
 }
 
 
+returnValue Process::setNoiseSeed(	uint _noiseSeed
+									)
+{
+	noiseSeed = _noiseSeed;
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue Process::initializeStartValues(	const Vector& _xStart,
 											const Vector& _xaStart
@@ -359,6 +398,7 @@ returnValue Process::init(	double _startTime,
 
 	/* 1) Assign values */
 	lastTime = _startTime;
+	disturbanceCursor = 0;
 
 	if ( _xStart.getDim( ) > 0 )
 		x = _xStart;
@@ -456,6 +496,12 @@ returnValue Process::init(	double _startTime,
 
 
 	/* 3) Initialize all sub-blocks. */
+	if ( hasActuator( ) == BT_TRUE )
+		actuator->setNoiseSeed( Noise::deriveSeed( noiseSeed,1 ) );
+
+	if ( hasSensor( ) == BT_TRUE )
+		sensor->setNoiseSeed( Noise::deriveSeed( noiseSeed,2 ) );
+
 	if ( hasActuator( ) == BT_TRUE )
 		if ( actuator->init( _startTime,_uStart,_pStart ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_PROCESS_INIT_FAILED );
@@ -474,7 +520,9 @@ returnValue Process::init(	double _startTime,
 
 	if ( hasProcessDisturbance( ) == BT_TRUE )
 	{
-		if ( processDisturbance->evaluate( _startTime,_wStart ) != SUCCESSFUL_RETURN )
+		_wStart.init( processDisturbance->getDim( ) );
+
+		if ( processDisturbance->evaluate( _startTime,_wStart.getDoublePointer( ),disturbanceCursor ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_PROCESS_INIT_FAILED );
 	}
 
@@ -546,7 +594,8 @@ returnValue Process::step(	const VariablesGrid& _u,
 
 	if ( hasProcessDisturbance( ) == BT_TRUE )
 	{
-		if ( processDisturbance->evaluate( _u.getFirstTime( ),_u.getLastTime( ),_w ) != SUCCESSFUL_RETURN )
+		// (the disturbance is looked up from the interval of the previous step onwards)
+		if ( processDisturbance->evaluate( _u.getFirstTime( ),_u.getLastTime( ),_w,disturbanceCursor ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_PROCESS_STEP_FAILED_DISTURBANCE );
 	}
 // 	_w.print( "read w" );
@@ -717,6 +766,7 @@ returnValue Process::setupOptions( )
 	
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , BT_FALSE                       );
+	addOption( DISCRETIZATION_THREADS      , defaultDiscretizationThreads   );
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -735,6 +785,7 @@ returnValue Process::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( USE_NATIVE_CODE             , defaultUseNativeCode           );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -817,6 +868,8 @@ returnValue Process::clear( )
 	if ( processDisturbance != 0 )
 		delete processDisturbance;
 
+	simulationIterate.clear( );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -827,55 +880,74 @@ returnValue Process::simulate(	const VariablesGrid& _u,
 								const VariablesGrid& _w
 								)
 {
-	DynamicSystem*       dynSys    = dynamicSystems[0];
-	DifferentialEquation diffEqn   = dynSys->getDifferentialEquation( );
-	OutputFcn            outputFcn = dynSys->getOutputFcn( );
+	DynamicSystem*              dynSys    = dynamicSystems[0];
+	const DifferentialEquation& diffEqn   = dynSys->getDifferentialEquation( );
+	OutputFcn&                  outputFcn = dynSys->getOutputFcn( );
 
 	Grid currentGrid;
 	_u.getGrid( currentGrid );
 
-	OCPiterate iter;
+	// the iterate (as well as the integrators of the shooting method) is kept
+	// alive across all simulation steps; only time points and initial values
+	// and inputs are updated as long as all dimensions remain the same
+	OCPiterate& iter = simulationIterate;
 
-	// allocate memory for call to simulation algorithm
-	// and initialise states with start value
+	// initialise states with start value
 	Vector xComponents = diffEqn.getDifferentialStateComponents( );
+	uint nxAll = (uint)round( xComponents.getMax( )+1.0 );
 
-	iter.x = new VariablesGrid( (int)round( xComponents.getMax( )+1.0 ),currentGrid,VT_DIFFERENTIAL_STATE );
+	if ( ( iter.x == 0 ) || ( iter.x->getNumValues( ) != nxAll ) || ( iter.x->getNumPoints( ) != currentGrid.getNumPoints( ) ) )
+	{
+		if ( iter.x != 0 )
+			delete iter.x;
+		iter.x = new VariablesGrid( nxAll,currentGrid,VT_DIFFERENTIAL_STATE );
+	}
+	else
+	{
+		for( uint i=0; i<currentGrid.getNumPoints( ); ++i )
+			iter.x->setTime( i,currentGrid.getTime( i ) );
+	}
+
+	iter.x->setAll( 0.0 );
 	for( uint i=0; i<xComponents.getDim( ); ++i )
 		iter.x->operator()( 0,(int)xComponents(i) ) = x(i);
 
-//	Vector xaComponents;
 	if ( getNXA() > 0 )
 	{
-		iter.xa = new VariablesGrid( getNXA(),currentGrid,VT_ALGEBRAIC_STATE );
+		if ( ( iter.xa == 0 ) || ( iter.xa->getNumValues( ) != getNXA() ) || ( iter.xa->getNumPoints( ) != currentGrid.getNumPoints( ) ) )
+		{
+			if ( iter.xa != 0 )
+				delete iter.xa;
+			iter.xa = new VariablesGrid( getNXA(),currentGrid,VT_ALGEBRAIC_STATE );
+		}
+		else
+		{
+			for( uint i=0; i<currentGrid.getNumPoints( ); ++i )
+				iter.xa->setTime( i,currentGrid.getTime( i ) );
+		}
+
+		iter.xa->setAll( 0.0 );
 		iter.xa->setVector( 0,xa );
 	}
 
-	if ( ( _u.getNumPoints( ) > 0 ) && ( _u.getNumValues( ) > 0 ) )
-		iter.u = new VariablesGrid( _u );
-
-	if ( ( _p.getNumPoints( ) > 0 ) && ( _p.getNumValues( ) > 0 ) )
-		iter.p = new VariablesGrid( _p );
+	updateIterateGrid( iter.u,_u );
+	updateIterateGrid( iter.p,_p );
+	updateIterateGrid( iter.w,_w );
 
-	if ( ( _w.getNumPoints( ) > 0 ) && ( _w.getNumValues( ) > 0 ) )
-		iter.w = new VariablesGrid( _w );
 
+	// simulate process (re-using the integrators if possible)...
+	Grid unionGrid = iter.getUnionGrid( );
 
-	// simulate process...
-
-// 	delete integrationMethod;
-// 	integrationMethod = new ShootingMethod( this );
-	ACADO_TRY( integrationMethod->clear() );
-	ACADO_TRY( integrationMethod->addStage( *dynSys, iter.getUnionGrid(), integratorType ) );
+	if ( integrationMethod->moveStage( unionGrid ) != SUCCESSFUL_RETURN )
+	{
+		ACADO_TRY( integrationMethod->clear() );
+		ACADO_TRY( integrationMethod->addStage( *dynSys, unionGrid, integratorType ) );
+	}
 
-// 	iter.u->print( "u" );
-	
 	#ifdef SIM_DEBUG
 // 	printf("process step \n");
 	(iter.x->getVector(0)).print("iter.x(0)");
 	(iter.u->getVector(0)).print("iter.u(0)");
-// 	(iter.x->getVector(1)).print("iter.x(1)");
-// 	(iter.u->getVector(1)).print("iter.u(1)");
 	#endif
 	
 	iter.enableSimulationMode();
@@ -1033,6 +1105,40 @@ returnValue Process::projectToComponents(	const VariablesGrid& _x,
 }
 
 
+returnValue Process::updateIterateGrid(	VariablesGrid*& _target,
+										const VariablesGrid& _source
+										) const
+{
+	if ( ( _source.getNumPoints( ) == 0 ) || ( _source.getNumValues( ) == 0 ) )
+	{
+		if ( _target != 0 )
+			delete _target;
+
+		_target = 0;
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( ( _target == 0 ) || ( _target->getNumPoints( ) != _source.getNumPoints( ) ) || ( _target->getNumValues( ) != _source.getNumValues( ) ) )
+	{
+		if ( _target != 0 )
+			delete _target;
+
+		_target = new VariablesGrid( _source );
+		return SUCCESSFUL_RETURN;
+	}
+
+	for( uint j=0; j<_source.getNumPoints( ); ++j )
+	{
+		_target->setTime( j,_source.getTime( j ) );
+
+		for( uint i=0; i<_source.getNumValues( ); ++i )
+			_target->operator()( j,i ) = _source( j,i );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -107,18 +107,21 @@ returnValue PeriodicReferenceTrajectory::getReference(	double tStart,
 	int nStart = (int)floor( (double) (tStart/T+100.0*EPS) );  // cycle number at start
 	int nEnd   = (int)floor( (double) (tEnd  /T-100.0*EPS) );  // cycle number at end
 
+	uint idx = cursor;
+
 	if ( nStart == nEnd )
 	{
-		_yRef = (yRef.getTimeSubGrid( tStart-T*(double)nStart,tEnd-T*(double)nStart )).shiftTimes( T*(double)nStart );
+		_yRef = (yRef.getTimeSubGrid( tStart-T*(double)nStart,tEnd-T*(double)nStart,idx )).shiftTimes( T*(double)nStart );
 	}
 	else
 	{
-		_yRef = (yRef.getTimeSubGrid( tStart-T*(double)nStart,yRef.getLastTime() )).shiftTimes( T*(double)nStart );
+		_yRef = (yRef.getTimeSubGrid( tStart-T*(double)nStart,yRef.getLastTime(),idx )).shiftTimes( T*(double)nStart );
 		
 		for( int i=nStart+1; i<nEnd; ++i )
 			_yRef.appendTimes( VariablesGrid(yRef).shiftTimes( T*(double)i ),MM_KEEP );
 		
-		_yRef.appendTimes( (yRef.getTimeSubGrid( yRef.getFirstTime(),tEnd-T*(double)nEnd )).shiftTimes( T*(double)nEnd ) );
+		idx = 0;
+		_yRef.appendTimes( (yRef.getTimeSubGrid( yRef.getFirstTime(),tEnd-T*(double)nEnd,idx )).shiftTimes( T*(double)nEnd ) );
 	}
 	
 	return SUCCESSFUL_RETURN;
@@ -130,6 +133,16 @@ returnValue PeriodicReferenceTrajectory::getReference(	double tStart,
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+double PeriodicReferenceTrajectory::getGridTime(	double _time
+												) const
+{
+	double T = yRef.getLastTime() - yRef.getFirstTime();         // cycle duration
+
+	if ( acadoIsStrictlyGreater( T,0.0 ) == BT_FALSE )
+		return _time;
+
+	return _time - T*floor( (double) (_time/T+100.0*EPS) );
+}
 
 
 
@@ -43,6 +43,7 @@ BEGIN_NAMESPACE_ACADO
 
 StaticReferenceTrajectory::StaticReferenceTrajectory( ) : ReferenceTrajectory( )
 {
+	cursor = 0;
 }
 
 
@@ -66,6 +67,7 @@ StaticReferenceTrajectory::StaticReferenceTrajectory(	const VariablesGrid& _yRef
 
 // 	yRef.add( _yRef );
 	yRef = _yRef;
+	cursor = 0;
 
 	//setStatus( BS_READY );
 }
@@ -84,6 +86,7 @@ StaticReferenceTrajectory::StaticReferenceTrajectory(	const char* const _yRefFil
 
 // 	yRef.add( _yRef );
 	yRef = _yRef;
+	cursor = 0;
 
 	//setStatus( BS_READY );
 }
@@ -93,6 +96,7 @@ StaticReferenceTrajectory::StaticReferenceTrajectory(	const char* const _yRefFil
 StaticReferenceTrajectory::StaticReferenceTrajectory( const StaticReferenceTrajectory& rhs ) : ReferenceTrajectory( rhs )
 {
 	yRef = rhs.yRef;
+	cursor = rhs.cursor;
 }
 
 
@@ -108,6 +112,7 @@ StaticReferenceTrajectory& StaticReferenceTrajectory::operator=( const StaticRef
 		ReferenceTrajectory::operator=( rhs );
 
 		yRef = rhs.yRef;
+		cursor = rhs.cursor;
 	}
 
     return *this;
@@ -128,6 +133,11 @@ returnValue StaticReferenceTrajectory::init(	double startTime,
 												const Vector& _w
 												)
 {
+	cursor = 0;
+
+	if ( yRef.isEmpty( ) == BT_FALSE )
+		yRef.getFloorIndex( getGridTime( startTime ),cursor );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -141,6 +151,10 @@ returnValue StaticReferenceTrajectory::step(	double _currentTime,
 												const Vector& _w
 												)
 {
+	// the reference is requested from the current time onwards
+	if ( yRef.isEmpty( ) == BT_FALSE )
+		yRef.getFloorIndex( getGridTime( _currentTime ),cursor );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -168,9 +182,11 @@ returnValue StaticReferenceTrajectory::getReference(	double tStart,
 	
 //     return yRef.evaluate( tStart,tEnd,_yRef );
 
+	uint idx = cursor;
+
 	if ( acadoIsSmaller( tEnd,yRef.getLastTime() ) == BT_TRUE )
 	{
-		_yRef = yRef.getTimeSubGrid( tStart,tEnd );
+		_yRef = yRef.getTimeSubGrid( tStart,tEnd,idx );
 	}
 	else
 	{
@@ -182,7 +198,7 @@ returnValue StaticReferenceTrajectory::getReference(	double tStart,
 		}
 		else
 		{
-			_yRef = yRef.getTimeSubGrid( tStart,yRef.getLastTime() );
+			_yRef = yRef.getTimeSubGrid( tStart,yRef.getLastTime(),idx );
 			_yRef.setTime( _yRef.getLastIndex(),tEnd );
 		}
 	}
@@ -203,6 +219,11 @@ uint StaticReferenceTrajectory::getDim( ) const
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+double StaticReferenceTrajectory::getGridTime(	double _time
+												) const
+{
+	return _time;
+}
 
 
 
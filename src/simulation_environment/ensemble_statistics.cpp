@@ -0,0 +1,440 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+*    \file src/simulation_environment/ensemble_statistics.cpp
+*    \author Hans Joachim Ferreau, Boris Houska
+*/
+
+
+#include <acado/simulation_environment/ensemble_statistics.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+EnsembleStatistics::EnsembleStatistics( )
+{
+	dim      = 0;
+	nMembers = 0;
+
+	mean              = 0;
+	squaredDeviations = 0;
+
+	markerHeights   = 0;
+	markerPositions = 0;
+}
+
+
+EnsembleStatistics::EnsembleStatistics(	const Grid& _grid,
+										const Vector& _probabilities
+										)
+{
+	dim      = 0;
+	nMembers = 0;
+
+	mean              = 0;
+	squaredDeviations = 0;
+
+	markerHeights   = 0;
+	markerPositions = 0;
+
+	init( _grid,_probabilities );
+}
+
+
+EnsembleStatistics::EnsembleStatistics( const EnsembleStatistics& rhs )
+{
+	dim      = 0;
+	nMembers = 0;
+
+	mean              = 0;
+	squaredDeviations = 0;
+
+	markerHeights   = 0;
+	markerPositions = 0;
+
+	copy( rhs );
+}
+
+
+EnsembleStatistics::~EnsembleStatistics( )
+{
+	clear( );
+}
+
+
+EnsembleStatistics& EnsembleStatistics::operator=( const EnsembleStatistics& rhs )
+{
+	if ( this != &rhs )
+	{
+		clear( );
+		copy( rhs );
+	}
+
+	return *this;
+}
+
+
+
+returnValue EnsembleStatistics::init(	const Grid& _grid,
+										const Vector& _probabilities
+										)
+{
+	if ( _grid.isEmpty( ) == BT_TRUE )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	for( uint i=0; i<_probabilities.getDim( ); ++i )
+		if ( ( _probabilities(i) < 0.0 ) || ( _probabilities(i) > 1.0 ) )
+			return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	clear( );
+
+	grid          = _grid;
+	probabilities = _probabilities;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EnsembleStatistics::add(	const VariablesGrid& member
+										)
+{
+	if ( grid.isEmpty( ) == BT_TRUE )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	if ( member.getNumPoints( ) != grid.getNumPoints( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	uint nPoints    = grid.getNumPoints( );
+	uint nQuantiles = getNumQuantiles( );
+
+	// the first member determines the dimension
+	if ( mean == 0 )
+	{
+		dim = member.getNumValues( );
+
+		uint nCells = nPoints*dim;
+
+		mean              = new double[nCells];
+		squaredDeviations = new double[nCells];
+
+		for( uint i=0; i<nCells; ++i )
+		{
+			mean[i]              = 0.0;
+			squaredDeviations[i] = 0.0;
+		}
+
+		if ( nQuantiles > 0 )
+		{
+			markerHeights   = new double[nCells*nQuantiles*5];
+			markerPositions = new int   [nCells*nQuantiles*5];
+
+			for( uint i=0; i<nCells*nQuantiles*5; ++i )
+			{
+				markerHeights[i]   = 0.0;
+				markerPositions[i] = 0;
+			}
+		}
+	}
+
+	if ( member.getNumValues( ) != dim )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	++nMembers;
+
+	for( uint i=0; i<nPoints; ++i )
+	{
+		for( uint j=0; j<dim; ++j )
+		{
+			uint   cell = i*dim + j;
+			double x    = member( i,j );
+
+			// Welford's update of mean and variance
+			double delta = x - mean[cell];
+			mean[cell] += delta / ((double) nMembers);
+			squaredDeviations[cell] += delta * ( x - mean[cell] );
+
+			for( uint k=0; k<nQuantiles; ++k )
+				updateQuantile( probabilities(k),
+								&(markerHeights[(cell*nQuantiles+k)*5]),
+								&(markerPositions[(cell*nQuantiles+k)*5]),
+								x );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EnsembleStatistics::getMean(	VariablesGrid& _mean
+											) const
+{
+	if ( nMembers == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	_mean.init( dim,grid );
+
+	for( uint i=0; i<grid.getNumPoints( ); ++i )
+		for( uint j=0; j<dim; ++j )
+			_mean( i,j ) = mean[i*dim+j];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EnsembleStatistics::getVariance(	VariablesGrid& _variance
+												) const
+{
+	if ( nMembers == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	_variance.init( dim,grid );
+
+	for( uint i=0; i<grid.getNumPoints( ); ++i )
+		for( uint j=0; j<dim; ++j )
+		{
+			if ( nMembers > 1 )
+				_variance( i,j ) = squaredDeviations[i*dim+j] / ((double) nMembers-1);
+			else
+				_variance( i,j ) = 0.0;
+		}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EnsembleStatistics::getQuantile(	uint idx,
+												VariablesGrid& _quantile
+												) const
+{
+	if ( nMembers == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	if ( idx >= getNumQuantiles( ) )
+		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+	uint nQuantiles = getNumQuantiles( );
+
+	_quantile.init( dim,grid );
+
+	for( uint i=0; i<grid.getNumPoints( ); ++i )
+		for( uint j=0; j<dim; ++j )
+			_quantile( i,j ) = evaluateQuantile( probabilities(idx),&(markerHeights[((i*dim+j)*nQuantiles+idx)*5]) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void EnsembleStatistics::clear( )
+{
+	if ( mean != 0 )
+		delete[] mean;
+
+	if ( squaredDeviations != 0 )
+		delete[] squaredDeviations;
+
+	if ( markerHeights != 0 )
+		delete[] markerHeights;
+
+	if ( markerPositions != 0 )
+		delete[] markerPositions;
+
+	dim      = 0;
+	nMembers = 0;
+
+	mean              = 0;
+	squaredDeviations = 0;
+
+	markerHeights   = 0;
+	markerPositions = 0;
+}
+
+
+void EnsembleStatistics::copy(	const EnsembleStatistics& rhs
+								)
+{
+	grid          = rhs.grid;
+	probabilities = rhs.probabilities;
+
+	dim      = rhs.dim;
+	nMembers = rhs.nMembers;
+
+	uint nCells = grid.getNumPoints( )*dim;
+
+	if ( rhs.mean != 0 )
+	{
+		mean              = new double[nCells];
+		squaredDeviations = new double[nCells];
+
+		for( uint i=0; i<nCells; ++i )
+		{
+			mean[i]              = rhs.mean[i];
+			squaredDeviations[i] = rhs.squaredDeviations[i];
+		}
+	}
+
+	if ( rhs.markerHeights != 0 )
+	{
+		uint nMarkers = nCells*getNumQuantiles( )*5;
+
+		markerHeights   = new double[nMarkers];
+		markerPositions = new int   [nMarkers];
+
+		for( uint i=0; i<nMarkers; ++i )
+		{
+			markerHeights[i]   = rhs.markerHeights[i];
+			markerPositions[i] = rhs.markerPositions[i];
+		}
+	}
+}
+
+
+void EnsembleStatistics::updateQuantile(	double p,
+											double* heights,
+											int* positions,
+											double x
+											) const
+{
+	int i;
+
+	// the first five observations are stored in ascending order
+	if ( nMembers <= 5 )
+	{
+		for( i=(int)nMembers-1; ( i > 0 ) && ( heights[i-1] > x ); --i )
+			heights[i] = heights[i-1];
+		heights[i] = x;
+
+		if ( nMembers == 5 )
+			for( i=0; i<5; ++i )
+				positions[i] = i+1;
+
+		return;
+	}
+
+	// find cell containing the observation, adjust extreme markers
+	int k;
+
+	if ( x < heights[0] )
+	{
+		heights[0] = x;
+		k = 0;
+	}
+	else if ( x >= heights[4] )
+	{
+		heights[4] = x;
+		k = 3;
+	}
+	else
+	{
+		k = 0;
+		while ( x >= heights[k+1] )
+			++k;
+	}
+
+	for( i=k+1; i<5; ++i )
+		++positions[i];
+
+	// desired marker positions after nMembers observations
+	double n = (double) nMembers - 5.0;
+	double desired[5] = { 1.0,
+						  1.0 + 2.0*p + n*p/2.0,
+						  1.0 + 4.0*p + n*p,
+						  3.0 + 2.0*p + n*(1.0+p)/2.0,
+						  5.0 + n };
+
+	// adjust heights of middle markers (piecewise-parabolic, otherwise linear)
+	for( i=1; i<4; ++i )
+	{
+		double d = desired[i] - (double) positions[i];
+
+		if ( ( ( d >=  1.0 ) && ( positions[i+1]-positions[i] >  1 ) ) ||
+			 ( ( d <= -1.0 ) && ( positions[i-1]-positions[i] < -1 ) ) )
+		{
+			int s = ( d >= 0.0 ) ? 1 : -1;
+
+			double qp = heights[i] + ((double) s) / ((double) (positions[i+1]-positions[i-1])) *
+						( ((double) (positions[i]-positions[i-1]+s)) * (heights[i+1]-heights[i]) / ((double) (positions[i+1]-positions[i]))
+						+ ((double) (positions[i+1]-positions[i]-s)) * (heights[i]-heights[i-1]) / ((double) (positions[i]-positions[i-1])) );
+
+			if ( ( heights[i-1] < qp ) && ( qp < heights[i+1] ) )
+				heights[i] = qp;
+			else
+				heights[i] += ((double) s) * (heights[i+s]-heights[i]) / ((double) (positions[i+s]-positions[i]));
+
+			positions[i] += s;
+		}
+	}
+}
+
+
+double EnsembleStatistics::evaluateQuantile(	double p,
+												const double* heights
+												) const
+{
+	// few observations: interpolate between the sorted observations
+	if ( nMembers <= 5 )
+	{
+		double r  = p * ((double) nMembers-1);
+		uint   lo = (uint) floor( r );
+
+		if ( lo+1 >= nMembers )
+			return heights[nMembers-1];
+
+		return heights[lo] + ( r-(double)lo ) * ( heights[lo+1]-heights[lo] );
+	}
+
+	// extreme markers track minimum and maximum exactly
+	if ( acadoIsZero( p ) == BT_TRUE )
+		return heights[0];
+
+	if ( acadoIsEqual( p,1.0 ) == BT_TRUE )
+		return heights[4];
+
+	return heights[2];
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
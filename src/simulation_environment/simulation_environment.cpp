@@ -305,8 +305,12 @@ returnValue SimulationEnvironment::step( )
 		return ACADOERROR( RET_BLOCK_NOT_READY );
 
 
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
 	++nSteps;
-	acadoPrintf( "\n*** SIMULATION LOOP NO. %d (starting at time %.3f) ***\n",nSteps,simulationClock.getTime( ) );
+	if ( (PrintLevel)printLevel > NONE )
+		acadoPrintf( "\n*** SIMULATION LOOP NO. %d (starting at time %.3f) ***\n",nSteps,simulationClock.getTime( ) );
 
 	/* Perform one single simulation loop */
 	Vector u, p;
@@ -328,9 +332,6 @@ returnValue SimulationEnvironment::step( )
 	// step controller
 // 	yPrevious.print("controller input y");
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
-
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		acadoPrintf( "--> Calling controller ...\n" );
 
@@ -477,6 +478,25 @@ returnValue SimulationEnvironment::run( )
 }
 
 
+returnValue SimulationEnvironment::runEnsemble(	const Matrix& _x0,
+												EnsembleStatistics& _outputStatistics,
+												uint _seed
+												)
+{
+	return simulateEnsemble( _x0,&_outputStatistics,0,_seed );
+}
+
+
+returnValue SimulationEnvironment::runEnsemble(	const Matrix& _x0,
+												EnsembleStatistics& _outputStatistics,
+												EnsembleStatistics& _controlStatistics,
+												uint _seed
+												)
+{
+	return simulateEnsemble( _x0,&_outputStatistics,&_controlStatistics,_seed );
+}
+
+
 
 // PROTECTED FUCNTIONS:
 // --------------------
@@ -486,6 +506,7 @@ returnValue SimulationEnvironment::setupOptions( )
 	addOption( SIMULATE_COMPUTATIONAL_DELAY , defaultSimulateComputationalDelay );
 	addOption( COMPUTATIONAL_DELAY_FACTOR   , defaultComputationalDelayFactor   );
 	addOption( COMPUTATIONAL_DELAY_OFFSET   , defaultComputationalDelayOffset   );
+	addOption( ENSEMBLE_THREADS             , defaultEnsembleThreads            );
 	addOption( PRINTLEVEL                   , defaultPrintlevel                 );
 
 	return SUCCESSFUL_RETURN;
@@ -525,6 +546,161 @@ double SimulationEnvironment::determineComputationalDelay(	double controllerRunt
 }
 
 
+returnValue SimulationEnvironment::simulateEnsemble(	const Matrix& _x0,
+														EnsembleStatistics* _outputStatistics,
+														EnsembleStatistics* _controlStatistics,
+														uint _seed
+														)
+{
+	if ( process == 0 )
+		return ACADOERROR( RET_NO_PROCESS_SPECIFIED );
+
+	if ( controller == 0 )
+		return ACADOERROR( RET_NO_CONTROLLER_SPECIFIED );
+
+	if ( _x0.getNumRows( ) == 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	if ( _outputStatistics->getGrid( ).isEmpty( ) == BT_TRUE )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	if ( ( _controlStatistics != 0 ) && ( _controlStatistics->getGrid( ).isEmpty( ) == BT_TRUE ) )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	int nThreads = 1;
+	get( ENSEMBLE_THREADS,nThreads );
+
+	#ifndef _OPENMP
+	nThreads = 1;
+	#endif
+
+	if ( nThreads < 1 )
+		nThreads = 1;
+
+	int nMembers = (int) _x0.getNumRows( );
+	int run1;
+
+	// the members are simulated in windows of nThreads members, one per
+	// thread, and the results of each window are added in the order of
+	// the members, such that the statistics do not depend on the number
+	// of threads and at most nThreads results are buffered:
+	VariablesGrid** outputs  = new VariablesGrid*[nThreads];
+	VariablesGrid** controls = new VariablesGrid*[nThreads];
+
+	for( run1 = 0; run1 < nThreads; run1++ )
+	{
+		outputs[run1]  = 0;
+		controls[run1] = 0;
+	}
+
+	int nFailed = 0;
+
+	#ifdef _OPENMP
+	#pragma omp parallel num_threads( nThreads )
+	#endif
+	for( int first = 0; first < nMembers; first += nThreads )
+	{
+		int last = acadoMin( first+nThreads,nMembers );
+
+		#ifdef _OPENMP
+		#pragma omp for schedule( static,1 )
+		#endif
+		for( int idx = first; idx < last; idx++ )
+		{
+			Process*               memberProcess    = 0;
+			Controller*            memberController = 0;
+			SimulationEnvironment* member           = 0;
+			BooleanType            isReady          = BT_FALSE;
+
+			// copies of the symbolic parts (dynamic systems, optimal control
+			// problems) share expression trees and are not thread-safe
+			#ifdef _OPENMP
+			#pragma omp critical( acado_simulation_ensemble )
+			#endif
+			{
+				if ( (PrintLevel)printLevel >= MEDIUM )
+					acadoPrintf( "\n*** SIMULATION ENSEMBLE MEMBER NO. %d OUT OF %d ***\n",idx+1,nMembers );
+
+				memberProcess = new Process( *process );
+				memberProcess->setNoiseSeed( Noise::deriveSeed( _seed,(uint)idx ) );
+
+				memberController = controller->clone( );
+
+				member = new SimulationEnvironment( startTime,endTime,*memberProcess,*memberController );
+				member->setOptions( *this );
+				member->set( PRINTLEVEL,NONE );
+
+				if ( member->init( _x0.getRow( idx ) ) == SUCCESSFUL_RETURN )
+					isReady = BT_TRUE;
+			}
+
+			VariablesGrid* output  = 0;
+			VariablesGrid* control = 0;
+
+			if ( ( isReady == BT_TRUE ) && ( member->run( ) == SUCCESSFUL_RETURN ) )
+			{
+				output = new VariablesGrid;
+				member->processOutput.discretize( _outputStatistics->getGrid( ),*output );
+
+				if ( _controlStatistics != 0 )
+				{
+					control = new VariablesGrid;
+					member->feedbackControl.discretize( _controlStatistics->getGrid( ),*control );
+				}
+			}
+
+			#ifdef _OPENMP
+			#pragma omp critical( acado_simulation_ensemble )
+			#endif
+			{
+				delete member;
+				delete memberController;
+				delete memberProcess;
+			}
+
+			outputs[idx-first]  = output;
+			controls[idx-first] = control;
+		}
+
+		#ifdef _OPENMP
+		#pragma omp single
+		#endif
+		for( int idx = 0; idx < last-first; idx++ )
+		{
+			if ( outputs[idx] != 0 )
+			{
+				_outputStatistics->add( *(outputs[idx]) );
+
+				if ( controls[idx] != 0 )
+					_controlStatistics->add( *(controls[idx]) );
+			}
+			else
+				++nFailed;
+
+			if ( outputs[idx] != 0 )
+				delete outputs[idx];
+
+			if ( controls[idx] != 0 )
+				delete controls[idx];
+
+			outputs[idx]  = 0;
+			controls[idx] = 0;
+		}
+	}
+
+	delete[] outputs;
+	delete[] controls;
+
+	if ( nFailed > 0 )
+		return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 
 CLOSE_NAMESPACE_ACADO
@@ -1308,6 +1308,26 @@ Expression Expression::ADbackward( const Expression &arg, const Expression &seed
 }
 
 
+Expression Expression::shareSubexpressions( ) const{
+
+    uint run1;
+
+    Expression result( *this );
+    SubexpressionTable subexpressions;
+
+    for( run1 = 0; run1 < getDim(); run1++ )
+        if( subexpressions.add( *element[run1] ) != SUCCESSFUL_RETURN )
+            return result;
+
+    for( run1 = 0; run1 < getDim(); run1++ ){
+        delete result.element[run1];
+        result.element[run1] = subexpressions.share( *element[run1] );
+    }
+
+    return result;
+}
+
+
 returnValue Expression::substitute( int idx, const Expression &arg ) const{
 
     ASSERT( arg.getDim() == 1 );
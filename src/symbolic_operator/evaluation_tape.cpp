@@ -0,0 +1,1223 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/symbolic_operator/evaluation_tape.cpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+EvaluationWorkspace::EvaluationWorkspace( ){
+
+    nRegisters    = 0;
+    nTrace        = 0;
+    nDirections   = 1;
+    nPoints       = 1;
+    nTracedPoints = 0;
+    w             = 0;
+    dw            = 0;
+    trace         = 0;
+}
+
+
+EvaluationWorkspace::EvaluationWorkspace( const EvaluationTape& tape, int nDirections_, int nPoints_ ){
+
+    nRegisters    = 0;
+    nTrace        = 0;
+    nDirections   = 1;
+    nPoints       = 1;
+    nTracedPoints = 0;
+    w             = 0;
+    dw            = 0;
+    trace         = 0;
+
+    init( tape,nDirections_,nPoints_ );
+}
+
+
+EvaluationWorkspace::EvaluationWorkspace( const EvaluationWorkspace& rhs ){
+
+    nRegisters    = 0;
+    nTrace        = 0;
+    nDirections   = 1;
+    nPoints       = 1;
+    nTracedPoints = 0;
+    w             = 0;
+    dw            = 0;
+    trace         = 0;
+
+    copy( rhs );
+}
+
+
+EvaluationWorkspace::~EvaluationWorkspace( ){
+
+    if( w     != 0 ) free( w );
+    if( dw    != 0 ) free( dw );
+    if( trace != 0 ) free( trace );
+}
+
+
+EvaluationWorkspace& EvaluationWorkspace::operator=( const EvaluationWorkspace& rhs ){
+
+    if( this != &rhs ) copy( rhs );
+    return *this;
+}
+
+
+returnValue EvaluationWorkspace::init( const EvaluationTape& tape, int nDirections_, int nPoints_ ){
+
+    if( nDirections_ < 1 || nPoints_ < 1 )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    allocate( tape.getWorkspaceSize(), 2*tape.getNumInstructions(), nDirections_, nPoints_ );
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType EvaluationWorkspace::fits( const EvaluationTape& tape, int nDirections_, int nPoints_ ) const{
+
+    if( nRegisters  < tape.getWorkspaceSize() )     return BT_FALSE;
+    if( nTrace      < 2*tape.getNumInstructions() ) return BT_FALSE;
+    if( nDirections < nDirections_ )                return BT_FALSE;
+    if( nPoints     < nPoints_ )                    return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+void EvaluationWorkspace::allocate( int nRegisters_, int nTrace_, int nDirections_, int nPoints_ ){
+
+    if( w     != 0 ) free( w );
+    if( dw    != 0 ) free( dw );
+    if( trace != 0 ) free( trace );
+
+    nRegisters    = nRegisters_;
+    nTrace        = nTrace_;
+    nDirections   = nDirections_;
+    nPoints       = nPoints_;
+    nTracedPoints = 0;
+
+    // registers and trace hold the values of all points of a batched
+    // evaluation, derivative registers are needed for a single point:
+    w     = (double*)calloc( nRegisters*nPoints +1,sizeof(double) );
+    dw    = (double*)calloc( nRegisters*nDirections+1,sizeof(double) );
+    trace = (double*)calloc( nTrace*nPoints     +1,sizeof(double) );
+}
+
+
+void EvaluationWorkspace::copy( const EvaluationWorkspace& rhs ){
+
+    allocate( rhs.nRegisters, rhs.nTrace, rhs.nDirections, rhs.nPoints );
+
+    // (a default constructed workspace holds no memory)
+    if( rhs.w == 0 )
+        return;
+
+    // the trace of a batched evaluation remains valid:
+    nTracedPoints = rhs.nTracedPoints;
+    memcpy( w    , rhs.w    , (nRegisters*nPoints +1)*sizeof(double) );
+    memcpy( dw   , rhs.dw   , (nRegisters*nDirections+1)*sizeof(double) );
+    memcpy( trace, rhs.trace, (nTrace*nPoints     +1)*sizeof(double) );
+}
+
+
+
+EvaluationTape::EvaluationTape( ) : EvaluationBase( ){
+
+    instructions    = 0;
+    nInstructions   = 0;
+    maxInstructions = 0;
+
+    nRegisters = 0;
+    work       = 0;
+    batchWork  = 0;
+    nBatchWork = 0;
+
+    reg     = 0;
+    isValid = BT_TRUE;
+
+    firstShared = 0;
+    nShared     = 0;
+    shared      = 0;
+    isStored    = 0;
+}
+
+
+EvaluationTape::EvaluationTape( const EvaluationTape& rhs ) : EvaluationBase( ){
+
+    instructions    = 0;
+    nInstructions   = 0;
+    maxInstructions = 0;
+
+    nRegisters = 0;
+    work       = 0;
+    batchWork  = 0;
+    nBatchWork = 0;
+
+    firstShared = 0;
+    nShared     = 0;
+    shared      = 0;
+    isStored    = 0;
+
+    copy( rhs );
+}
+
+
+EvaluationTape::~EvaluationTape( ){
+
+    if( instructions != 0 ) free( instructions );
+    if( work         != 0 ) free( work );
+    if( batchWork    != 0 ) free( batchWork );
+
+    clearShared( );
+}
+
+
+EvaluationTape& EvaluationTape::operator=( const EvaluationTape& rhs ){
+
+    if( this != &rhs ) copy( rhs );
+    return *this;
+}
+
+
+returnValue EvaluationTape::clear( ){
+
+    nInstructions = 0;
+    nRegisters    = 0;
+    reg           = 0;
+    isValid       = BT_TRUE;
+
+    clearShared( );
+
+    return native.unload( );
+}
+
+
+returnValue EvaluationTape::shareSubexpressions( int firstIndex_, int nShared_, Operator **args ){
+
+    int run1;
+
+    // the shared registers are placed below the stack of all instructions:
+    if( isEmpty() == BT_FALSE || nShared_ < 0 )
+        return ACADOERROR( RET_INVALID_USE_OF_FUNCTION );
+
+    clearShared( );
+
+    firstShared = firstIndex_;
+    nShared     = nShared_;
+
+    if( nShared > 0 ){
+
+        shared   = (Operator**)calloc( nShared,sizeof(Operator*) );
+        isStored = (BooleanType*)calloc( nShared,sizeof(BooleanType) );
+
+        for( run1 = 0; run1 < nShared; run1++ ){
+            shared  [run1] = args[run1]->clone();
+            isStored[run1] = BT_FALSE;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::addIntermediateState( Operator& arg, int xIndex ){
+
+    if( record( arg,nShared ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+    append( TIC_STORE_INTERMEDIATE, xIndex, nShared, 0 );
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::addComponent( Operator& arg, int component ){
+
+    if( record( arg,nShared ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+    append( TIC_STORE_RESULT, component, nShared, 0 );
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::evaluate( double *x, double *result ){
+
+    return evaluate( x, result, work );
+}
+
+
+returnValue EvaluationTape::evaluate( double *x, double *result, double *w ) const{
+
+    if( native.isLoaded() == BT_TRUE ){
+        native.evaluate( x,result );
+        return SUCCESSFUL_RETURN;
+    }
+
+    const TapeInstruction *it  = instructions;
+    const TapeInstruction *end = instructions + nInstructions;
+
+    for( ; it != end; ++it ){
+
+        switch( it->code ){
+
+            case TIC_LOAD_VARIABLE:      w[it->dest] = x[it->arg1];                   break;
+            case TIC_LOAD_CONSTANT:      w[it->dest] = it->value;                     break;
+            case TIC_ADDITION:           w[it->dest] = w[it->arg1] + w[it->arg2];     break;
+            case TIC_SUBTRACTION:        w[it->dest] = w[it->arg1] - w[it->arg2];     break;
+            case TIC_PRODUCT:            w[it->dest] = w[it->arg1] * w[it->arg2];     break;
+            case TIC_QUOTIENT:           w[it->dest] = w[it->arg1] / w[it->arg2];     break;
+            case TIC_POWER:              w[it->dest] = pow( w[it->arg1], w[it->arg2] ); break;
+            case TIC_POWER_INT:          w[it->dest] = pow( w[it->arg1], it->arg2 );  break;
+            case TIC_SIN:                w[it->dest] = sin ( w[it->arg1] );           break;
+            case TIC_COS:                w[it->dest] = cos ( w[it->arg1] );           break;
+            case TIC_TAN:                w[it->dest] = tan ( w[it->arg1] );           break;
+            case TIC_ASIN:               w[it->dest] = asin( w[it->arg1] );           break;
+            case TIC_ACOS:               w[it->dest] = acos( w[it->arg1] );           break;
+            case TIC_ATAN:               w[it->dest] = atan( w[it->arg1] );           break;
+            case TIC_LOGARITHM:          w[it->dest] = log ( w[it->arg1] );           break;
+            case TIC_EXP:                w[it->dest] = exp ( w[it->arg1] );           break;
+            case TIC_STORE_INTERMEDIATE: x[it->dest] = w[it->arg1];                   break;
+            case TIC_STORE_RESULT:       result[it->dest] = w[it->arg1];              break;
+            case TIC_LOAD_REGISTER:      w[it->dest] = w[it->arg1];                   break;
+            case TIC_STORE_REGISTER:     w[it->dest] = w[it->arg1];                   break;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::evaluate( double *x, double *result, EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this ) == BT_FALSE )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    return evaluate( x, result, ws.w );
+}
+
+
+returnValue EvaluationTape::evaluateBatch( int nPoints, double *x, double *result ){
+
+    if( nPoints*nRegisters > nBatchWork ){
+
+        nBatchWork = nPoints*nRegisters;
+        batchWork  = (double*)realloc( batchWork, nBatchWork*sizeof(double) );
+    }
+
+    return evaluateBatch( nPoints, x, result, batchWork );
+}
+
+
+returnValue EvaluationTape::evaluateBatch( int nPoints, double *x, double *result, double *w ) const{
+
+    batchSweep( nPoints, x, result, w, 0 );
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::evaluateBatch( int nPoints, double *x, double *result,
+                                           EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this,1,nPoints ) == BT_FALSE )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    batchSweep( nPoints, x, result, ws.w, ws.trace );
+    ws.nTracedPoints = nPoints;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::AD_forward( double *x, double *seed, double *f, double *df,
+                                        EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this ) == BT_FALSE )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    if( native.isLoaded() == BT_TRUE ){
+        native.AD_forward( 1,x,seed,f,df,ws.dw );
+        return SUCCESSFUL_RETURN;
+    }
+
+    double *w  = ws.w ;
+    double *dw = ws.dw;
+    double  a = 0.0, b, da = 0.0, db, v;
+
+    const TapeInstruction *it  = instructions;
+    const TapeInstruction *end = instructions + nInstructions;
+
+    for( ; it != end; ++it ){
+
+        // the target register coincides with the first argument (except
+        // for copies between registers), hence the arguments are read
+        // before anything is written:
+        if( it->code != TIC_LOAD_VARIABLE && it->code != TIC_LOAD_CONSTANT ){
+            a  = w [it->arg1];
+            da = dw[it->arg1];
+        }
+
+        switch( it->code ){
+
+            case TIC_LOAD_VARIABLE:
+                w [it->dest] = x   [it->arg1];
+                dw[it->dest] = seed[it->arg1];
+                break;
+
+            case TIC_LOAD_CONSTANT:
+                w [it->dest] = it->value;
+                dw[it->dest] = 0.0;
+                break;
+
+            case TIC_ADDITION:
+                w [it->dest] = a  + w [it->arg2];
+                dw[it->dest] = da + dw[it->arg2];
+                break;
+
+            case TIC_SUBTRACTION:
+                w [it->dest] = a  - w [it->arg2];
+                dw[it->dest] = da - dw[it->arg2];
+                break;
+
+            case TIC_PRODUCT:
+                b = w[it->arg2]; db = dw[it->arg2];
+                w [it->dest] = a*b;
+                dw[it->dest] = da*b + a*db;
+                break;
+
+            case TIC_QUOTIENT:
+                b = w[it->arg2]; db = dw[it->arg2];
+                w [it->dest] = a/b;
+                dw[it->dest] = da/b - a*db/(b*b);
+                break;
+
+            case TIC_POWER:
+                b = w[it->arg2]; db = dw[it->arg2];
+                v = pow( a,b );
+                w [it->dest] = v;
+                dw[it->dest] = b*pow( a,b-1.0 )*da + v*log( a )*db;
+                break;
+
+            case TIC_POWER_INT:
+                w [it->dest] = pow( a,it->arg2 );
+                dw[it->dest] = it->arg2*pow( a,it->arg2-1 )*da;
+                break;
+
+            case TIC_SIN:       w[it->dest] = sin ( a ); dw[it->dest] =  cos( a )*da;              break;
+            case TIC_COS:       w[it->dest] = cos ( a ); dw[it->dest] = -sin( a )*da;              break;
+            case TIC_TAN:       v = tan( a ); w[it->dest] = v; dw[it->dest] = (1.0+v*v)*da;       break;
+            case TIC_ASIN:      w[it->dest] = asin( a ); dw[it->dest] =  da/sqrt( 1.0-a*a );       break;
+            case TIC_ACOS:      w[it->dest] = acos( a ); dw[it->dest] = -da/sqrt( 1.0-a*a );       break;
+            case TIC_ATAN:      w[it->dest] = atan( a ); dw[it->dest] =  da/( 1.0+a*a );           break;
+            case TIC_LOGARITHM: w[it->dest] = log ( a ); dw[it->dest] =  da/a;                     break;
+            case TIC_EXP:       v = exp( a ); w[it->dest] = v; dw[it->dest] = v*da;               break;
+
+            case TIC_STORE_INTERMEDIATE:
+                x   [it->dest] = a ;
+                seed[it->dest] = da;
+                break;
+
+            case TIC_STORE_RESULT:
+                f [it->dest] = a ;
+                df[it->dest] = da;
+                break;
+
+            case TIC_LOAD_REGISTER:
+            case TIC_STORE_REGISTER:
+                w [it->dest] = a ;
+                dw[it->dest] = da;
+                break;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::AD_forward( int nDirections, double *x, double *seed, double *f, double *df,
+                                        EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this,nDirections ) == BT_FALSE )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    if( native.isLoaded() == BT_TRUE ){
+        native.AD_forward( nDirections,x,seed,f,df,ws.dw );
+        return SUCCESSFUL_RETURN;
+    }
+
+    int     j;
+    double *w  = ws.w ;
+    double *dw = ws.dw;
+    double  a = 0.0, b, v, p;
+
+    const TapeInstruction *it  = instructions;
+    const TapeInstruction *end = instructions + nInstructions;
+
+    for( ; it != end; ++it ){
+
+        // the derivatives of all directions are stored contiguously; as the
+        // target register coincides with the first argument, d and da may
+        // point to the same memory (which is fine as all updates are
+        // element-wise):
+        double       *d  = dw + it->dest*nDirections;
+        const double *da = dw + it->arg1*nDirections;
+        const double *db = dw + it->arg2*nDirections;
+
+        if( it->code != TIC_LOAD_VARIABLE && it->code != TIC_LOAD_CONSTANT )
+            a = w[it->arg1];
+
+        switch( it->code ){
+
+            case TIC_LOAD_VARIABLE:
+                w[it->dest] = x[it->arg1];
+                da = seed + it->arg1*nDirections;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j];
+                break;
+
+            case TIC_LOAD_CONSTANT:
+                w[it->dest] = it->value;
+                for( j = 0; j < nDirections; j++ ) d[j] = 0.0;
+                break;
+
+            case TIC_ADDITION:
+                w[it->dest] = a + w[it->arg2];
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j] + db[j];
+                break;
+
+            case TIC_SUBTRACTION:
+                w[it->dest] = a - w[it->arg2];
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j] - db[j];
+                break;
+
+            case TIC_PRODUCT:
+                b = w[it->arg2];
+                w[it->dest] = a*b;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j]*b + a*db[j];
+                break;
+
+            case TIC_QUOTIENT:
+                b = w[it->arg2];
+                w[it->dest] = a/b;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j]/b - a*db[j]/(b*b);
+                break;
+
+            case TIC_POWER:
+                b = w[it->arg2];
+                v = pow( a,b );
+                w[it->dest] = v;
+                p = b*pow( a,b-1.0 ); v = v*log( a );
+                for( j = 0; j < nDirections; j++ ) d[j] = p*da[j] + v*db[j];
+                break;
+
+            case TIC_POWER_INT:
+                w[it->dest] = pow( a,it->arg2 );
+                p = it->arg2*pow( a,it->arg2-1 );
+                for( j = 0; j < nDirections; j++ ) d[j] = p*da[j];
+                break;
+
+            case TIC_SIN:       w[it->dest] = sin ( a ); p =  cos( a );  for( j = 0; j < nDirections; j++ ) d[j] = p*da[j];  break;
+            case TIC_COS:       w[it->dest] = cos ( a ); p = -sin( a );  for( j = 0; j < nDirections; j++ ) d[j] = p*da[j];  break;
+            case TIC_TAN:       v = tan( a ); w[it->dest] = v; p = 1.0+v*v; for( j = 0; j < nDirections; j++ ) d[j] = p*da[j]; break;
+            case TIC_ASIN:      w[it->dest] = asin( a ); p = sqrt( 1.0-a*a ); for( j = 0; j < nDirections; j++ ) d[j] =  da[j]/p; break;
+            case TIC_ACOS:      w[it->dest] = acos( a ); p = sqrt( 1.0-a*a ); for( j = 0; j < nDirections; j++ ) d[j] = -da[j]/p; break;
+            case TIC_ATAN:      w[it->dest] = atan( a ); p = 1.0+a*a;    for( j = 0; j < nDirections; j++ ) d[j] = da[j]/p;  break;
+            case TIC_LOGARITHM: w[it->dest] = log ( a );                 for( j = 0; j < nDirections; j++ ) d[j] = da[j]/a;  break;
+            case TIC_EXP:       v = exp( a ); w[it->dest] = v;           for( j = 0; j < nDirections; j++ ) d[j] = v*da[j];  break;
+
+            case TIC_STORE_INTERMEDIATE:
+                x[it->dest] = a;
+                d = seed + it->dest*nDirections;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j];
+                break;
+
+            case TIC_STORE_RESULT:
+                f[it->dest] = a;
+                d = df + it->dest*nDirections;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j];
+                break;
+
+            case TIC_LOAD_REGISTER:
+            case TIC_STORE_REGISTER:
+                w[it->dest] = a;
+                for( j = 0; j < nDirections; j++ ) d[j] = da[j];
+                break;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::AD_backward( double *x, double *seed, double *df,
+                                         EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this ) == BT_FALSE )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    if( native.isLoaded() == BT_TRUE ){
+        native.AD_backward( x,seed,df,ws.dw,ws.trace );
+        return SUCCESSFUL_RETURN;
+    }
+
+    int     run1;
+    double *w     = ws.w    ;
+    double *adj   = ws.dw   ;
+    double *trace = ws.trace;
+
+    // forward sweep recording the arguments of each instruction:
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        if( it.code != TIC_LOAD_VARIABLE && it.code != TIC_LOAD_CONSTANT )
+            trace[2*run1  ] = w[it.arg1];
+        if( it.code >= TIC_ADDITION && it.code <= TIC_POWER )   // binary instructions
+            trace[2*run1+1] = w[it.arg2];
+
+        switch( it.code ){
+
+            case TIC_LOAD_VARIABLE:      w[it.dest] = x[it.arg1];                 break;
+            case TIC_LOAD_CONSTANT:      w[it.dest] = it.value;                   break;
+            case TIC_ADDITION:           w[it.dest] = w[it.arg1] + w[it.arg2];    break;
+            case TIC_SUBTRACTION:        w[it.dest] = w[it.arg1] - w[it.arg2];    break;
+            case TIC_PRODUCT:            w[it.dest] = w[it.arg1] * w[it.arg2];    break;
+            case TIC_QUOTIENT:           w[it.dest] = w[it.arg1] / w[it.arg2];    break;
+            case TIC_POWER:              w[it.dest] = pow( w[it.arg1], w[it.arg2] ); break;
+            case TIC_POWER_INT:          w[it.dest] = pow( w[it.arg1], it.arg2 ); break;
+            case TIC_SIN:                w[it.dest] = sin ( w[it.arg1] );         break;
+            case TIC_COS:                w[it.dest] = cos ( w[it.arg1] );         break;
+            case TIC_TAN:                w[it.dest] = tan ( w[it.arg1] );         break;
+            case TIC_ASIN:               w[it.dest] = asin( w[it.arg1] );         break;
+            case TIC_ACOS:               w[it.dest] = acos( w[it.arg1] );         break;
+            case TIC_ATAN:               w[it.dest] = atan( w[it.arg1] );         break;
+            case TIC_LOGARITHM:          w[it.dest] = log ( w[it.arg1] );         break;
+            case TIC_EXP:                w[it.dest] = exp ( w[it.arg1] );         break;
+            case TIC_STORE_INTERMEDIATE: x[it.dest] = w[it.arg1];                 break;
+            case TIC_STORE_RESULT:                                                break;
+            case TIC_LOAD_REGISTER:      w[it.dest] = w[it.arg1];                 break;
+            case TIC_STORE_REGISTER:     w[it.dest] = w[it.arg1];                 break;
+        }
+    }
+
+    backwardSweep( trace, 1, seed, df, adj );
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::AD_backward( int point, double *seed, double *df,
+                                         EvaluationWorkspace& ws ) const{
+
+    if( ws.fits( *this ) == BT_FALSE || point < 0 || point >= ws.nTracedPoints )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    backwardSweep( ws.trace+point, ws.nTracedPoints, seed, df, ws.dw );
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::exportCode( FILE *file ) const{
+
+    int run1;
+
+    // constants are printed with 17 significant digits, which is exact
+    // for finite values only:
+    for( run1 = 0; run1 < nInstructions; run1++ )
+        if( instructions[run1].code == TIC_LOAD_CONSTANT )
+            if( acadoIsNaN( instructions[run1].value - instructions[run1].value ) == BT_TRUE )
+                return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+    acadoFPrintf( file,"/* Native code of an ACADO evaluation tape (generated, do not edit). */\n\n" );
+    acadoFPrintf( file,"#include <math.h>\n\n" );
+    acadoFPrintf( file,"extern \"C\" {\n\n" );
+
+
+    // EVALUATION:
+    // -----------
+    acadoFPrintf( file,"void acado_native_evaluate( double *x, double *f ){\n\n" );
+    acadoFPrintf( file,"    double w[%d];\n\n",nRegisters+1 );
+
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        if( it.code == TIC_STORE_RESULT )
+            acadoFPrintf( file,"    f[%d] = w[%d];\n",it.dest,it.arg1 );
+        else
+            exportInstruction( file,it );
+    }
+    acadoFPrintf( file,"}\n\n" );
+
+
+    // FORWARD AD (SEE THE MULTI-DIRECTION VERSION OF AD_forward):
+    // ------------------------------------------------------------
+    acadoFPrintf( file,"void acado_native_forward( int nd, double *x, double *seed, double *f, double *df, double *dw ){\n\n" );
+    acadoFPrintf( file,"    int j;\n" );
+    acadoFPrintf( file,"    double w[%d];\n",nRegisters+1 );
+    acadoFPrintf( file,"    double a, b, v, p;\n" );
+    acadoFPrintf( file,"    double *d;\n" );
+    acadoFPrintf( file,"    const double *da, *db;\n\n" );
+
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        acadoFPrintf( file,"    " );
+
+        if( it.code != TIC_STORE_INTERMEDIATE && it.code != TIC_STORE_RESULT )
+            acadoFPrintf( file,"d = dw+%d*nd; ",it.dest );
+
+        if( it.code != TIC_LOAD_VARIABLE && it.code != TIC_LOAD_CONSTANT )
+            acadoFPrintf( file,"a = w[%d]; da = dw+%d*nd; ",it.arg1,it.arg1 );
+        if( it.code >= TIC_ADDITION && it.code <= TIC_POWER )
+            acadoFPrintf( file,"db = dw+%d*nd; ",it.arg2 );
+
+        switch( it.code ){
+
+            case TIC_LOAD_VARIABLE:
+                acadoFPrintf( file,"w[%d] = x[%d]; da = seed+%d*nd; for( j = 0; j < nd; j++ ) d[j] = da[j];\n",it.dest,it.arg1,it.arg1 );
+                break;
+
+            case TIC_LOAD_CONSTANT:
+                acadoFPrintf( file,"w[%d] = %.16e; for( j = 0; j < nd; j++ ) d[j] = 0.0;\n",it.dest,it.value );
+                break;
+
+            case TIC_ADDITION:
+                acadoFPrintf( file,"w[%d] = a + w[%d]; for( j = 0; j < nd; j++ ) d[j] = da[j] + db[j];\n",it.dest,it.arg2 );
+                break;
+
+            case TIC_SUBTRACTION:
+                acadoFPrintf( file,"w[%d] = a - w[%d]; for( j = 0; j < nd; j++ ) d[j] = da[j] - db[j];\n",it.dest,it.arg2 );
+                break;
+
+            case TIC_PRODUCT:
+                acadoFPrintf( file,"b = w[%d]; w[%d] = a*b; for( j = 0; j < nd; j++ ) d[j] = da[j]*b + a*db[j];\n",it.arg2,it.dest );
+                break;
+
+            case TIC_QUOTIENT:
+                acadoFPrintf( file,"b = w[%d]; w[%d] = a/b; for( j = 0; j < nd; j++ ) d[j] = da[j]/b - a*db[j]/(b*b);\n",it.arg2,it.dest );
+                break;
+
+            case TIC_POWER:
+                acadoFPrintf( file,"b = w[%d]; v = pow( a,b ); w[%d] = v; p = b*pow( a,b-1.0 ); v = v*log( a ); for( j = 0; j < nd; j++ ) d[j] = p*da[j] + v*db[j];\n",it.arg2,it.dest );
+                break;
+
+            case TIC_POWER_INT:
+                acadoFPrintf( file,"w[%d] = pow( a,%d ); p = %d*pow( a,%d ); for( j = 0; j < nd; j++ ) d[j] = p*da[j];\n",it.dest,it.arg2,it.arg2,it.arg2-1 );
+                break;
+
+            case TIC_SIN:       acadoFPrintf( file,"w[%d] = sin( a ); p = cos( a ); for( j = 0; j < nd; j++ ) d[j] = p*da[j];\n",it.dest );           break;
+            case TIC_COS:       acadoFPrintf( file,"w[%d] = cos( a ); p = -sin( a ); for( j = 0; j < nd; j++ ) d[j] = p*da[j];\n",it.dest );          break;
+            case TIC_TAN:       acadoFPrintf( file,"v = tan( a ); w[%d] = v; p = 1.0+v*v; for( j = 0; j < nd; j++ ) d[j] = p*da[j];\n",it.dest );     break;
+            case TIC_ASIN:      acadoFPrintf( file,"w[%d] = asin( a ); p = sqrt( 1.0-a*a ); for( j = 0; j < nd; j++ ) d[j] = da[j]/p;\n",it.dest );  break;
+            case TIC_ACOS:      acadoFPrintf( file,"w[%d] = acos( a ); p = sqrt( 1.0-a*a ); for( j = 0; j < nd; j++ ) d[j] = -da[j]/p;\n",it.dest ); break;
+            case TIC_ATAN:      acadoFPrintf( file,"w[%d] = atan( a ); p = 1.0+a*a; for( j = 0; j < nd; j++ ) d[j] = da[j]/p;\n",it.dest );          break;
+            case TIC_LOGARITHM: acadoFPrintf( file,"w[%d] = log( a ); for( j = 0; j < nd; j++ ) d[j] = da[j]/a;\n",it.dest );                          break;
+            case TIC_EXP:       acadoFPrintf( file,"v = exp( a ); w[%d] = v; for( j = 0; j < nd; j++ ) d[j] = v*da[j];\n",it.dest );                  break;
+
+            case TIC_STORE_INTERMEDIATE:
+                acadoFPrintf( file,"x[%d] = a; d = seed+%d*nd; for( j = 0; j < nd; j++ ) d[j] = da[j];\n",it.dest,it.dest );
+                break;
+
+            case TIC_STORE_RESULT:
+                acadoFPrintf( file,"f[%d] = a; d = df+%d*nd; for( j = 0; j < nd; j++ ) d[j] = da[j];\n",it.dest,it.dest );
+                break;
+
+            case TIC_LOAD_REGISTER:
+            case TIC_STORE_REGISTER:
+                acadoFPrintf( file,"w[%d] = a; for( j = 0; j < nd; j++ ) d[j] = da[j];\n",it.dest );
+                break;
+        }
+    }
+    acadoFPrintf( file,"}\n\n" );
+
+
+    // BACKWARD AD (SEE AD_backward):
+    // ------------------------------
+    acadoFPrintf( file,"void acado_native_backward( double *x, double *seed, double *df, double *adj, double *trace ){\n\n" );
+    acadoFPrintf( file,"    double w[%d];\n",nRegisters+1 );
+    acadoFPrintf( file,"    double a, b, ad;\n\n" );
+
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        if( it.code != TIC_LOAD_VARIABLE && it.code != TIC_LOAD_CONSTANT )
+            acadoFPrintf( file,"    trace[%d] = w[%d];\n",2*run1,it.arg1 );
+        if( it.code >= TIC_ADDITION && it.code <= TIC_POWER )
+            acadoFPrintf( file,"    trace[%d] = w[%d];\n",2*run1+1,it.arg2 );
+
+        if( it.code != TIC_STORE_RESULT )
+            exportInstruction( file,it );
+    }
+    acadoFPrintf( file,"\n" );
+
+    for( run1 = 0; run1 < nShared; run1++ )
+        acadoFPrintf( file,"    adj[%d] = 0.0;\n",run1 );
+
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        if( it.code == TIC_LOAD_CONSTANT )
+            continue;
+
+        acadoFPrintf( file,"    " );
+
+        if( it.code != TIC_STORE_INTERMEDIATE && it.code != TIC_STORE_RESULT )
+            acadoFPrintf( file,"ad = adj[%d]; ",it.dest );
+
+        if( it.code >= TIC_ADDITION && it.code <= TIC_EXP )
+            acadoFPrintf( file,"a = trace[%d]; ",2*run1 );
+        if( it.code >= TIC_ADDITION && it.code <= TIC_POWER )
+            acadoFPrintf( file,"b = trace[%d]; ",2*run1+1 );
+
+        switch( it.code ){
+
+            case TIC_LOAD_VARIABLE:      acadoFPrintf( file,"df[%d] += ad;\n",it.arg1 );                                            break;
+            case TIC_ADDITION:           acadoFPrintf( file,"adj[%d] = ad; adj[%d] = ad;\n",it.arg2,it.arg1 );                      break;
+            case TIC_SUBTRACTION:        acadoFPrintf( file,"adj[%d] = -ad; adj[%d] = ad;\n",it.arg2,it.arg1 );                     break;
+            case TIC_PRODUCT:            acadoFPrintf( file,"adj[%d] = ad*a; adj[%d] = ad*b;\n",it.arg2,it.arg1 );                  break;
+            case TIC_QUOTIENT:           acadoFPrintf( file,"adj[%d] = -ad*a/(b*b); adj[%d] = ad/b;\n",it.arg2,it.arg1 );           break;
+            case TIC_POWER:              acadoFPrintf( file,"adj[%d] = ad*pow( a,b )*log( a ); adj[%d] = ad*b*pow( a,b-1.0 );\n",it.arg2,it.arg1 ); break;
+            case TIC_POWER_INT:          acadoFPrintf( file,"adj[%d] = ad*%d*pow( a,%d );\n",it.arg1,it.arg2,it.arg2-1 );          break;
+            case TIC_SIN:                acadoFPrintf( file,"adj[%d] = ad*cos( a );\n",it.arg1 );                                   break;
+            case TIC_COS:                acadoFPrintf( file,"adj[%d] = -ad*sin( a );\n",it.arg1 );                                  break;
+            case TIC_TAN:                acadoFPrintf( file,"adj[%d] = ad*( 1.0+tan( a )*tan( a ) );\n",it.arg1 );                  break;
+            case TIC_ASIN:               acadoFPrintf( file,"adj[%d] = ad/sqrt( 1.0-a*a );\n",it.arg1 );                            break;
+            case TIC_ACOS:               acadoFPrintf( file,"adj[%d] = -ad/sqrt( 1.0-a*a );\n",it.arg1 );                           break;
+            case TIC_ATAN:               acadoFPrintf( file,"adj[%d] = ad/( 1.0+a*a );\n",it.arg1 );                                break;
+            case TIC_LOGARITHM:          acadoFPrintf( file,"adj[%d] = ad/a;\n",it.arg1 );                                          break;
+            case TIC_EXP:                acadoFPrintf( file,"adj[%d] = ad*exp( a );\n",it.arg1 );                                   break;
+            case TIC_STORE_INTERMEDIATE: acadoFPrintf( file,"adj[%d] = df[%d];\n",it.arg1,it.dest );                                break;
+            case TIC_STORE_RESULT:       acadoFPrintf( file,"adj[%d] = seed[%d];\n",it.arg1,it.dest );                              break;
+            case TIC_LOAD_REGISTER:      acadoFPrintf( file,"adj[%d] += ad;\n",it.arg1 );                                           break;
+            case TIC_STORE_REGISTER:     acadoFPrintf( file,"adj[%d] += ad;\n",it.arg1 );                                           break;
+            default:                                                                                                                break;
+        }
+    }
+    acadoFPrintf( file,"}\n\n" );
+
+    acadoFPrintf( file,"}\n" );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::compileNative( const char *compiler, const char *cacheDirectory ){
+
+    if( isEmpty() == BT_TRUE )
+        return ACADOERROR( RET_INVALID_USE_OF_FUNCTION );
+
+    if( native.isLoaded() == BT_TRUE )
+        return SUCCESSFUL_RETURN;
+
+    return native.load( *this,compiler,cacheDirectory );
+}
+
+
+void EvaluationTape::addition( Operator &arg1, Operator &arg2 ){
+
+    binary( TIC_ADDITION, arg1, arg2 );
+}
+
+void EvaluationTape::subtraction( Operator &arg1, Operator &arg2 ){
+
+    binary( TIC_SUBTRACTION, arg1, arg2 );
+}
+
+void EvaluationTape::product( Operator &arg1, Operator &arg2 ){
+
+    binary( TIC_PRODUCT, arg1, arg2 );
+}
+
+void EvaluationTape::quotient( Operator &arg1, Operator &arg2 ){
+
+    binary( TIC_QUOTIENT, arg1, arg2 );
+}
+
+void EvaluationTape::power( Operator &arg1, Operator &arg2 ){
+
+    binary( TIC_POWER, arg1, arg2 );
+}
+
+void EvaluationTape::powerInt( Operator &arg1, int &arg2 ){
+
+    int r = reg;
+    visit( arg1,r );
+    append( TIC_POWER_INT, r, r, arg2 );
+}
+
+void EvaluationTape::project( int &idx ){
+
+    int k = idx - firstShared;
+    int r = reg;
+
+    if( k < 0 || k >= nShared ){
+        append( TIC_LOAD_VARIABLE, r, idx, 0 );
+        return;
+    }
+
+    if( isStored[k] == BT_TRUE ){
+        append( TIC_LOAD_REGISTER, r, k, 0 );
+        return;
+    }
+
+    // the tape is straight-line code, so the first use of a shared
+    // subexpression is evaluated before all further ones:
+    visit( *shared[k],r );
+    append( TIC_STORE_REGISTER, k, r, 0 );
+
+    isStored[k] = BT_TRUE;
+}
+
+void EvaluationTape::set( double &arg ){
+
+    append( TIC_LOAD_CONSTANT, reg, 0, 0, arg );
+}
+
+void EvaluationTape::Acos( Operator &arg ){ unary( TIC_ACOS     , arg ); }
+void EvaluationTape::Asin( Operator &arg ){ unary( TIC_ASIN     , arg ); }
+void EvaluationTape::Atan( Operator &arg ){ unary( TIC_ATAN     , arg ); }
+void EvaluationTape::Cos ( Operator &arg ){ unary( TIC_COS      , arg ); }
+void EvaluationTape::Exp ( Operator &arg ){ unary( TIC_EXP      , arg ); }
+void EvaluationTape::Log ( Operator &arg ){ unary( TIC_LOGARITHM, arg ); }
+void EvaluationTape::Sin ( Operator &arg ){ unary( TIC_SIN      , arg ); }
+void EvaluationTape::Tan ( Operator &arg ){ unary( TIC_TAN      , arg ); }
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue EvaluationTape::record( Operator& arg, int reg_ ){
+
+    // C-functions cannot be visited and nonsmooth operators do not
+    // report back to the visitor, so such trees cannot be lowered:
+    if( arg.isSymbolic() == BT_FALSE )
+        return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    // native code does not know about new instructions:
+    native.unload( );
+
+    isValid = BT_TRUE;
+    visit( arg,reg_ );
+
+    if( isValid == BT_FALSE )
+        return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void EvaluationTape::visit( Operator& arg, int reg_ ){
+
+    int nOld = nInstructions;
+
+    reg = reg_;
+    arg.evaluate( this );
+    reg = reg_;
+
+    if( nInstructions == nOld ) isValid = BT_FALSE;
+}
+
+
+void EvaluationTape::unary( TapeInstructionCode code_, Operator& arg ){
+
+    int r = reg;
+    visit( arg,r );
+    append( code_, r, r, 0 );
+}
+
+
+void EvaluationTape::binary( TapeInstructionCode code_, Operator& arg1, Operator& arg2 ){
+
+    int r = reg;
+    visit( arg1,r   );
+    visit( arg2,r+1 );
+    append( code_, r, r, r+1 );
+}
+
+
+void EvaluationTape::append( TapeInstructionCode code_, int dest_, int arg1_, int arg2_, double value_ ){
+
+    if( nInstructions >= maxInstructions ){
+
+        maxInstructions = 2*maxInstructions + 16;
+        instructions = (TapeInstruction*)realloc( instructions, maxInstructions*sizeof(TapeInstruction) );
+    }
+
+    instructions[nInstructions].code  = code_ ;
+    instructions[nInstructions].dest  = dest_ ;
+    instructions[nInstructions].arg1  = arg1_ ;
+    instructions[nInstructions].arg2  = arg2_ ;
+    instructions[nInstructions].value = value_;
+    nInstructions++;
+
+    if( code_ != TIC_STORE_INTERMEDIATE && code_ != TIC_STORE_RESULT && dest_ >= nRegisters ){
+
+        nRegisters = dest_+1;
+        work = (double*)realloc( work, nRegisters*sizeof(double) );
+    }
+}
+
+
+void EvaluationTape::batchSweep( int nPoints, double *x, double *result, double *w, double *trace ) const{
+
+    int j;
+
+    const TapeInstruction *it  = instructions;
+    const TapeInstruction *end = instructions + nInstructions;
+
+    for( ; it != end; ++it ){
+
+        // registers and components of all points are stored contiguously:
+        double       *d  = w + it->dest*nPoints;
+        const double *a1 = w + it->arg1*nPoints;
+        const double *a2 = w + it->arg2*nPoints;
+
+        // record the arguments for backward AD (before the target register,
+        // which coincides with the first argument, is overwritten):
+        if( trace != 0 ){
+
+            double *t = trace + 2*( it-instructions )*nPoints;
+
+            if( it->code != TIC_LOAD_VARIABLE && it->code != TIC_LOAD_CONSTANT )
+                for( j = 0; j < nPoints; j++ ) t[j] = a1[j];
+            if( it->code >= TIC_ADDITION && it->code <= TIC_POWER )     // binary instructions
+                for( j = 0; j < nPoints; j++ ) t[nPoints+j] = a2[j];
+        }
+
+        switch( it->code ){
+
+            case TIC_LOAD_VARIABLE:
+                a1 = x + it->arg1*nPoints;
+                for( j = 0; j < nPoints; j++ ) d[j] = a1[j];
+                break;
+
+            case TIC_LOAD_CONSTANT:
+                for( j = 0; j < nPoints; j++ ) d[j] = it->value;
+                break;
+
+            case TIC_ADDITION:    for( j = 0; j < nPoints; j++ ) d[j] = a1[j] + a2[j];          break;
+            case TIC_SUBTRACTION: for( j = 0; j < nPoints; j++ ) d[j] = a1[j] - a2[j];          break;
+            case TIC_PRODUCT:     for( j = 0; j < nPoints; j++ ) d[j] = a1[j] * a2[j];          break;
+            case TIC_QUOTIENT:    for( j = 0; j < nPoints; j++ ) d[j] = a1[j] / a2[j];          break;
+            case TIC_POWER:       for( j = 0; j < nPoints; j++ ) d[j] = pow( a1[j], a2[j] );    break;
+            case TIC_POWER_INT:   for( j = 0; j < nPoints; j++ ) d[j] = pow( a1[j], it->arg2 ); break;
+            case TIC_SIN:         for( j = 0; j < nPoints; j++ ) d[j] = sin ( a1[j] );          break;
+            case TIC_COS:         for( j = 0; j < nPoints; j++ ) d[j] = cos ( a1[j] );          break;
+            case TIC_TAN:         for( j = 0; j < nPoints; j++ ) d[j] = tan ( a1[j] );          break;
+            case TIC_ASIN:        for( j = 0; j < nPoints; j++ ) d[j] = asin( a1[j] );          break;
+            case TIC_ACOS:        for( j = 0; j < nPoints; j++ ) d[j] = acos( a1[j] );          break;
+            case TIC_ATAN:        for( j = 0; j < nPoints; j++ ) d[j] = atan( a1[j] );          break;
+            case TIC_LOGARITHM:   for( j = 0; j < nPoints; j++ ) d[j] = log ( a1[j] );          break;
+            case TIC_EXP:         for( j = 0; j < nPoints; j++ ) d[j] = exp ( a1[j] );          break;
+
+            case TIC_STORE_INTERMEDIATE:
+                d = x + it->dest*nPoints;
+                for( j = 0; j < nPoints; j++ ) d[j] = a1[j];
+                break;
+
+            case TIC_STORE_RESULT:
+                d = result + it->dest*nPoints;
+                for( j = 0; j < nPoints; j++ ) d[j] = a1[j];
+                break;
+
+            case TIC_LOAD_REGISTER:
+            case TIC_STORE_REGISTER:
+                for( j = 0; j < nPoints; j++ ) d[j] = a1[j];
+                break;
+        }
+    }
+}
+
+
+void EvaluationTape::backwardSweep( const double *trace, int stride, double *seed, double *df,
+                                    double *adj ) const{
+
+    int    run1;
+    double a, b, ad;
+
+    // the values of the shared registers are used several times, hence
+    // their adjoints (and the ones of the registers they are stored from)
+    // are accumulated:
+    for( run1 = 0; run1 < nShared; run1++ )
+        adj[run1] = 0.0;
+
+    // backward sweep; as every other register value is used exactly once,
+    // adjoints can be assigned instead of accumulated:
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        const TapeInstruction &it = instructions[run1];
+
+        a  = trace[(2*run1  )*stride];
+        b  = trace[(2*run1+1)*stride];
+
+        // (the destination of a store instruction is no register)
+        if( it.code != TIC_STORE_INTERMEDIATE && it.code != TIC_STORE_RESULT )
+            ad = adj[it.dest];
+        else
+            ad = 0.0;
+
+        switch( it.code ){
+
+            case TIC_LOAD_VARIABLE:      df[it.arg1] += ad;                                      break;
+            case TIC_LOAD_CONSTANT:                                                              break;
+            case TIC_ADDITION:           adj[it.arg2] =  ad;       adj[it.arg1] = ad;            break;
+            case TIC_SUBTRACTION:        adj[it.arg2] = -ad;       adj[it.arg1] = ad;            break;
+            case TIC_PRODUCT:            adj[it.arg2] =  ad*a;     adj[it.arg1] = ad*b;          break;
+            case TIC_QUOTIENT:           adj[it.arg2] = -ad*a/(b*b); adj[it.arg1] = ad/b;        break;
+            case TIC_POWER:
+                adj[it.arg2] = ad*pow( a,b )*log( a );
+                adj[it.arg1] = ad*b*pow( a,b-1.0 );
+                break;
+            case TIC_POWER_INT:          adj[it.arg1] = ad*it.arg2*pow( a,it.arg2-1 );           break;
+            case TIC_SIN:                adj[it.arg1] =  ad*cos( a );                            break;
+            case TIC_COS:                adj[it.arg1] = -ad*sin( a );                            break;
+            case TIC_TAN:                adj[it.arg1] =  ad*( 1.0+tan( a )*tan( a ) );           break;
+            case TIC_ASIN:               adj[it.arg1] =  ad/sqrt( 1.0-a*a );                     break;
+            case TIC_ACOS:               adj[it.arg1] = -ad/sqrt( 1.0-a*a );                     break;
+            case TIC_ATAN:               adj[it.arg1] =  ad/( 1.0+a*a );                         break;
+            case TIC_LOGARITHM:          adj[it.arg1] =  ad/a;                                   break;
+            case TIC_EXP:                adj[it.arg1] =  ad*exp( a );                            break;
+            case TIC_STORE_INTERMEDIATE: adj[it.arg1] = df  [it.dest];                           break;
+            case TIC_STORE_RESULT:       adj[it.arg1] = seed[it.dest];                           break;
+            case TIC_LOAD_REGISTER:      adj[it.arg1] += ad;                                     break;
+            case TIC_STORE_REGISTER:     adj[it.arg1] += ad;                                     break;
+        }
+    }
+}
+
+
+void EvaluationTape::exportInstruction( FILE *file, const TapeInstruction &it ) const{
+
+    switch( it.code ){
+
+        case TIC_LOAD_VARIABLE:      acadoFPrintf( file,"    w[%d] = x[%d];\n",it.dest,it.arg1 );                        break;
+        case TIC_LOAD_CONSTANT:      acadoFPrintf( file,"    w[%d] = %.16e;\n",it.dest,it.value );                       break;
+        case TIC_ADDITION:           acadoFPrintf( file,"    w[%d] = w[%d] + w[%d];\n",it.dest,it.arg1,it.arg2 );        break;
+        case TIC_SUBTRACTION:        acadoFPrintf( file,"    w[%d] = w[%d] - w[%d];\n",it.dest,it.arg1,it.arg2 );        break;
+        case TIC_PRODUCT:            acadoFPrintf( file,"    w[%d] = w[%d] * w[%d];\n",it.dest,it.arg1,it.arg2 );        break;
+        case TIC_QUOTIENT:           acadoFPrintf( file,"    w[%d] = w[%d] / w[%d];\n",it.dest,it.arg1,it.arg2 );        break;
+        case TIC_POWER:              acadoFPrintf( file,"    w[%d] = pow( w[%d], w[%d] );\n",it.dest,it.arg1,it.arg2 );  break;
+        case TIC_POWER_INT:          acadoFPrintf( file,"    w[%d] = pow( w[%d], %d );\n",it.dest,it.arg1,it.arg2 );     break;
+        case TIC_SIN:                acadoFPrintf( file,"    w[%d] = sin( w[%d] );\n",it.dest,it.arg1 );                 break;
+        case TIC_COS:                acadoFPrintf( file,"    w[%d] = cos( w[%d] );\n",it.dest,it.arg1 );                 break;
+        case TIC_TAN:                acadoFPrintf( file,"    w[%d] = tan( w[%d] );\n",it.dest,it.arg1 );                 break;
+        case TIC_ASIN:               acadoFPrintf( file,"    w[%d] = asin( w[%d] );\n",it.dest,it.arg1 );                break;
+        case TIC_ACOS:               acadoFPrintf( file,"    w[%d] = acos( w[%d] );\n",it.dest,it.arg1 );                break;
+        case TIC_ATAN:               acadoFPrintf( file,"    w[%d] = atan( w[%d] );\n",it.dest,it.arg1 );                break;
+        case TIC_LOGARITHM:          acadoFPrintf( file,"    w[%d] = log( w[%d] );\n",it.dest,it.arg1 );                 break;
+        case TIC_EXP:                acadoFPrintf( file,"    w[%d] = exp( w[%d] );\n",it.dest,it.arg1 );                 break;
+        case TIC_STORE_INTERMEDIATE: acadoFPrintf( file,"    x[%d] = w[%d];\n",it.dest,it.arg1 );                        break;
+        case TIC_STORE_RESULT:                                                                                           break;
+        case TIC_LOAD_REGISTER:      acadoFPrintf( file,"    w[%d] = w[%d];\n",it.dest,it.arg1 );                        break;
+        case TIC_STORE_REGISTER:     acadoFPrintf( file,"    w[%d] = w[%d];\n",it.dest,it.arg1 );                        break;
+    }
+}
+
+
+void EvaluationTape::copy( const EvaluationTape& rhs ){
+
+    int run1;
+
+    nInstructions   = rhs.nInstructions;
+    maxInstructions = rhs.nInstructions;
+    nRegisters      = rhs.nRegisters;
+    reg             = 0;
+    isValid         = rhs.isValid;
+
+    if( instructions != 0 ) free( instructions );
+    if( work         != 0 ) free( work );
+
+    instructions = 0;
+    work         = 0;
+
+    if( nInstructions > 0 ){
+        instructions = (TapeInstruction*)calloc( nInstructions,sizeof(TapeInstruction) );
+        for( run1 = 0; run1 < nInstructions; run1++ )
+            instructions[run1] = rhs.instructions[run1];
+    }
+
+    if( nRegisters > 0 )
+        work = (double*)calloc( nRegisters,sizeof(double) );
+
+    clearShared( );
+
+    firstShared = rhs.firstShared;
+    nShared     = rhs.nShared;
+
+    if( nShared > 0 ){
+
+        shared   = (Operator**)calloc( nShared,sizeof(Operator*) );
+        isStored = (BooleanType*)calloc( nShared,sizeof(BooleanType) );
+
+        for( run1 = 0; run1 < nShared; run1++ ){
+            shared  [run1] = rhs.shared[run1]->clone();
+            isStored[run1] = rhs.isStored[run1];
+        }
+    }
+
+    native = rhs.native;
+}
+
+
+void EvaluationTape::clearShared( ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nShared; run1++ )
+        delete shared[run1];
+
+    if( shared   != 0 ) free( shared   );
+    if( isStored != 0 ) free( isStored );
+
+    firstShared = 0;
+    nShared     = 0;
+    shared      = 0;
+    isStored    = 0;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,367 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/symbolic_operator/native_code.cpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#ifdef ACADO_WITH_DLOPEN
+    #include <dlfcn.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+    #include <sys/types.h>
+    #include <errno.h>
+#endif
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+NativeCode::NativeCode( ){
+
+    libraryName = 0;
+    handle      = 0;
+    hasFailed   = BT_FALSE;
+    evaluateFcn = 0;
+    forwardFcn  = 0;
+    backwardFcn = 0;
+}
+
+
+NativeCode::NativeCode( const NativeCode& rhs ){
+
+    libraryName = 0;
+    handle      = 0;
+    hasFailed   = BT_FALSE;
+    evaluateFcn = 0;
+    forwardFcn  = 0;
+    backwardFcn = 0;
+
+    copy( rhs );
+}
+
+
+NativeCode::~NativeCode( ){
+
+    unload( );
+}
+
+
+NativeCode& NativeCode::operator=( const NativeCode& rhs ){
+
+    if( this != &rhs ) copy( rhs );
+    return *this;
+}
+
+
+returnValue NativeCode::load( const EvaluationTape& tape, const char *compiler, const char *cacheDirectory ){
+
+#ifdef ACADO_WITH_DLOPEN
+
+    // do not retry (and recompile) after a failure:
+    if( hasFailed == BT_TRUE )
+        return RET_UNABLE_TO_COMPILE_NATIVE_CODE;
+
+    unload( );
+
+    if( compiler == 0 )
+        compiler = "c++ -O2 -fPIC -shared";
+
+    const char *tmpDir = getenv( "TMPDIR" );
+    if( tmpDir == 0 )
+        tmpDir = "/tmp";
+
+    uint  length  = strlen( compiler ) + 64;
+    char *dirName = 0;
+
+    // (the default directory is private to the user, as a library planted
+    // into a shared directory would be run in the process of the user)
+    if( cacheDirectory == 0 ){
+        dirName = (char*)calloc( strlen( tmpDir ) + 48,sizeof(char) );
+        sprintf( dirName,"%s/acado_native_code-%lu",tmpDir,(unsigned long)getuid() );
+    }
+    else{
+        dirName = (char*)calloc( strlen( cacheDirectory ) + 1,sizeof(char) );
+        strcpy( dirName,cacheDirectory );
+    }
+    length += 2*strlen( dirName );
+
+    char *tmpSourceName  = (char*)calloc( length,sizeof(char) );
+    char *tmpLibraryName = (char*)calloc( length,sizeof(char) );
+    char *sourceName     = (char*)calloc( length,sizeof(char) );
+    char *libraryName_   = (char*)calloc( length,sizeof(char) );
+    char *command        = (char*)calloc( 3*length,sizeof(char) );
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    FILE       *file        = 0;
+
+    if( ( mkdir( dirName,0700 ) != 0 ) && ( errno != EEXIST ) )
+        returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+    else
+        if( isSecure( dirName,BT_TRUE ) == BT_FALSE )
+            returnvalue = RET_NATIVE_CODE_CACHE_NOT_SECURE;
+
+
+    // EXPORT THE TAPE INTO A TEMPORARY SOURCE FILE:
+    // ---------------------------------------------
+    sprintf( tmpSourceName,"%s/acado_native_%d_%lu.cpp",dirName,(int)getpid(),(unsigned long)this );
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        file = fopen( tmpSourceName,"w" );
+
+        if( file == 0 ){
+            returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+        }
+        else{
+            returnvalue = tape.exportCode( file );
+            fclose( file );
+        }
+    }
+
+
+    // HASH THE SOURCE AND THE COMPILER COMMAND (TWO 32-BIT FNV-1A HASHES):
+    // --------------------------------------------------------------------
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        unsigned int h1 = 2166136261u;
+        unsigned int h2 = 2166136261u ^ 0x5bd1e995u;
+        const char  *c;
+        int          ch;
+
+        file = fopen( tmpSourceName,"r" );
+
+        if( file == 0 ){
+            returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+        }
+        else{
+            while( ( ch = fgetc( file ) ) != EOF ){
+                h1 = ( h1 ^ (unsigned int)ch ) * 16777619u;
+                h2 = ( h2 ^ (unsigned int)ch ) * 16777619u + 0x9e3779b9u;
+            }
+            fclose( file );
+        }
+
+        for( c = compiler; *c != 0; c++ ){
+            h1 = ( h1 ^ (unsigned int)(unsigned char)(*c) ) * 16777619u;
+            h2 = ( h2 ^ (unsigned int)(unsigned char)(*c) ) * 16777619u + 0x9e3779b9u;
+        }
+
+        sprintf( sourceName   ,"%s/acado_native_%08x%08x.cpp",dirName,h1,h2 );
+        sprintf( libraryName_ ,"%s/acado_native_%08x%08x.so" ,dirName,h1,h2 );
+        sprintf( tmpLibraryName,"%s/acado_native_%d_%lu.so"  ,dirName,(int)getpid(),(unsigned long)this );
+    }
+
+
+    // COMPILE UNLESS A CACHED LIBRARY EXISTS (ONE THREAD AT A TIME, SUCH THAT
+    // CONCURRENT INTEGRATORS DO NOT COMPILE THE SAME MODEL SEVERAL TIMES):
+    // -----------------------------------------------------------------------
+    #ifdef _OPENMP
+    #pragma omp critical (acadoNativeCode)
+    #endif
+    {
+        if( returnvalue == SUCCESSFUL_RETURN ){
+
+            file = fopen( libraryName_,"r" );
+
+            if( file != 0 ){
+                fclose( file );
+                remove( tmpSourceName );
+            }
+            else{
+                sprintf( command,"%s -o \"%s\" \"%s\"",compiler,tmpLibraryName,tmpSourceName );
+
+                if( system( command ) != 0 ){
+                    remove( tmpLibraryName );
+                    remove( tmpSourceName );
+                    returnvalue = RET_UNABLE_TO_COMPILE_NATIVE_CODE;
+                }
+                else{
+                    // renaming is atomic, hence concurrent processes never
+                    // see a partially written library:
+                    chmod( tmpLibraryName,0700 );
+                    rename( tmpLibraryName,libraryName_ );
+                    rename( tmpSourceName ,sourceName   );
+                }
+            }
+        }
+        else{
+            if( returnvalue != RET_NATIVE_CODE_CACHE_NOT_SECURE )
+                remove( tmpSourceName );
+        }
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN )
+        returnvalue = open( libraryName_ );
+
+    free( dirName );
+    free( tmpSourceName );
+    free( tmpLibraryName );
+    free( sourceName );
+    free( libraryName_ );
+    free( command );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        hasFailed = BT_TRUE;
+        return ACADOERROR( returnvalue );
+    }
+
+    return SUCCESSFUL_RETURN;
+
+#else
+
+    return ACADOERROR( RET_AVAILABLE_WITH_LINUX_ONLY );
+
+#endif
+}
+
+
+returnValue NativeCode::unload( ){
+
+#ifdef ACADO_WITH_DLOPEN
+    if( handle != 0 )
+        dlclose( handle );
+#endif
+
+    if( libraryName != 0 )
+        free( libraryName );
+
+    libraryName = 0;
+    handle      = 0;
+    hasFailed   = BT_FALSE;
+    evaluateFcn = 0;
+    forwardFcn  = 0;
+    backwardFcn = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue NativeCode::open( const char *libraryName_ ){
+
+#ifdef ACADO_WITH_DLOPEN
+
+    if( isSecure( libraryName_,BT_FALSE ) == BT_FALSE )
+        return RET_NATIVE_CODE_CACHE_NOT_SECURE;
+
+    handle = dlopen( libraryName_,RTLD_NOW | RTLD_LOCAL );
+
+    if( handle == 0 )
+        return RET_UNABLE_TO_LOAD_NATIVE_CODE;
+
+    // (POSIX way of converting the data pointers returned by dlsym)
+    *(void**)(&evaluateFcn) = dlsym( handle,"acado_native_evaluate" );
+    *(void**)(&forwardFcn ) = dlsym( handle,"acado_native_forward"  );
+    *(void**)(&backwardFcn) = dlsym( handle,"acado_native_backward" );
+
+    if( ( evaluateFcn == 0 ) || ( forwardFcn == 0 ) || ( backwardFcn == 0 ) ){
+
+        dlclose( handle );
+        handle      = 0;
+        evaluateFcn = 0;
+        forwardFcn  = 0;
+        backwardFcn = 0;
+        return RET_UNABLE_TO_LOAD_NATIVE_CODE;
+    }
+
+    libraryName = (char*)calloc( strlen( libraryName_ ) + 1,sizeof(char) );
+    strcpy( libraryName,libraryName_ );
+
+    return SUCCESSFUL_RETURN;
+
+#else
+
+    return RET_AVAILABLE_WITH_LINUX_ONLY;
+
+#endif
+}
+
+
+BooleanType NativeCode::isSecure( const char *fileName, BooleanType isDirectory ) const{
+
+#ifdef ACADO_WITH_DLOPEN
+
+    struct stat status;
+
+    if( lstat( fileName,&status ) != 0 )
+        return BT_FALSE;
+
+    if( isDirectory == BT_TRUE ){
+        if( !S_ISDIR( status.st_mode ) )
+            return BT_FALSE;
+    }
+    else{
+        if( !S_ISREG( status.st_mode ) )
+            return BT_FALSE;
+    }
+
+    if( status.st_uid != getuid() )
+        return BT_FALSE;
+
+    if( ( status.st_mode & ( S_IWGRP | S_IWOTH ) ) != 0 )
+        return BT_FALSE;
+
+    return BT_TRUE;
+
+#else
+
+    return BT_FALSE;
+
+#endif
+}
+
+
+void NativeCode::copy( const NativeCode& rhs ){
+
+    unload( );
+
+    if( rhs.libraryName != 0 )
+        open( rhs.libraryName );
+
+    hasFailed = rhs.hasFailed;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
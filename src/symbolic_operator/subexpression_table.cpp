@@ -0,0 +1,542 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/symbolic_operator/subexpression_table.cpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*/
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+static unsigned int hashKey( int name, int arg1, int arg2, double value ){
+
+    unsigned int w[2];
+    memcpy( w,&value,sizeof(double) );
+
+    unsigned int h = 2166136261u;
+    h = ( h ^ (unsigned int)name ) * 16777619u;
+    h = ( h ^ (unsigned int)arg1 ) * 16777619u;
+    h = ( h ^ (unsigned int)arg2 ) * 16777619u;
+    h = ( h ^ w[0] ) * 16777619u;
+    h = ( h ^ w[1] ) * 16777619u;
+
+    return h ^ ( h >> 15 );
+}
+
+
+static unsigned int hashAddress( const Operator* arg ){
+
+    unsigned long a = (unsigned long)arg;
+    return (unsigned int)( ( a >> 4 ) ^ ( a >> 19 ) );
+}
+
+
+
+// (the visitor methods of the table hide the names of the operator classes)
+
+static Operator* createUnary( OperatorName name, Operator* arg ){
+
+    switch( name ){
+
+        case ON_ACOS     : return new Acos     ( arg );
+        case ON_ASIN     : return new Asin     ( arg );
+        case ON_ATAN     : return new Atan     ( arg );
+        case ON_COS      : return new Cos      ( arg );
+        case ON_EXP      : return new Exp      ( arg );
+        case ON_LOGARITHM: return new Logarithm( arg );
+        case ON_SIN      : return new Sin      ( arg );
+        case ON_TAN      : return new Tan      ( arg );
+        default          : delete arg; return 0;
+    }
+}
+
+
+static Operator* createBinary( OperatorName name, Operator* arg1, Operator* arg2 ){
+
+    switch( name ){
+
+        case ON_ADDITION   : return new Addition   ( arg1,arg2 );
+        case ON_SUBTRACTION: return new Subtraction( arg1,arg2 );
+        case ON_PRODUCT    : return new Product    ( arg1,arg2 );
+        case ON_QUOTIENT   : return new Quotient   ( arg1,arg2 );
+        case ON_POWER      : return new Power      ( arg1,arg2 );
+        default            : delete arg1; delete arg2; return 0;
+    }
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SubexpressionTable::SubexpressionTable( int firstIndex_ ){
+
+    entries    = 0;
+    nEntries   = 0;
+    maxEntries = 0;
+
+    table      = 0;
+    addresses  = 0;
+    addressIdx = 0;
+    tableSize  = 0;
+    nAddresses = 0;
+
+    firstIndex = firstIndex_;
+    nextIndex  = firstIndex_;
+    nStates    = 0;
+
+    isCopying  = BT_FALSE;
+    current    = -1;
+    result     = 0;
+}
+
+
+SubexpressionTable::~SubexpressionTable( ){
+
+    clear();
+}
+
+
+returnValue SubexpressionTable::clear( ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nEntries; run1++ )
+        if( entries[run1].shared != 0 )
+            delete entries[run1].shared;
+
+    if( entries    != 0 ) free( entries    );
+    if( table      != 0 ) free( table      );
+    if( addresses  != 0 ) free( addresses  );
+    if( addressIdx != 0 ) free( addressIdx );
+
+    entries    = 0;
+    nEntries   = 0;
+    maxEntries = 0;
+
+    table      = 0;
+    addresses  = 0;
+    addressIdx = 0;
+    tableSize  = 0;
+    nAddresses = 0;
+
+    nextIndex  = firstIndex;
+    nStates    = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SubexpressionTable::add( Operator& arg ){
+
+    // C-functions cannot be visited, so their subexpressions are unknown:
+    if( arg.isSymbolic() == BT_FALSE )
+        return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    isCopying = BT_FALSE;
+
+    int idx = enter( arg );
+    entries[idx].nRefs++;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* SubexpressionTable::share( Operator& arg ){
+
+    isCopying = BT_TRUE;
+
+    Operator *tmp = copy( arg );
+
+    isCopying = BT_FALSE;
+    return tmp;
+}
+
+
+int SubexpressionTable::getNumEntries( ) const{
+
+    return nEntries;
+}
+
+
+int SubexpressionTable::getNumSharedEntries( ) const{
+
+    int run1;
+    int nShared = 0;
+
+    for( run1 = 0; run1 < nEntries; run1++ )
+        if( entries[run1].nRefs > 1 && isLeaf(run1) == BT_FALSE )
+            nShared++;
+
+    return nShared;
+}
+
+
+int SubexpressionTable::getNumStates( ) const{
+
+    return nStates;
+}
+
+
+returnValue SubexpressionTable::getStateArguments( Operator **args ) const{
+
+    int run1;
+
+    if( firstIndex < 0 )
+        return ACADOERROR( RET_INVALID_USE_OF_FUNCTION );
+
+    for( run1 = 0; run1 < nEntries; run1++ )
+        if( entries[run1].shared != 0 )
+            args[ entries[run1].shared->getVariableIndex() - firstIndex ] = entries[run1].shared->passArgument();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+void SubexpressionTable::addition   ( Operator &arg1, Operator &arg2 ){ binary( ON_ADDITION   , arg1, arg2 ); }
+void SubexpressionTable::subtraction( Operator &arg1, Operator &arg2 ){ binary( ON_SUBTRACTION, arg1, arg2 ); }
+void SubexpressionTable::product    ( Operator &arg1, Operator &arg2 ){ binary( ON_PRODUCT    , arg1, arg2 ); }
+void SubexpressionTable::quotient   ( Operator &arg1, Operator &arg2 ){ binary( ON_QUOTIENT   , arg1, arg2 ); }
+void SubexpressionTable::power      ( Operator &arg1, Operator &arg2 ){ binary( ON_POWER      , arg1, arg2 ); }
+
+
+void SubexpressionTable::powerInt( Operator &arg1, int &arg2 ){
+
+    if( isCopying == BT_TRUE ){
+
+        result = new Power_Int( copy(arg1), arg2 );
+        return;
+    }
+
+    int idx1 = enter( arg1 );
+    int nOld = nEntries;
+
+    current = find( ON_POWER_INT, idx1, arg2, 0.0 );
+    if( nEntries > nOld ) entries[idx1].nRefs++;
+}
+
+
+void SubexpressionTable::project( int &idx ){
+
+    // variables are entered by enter() directly, i.e. any other
+    // operator reporting a projection is treated as opaque.
+}
+
+
+void SubexpressionTable::set( double &arg ){
+
+    // constants are copied as they are (see copy()):
+    if( isCopying == BT_FALSE )
+        current = find( ON_DOUBLE_CONSTANT, 0, 0, arg );
+}
+
+
+void SubexpressionTable::Acos( Operator &arg ){ unary( ON_ACOS     , arg ); }
+void SubexpressionTable::Asin( Operator &arg ){ unary( ON_ASIN     , arg ); }
+void SubexpressionTable::Atan( Operator &arg ){ unary( ON_ATAN     , arg ); }
+void SubexpressionTable::Cos ( Operator &arg ){ unary( ON_COS      , arg ); }
+void SubexpressionTable::Exp ( Operator &arg ){ unary( ON_EXP      , arg ); }
+void SubexpressionTable::Log ( Operator &arg ){ unary( ON_LOGARITHM, arg ); }
+void SubexpressionTable::Sin ( Operator &arg ){ unary( ON_SIN      , arg ); }
+void SubexpressionTable::Tan ( Operator &arg ){ unary( ON_TAN      , arg ); }
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+int SubexpressionTable::enter( Operator& arg ){
+
+    VariableType varType;
+    int          component;
+    int          idx;
+
+    if( arg.isVariable( varType,component ) == BT_TRUE ){
+
+        Operator *argument = arg.passArgument();
+
+        if( argument == 0 ){
+            idx = find( ON_VARIABLE, (int)varType, component, 0.0 );
+        }
+        else{
+
+            // intermediate states are distinguished from plain projections onto
+            // the same component; they are kept as they are, i.e. their
+            // arguments are not entered:
+            idx = find( ON_VARIABLE, (int)varType, component, 1.0 );
+        }
+    }
+    else{
+
+        current = -1;
+        arg.evaluate( this );
+        idx = current;
+
+        if( idx < 0 )
+            idx = find( ON_CEXPRESSION, nEntries, 0, 0.0 );
+    }
+
+    if( findAddress( &arg ) < 0 ){
+
+        if( 2*(nAddresses+1) > tableSize ) rehash();
+
+        unsigned int pos = hashAddress( &arg ) & (unsigned int)(tableSize-1);
+
+        while( addresses[pos] != 0 )
+            pos = ( pos+1 ) & (unsigned int)(tableSize-1);
+
+        addresses [pos] = &arg;
+        addressIdx[pos] = idx ;
+        nAddresses++;
+    }
+
+    current = idx;
+    return idx;
+}
+
+
+Operator* SubexpressionTable::copy( Operator& arg ){
+
+    int idx = findAddress( &arg );
+
+    if( idx < 0 )
+        return arg.clone();
+
+    if( entries[idx].shared != 0 )
+        return entries[idx].shared->clone();
+
+    Operator *tmp;
+
+    // (variables and intermediate states)
+    if( isLeaf(idx) == BT_TRUE )
+        return arg.clone();
+
+    result = 0;
+    arg.evaluate( this );
+
+    tmp    = result;
+    result = 0;
+
+    if( tmp == 0 )
+        return arg.clone();
+
+    if( entries[idx].nRefs <= 1 )
+        return tmp;
+
+    // the subexpression is used more than once, so it is
+    // replaced by an intermediate state which is evaluated once:
+    return makeShared( idx, tmp, tmp->getCurvature(), tmp->getMonotonicity() );
+}
+
+
+Operator* SubexpressionTable::makeShared(	int idx,
+											Operator* arg,
+											CurvatureType curvature_,
+											MonotonicityType monotonicity_
+											){
+
+    entries[idx].shared = new TreeProjection();
+
+    if( firstIndex < 0 ) *entries[idx].shared = *arg;
+    else                 entries[idx].shared->setArgument( *arg, nextIndex++ );
+
+    nStates++;
+    entries[idx].shared->setCurvature   ( curvature_    );
+    entries[idx].shared->setMonotonicity( monotonicity_ );
+
+    delete arg;
+    return entries[idx].shared->clone();
+}
+
+
+void SubexpressionTable::unary( OperatorName name_, Operator& arg ){
+
+    if( isCopying == BT_TRUE ){
+
+        result = createUnary( name_,copy(arg) );
+        return;
+    }
+
+    int idx  = enter( arg );
+    int nOld = nEntries;
+
+    current = find( name_, idx, -1, 0.0 );
+    if( nEntries > nOld ) entries[idx].nRefs++;
+}
+
+
+void SubexpressionTable::binary( OperatorName name_, Operator& arg1, Operator& arg2 ){
+
+    if( isCopying == BT_TRUE ){
+
+        Operator *tmp1 = copy( arg1 );
+        Operator *tmp2 = copy( arg2 );
+
+        result = createBinary( name_,tmp1,tmp2 );
+        return;
+    }
+
+    int idx1 = enter( arg1 );
+    int idx2 = enter( arg2 );
+    int nOld = nEntries;
+
+    current = find( name_, idx1, idx2, 0.0 );
+
+    if( nEntries > nOld ){
+        entries[idx1].nRefs++;
+        entries[idx2].nRefs++;
+    }
+}
+
+
+int SubexpressionTable::find( OperatorName name_, int arg1_, int arg2_, double value_ ){
+
+    if( 2*(nEntries+1) > tableSize ) rehash();
+
+    unsigned int pos = hashKey( name_,arg1_,arg2_,value_ ) & (unsigned int)(tableSize-1);
+
+    while( table[pos] >= 0 ){
+
+        Entry &e = entries[ table[pos] ];
+
+        if( e.name == name_ && e.arg1 == arg1_ && e.arg2 == arg2_ &&
+            memcmp( &e.value,&value_,sizeof(double) ) == 0 )
+            return table[pos];
+
+        pos = ( pos+1 ) & (unsigned int)(tableSize-1);
+    }
+
+    if( nEntries >= maxEntries ){
+
+        maxEntries = 2*maxEntries + 64;
+        entries = (Entry*)realloc( entries, maxEntries*sizeof(Entry) );
+    }
+
+    entries[nEntries].name   = name_ ;
+    entries[nEntries].arg1   = arg1_ ;
+    entries[nEntries].arg2   = arg2_ ;
+    entries[nEntries].value  = value_;
+    entries[nEntries].nRefs  = 0     ;
+    entries[nEntries].shared = 0     ;
+
+    table[pos] = nEntries;
+
+    return nEntries++;
+}
+
+
+int SubexpressionTable::findAddress( const Operator* arg ) const{
+
+    if( tableSize == 0 ) return -1;
+
+    unsigned int pos = hashAddress( arg ) & (unsigned int)(tableSize-1);
+
+    while( addresses[pos] != 0 ){
+
+        if( addresses[pos] == arg ) return addressIdx[pos];
+        pos = ( pos+1 ) & (unsigned int)(tableSize-1);
+    }
+    return -1;
+}
+
+
+BooleanType SubexpressionTable::isLeaf( int idx ) const{
+
+    switch( entries[idx].name ){
+
+        case ON_VARIABLE       : return BT_TRUE;
+        case ON_DOUBLE_CONSTANT: return BT_TRUE;
+        case ON_CEXPRESSION    : return BT_TRUE;
+        default                : return BT_FALSE;
+    }
+}
+
+
+void SubexpressionTable::rehash( ){
+
+    int run1;
+
+    int              oldSize       = tableSize ;
+    const Operator **oldAddresses  = addresses ;
+    int             *oldAddressIdx = addressIdx;
+
+    tableSize = ( tableSize == 0 ) ? 256 : 2*tableSize;
+
+    if( table != 0 ) free( table );
+
+    table      = (int*)malloc( tableSize*sizeof(int) );
+    addresses  = (const Operator**)calloc( tableSize,sizeof(Operator*) );
+    addressIdx = (int*)malloc( tableSize*sizeof(int) );
+
+    for( run1 = 0; run1 < tableSize; run1++ )
+        table[run1] = -1;
+
+    for( run1 = 0; run1 < nEntries; run1++ ){
+
+        Entry &e = entries[run1];
+        unsigned int pos = hashKey( e.name,e.arg1,e.arg2,e.value ) & (unsigned int)(tableSize-1);
+
+        while( table[pos] >= 0 )
+            pos = ( pos+1 ) & (unsigned int)(tableSize-1);
+
+        table[pos] = run1;
+    }
+
+    for( run1 = 0; run1 < oldSize; run1++ ){
+
+        if( oldAddresses[run1] == 0 ) continue;
+
+        unsigned int pos = hashAddress( oldAddresses[run1] ) & (unsigned int)(tableSize-1);
+
+        while( addresses[pos] != 0 )
+            pos = ( pos+1 ) & (unsigned int)(tableSize-1);
+
+        addresses [pos] = oldAddresses [run1];
+        addressIdx[pos] = oldAddressIdx[run1];
+    }
+
+    if( oldAddresses  != 0 ) free( oldAddresses  );
+    if( oldAddressIdx != 0 ) free( oldAddressIdx );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -101,6 +101,15 @@ TreeProjection::~TreeProjection(){
 
 TreeProjection& TreeProjection::operator=( const Operator &arg ){
 
+    if( this != &arg )
+        setArgument( arg, count++ );
+
+    return *this;
+}
+
+
+TreeProjection& TreeProjection::setArgument( const Operator &arg, int index ){
+
     if( this != &arg ){
 
         if( argument != 0 ){
@@ -118,8 +127,8 @@ TreeProjection& TreeProjection::operator=( const Operator &arg ){
         if( tmp == 0 ) argument = arg.clone() ;
         else           argument = tmp->clone();
 
-        vIndex         = count++;
-        variableIndex  = vIndex ;
+        vIndex         = index ;
+        variableIndex  = vIndex;
 
         curvature      = CT_UNKNOWN; // argument->getCurvature();
         monotonicity   = MT_UNKNOWN; // argument->getMonotonicity();
@@ -45,6 +45,7 @@ BEGIN_NAMESPACE_ACADO
 TransferDevice::TransferDevice( ) : SimulationBlock( )
 {
 	additiveNoise = 0;
+	noiseSeed = 0;
 
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -63,6 +64,7 @@ TransferDevice::TransferDevice(	uint _dim,
 
 	noiseSamplingTimes.init( _dim );
 	noiseSamplingTimes.setAll( 0.0 );
+	noiseSeed = 0;
 
 	deadTimes.init( _dim );
 	deadTimes.setAll( 0.0 );
@@ -89,6 +91,7 @@ TransferDevice::TransferDevice( const TransferDevice& rhs ) : SimulationBlock( r
 		additiveNoise = 0;
 
 	noiseSamplingTimes = rhs.noiseSamplingTimes;
+	noiseSeed = rhs.noiseSeed;
 	
 	deadTimes = rhs.deadTimes;
 }
@@ -139,6 +142,7 @@ TransferDevice& TransferDevice::operator=( const TransferDevice& rhs )
 			additiveNoise = 0;
 
 		noiseSamplingTimes = rhs.noiseSamplingTimes;
+		noiseSeed = rhs.noiseSeed;
 
 		deadTimes = rhs.deadTimes;
 	}
@@ -180,7 +184,7 @@ returnValue TransferDevice::init(	double _startTime,
 		for( uint i=0; i<getDim( ); ++i )
 		{
 			if ( additiveNoise[i] != 0 )
-				additiveNoise[i]->init( );
+				additiveNoise[i]->init( Noise::deriveSeed( noiseSeed,i ) );
 		}
 	}
 
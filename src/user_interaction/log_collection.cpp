@@ -174,36 +174,41 @@ returnValue LogCollection::print(	LogPrintMode _mode
 returnValue LogCollection::updateLogRecord(	LogRecord& _record
 											) const
 {
-	LogRecord currentRecord;
+	LogRecord* currentRecord;
+	LogRecordItem* currentItem;
 
 	uint name;
 	LogRecordItemType type;
 
-	MatrixVariablesGrid newValues;
+	LogRecordItem* item = _record.first;
 
-	for( uint i=0; i<_record.getNumItems( ); ++i )
+	while ( item != 0 )
 	{
-		if ( _record( i ).isWriteProtected( ) == BT_FALSE )
+		if ( item->isWriteProtected( ) == BT_FALSE )
 		{
-			name = _record( i ).getName();
-			type = _record( i ).getType();
+			name = item->getName();
+			type = item->getType();
 
-			for( uint j=0; j<getNumLogRecords( ); ++j )
+			currentRecord = first;
+
+			while ( currentRecord != 0 )
 			{
-				currentRecord = operator()( j );
-	
-				if ( ( currentRecord.hasItem( name,type ) == BT_TRUE ) && 
-					( currentRecord.getLogFrequency( ) == _record.getLogFrequency( ) ) )
+				currentItem = currentRecord->find( name,type );
+
+				if ( ( currentItem != 0 ) && 
+					( currentRecord->getLogFrequency( ) == _record.getLogFrequency( ) ) )
 				{
-					currentRecord.getAll( name,type,newValues );
-	
-					if ( newValues.getNumPoints( ) > 0 )
-						_record.setAll( name,type,newValues );
+					if ( ( currentItem->getNumPoints( ) > 0 ) && ( currentItem != item ) )
+						item->setAllValues( *currentItem );
 	
 					break;
 				}
+
+				currentRecord = currentRecord->getNext( );
 			}
 		}
+
+		item = item->getNext( );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -222,14 +227,24 @@ returnValue LogCollection::getAll(	uint _name,
 									MatrixVariablesGrid& values
 									) const
 {
-	for( uint i=0; i<getNumLogRecords( ); ++i )
-	{
-		if ( operator()( i ).hasItem( _name,_type ) == BT_TRUE )
-		{
-			operator()( i ).getAll( _name,_type,values );
-			return SUCCESSFUL_RETURN;
-		}
-	}
+	LogRecord* record = find( _name,_type );
+
+	if ( record != 0 )
+		return record->getAll( _name,_type,values );
+
+	return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+}
+
+
+returnValue LogCollection::getAll(	uint _name,
+									LogRecordItemType _type,
+									VariablesGrid& values
+									) const
+{
+	LogRecord* record = find( _name,_type );
+
+	if ( record != 0 )
+		return record->getAll( _name,_type,values );
 
 	return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 }
@@ -240,14 +255,10 @@ returnValue LogCollection::getFirst(	uint _name,
 										Matrix& value
 										) const
 {
-	for( uint i=0; i<getNumLogRecords( ); ++i )
-	{
-		if ( operator()( i ).hasItem( _name,_type ) == BT_TRUE )
-		{
-			operator()( i ).getFirst( _name,_type,value );
-			return SUCCESSFUL_RETURN;
-		}
-	}
+	LogRecord* record = find( _name,_type );
+
+	if ( record != 0 )
+		return record->getFirst( _name,_type,value );
 
 	return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 }
@@ -258,14 +269,10 @@ returnValue LogCollection::getLast(	uint _name,
 									Matrix& value
 									) const
 {
-	for( uint i=0; i<getNumLogRecords( ); ++i )
-	{
-		if ( operator()( i ).hasItem( _name,_type ) == BT_TRUE )
-		{
-			operator()( i ).getLast( _name,_type,value );
-			return SUCCESSFUL_RETURN;
-		}
-	}
+	LogRecord* record = find( _name,_type );
+
+	if ( record != 0 )
+		return record->getLast( _name,_type,value );
 
 	return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 }
@@ -280,11 +287,9 @@ returnValue LogCollection::setAll(	uint _name,
 
 	while ( record != 0 )
 	{
-		if ( record->hasItem( _name,_type ) == BT_TRUE )
-		{
-			if ( record->setAll( _name,_type,values ) != SUCCESSFUL_RETURN )
-				return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
-		}
+		// does nothing if record does not contain the item
+		if ( record->setAll( _name,_type,values ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
 
 		record = record->getNext( );
 	}
@@ -303,11 +308,9 @@ returnValue LogCollection::setLast(	uint _name,
 
 	while ( record != 0 )
 	{
-		if ( record->hasItem( _name,_type ) == BT_TRUE )
-		{
-			if ( record->setLast( _name,_type,value,time ) != SUCCESSFUL_RETURN )
-				return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
-		}
+		// does nothing if record does not contain the item
+		if ( record->setLast( _name,_type,value,time ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
 
 		record = record->getNext( );
 	}
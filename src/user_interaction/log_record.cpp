@@ -250,21 +250,7 @@ returnValue LogRecord::addItem(	LogRecordItem& _item
 	// create new item
 	LogRecordItem* newItem = new LogRecordItem( _item );
 
-	if ( number == 0 )
-	{
-		first = newItem;
-		last = newItem;
-	}
-	else
-	{
-		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_LOG_RECORD_CORRUPTED );
-		last = newItem;
-	}
-
-	++number;
-
-	return SUCCESSFUL_RETURN;
+	return append( newItem );
 }
 
 
@@ -325,21 +311,7 @@ returnValue LogRecord::addItem(	LogName _name,
 	LogRecordItem* newItem = new LogRecordItem( _name,_label,_startString,_endString,
 												_width,_precision,_colSeparator,_rowSeparator );
 
-	if ( number == 0 )
-	{
-		first = newItem;
-		last = newItem;
-	}
-	else
-	{
-		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_LOG_RECORD_CORRUPTED );
-		last = newItem;
-	}
-
-	++number;
-
-	return SUCCESSFUL_RETURN;
+	return append( newItem );
 }
 
 
@@ -400,21 +372,7 @@ returnValue LogRecord::addItem(	const Expression& _name,
 	LogRecordItem* newItem = new LogRecordItem( _name,_label,_startString,_endString,
 												_width,_precision,_colSeparator,_rowSeparator );
 
-	if ( number == 0 )
-	{
-		first = newItem;
-		last = newItem;
-	}
-	else
-	{
-		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_LOG_RECORD_CORRUPTED );
-		last = newItem;
-	}
-
-	++number;
-
-	return SUCCESSFUL_RETURN;
+	return append( newItem );
 }
 
 
@@ -438,6 +396,9 @@ returnValue LogRecord::clearAllItems( )
 
 	number = 0;
 
+	enumItems.clear( );
+	variableItems.clear( );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -601,9 +562,22 @@ returnValue LogRecord::getAll(	uint _name,
 	if ( item == 0 )
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
-	values = item->getAllValues( );
+	return item->getAllValues( values );
+}
 
-	return SUCCESSFUL_RETURN;
+
+returnValue LogRecord::getAll(	uint _name,
+								LogRecordItemType _type,
+								VariablesGrid& values
+								) const
+{
+	LogRecordItem* item = find( _name,_type );
+
+	// checks if item exists
+	if ( item == 0 )
+		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+
+	return item->getAllValues( values );
 }
 
 
@@ -698,17 +672,17 @@ LogRecordItem* LogRecord::find(	uint _name,
 								LogRecordItemType _type
 								) const
 {
-	LogRecordItem* item = first;
-
-	while ( item != 0 )
+	switch ( _type )
 	{
-		if ( ( item->getName( ) == (int)_name ) && ( item->getType( ) == _type ) )
-			return item;
+		case LRT_ENUM:
+			return ( _name < enumItems.size( ) ) ? enumItems[_name] : 0;
 
-		item = item->getNext( );
-	}
+		case LRT_VARIABLE:
+			return ( _name < variableItems.size( ) ) ? variableItems[_name] : 0;
 
-	return 0;
+		default:
+			return 0;
+	}
 }
 
 
@@ -716,19 +690,48 @@ LogRecordItem* LogRecord::findNonEmpty(	uint _name,
 										LogRecordItemType _type
 										) const
 {
-	LogRecordItem* item = first;
+	LogRecordItem* item = find( _name,_type );
+
+	if ( ( item != 0 ) && ( item->isEmpty( ) == BT_FALSE ) )
+		return item;
+
+	return 0;
+}
+
+
+returnValue LogRecord::append(	LogRecordItem* newItem
+								)
+{
+	if ( number == 0 )
+	{
+		first = newItem;
+		last = newItem;
+	}
+	else
+	{
+		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
+		{
+			delete newItem;
+			return ACADOERROR( RET_LOG_RECORD_CORRUPTED );
+		}
+		last = newItem;
+	}
+
+	++number;
 
-	while ( item != 0 )
+	// register item within index of its type
+	if ( ( newItem->getName( ) >= 0 ) &&
+		 ( ( newItem->getType( ) == LRT_ENUM ) || ( newItem->getType( ) == LRT_VARIABLE ) ) )
 	{
-		if ( ( item->getName( ) == (int)_name ) && 
-			 ( item->getType( ) == _type )      && 
-			 ( item->isEmpty( ) == BT_FALSE )   )
-			return item;
+		std::vector<LogRecordItem*>& items = ( newItem->getType( ) == LRT_ENUM ) ? enumItems : variableItems;
+		uint idx = (uint)newItem->getName( );
 
-		item = item->getNext( );
+		if ( idx >= items.size( ) )
+			items.resize( idx+1,0 );
+		items[idx] = newItem;
 	}
 
-	return 0;
+	return SUCCESSFUL_RETURN;
 }
 
 
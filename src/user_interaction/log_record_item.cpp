@@ -44,6 +44,11 @@ BEGIN_NAMESPACE_ACADO
 
 LogRecordItem::LogRecordItem( )
 {
+	values    = 0;
+	times     = 0;
+	nPoints   = 0;
+	maxPoints = 0;
+
 	name = -1;
 	type = LRT_UNKNOWN;
 	
@@ -73,6 +78,11 @@ LogRecordItem::LogRecordItem(	LogName _name,
 								const char* const _rowSeparator
 								)
 {
+	values    = 0;
+	times     = 0;
+	nPoints   = 0;
+	maxPoints = 0;
+
 	name = (int) _name;
 	type  = LRT_ENUM;
 
@@ -109,6 +119,11 @@ LogRecordItem::LogRecordItem(	const Expression& _name,
 								const char* const _rowSeparator
 								)
 {
+	values    = 0;
+	times     = 0;
+	nPoints   = 0;
+	maxPoints = 0;
+
 	name = _name.getComponent( 0 );
 	type  = LRT_VARIABLE;
 
@@ -137,7 +152,12 @@ LogRecordItem::LogRecordItem(	const Expression& _name,
 
 LogRecordItem::LogRecordItem( const LogRecordItem& rhs )
 {
-	values = rhs.values;
+	values    = 0;
+	times     = 0;
+	nPoints   = 0;
+	maxPoints = 0;
+
+	setAllValues( rhs );
 
 	name  = rhs.name;
 	type  = rhs.type;
@@ -167,6 +187,14 @@ LogRecordItem::LogRecordItem( const LogRecordItem& rhs )
 
 LogRecordItem::~LogRecordItem( )
 {
+	clearValues( );
+
+	if ( values != 0 )
+		free( values );
+
+	if ( times != 0 )
+		free( times );
+
 	if ( label != 0 )
 		delete[] label;
 
@@ -204,7 +232,7 @@ LogRecordItem& LogRecordItem::operator=( const LogRecordItem& rhs )
 			delete[] rowSeparator;
 
 
-		values = rhs.values;
+		setAllValues( rhs );
 	
 		name  = rhs.name;
 		type  = rhs.type;
@@ -281,33 +309,80 @@ BooleanType LogRecordItem::operator!=(	const LogRecordItem& rhs
 }
 
 
+returnValue LogRecordItem::getAllValues(	MatrixVariablesGrid& _values
+											) const
+{
+	_values.init( );
+
+	// a matrix-valued variables grid requires equal dimensions at all points
+	for( uint i=1; i<getNumPoints( ); ++i )
+		if ( ( values[i]->getNumRows( ) != values[0]->getNumRows( ) ) ||
+			 ( values[i]->getNumCols( ) != values[0]->getNumCols( ) ) )
+			return RET_VECTOR_DIMENSION_MISMATCH;
+
+	for( uint i=0; i<getNumPoints( ); ++i )
+		_values.addMatrix( *(values[i]),times[i] );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogRecordItem::getAllValues(	VariablesGrid& _values
+											) const
+{
+	_values.init( );
+
+	for( uint i=0; i<getNumPoints( ); ++i )
+		if ( _values.appendTimes( *(values[i]) ) != SUCCESSFUL_RETURN )
+			return RET_INVALID_ARGUMENTS;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue LogRecordItem::setAllValues(	LogFrequency _frequency,
 											const MatrixVariablesGrid& _values
 											)
 {
+	clearValues( );
+
 	if ( _values.getNumPoints( ) <= 0 )
-		return values.init( );
+		return SUCCESSFUL_RETURN;
 
 	switch( _frequency )
 	{
 		case LOG_AT_START:
-			values.init();
-			values.addMatrix( _values.getFirstMatrix( ),_values.getFirstTime( ) );
+			addValue( _values.getFirstMatrix( ),_values.getFirstTime( ) );
 			break;
 
 		case LOG_AT_END:
-			values.init();
-			values.addMatrix( _values.getLastMatrix( ),_values.getFirstTime( ) );
+			addValue( _values.getLastMatrix( ),_values.getFirstTime( ) );
 			break;
 
 		case LOG_AT_EACH_ITERATION:
-			values = _values;
+			for( uint i=0; i<_values.getNumPoints( ); ++i )
+				addValue( _values.getMatrix( i ),_values.getTime( i ) );
 			break;
 	}
 	return SUCCESSFUL_RETURN;
 }
 
 
+returnValue LogRecordItem::setAllValues(	const LogRecordItem& rhs
+											)
+{
+	if ( this == &rhs )
+		return SUCCESSFUL_RETURN;
+
+	clearValues( );
+
+	for( uint i=0; i<rhs.getNumPoints( ); ++i )
+		addValue( *(rhs.values[i]),rhs.times[i] );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue LogRecordItem::setValue(	LogFrequency _frequency,
 										const Matrix& _value,
 										double _time
@@ -324,26 +399,33 @@ returnValue LogRecordItem::setValue(	LogFrequency _frequency,
 				if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
 					logTime = 0.0;
 				
-				values.addMatrix( _value,logTime );
+				addValue( _value,logTime );
 			}
 			break;
 
 		case LOG_AT_END:
 			// always overwrite existing matrices in order to keep only the last one
-			values.init();
-			
 			if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
 				logTime = 0.0;
-			
-			values.addMatrix( _value,logTime );
+
+			if ( getNumPoints( ) == 1 )
+			{
+				*(values[0]) = _value;
+				times[0] = logTime;
+			}
+			else
+			{
+				clearValues( );
+				addValue( _value,logTime );
+			}
 			break;
 
 		case LOG_AT_EACH_ITERATION:
-			// add matrix to list
+			// add matrix to list; its dimensions may differ from the previous ones
 			if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
 				logTime = (double)getNumPoints() + 1.0;
 
-			values.addMatrix( _value,logTime );
+			addValue( _value,logTime );
 			break;
 	}
 	return SUCCESSFUL_RETURN;
@@ -356,6 +438,37 @@ returnValue LogRecordItem::setValue(	LogFrequency _frequency,
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue LogRecordItem::addValue(	const Matrix& _value,
+										double _time
+										)
+{
+	if ( nPoints >= maxPoints )
+	{
+		maxPoints = ( maxPoints > 0 ) ? 2*maxPoints : 1;
+
+		values = (Matrix**) realloc( values,maxPoints*sizeof(Matrix*) );
+		times  = (double*) realloc( times,maxPoints*sizeof(double) );
+	}
+
+	values[nPoints] = new Matrix( _value );
+	times[nPoints]  = _time;
+	++nPoints;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogRecordItem::clearValues( )
+{
+	for( uint i=0; i<nPoints; ++i )
+		delete values[i];
+
+	nPoints = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue LogRecordItem::assignDigits(	uint& toDigit,
 											uint fromDigit,
 											uint defaultDigit
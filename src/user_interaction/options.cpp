@@ -82,6 +82,15 @@ Options& Options::operator=( const Options& rhs )
 {
 	if ( this != &rhs )
 	{
+		// assign option lists in place if possible (avoids re-allocation)
+		if ( ( optionsList != 0 ) && ( nOptionsList == rhs.nOptionsList ) )
+		{
+			for( uint i=0; i<nOptionsList; ++i )
+				*(optionsList[i]) = *(rhs.optionsList[i]);
+
+			return *this;
+		}
+
 		clearOptionsList( );
 	
 		nOptionsList = rhs.nOptionsList;
@@ -202,9 +211,9 @@ returnValue Options::setOptions(	uint idx,
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
 	if ( optionsList[idx] != 0 )
-		delete optionsList[idx];
-
-	optionsList[idx] = new OptionsList( *(arg.optionsList[idx]) );
+		*(optionsList[idx]) = *(arg.optionsList[idx]);
+	else
+		optionsList[idx] = new OptionsList( *(arg.optionsList[idx]) );
 
 	return SUCCESSFUL_RETURN;
 }
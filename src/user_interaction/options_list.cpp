@@ -62,46 +62,13 @@ OptionsList::OptionsList( const OptionsList& rhs )
 	last = 0;
 	number = 0;
 
-	OptionsItem* current = rhs.first;
-
-	/* if rhs options list is not empty, add all option items... */
-	if ( current == 0 )
-		return;
-
-	while ( current != 0 )
-	{
-		if ( current->getType( ) == OIT_INT )
-		{
-			int currentValue;
-			current->getValue( currentValue );
-			add( current->getName( ),currentValue );
-		}
-		else
-		{
-			double currentValue;
-			current->getValue( currentValue );
-			add( current->getName( ),currentValue );
-		}
-
-		current = current->getNext( );
-	}
-
-	optionsHaveChanged = rhs.optionsHaveChanged;
+	operator=( rhs );
 }
 
 
 OptionsList::~OptionsList( )
 {
-	OptionsItem* current = first;
-	OptionsItem* tmp;
-
-	/* deallocate all OptionItems within list */
-	while ( current != 0 )
-	{
-		tmp = current->getNext( );
-		delete current;
-		current = tmp;
-	}
+	clear( );
 }
 
 
@@ -109,44 +76,54 @@ OptionsList& OptionsList::operator=( const OptionsList& rhs )
 {
 	if ( this != &rhs )
 	{
-		OptionsItem* current = first;
-		OptionsItem* tmp;
+		OptionsItem* current = rhs.first;
 
-		/* deallocate all OptionItems within list */
-		while ( current != 0 )
+		/* if both lists comprise the same options, only copy their values... */
+		if ( hasSameItems( rhs ) == BT_TRUE )
 		{
-			tmp = current->getNext( );
-			delete current;
-			current = tmp;
-		}
-
-
-		first = 0;
-		last = 0;
-		number = 0;
+			OptionsItem* item = first;
 
-		current = rhs.first;
-
-		/* if rhs options list is not empty, add all option items... */
-		if ( current == 0 )
-			return *this;
-
-		while ( current != 0 )
-		{
-			if ( current->getType( ) == OIT_INT )
+			while ( current != 0 )
 			{
-				int currentValue;
-				current->getValue( currentValue );
-				add( current->getName( ),currentValue );
+				if ( current->getType( ) == OIT_INT )
+				{
+					int currentValue;
+					current->getValue( currentValue );
+					item->setValue( currentValue );
+				}
+				else
+				{
+					double currentValue;
+					current->getValue( currentValue );
+					item->setValue( currentValue );
+				}
+
+				current = current->getNext( );
+				item = item->getNext( );
 			}
-			else
+		}
+		else
+		{
+			/* ...otherwise rebuild list from scratch */
+			clear( );
+
+			while ( current != 0 )
 			{
-				double currentValue;
-				current->getValue( currentValue );
-				add( current->getName( ),currentValue );
+				if ( current->getType( ) == OIT_INT )
+				{
+					int currentValue;
+					current->getValue( currentValue );
+					add( current->getName( ),currentValue );
+				}
+				else
+				{
+					double currentValue;
+					current->getValue( currentValue );
+					add( current->getName( ),currentValue );
+				}
+
+				current = current->getNext( );
 			}
-
-			current = current->getNext( );
 		}
 
 		optionsHaveChanged = rhs.optionsHaveChanged;
@@ -167,23 +144,7 @@ returnValue OptionsList::add(	OptionsName name,
 	//	return ACADOERROR( RET_OPTION_ALREADY_EXISTS );
 
 	// create new item
-	OptionsItemInt* newItem = new OptionsItemInt( name,value );
-
-	if ( number == 0 )
-	{
-		first = newItem;
-		last = newItem;
-	}
-	else
-	{
-		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_OPTIONS_LIST_CORRUPTED );
-		last = newItem;
-	}
-
-	++number;
-
-	return SUCCESSFUL_RETURN;
+	return append( new OptionsItemInt( name,value ) );
 }
 
 
@@ -198,23 +159,7 @@ returnValue OptionsList::add(	OptionsName name,
 //		return ACADOERROR( RET_OPTION_ALREADY_EXISTS );
 
 	// create new item
-	OptionsItemDouble* newItem = new OptionsItemDouble( name,value );
-
-	if ( number == 0 )
-	{
-		first = newItem;
-		last = newItem;
-	}
-	else
-	{
-		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_OPTIONS_LIST_CORRUPTED );
-		last = newItem;
-	}
-
-	++number;
-
-	return SUCCESSFUL_RETURN;
+	return append( new OptionsItemDouble( name,value ) );
 }
 
 
@@ -334,21 +279,100 @@ OptionsItem* OptionsList::find(	OptionsName name,
 								OptionsItemType type
 								) const
 {
-	OptionsItem* item = first;
+	uint idx = (uint)name;
 
-	uint i;
-	for( i=0; i<number; ++i )
+	switch ( type )
 	{
-		if ( item == 0 )
+		case OIT_INT:
+			return ( idx < intItems.size( ) ) ? intItems[idx] : 0;
+
+		case OIT_DOUBLE:
+			return ( idx < doubleItems.size( ) ) ? doubleItems[idx] : 0;
+
+		default:
 			return 0;
+	}
+}
+
+
+returnValue OptionsList::append(	OptionsItem* newItem
+									)
+{
+	if ( number == 0 )
+	{
+		first = newItem;
+		last = newItem;
+	}
+	else
+	{
+		if ( last->setNext( newItem ) != SUCCESSFUL_RETURN )
+		{
+			delete newItem;
+			return ACADOERROR( RET_OPTIONS_LIST_CORRUPTED );
+		}
+		last = newItem;
+	}
+
+	++number;
 
-		if ( ( name == item->getName( ) ) && ( item->getType( ) == type ) )
-			return item;
+	// register item within index of its type
+	std::vector<OptionsItem*>& items = ( newItem->getType( ) == OIT_INT ) ? intItems : doubleItems;
+	uint idx = (uint)newItem->getName( );
+
+	if ( idx >= items.size( ) )
+		items.resize( idx+1,0 );
+	items[idx] = newItem;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType OptionsList::hasSameItems(	const OptionsList& rhs
+										) const
+{
+	if ( number != rhs.number )
+		return BT_FALSE;
+
+	OptionsItem* item = first;
+	OptionsItem* current = rhs.first;
+
+	while ( ( item != 0 ) && ( current != 0 ) )
+	{
+		if ( ( item->getName( ) != current->getName( ) ) || ( item->getType( ) != current->getType( ) ) )
+			return BT_FALSE;
 
 		item = item->getNext( );
+		current = current->getNext( );
 	}
 
-	return 0;
+	if ( ( item != 0 ) || ( current != 0 ) )
+		return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
+returnValue OptionsList::clear( )
+{
+	OptionsItem* current = first;
+	OptionsItem* tmp;
+
+	/* deallocate all OptionItems within list */
+	while ( current != 0 )
+	{
+		tmp = current->getNext( );
+		delete current;
+		current = tmp;
+	}
+
+	first = 0;
+	last = 0;
+	number = 0;
+
+	intItems.clear( );
+	doubleItems.clear( );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
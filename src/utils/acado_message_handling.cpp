@@ -346,6 +346,9 @@ ReturnValueList returnValueList[] =
 { RET_QPOASES_EMBEDDED_NOT_FOUND,				"Embedded qpOASES code not found", VS_VISIBLE },
 { RET_UNABLE_TO_EXPORT_STATEMENT,				"Unable to export statement due to incomplete definition", VS_VISIBLE },
 { RET_INVALID_CALL_TO_EXPORTED_FUNCTION,		"Invalid call to export functions (check number of calling arguments)", VS_VISIBLE },
+{ RET_UNABLE_TO_COMPILE_NATIVE_CODE,			"Unable to compile native code (check the compiler command)", VS_VISIBLE },
+{ RET_UNABLE_TO_LOAD_NATIVE_CODE,				"Unable to load compiled native code", VS_VISIBLE },
+{ RET_NATIVE_CODE_CACHE_NOT_SECURE,			"Cache directory or library of native code is not owned by the user or writable by others", VS_VISIBLE },
 
 /* IMPORTANT: Terminal list element! */
 { TERMINAL_LIST_ELEMENT,						" ", VS_HIDDEN }
@@ -153,6 +153,9 @@ Tmatrix<Interval> EllipsoidalIntegrator::integrate( double t0, double tf, int M,
 	
 	integrate( t0, tf, &xx, pp, ww );
 	
+	if( pp != 0 ) delete pp;
+	if( ww != 0 ) delete ww;
+	
 	return getStateBound( xx );
 }
 
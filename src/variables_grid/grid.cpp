@@ -541,16 +541,24 @@ int Grid::findFirstTime(	double _time,
 	if ( times == 0 )
 		return -1;
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
+	uint lowerIdx = startIdx;
+	uint upperIdx = getNumPoints( );
+
+	/* binary search for first grid point not lying before given time
+	 * (grid point times are ordered!) */
+	while ( lowerIdx < upperIdx )
 	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-			return i;
+		uint idx = lowerIdx + ( upperIdx-lowerIdx )/2;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+		if ( ( times[idx] < _time ) && ( acadoIsEqual( times[idx] ,_time ) == BT_FALSE ) )
+			lowerIdx = idx+1;
+		else
+			upperIdx = idx;
 	}
 
+	if ( ( lowerIdx < getNumPoints( ) ) && ( acadoIsEqual( times[lowerIdx] ,_time ) == BT_TRUE ) )
+		return lowerIdx;
+
 	/* no grid point with given time found */
 	return -1;
 }
@@ -560,30 +568,19 @@ int Grid::findLastTime(	double _time,
 						uint startIdx
 						) const
 {
-	if ( times == 0 )
-		return -1;
+	int firstIdx = findFirstTime( _time,startIdx );
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-		{
-			uint j = i;
-
-			while( ( j<getNumPoints( ) ) && ( acadoIsEqual( times[j] , _time ) == BT_TRUE ) )
-			{
-				++j;
-			}
+	if ( firstIdx < 0 )
+		return -1;
 
-			return j-1;
-		}
+	uint j = firstIdx;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+	while( ( j<getNumPoints( ) ) && ( acadoIsEqual( times[j] , _time ) == BT_TRUE ) )
+	{
+		++j;
 	}
 
-	/* no grid point with given time found */
-	return -1;
+	return j-1;
 }
 
 
@@ -620,6 +617,26 @@ uint Grid::getFloorIndex(	double time_
 }
 
 
+uint Grid::getFloorIndex(	double time_,
+							uint& cursor
+							) const
+{
+	/* try interval of previous query and its successor first */
+	if ( ( getNumPoints( ) > 1 ) && ( cursor < getLastIndex( ) ) )
+	{
+		if ( isInUpperHalfOpenInterval( cursor,time_ ) == BT_TRUE )
+			return cursor;
+
+		if ( ( cursor+1 < getLastIndex( ) ) && ( isInUpperHalfOpenInterval( cursor+1,time_ ) == BT_TRUE ) )
+			return ++cursor;
+	}
+
+	cursor = getFloorIndex( time_ );
+
+	return cursor;
+}
+
+
 uint Grid::getCeilIndex ( double time_ ) const
 {
 	uint lowerIdx = 0;
@@ -660,18 +677,26 @@ returnValue Grid::getSubGrid(	double tStart,
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
 
+	// determine range of grid points within [tStart,tEnd]
+	uint startIdx = getFloorIndex( tStart );
+
+	while ( ( startIdx > 0 ) && ( acadoIsGreater( getTime( startIdx-1 ) , tStart ) == BT_TRUE ) )
+		--startIdx;
+
+	while ( ( startIdx < getNumPoints( ) ) && ( acadoIsGreater( getTime( startIdx ) , tStart ) == BT_FALSE ) )
+		++startIdx;
+
+	uint endIdx = startIdx;
+
+	while ( ( endIdx < getNumPoints( ) ) && ( acadoIsSmaller( getTime( endIdx ) , tEnd ) == BT_TRUE ) )
+		++endIdx;
+
 	// determine number of subpoints
-	uint nSubPoints = 0;
+	uint nSubPoints = endIdx - startIdx;
 
 	if ( hasTime( tStart ) == BT_FALSE )
 		++nSubPoints;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE  &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     ) ++nSubPoints;
-	}
-
 	if ( hasTime( tEnd ) == BT_FALSE )
 		++nSubPoints;
 
@@ -681,12 +706,8 @@ returnValue Grid::getSubGrid(	double tStart,
 	if ( hasTime( tStart ) == BT_FALSE )
 		_subGrid.setTime( tStart );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     )
-			_subGrid.setTime( getTime( i ) );
-	}
+	for( uint i=startIdx; i<endIdx; ++i )
+		_subGrid.setTime( getTime( i ) );
 
 	if ( hasTime( tEnd ) == BT_FALSE )
 		_subGrid.setTime( tEnd );
@@ -44,7 +44,15 @@ BEGIN_NAMESPACE_ACADO
 
 MatrixVariablesGrid::MatrixVariablesGrid( ) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 }
 
 
@@ -60,7 +68,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 	init( _nRows,_nCols,_grid,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -77,7 +93,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 	init( _nRows,_nCols,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -96,7 +120,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 	init( _nRows,_nCols,_firstTime,_lastTime,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -106,7 +138,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const Matrix& arg,
 											VariableType _type
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 	init( arg,_grid,_type );
 }
 
@@ -115,7 +155,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const Matrix& arg,
 MatrixVariablesGrid::MatrixVariablesGrid(	FILE *file
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 	operator=( file );
 }
 
@@ -123,7 +171,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	FILE *file
 MatrixVariablesGrid::MatrixVariablesGrid(	const char* filename
 											) : Grid( )
 {
-	values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
 
 	FILE* file = fopen( filename,"r" );
 	
@@ -143,13 +199,17 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const char* filename
 MatrixVariablesGrid::MatrixVariablesGrid(	const MatrixVariablesGrid& rhs
 											) : Grid( rhs )
 {
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
 
-	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( *(rhs.values[i]) );
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
+
+	copyValues( rhs );
 }
 
 
@@ -169,13 +229,7 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator=(	const MatrixVariablesGrid&
 
 		Grid::operator=( rhs );
 
-		if ( nPoints > 0 )
-			values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-		else
-			values = 0;
-	
-		for( uint i=0; i<nPoints; ++i )
-			values[i] = new MatrixVariable( *(rhs.values[i]) );
+		copyValues( rhs );
     }
 
     return *this;
@@ -253,11 +307,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -277,11 +326,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _nPoints );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -303,11 +347,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _firstTime,_lastTime,_nPoints );
 	
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -320,13 +359,13 @@ returnValue MatrixVariablesGrid::init(	const Matrix& arg,
 	clearValues( );
 	Grid::operator=( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	// (the type is not assigned, as for grids constructed point by point from matrices)
+	initMatrixVariables( arg.getNumRows( ),arg.getNumCols( ) );
 
 	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( arg );
+		for( uint j=0; j<nRows; ++j )
+			for( uint k=0; k<nCols; ++k )
+				operator()( i,j,k ) = arg( j,k );
 
     return SUCCESSFUL_RETURN;
 }
@@ -337,7 +376,16 @@ returnValue MatrixVariablesGrid::addMatrix(	const Matrix& newMatrix,
 											double newTime
 											)
 {
-	return addMatrix( MatrixVariable(newMatrix),newTime );
+	returnValue returnvalue = addPoint( newMatrix.getNumRows( ),newMatrix.getNumCols( ),newTime );
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	for( uint j=0; j<nRows; ++j )
+		for( uint k=0; k<nCols; ++k )
+			operator()( nPoints-1,j,k ) = newMatrix( j,k );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -346,12 +394,17 @@ returnValue MatrixVariablesGrid::setMatrix(	uint pointIdx,
 											const Matrix& _value
 											) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	*(values[pointIdx]) = _value;
+	if ( ( _value.getNumRows( ) != nRows ) || ( _value.getNumCols( ) != nCols ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	double* pointValues = &(values[pointIdx*nRows*nCols]);
+
+	for( uint j=0; j<nRows; ++j )
+		for( uint k=0; k<nCols; ++k )
+			pointValues[j*nCols+k] = _value( j,k );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -370,12 +423,10 @@ returnValue MatrixVariablesGrid::setAllMatrices(	const Matrix& _values
 Matrix MatrixVariablesGrid::getMatrix(	uint pointIdx
 										) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return emptyMatrix;
 
-	return values[pointIdx]->getMatrix( );
+	return Matrix( nRows,nCols,&(values[pointIdx*nRows*nCols]) );
 }
 
 
@@ -412,7 +463,7 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -427,13 +478,13 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addPoint( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -445,13 +496,74 @@ returnValue MatrixVariablesGrid::appendValues( const MatrixVariablesGrid& arg )
 	if ( getNumPoints( ) != arg.getNumPoints( ) )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-	Vector tmp1,tmp2;
+	if ( getNumPoints( ) == 0 )
+		return SUCCESSFUL_RETURN;
+
+	if ( ( getNumValues( ) > 0 ) && ( arg.getNumValues( ) > 0 ) && ( nCols != arg.nCols ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	uint dim    = getNumValues( );
+	uint argDim = arg.getNumValues( );
+	uint newDim = dim + argDim;
+
+	double* newValues   = (double*) calloc( nPoints*newDim+1,sizeof(double) );
+	double* newScaling  = 0;
+	double* newLb       = 0;
+	double* newUb       = 0;
+
+	if ( ( scaling != 0 ) || ( arg.scaling != 0 ) )
+		newScaling = (double*) calloc( nPoints*newDim+1,sizeof(double) );
+
+	if ( ( lb != 0 ) || ( arg.lb != 0 ) )
+		newLb = (double*) calloc( nPoints*newDim+1,sizeof(double) );
+
+	if ( ( ub != 0 ) || ( arg.ub != 0 ) )
+		newUb = (double*) calloc( nPoints*newDim+1,sizeof(double) );
+
+	for( uint i=0; i<nPoints; ++i )
+	{
+		for( uint j=0; j<dim; ++j )
+		{
+			newValues[i*newDim+j] = values[i*dim+j];
+
+			if ( newScaling != 0 ) newScaling[i*newDim+j] = ( scaling != 0 ) ? scaling[i*dim+j] : defaultScaling;
+			if ( newLb      != 0 ) newLb     [i*newDim+j] = ( lb      != 0 ) ? lb     [i*dim+j] : defaultLowerBound;
+			if ( newUb      != 0 ) newUb     [i*newDim+j] = ( ub      != 0 ) ? ub     [i*dim+j] : defaultUpperBound;
+		}
+
+		for( uint j=0; j<argDim; ++j )
+		{
+			newValues[i*newDim+dim+j] = arg.values[i*argDim+j];
+
+			if ( newScaling != 0 ) newScaling[i*newDim+dim+j] = ( arg.scaling != 0 ) ? arg.scaling[i*argDim+j] : defaultScaling;
+			if ( newLb      != 0 ) newLb     [i*newDim+dim+j] = ( arg.lb      != 0 ) ? arg.lb     [i*argDim+j] : defaultLowerBound;
+			if ( newUb      != 0 ) newUb     [i*newDim+dim+j] = ( arg.ub      != 0 ) ? arg.ub     [i*argDim+j] : defaultUpperBound;
+		}
+	}
 
-	for( uint i=0; i<getNumPoints(); ++i )
+	if ( dim == 0 )
 	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
+		nRows = arg.nRows;
+		nCols = arg.nCols;
 	}
+	else
+		nRows += arg.nRows;
+
+	settings.appendSettings( arg.settings );
+
+	free( values );
+	values = newValues;
+
+	if ( scaling != 0 ) free( scaling );
+	if ( lb != 0 )      free( lb );
+	if ( ub != 0 )      free( ub );
+
+	scaling = newScaling;
+	lb      = newLb;
+	ub      = newUb;
+
+	autoInit = (BooleanType*) realloc( autoInit,(nPoints+1)*sizeof(BooleanType) );
+	nAllocatedPoints = nPoints;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -499,7 +611,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -511,16 +623,16 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -531,7 +643,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addPoint( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -540,7 +652,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -566,7 +678,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -584,8 +696,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getValuesSubGrid(	uint startIdx,
 	if ( startIdx > endIdx )
 		return newVariablesGrid;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+	getRows( startIdx,endIdx,newVariablesGrid );
 
     return newVariablesGrid;
 }
@@ -653,9 +764,9 @@ MatrixVariablesGrid MatrixVariablesGrid::getRefinedGrid(	const Grid& arg,
 			count = acadoMin( count+1,(int)getNumPoints()-1 );
 
 		if ( count < 0 )
-			tmp.addMatrix( *(values[0]),arg.getTime( i ) );
+			tmp.addPoint( *this,0,arg.getTime( i ) );
 		else
-			tmp.addMatrix( *(values[count]),arg.getTime( i ) );
+			tmp.addPoint( *this,count,arg.getTime( i ) );
 	}
 
 	return tmp;
@@ -683,7 +794,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getCoarsenedGrid(	const Grid& arg
 		int idx = findLastTime( arg.getTime( i ) );
 
 		if ( idx >= 0 )
-			tmp.addMatrix( *(values[idx]),arg.getTime( i ) );
+			tmp.addPoint( *this,idx,arg.getTime( i ) );
 		else
 		{
 			tmp.init( );
@@ -707,16 +818,20 @@ MatrixVariablesGrid& MatrixVariablesGrid::shiftTimes(	double timeShift
 MatrixVariablesGrid& MatrixVariablesGrid::shiftBackwards( Matrix lastValue )
 {
 	if ( getNumPoints() < 2 ){
-        if( lastValue.isEmpty() == BT_FALSE )
-             *(values[getNumIntervals()]) = lastValue;	
+        if( lastValue.isEmpty() == BT_FALSE ){
+             setMatrix( getNumIntervals(),lastValue );
+             resetPointSettings( getNumIntervals() );
+        }
 		return *this;	
     }
 
 	for( uint i=1; i<getNumPoints( ); ++i )
-		*(values[i-1]) = *(values[i]);
+		copyPoint( i-1,*this,i );
 		
-    if( lastValue.isEmpty() == BT_FALSE )
-        *(values[getNumIntervals()]) = lastValue;
+    if( lastValue.isEmpty() == BT_FALSE ){
+        setMatrix( getNumIntervals(),lastValue );
+        resetPointSettings( getNumIntervals() );
+    }
 
 	return *this;
 }
@@ -732,8 +847,9 @@ Vector MatrixVariablesGrid::linearInterpolation( double time ) const
 	ASSERT( idx1 < getNumPoints( ) );
 	ASSERT( idx2 < getNumPoints( ) );
 
-    Vector tmp1( values[idx1]->getCol( 0 ) );
-    Vector tmp2( values[idx2]->getCol( 0 ) );
+	// (first column of the matrices at both grid points)
+    Vector tmp1( VectorView<const double>( &(values[idx1*nRows*nCols]),nRows,nCols ).getVector( ) );
+    Vector tmp2( VectorView<const double>( &(values[idx2*nRows*nCols]),nRows,nCols ).getVector( ) );
 
     double t1 = getTime( idx1 );
     double t2 = getTime( idx2 );
@@ -953,8 +1069,7 @@ returnValue MatrixVariablesGrid::printToString(	char** string,
 		strcat( *string,colSeparator );
 
 		// write matrix string
-		//matrixString = new char[ values[k]->determineStringLength( 0,0,0,width,precision,colSeparator,colSeparator ) ];
-		values[k]->printToString( &matrixString,0,0,0,width,precision,colSeparator,colSeparator );
+		getMatrix( k ).printToString( &matrixString,0,0,0,width,precision,colSeparator,colSeparator );
 
 		strcat( *string,matrixString );
 
@@ -1032,7 +1147,7 @@ uint MatrixVariablesGrid::determineStringLength(	const char* const name,
 		stringLength += getStringLength(name)+3;
 
 	for( uint k=0; k<getNumPoints(); ++k )
-		stringLength += values[k]->determineStringLength( 0,0,0,width,precision,colSeparator,colSeparator );
+		stringLength += getMatrix( k ).determineStringLength( 0,0,0,width,precision,colSeparator,colSeparator );
 
 	return stringLength; 
 }
@@ -1071,19 +1186,94 @@ int MatrixVariablesGrid::sprintf( char* buffer )
 
 returnValue MatrixVariablesGrid::clearValues( )
 {
-	if ( values != 0 )
+	if ( values != 0 )   free( values );
+	if ( scaling != 0 )  free( scaling );
+	if ( lb != 0 )       free( lb );
+	if ( ub != 0 )       free( ub );
+	if ( autoInit != 0 ) free( autoInit );
+
+	nRows = 0;
+	nCols = 0;
+	nAllocatedPoints = 0;
+
+	values   = 0;
+	scaling  = 0;
+	lb       = 0;
+	ub       = 0;
+	autoInit = 0;
+
+	settings.init( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::copyValues(	const MatrixVariablesGrid& rhs
+												)
+{
+	nRows = rhs.nRows;
+	nCols = rhs.nCols;
+
+	settings = rhs.settings;
+
+	reservePoints( rhs.nPoints );
+
+	uint nTotal = rhs.nPoints*nRows*nCols;
+
+	if ( nTotal > 0 )
+		memcpy( values,rhs.values,nTotal*sizeof(double) );
+
+	if ( rhs.nPoints > 0 )
+		memcpy( autoInit,rhs.autoInit,rhs.nPoints*sizeof(BooleanType) );
+
+	if ( rhs.scaling != 0 )
+		memcpy( allocatePointSettings( scaling,defaultScaling ),rhs.scaling,nTotal*sizeof(double) );
+
+	if ( rhs.lb != 0 )
+		memcpy( allocatePointSettings( lb,defaultLowerBound ),rhs.lb,nTotal*sizeof(double) );
+
+	if ( rhs.ub != 0 )
+		memcpy( allocatePointSettings( ub,defaultUpperBound ),rhs.ub,nTotal*sizeof(double) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void MatrixVariablesGrid::reservePoints(	uint _nPoints
+											)
+{
+	if ( ( _nPoints <= nAllocatedPoints ) && ( autoInit != 0 ) )
+		return;
+
+	uint newAllocatedPoints = 2*nAllocatedPoints;
+
+	if ( newAllocatedPoints < _nPoints )
+		newAllocatedPoints = _nPoints;
+
+	// (one additional entry avoids zero-sized allocations)
+	uint nTotal = newAllocatedPoints*nRows*nCols + 1;
+
+	values   = (double*)      realloc( values,  nTotal*sizeof(double) );
+	autoInit = (BooleanType*) realloc( autoInit,(newAllocatedPoints+1)*sizeof(BooleanType) );
+
+	if ( scaling != 0 ) scaling = (double*) realloc( scaling,nTotal*sizeof(double) );
+	if ( lb != 0 )      lb      = (double*) realloc( lb,     nTotal*sizeof(double) );
+	if ( ub != 0 )      ub      = (double*) realloc( ub,     nTotal*sizeof(double) );
+
+	// initialize new memory such that all values are defined
+	for( uint i=nAllocatedPoints*nRows*nCols; i<nTotal; ++i )
 	{
-		for( uint i=0; i<nPoints; ++i )
-		{
-			if ( values[i] != 0 )
-				delete values[i];
-		}
+		values[i] = 0.0;
 
-		free( values );
-		values = 0;
+		if ( scaling != 0 ) scaling[i] = defaultScaling;
+		if ( lb != 0 )      lb[i]      = defaultLowerBound;
+		if ( ub != 0 )      ub[i]      = defaultUpperBound;
 	}
 
-	return SUCCESSFUL_RETURN;
+	for( uint i=nAllocatedPoints; i<=newAllocatedPoints; ++i )
+		autoInit[i] = defaultAutoInit;
+
+	nAllocatedPoints = newAllocatedPoints;
 }
 
 
@@ -1098,49 +1288,195 @@ returnValue MatrixVariablesGrid::initMatrixVariables(	uint _nRows,
 														const BooleanType* const _autoInit
 														)
 {
-	VectorspaceElement currentScaling,currentLb,currentUb;
+	nRows = _nRows;
+	nCols = _nCols;
+
+	settings.init( _nRows*_nCols,_type,_names,_units );
+
+	reservePoints( nPoints );
+
+	uint dim = _nRows*_nCols;
 
 	for( uint i=0; i<nPoints; ++i )
 	{
-		if ( _scaling != 0 )
-			currentScaling = _scaling[i];
-		else
-			currentScaling.init( );
+		if ( ( _scaling != 0 ) && ( _scaling[i].isEmpty( ) == BT_FALSE ) )
+		{
+			double* pointScaling = allocatePointSettings( scaling,defaultScaling ) + i*dim;
+			for( uint j=0; ( j<dim ) && ( j<_scaling[i].getDim( ) ); ++j )
+				pointScaling[j] = _scaling[i]( j );
+		}
 
-		if ( _lb != 0 )
-			currentLb = _lb[i];
-		else
-			currentLb.init( );
+		if ( ( _lb != 0 ) && ( _lb[i].isEmpty( ) == BT_FALSE ) )
+		{
+			double* pointLb = allocatePointSettings( lb,defaultLowerBound ) + i*dim;
+			for( uint j=0; ( j<dim ) && ( j<_lb[i].getDim( ) ); ++j )
+				pointLb[j] = _lb[i]( j );
+		}
 
-		if ( _ub != 0 )
-			currentUb = _ub[i];
-		else
-			currentUb.init( );
+		if ( ( _ub != 0 ) && ( _ub[i].isEmpty( ) == BT_FALSE ) )
+		{
+			double* pointUb = allocatePointSettings( ub,defaultUpperBound ) + i*dim;
+			for( uint j=0; ( j<dim ) && ( j<_ub[i].getDim( ) ); ++j )
+				pointUb[j] = _ub[i]( j );
+		}
 
-		values[i] = new MatrixVariable( _nRows,_nCols,_type,_names,_units,currentScaling,currentLb,currentUb );
+		if ( _autoInit != 0 )
+			autoInit[i] = _autoInit[i];
 	}
 	
 	return SUCCESSFUL_RETURN;
 }
 
 
-returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariable& newMatrix,
+returnValue MatrixVariablesGrid::addPoint(	uint _nRows,
+											uint _nCols,
 											double newTime
 											)
 {
+	if ( ( getNumPoints( ) > 0 ) && ( ( _nRows != nRows ) || ( _nCols != nCols ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
 	if ( ( isInfty( newTime ) == BT_TRUE ) && ( getNumPoints( ) > 0 ) )
 		newTime = getLastTime( ) + 1.0;
 
 	if ( Grid::addTime( newTime ) != SUCCESSFUL_RETURN )
 		return RET_INVALID_ARGUMENTS;
 
-	values = (MatrixVariable**) realloc( values,nPoints*sizeof(MatrixVariable*) );
-	values[nPoints-1] = new MatrixVariable( newMatrix );
+	// the first grid point determines the dimensions and the shared settings
+	if ( nPoints == 1 )
+	{
+		if ( ( _nRows != nRows ) || ( _nCols != nCols ) )
+		{
+			clearValues( );
+
+			nRows = _nRows;
+			nCols = _nCols;
+		}
+
+		settings.init( _nRows*_nCols,VT_UNKNOWN,0,0 );
+	}
+
+	reservePoints( nPoints );
+	resetPointSettings( nPoints-1 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::addPoint(	const MatrixVariablesGrid& arg,
+											uint pointIdx,
+											double newTime
+											)
+{
+	returnValue returnvalue = addPoint( arg.nRows,arg.nCols,newTime );
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	if ( nPoints == 1 )
+		settings = arg.settings;
+
+	copyPoint( nPoints-1,arg,pointIdx );
 
 	return SUCCESSFUL_RETURN;
 }
 
 
+void MatrixVariablesGrid::copyPoint(	uint pointIdx,
+										const MatrixVariablesGrid& arg,
+										uint argIdx
+										)
+{
+	uint dim = getNumValues( );
+
+	ASSERT( arg.getNumValues( ) == dim );
+
+	if ( ( &arg == this ) && ( pointIdx == argIdx ) )
+		return;
+
+	memcpy( &(values[pointIdx*dim]),&(arg.values[argIdx*dim]),dim*sizeof(double) );
+
+	if ( ( arg.scaling != 0 ) || ( scaling != 0 ) )
+	{
+		double* pointScaling = allocatePointSettings( scaling,defaultScaling ) + pointIdx*dim;
+		for( uint j=0; j<dim; ++j )
+			pointScaling[j] = ( arg.scaling != 0 ) ? arg.scaling[argIdx*dim+j] : defaultScaling;
+	}
+
+	if ( ( arg.lb != 0 ) || ( lb != 0 ) )
+	{
+		double* pointLb = allocatePointSettings( lb,defaultLowerBound ) + pointIdx*dim;
+		for( uint j=0; j<dim; ++j )
+			pointLb[j] = ( arg.lb != 0 ) ? arg.lb[argIdx*dim+j] : defaultLowerBound;
+	}
+
+	if ( ( arg.ub != 0 ) || ( ub != 0 ) )
+	{
+		double* pointUb = allocatePointSettings( ub,defaultUpperBound ) + pointIdx*dim;
+		for( uint j=0; j<dim; ++j )
+			pointUb[j] = ( arg.ub != 0 ) ? arg.ub[argIdx*dim+j] : defaultUpperBound;
+	}
+
+	autoInit[pointIdx] = arg.autoInit[argIdx];
+}
+
+
+void MatrixVariablesGrid::resetPointSettings(	uint pointIdx
+												)
+{
+	uint dim = getNumValues( );
+
+	for( uint j=0; j<dim; ++j )
+	{
+		if ( scaling != 0 ) scaling[pointIdx*dim+j] = defaultScaling;
+		if ( lb != 0 )      lb     [pointIdx*dim+j] = defaultLowerBound;
+		if ( ub != 0 )      ub     [pointIdx*dim+j] = defaultUpperBound;
+	}
+
+	autoInit[pointIdx] = defaultAutoInit;
+}
+
+
+double* MatrixVariablesGrid::allocatePointSettings(	double*& array,
+													double defaultValue
+													)
+{
+	if ( array == 0 )
+	{
+		uint nTotal = nAllocatedPoints*nRows*nCols + 1;
+
+		array = (double*) malloc( nTotal*sizeof(double) );
+
+		for( uint i=0; i<nTotal; ++i )
+			array[i] = defaultValue;
+	}
+
+	return array;
+}
+
+
+void MatrixVariablesGrid::getRows(	uint startIdx,
+									uint endIdx,
+									MatrixVariablesGrid& result
+									) const
+{
+	result.init( );
+
+	if ( ( startIdx > endIdx ) || ( endIdx >= getNumRows( ) ) )
+		return;
+
+	Grid tmpGrid;
+	getGrid( tmpGrid );
+
+	result.init( endIdx-startIdx+1,nCols,tmpGrid );
+
+	for( uint i=0; i<nPoints; ++i )
+		for( uint j=startIdx; j<=endIdx; ++j )
+			for( uint k=0; k<nCols; ++k )
+				result( i,j-startIdx,k ) = operator()( i,j,k );
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
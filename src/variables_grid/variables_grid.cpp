@@ -193,7 +193,7 @@ VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 	VariablesGrid rowGrid( 1,tmpGrid,getType( ) );
 
     for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0 ) = values[run1]->operator()( rowIdx,0 );
+         rowGrid( run1,0 ) = operator()( run1,rowIdx );
 
     return rowGrid;
 }
@@ -210,7 +210,7 @@ VariablesGrid VariablesGrid::operator[](	const uint pointIdx
 	}
 
 	VariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addPoint( *this,pointIdx,getTime( pointIdx ) );
 
     return pointGrid;
 }
@@ -320,7 +320,7 @@ Vector VariablesGrid::getVector(	uint pointIdx
 	if ( ( values == 0 ) || ( pointIdx >= getNumPoints() ) )
 		return emptyVector;
 
-	return values[pointIdx]->getCol( 0 );
+	return getPointView( pointIdx ).getVector( );
 }
 
 
@@ -392,7 +392,7 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -407,13 +407,13 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addPoint( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -438,18 +438,7 @@ returnValue VariablesGrid::appendValues( const VariablesGrid& arg )
 		return SUCCESSFUL_RETURN;
 	}
 
-	if ( getNumPoints( ) != arg.getNumPoints( ) )
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
-
-	Vector tmp1,tmp2;
-
-	for( uint i=0; i<getNumPoints(); ++i )
-	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
-	}
-
-	return SUCCESSFUL_RETURN;
+	return MatrixVariablesGrid::appendValues( arg );
 }
 
 
@@ -495,7 +484,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -507,16 +496,16 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -527,7 +516,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addPoint( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -536,7 +525,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -563,7 +552,7 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -589,13 +578,54 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	double startTime,
 	
 	// add all matrices in interval (constant interpolation)
 	if ( ( hasTime( startTime ) == BT_FALSE ) && ( startIdx > 0 ) )
-		newVariablesGrid.addMatrix( *(values[ startIdx-1 ]),startTime );
+		newVariablesGrid.addPoint( *this,startIdx-1,startTime );
 	
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 	
 	if ( hasTime( endTime ) == BT_FALSE )
-		newVariablesGrid.addMatrix( *(values[ endIdx ]),endTime );
+		newVariablesGrid.addPoint( *this,endIdx,endTime );
+
+    return newVariablesGrid;
+}
+
+
+VariablesGrid VariablesGrid::getTimeSubGrid(	double startTime,
+												double endTime,
+												uint& cursor
+												) const
+{
+	VariablesGrid newVariablesGrid;
+
+	if ( ( isInInterval( startTime ) == BT_FALSE ) || ( isInInterval( endTime ) == BT_FALSE ) )
+		return newVariablesGrid;
+
+	// the ceil index of the start time is obtained from its floor index
+	uint startIdx = getFloorIndex( startTime,cursor );
+	BooleanType hasStartTime = acadoIsEqual( getTime( startIdx ),startTime );
+
+	if ( hasStartTime == BT_TRUE )
+	{
+		while( ( startIdx > 0 ) && ( acadoIsEqual( getTime( startIdx-1 ),startTime ) == BT_TRUE ) )
+			--startIdx;
+	}
+	else
+		++startIdx;
+
+	uint endIdx = getFloorIndex( endTime,cursor );
+
+	if ( ( startIdx >= getNumPoints( ) ) || ( endIdx >= getNumPoints( ) ) )
+		return newVariablesGrid;
+
+	// add all matrices in interval (constant interpolation)
+	if ( ( hasStartTime == BT_FALSE ) && ( startIdx > 0 ) )
+		newVariablesGrid.addPoint( *this,startIdx-1,startTime );
+
+	for( uint i=startIdx; i<=endIdx; ++i )
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
+
+	if ( acadoIsEqual( getTime( endIdx ),endTime ) == BT_FALSE )
+		newVariablesGrid.addPoint( *this,endIdx,endTime );
 
     return newVariablesGrid;
 }
@@ -613,8 +643,7 @@ VariablesGrid VariablesGrid::getValuesSubGrid(	uint startIdx,
 	if ( startIdx > endIdx )
 		return newVariablesGrid;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+	getRows( startIdx,endIdx,newVariablesGrid );
 
     return newVariablesGrid;
 }